@@ -64,11 +64,78 @@
 * Note(s) : (1) Default port for DHCP server is 67, and default port for DHCP client is 68.
 *
 *           (3) Configure DHCPc_CFG_MAX_NBR_IF to the maximum number of interface this DHCP client will
-*               be able to manage at a given time.
+*               be able to manage at a given time.  When logical clients are used (see Note #8), each
+*               logical client counts as one interface.
 *
 *           (4) Once the DHCP server has assigned the client an address, the later may perform a final
 *               check prior to use this address in order to make sure it is not being used by another
 *               host on the network.
+*
+*           (5) Configure DHCPc_CFG_MSG_BUF_SIZE to the maximum size of the DHCP messages the client is
+*               able to receive (at least 576 octets).  When larger than 576 octets, the maximum message
+*               size is advertised to the DHCP server.
+*
+*           (6) When enabled, the client keeps listening on the client port while its lease is bound &
+*               renews the lease as soon as an authenticated FORCERENEW message is received from the
+*               server (see RFC #3203 & RFC #6704).
+*
+*           (7) Configure DHCPc_CFG_RENEW_COALESCE_WIN_SEC to renew leases up to this number of seconds
+*               before their T1 time whenever another DHCPc timer expires, so that the renewals of several
+*               interfaces are performed in a single wake-up.  Set to 0 to renew every lease at its T1.
+*
+*           (8) Configure DHCPc_CFG_CLIENT_ID_MAX_LEN to the maximum length of the client identifier
+*               (option 61) of a logical client, between 2 & 64 octets.  Several logical clients, each
+*               identified by its own client identifier, may then be started on the same interface.
+*               Set to 0 to disable the client identifier & run a single client per interface.
+*
+*           (9) Configure DHCPc_CFG_EMUL_MAX_NBR_CLIENT to the maximum number of virtual clients that may
+*               be negotiating concurrently when DHCPc_EmulRun() is used to load test a DHCP server.  The
+*               client identifier MUST then be enabled (see Note #8).  Set to 0 to disable the emulation.
+*
+*          (10) DHCPc_CFG_WORKER_NBR MUST be 1 : a single DHCPc task handles the DHCP negotiations of ALL
+*               the interfaces, since the DHCP client port can be bound by ONE socket at a time (see
+*               'dhcp-c.h  DHCPc DEFAULT CFG  Note #7').
+*
+*          (11) Configure DHCPc_CFG_VENDOR_CLASS_MAX_LEN & DHCPc_CFG_VENDOR_INFO_MAX_LEN to the maximum length
+*               of the vendor class identifier (option 60) & of the vendor-specific information (option 43)
+*               sent by an interface, up to 64 octets.  Set to 0 to disable the corresponding option.
+*               DHCPc_CFG_MSG_BUF_SIZE MUST be large enough for the largest message sent, which grows with
+*               these lengths, the client identifier & the requested parameter table (see 'dhcp-c.h
+*               DHCPc TRANSMIT OPTION TEMPLATE DEFINES  Note #3').
+*
+*          (12) Configure DHCPc_CFG_ROUTE_MAX_NBR to the maximum number of routes (routers, static routes &
+*               classless static routes, options 3, 33 & 121) kept for each interface.  The routes are
+*               installed through the function configured with DHCPc_RouteFnctSet() & removed when the
+*               lease is lost or the client is stopped.  Set to 0 to only use the first router.
+*
+*          (13) Configure DHCPc_CFG_SRV_MAX_NBR to the maximum number of DNS servers (option 6) & of NTP
+*               servers (option 42) kept for each interface, & DHCPc_CFG_DOMAIN_NAME_MAX_LEN to the maximum
+*               length of its domain name (option 15, or first domain of option 119).  They are pushed to
+*               the functions configured with DHCPc_SrvFnctSet(), e.g. to configure uC/DNSc & SNTP, as
+*               soon as the lease is bound or changes.  Set to 0 to disable.
+*
+*          (14) When DHCPc_CFG_PARAM_APPLY_EN is enabled, the interface MTU (option 26), the ARP cache
+*               timeout (option 35), the default IP TTL (option 23) & the TCP default TTL (option 37) of the
+*               lease are applied to the IP stack, each as enabled in the interface configuration, &
+*               reverted when the lease is lost.  The TTLs are applied with the function configured with
+*               DHCPc_TTL_FnctSet().  Configure DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC to the ARP cache timeout
+*               the application configures with NetARP_CfgCacheTimeout(), which is restored on revert.
+*
+*          (15) When DHCPc_CFG_HW_TYPE_GENERIC_EN is enabled, the DHCP client runs on interfaces of any
+*               hardware type (set in the interface configuration), e.g. PPP or IP over InfiniBand.  The
+*               hardware type of a non-Ethernet interface MUST be configured explicitly.  An interface
+*               without a hardware address fitting the 'chaddr' field MUST then be started with a client
+*               identifier (see Note #8).  When disabled, ONLY Ethernet interfaces are supported.
+*
+*          (16) When DHCPc_CFG_RELAY_EN is enabled, the relay agent address ('giaddr') & the relay agent
+*               information (option 82, up to DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN octets) of each reply are
+*               recorded & returned by DHCPc_RelayInfoGet().
+*
+*          (17) When DHCPc_CFG_IPv6_EN is enabled, DHCPc_IPv6_Start() runs a DHCPv6 client (RFC #8415) on
+*               an interface, to acquire an IPv6 address, a delegated prefix or both.  The DHCPv6 clients
+*               share the DHCPc tasks, timers & pools with the DHCPv4 clients; each one uses one interface
+*               information object (see 'dhcp-c.h  DHCPc TIMER, INTERFACE INFORMATION, & MESSAGE QUANTITY
+*               DEFINES  Note #5').  Requires the IPv6 module of the network protocol suite.
 *********************************************************************************************************
 */
 
@@ -79,6 +146,8 @@
 
 #define  DHCPc_CFG_PARAM_REQ_TBL_SIZE                      5    /* Configure requested parameter table size.            */
 
+#define  DHCPc_CFG_MSG_BUF_SIZE                          576    /* Configure DHCP message buffer size    (see Note #5). */
+
 #define  DHCPc_CFG_MAX_NBR_IF                              1    /* Configure maximum number of interface (see Note #3). */
 
 #define  DHCPc_CFG_ADDR_VALIDATE_EN              DEF_ENABLED    /* Configure final check on assigned address ...        */
@@ -101,6 +170,47 @@
 #define  DHCPc_CFG_REQUEST_RETRY_CNT                       3    /* Number of attemps to transmit request messages       */
                                                                 /* during the request phase of the lease negotiation    */
 
+#define  DHCPc_CFG_FORCERENEW_EN                DEF_DISABLED    /* Configure FORCERENEW listener (see Note #6) :        */
+                                                                /*   DEF_DISABLED  FORCERENEW NOT accepted              */
+                                                                /*   DEF_ENABLED   FORCERENEW     accepted while BOUND  */
+
+#define  DHCPc_CFG_RENEW_COALESCE_WIN_SEC                  0    /* Configure renew coalescing window (in sec, ...       */
+                                                                /* ... see Note #7).                                    */
+
+#define  DHCPc_CFG_CLIENT_ID_MAX_LEN                       0    /* Configure client identifier max len (see Note #8).   */
+
+#define  DHCPc_CFG_EMUL_MAX_NBR_CLIENT                     0    /* Configure max nbr of virtual clients (see Note #9).  */
+
+#define  DHCPc_CFG_WORKER_NBR                              1    /* Configure nbr of DHCPc tasks        (see Note #10).  */
+
+#define  DHCPc_CFG_VENDOR_CLASS_MAX_LEN                    0    /* Configure max vendor class len      (see Note #11).  */
+#define  DHCPc_CFG_VENDOR_INFO_MAX_LEN                     0    /* Configure max vendor info  len      (see Note #11).  */
+
+#define  DHCPc_CFG_ROUTE_MAX_NBR                           0    /* Configure max nbr of routes per IF  (see Note #12).  */
+
+#define  DHCPc_CFG_SRV_MAX_NBR                             0    /* Configure max nbr of DNS/NTP srvs   (see Note #13).  */
+#define  DHCPc_CFG_DOMAIN_NAME_MAX_LEN                     0    /* Configure max domain name len       (see Note #13).  */
+
+#define  DHCPc_CFG_PARAM_APPLY_EN               DEF_DISABLED    /* Configure lease param apply (see Note #14) :         */
+                                                                /*   DEF_DISABLED  Lease params NOT applied             */
+                                                                /*   DEF_ENABLED   Lease params     applied             */
+
+                                                                /* Configure ARP cache timeout (in sec, see Note #14).  */
+#define  DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC        NET_ARP_CACHE_TIMEOUT_DFLT_SEC
+
+#define  DHCPc_CFG_HW_TYPE_GENERIC_EN           DEF_DISABLED    /* Configure generic hw type (see Note #15) :           */
+                                                                /*   DEF_DISABLED  Ethernet IFs ONLY                    */
+                                                                /*   DEF_ENABLED   IFs of any hw type                   */
+
+#define  DHCPc_CFG_RELAY_EN                     DEF_DISABLED    /* Configure relay agent path (see Note #16) :          */
+                                                                /*   DEF_DISABLED  Relay path NOT recorded              */
+                                                                /*   DEF_ENABLED   Relay path     recorded              */
+#define  DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN                0    /* Configure max relay agent info len  (see Note #16).  */
+
+#define  DHCPc_CFG_IPv6_EN                      DEF_DISABLED    /* Configure DHCPv6 client (see Note #17) :             */
+                                                                /*   DEF_DISABLED  DHCPv6 client NOT present            */
+                                                                /*   DEF_ENABLED   DHCPv6 client     present            */
+
 
 /*
 *********************************************************************************************************
@@ -84,9 +84,11 @@
                                           /* 012345678901234567890 */
 #define  DHCPc_OS_INIT_NAME                 "DHCPc Init Signal"
 #define  DHCPc_OS_LOCK_NAME                 "DHCPc Global Lock"
+#define  DHCPc_OS_IF_LOCK_NAME              "DHCPc IF Lock"
 #define  DHCPc_OS_TMR_NAME                  "DHCPc Tmr"
 #define  DHCPc_OS_TMR_SIGNAL_NAME           "DHCPc Tmr Signal"
 #define  DHCPc_OS_Q_NAME                    "DHCPc Msg Q"
+#define  DHCPc_OS_REQ_SIGNAL_NAME           "DHCPc Req Signal"
 
 #define  DHCPc_OBJ_NAME_SIZE_MAX                          18    /* Max of ALL DHCPc obj name sizes.                     */
 
@@ -100,10 +102,14 @@
 #define  DHCPc_OS_NBR_SEM_DHCPc_INIT                       1
 #define  DHCPc_OS_NBR_SEM_DHCPc_LOCK                       1
 #define  DHCPc_OS_NBR_SEM_DHCPc_TMR_SIGNAL                 1
+#define  DHCPc_OS_NBR_SEM_DHCPc_REQ_SIGNAL             DHCPc_NBR_REQ_WAIT
+#define  DHCPc_OS_NBR_SEM_DHCPc_IF_LOCK                DHCPc_NBR_IF_INFO
 
-#define  DHCPc_OS_NBR_SEM                              (DHCPc_OS_NBR_SEM_DHCPc_INIT + \
-                                                        DHCPc_OS_NBR_SEM_DHCPc_LOCK + \
-                                                        DHCPc_OS_NBR_SEM_DHCPc_TMR_SIGNAL)
+#define  DHCPc_OS_NBR_SEM                              (DHCPc_OS_NBR_SEM_DHCPc_INIT       + \
+                                                        DHCPc_OS_NBR_SEM_DHCPc_LOCK       + \
+                                                        DHCPc_OS_NBR_SEM_DHCPc_TMR_SIGNAL + \
+                                                        DHCPc_OS_NBR_SEM_DHCPc_REQ_SIGNAL + \
+                                                        DHCPc_OS_NBR_SEM_DHCPc_IF_LOCK)
 
 #define  DHCPc_OS_NBR_Q                                    1
 
@@ -159,7 +165,9 @@ static  OS_STK     DHCPc_OS_TmrTaskStk[DHCPc_OS_CFG_TMR_TASK_STK_SIZE];
                                                                 /* ----------------- LOCKS & SIGNALS ------------------ */
 static  OS_EVENT  *DHCPc_OS_InitSignalPtr;
 static  OS_EVENT  *DHCPc_OS_LockPtr;
+static  OS_EVENT  *DHCPc_OS_IF_LockPtr[DHCPc_NBR_IF_INFO];
 static  OS_EVENT  *DHCPc_OS_TmrSignalPtr;
+static  OS_EVENT  *DHCPc_OS_ReqSignalPtr[DHCPc_NBR_REQ_WAIT];
 
 
                                                                 /* ---------------------- TIMER ----------------------- */
@@ -307,6 +315,17 @@ static  void  DHCPc_OS_TmrCallback(void  *p_tmr,
 *
 *                   (c) Implement timer expiration communication by creating a message queue.
 *
+*                   (d) Implement DHCPc request completion signals by creating one counting semaphore
+*                       per request waiter (see 'dhcp-c.c  DHCPc_ReqWait()  Note #2').
+*
+*                       (1) Initialize DHCPc request completion signals with no signal by setting the
+*                           semaphore count to 0 to block the semaphore.
+*
+*                   (e) Implement interface locks by creating one binary semaphore per interface
+*                       information structure.
+*
+*                       (1) Initialize interface locks as released by setting the semaphore count to 1.
+*
 *
 * Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
 *
@@ -327,6 +346,17 @@ static  void  DHCPc_OS_TmrCallback(void  *p_tmr,
 *                               DHCPc_OS_ERR_INIT_Q_NAME        DHCPc    queue                 name
 *                                                                   NOT successfully configured.
 *
+*                               DHCPc_OS_ERR_INIT_REQ_SIGNAL    DHCPc    request        signal
+*                                                                   NOT successfully initialized.
+*                               DHCPc_OS_ERR_INIT_REQ_SIGNAL_NAME
+*                                                               DHCPc    request        signal name
+*                                                                   NOT successfully configured.
+*
+*                               DHCPc_OS_ERR_INIT_IF_LOCK       DHCPc    interface lock signal
+*                                                                   NOT successfully initialized.
+*                               DHCPc_OS_ERR_INIT_IF_LOCK_NAME  DHCPc    interface lock signal name
+*                                                                   NOT successfully configured.
+*
 * Return(s)   : none.
 *
 * Caller(s)   : DHCPc_Init().
@@ -341,8 +371,9 @@ void  DHCPc_OS_Init (DHCPc_ERR  *perr)
 {
 #if (((OS_VERSION >= 288) && (OS_EVENT_NAME_EN   >  0)) || \
      ((OS_VERSION <  288) && (OS_EVENT_NAME_SIZE >= DHCPc_OBJ_NAME_SIZE_MAX)))
-    INT8U  os_err;
+    INT8U              os_err;
 #endif
+    DHCPc_IF_INFO_QTY  i;
 
                                                                 /* -------------- INITIALIZE DHCPc SIGNAL ------------- */
                                                                 /* Create DHCPc initialization signal ...               */
@@ -403,6 +434,50 @@ void  DHCPc_OS_Init (DHCPc_ERR  *perr)
 #endif
 
 
+                                                                /* ----------- INITIALIZE DHCPc REQ SIGNALS ----------- */
+    for (i = 0u; i < DHCPc_NBR_REQ_WAIT; i++) {
+                                                                /* Create DHCPc req signal ...                          */
+        DHCPc_OS_ReqSignalPtr[i] = OSSemCreate((INT16U)0);      /* ... with NO req signaled (see Note #1d1).            */
+        if (DHCPc_OS_ReqSignalPtr[i] == (OS_EVENT *)0) {
+           *perr = DHCPc_OS_ERR_INIT_REQ_SIGNAL;
+            return;
+        }
+
+#if (((OS_VERSION >= 288) && (OS_EVENT_NAME_EN   >  0)) || \
+     ((OS_VERSION <  288) && (OS_EVENT_NAME_SIZE >= DHCPc_OBJ_NAME_SIZE_MAX)))
+        OSEventNameSet((OS_EVENT *) DHCPc_OS_ReqSignalPtr[i],
+                       (INT8U    *) DHCPc_OS_REQ_SIGNAL_NAME,
+                       (INT8U    *)&os_err);
+        if (os_err != OS_ERR_NONE) {
+           *perr = DHCPc_OS_ERR_INIT_REQ_SIGNAL_NAME;
+            return;
+        }
+#endif
+    }
+
+
+                                                                /* ------------ INITIALIZE DHCPc IF LOCKS ------------- */
+    for (i = 0u; i < DHCPc_NBR_IF_INFO; i++) {
+                                                                /* Create IF lock signal ...                            */
+        DHCPc_OS_IF_LockPtr[i] = OSSemCreate((INT16U)1);        /* ... with IF access available (see Note #1e1).        */
+        if (DHCPc_OS_IF_LockPtr[i] == (OS_EVENT *)0) {
+           *perr = DHCPc_OS_ERR_INIT_IF_LOCK;
+            return;
+        }
+
+#if (((OS_VERSION >= 288) && (OS_EVENT_NAME_EN   >  0)) || \
+     ((OS_VERSION <  288) && (OS_EVENT_NAME_SIZE >= DHCPc_OBJ_NAME_SIZE_MAX)))
+        OSEventNameSet((OS_EVENT *) DHCPc_OS_IF_LockPtr[i],
+                       (INT8U    *) DHCPc_OS_IF_LOCK_NAME,
+                       (INT8U    *)&os_err);
+        if (os_err != OS_ERR_NONE) {
+           *perr = DHCPc_OS_ERR_INIT_IF_LOCK_NAME;
+            return;
+        }
+#endif
+    }
+
+
    *perr = DHCPc_OS_ERR_NONE;
 }
 
@@ -597,6 +672,84 @@ void  DHCPc_OS_Unlock (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                                          DHCPc_OS_IF_Lock()
+*
+* Description : Acquire mutually exclusive access to an interface information structure.
+*
+* Argument(s) : if_info_id  Interface information ID.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_OS_ERR_NONE               Interface access     acquired.
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : various.
+*
+*               This function is an INTERNAL DHCP client function & SHOULD NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) Interface access MUST be acquired--i.e. MUST wait for access; do NOT timeout.
+*********************************************************************************************************
+*/
+
+void  DHCPc_OS_IF_Lock (DHCPc_IF_INFO_QTY   if_info_id,
+                        DHCPc_ERR          *perr)
+{
+    INT8U  os_err;
+
+
+    OSSemPend((OS_EVENT *) DHCPc_OS_IF_LockPtr[if_info_id],     /* Acquire IF access ...                                */
+              (INT16U    ) 0,                                   /* ... without timeout (see Note #1).                   */
+              (INT8U    *)&os_err);
+
+    switch (os_err) {
+        case OS_ERR_NONE:
+            *perr = DHCPc_OS_ERR_NONE;
+             break;
+
+
+        case OS_ERR_PEVENT_NULL:
+        case OS_ERR_EVENT_TYPE:
+        case OS_ERR_PEND_ISR:
+        case OS_ERR_PEND_LOCKED:
+        case OS_ERR_PEND_ABORT:
+        case OS_ERR_TIMEOUT:
+        default:
+            *perr = DHCPc_OS_ERR_LOCK;
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_OS_IF_Unlock()
+*
+* Description : Release mutually exclusive access to an interface information structure.
+*
+* Argument(s) : if_info_id  Interface information ID.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : various.
+*
+*               This function is an INTERNAL DHCP client function & SHOULD NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) See 'DHCPc_OS_Unlock()  Note #1'.
+*********************************************************************************************************
+*/
+
+void  DHCPc_OS_IF_Unlock (DHCPc_IF_INFO_QTY  if_info_id)
+{
+   (void)OSSemPost(DHCPc_OS_IF_LockPtr[if_info_id]);            /* Release IF access (see Note #1).                     */
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1160,6 +1313,137 @@ void  DHCPc_OS_TmrSignal (void)
 }
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      DHCPc/OS REQUEST FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_OS_ReqWait()
+*
+* Description : Wait on signal indicating a DHCPc request completed.
+*
+* Argument(s) : ix              Index of the request waiter's signal.
+*
+*               timeout_tick    Maximum time to wait (in clock ticks) :
+*
+*                                   0,                  wait forever.
+*                                   Any other value,    number of clock ticks to wait.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_OS_ERR_NONE               Request signal     received.
+*                               DHCPc_OS_ERR_REQ_TIMEOUT        Request signal NOT received before timeout.
+*                               DHCPc_OS_ERR_REQ_SIGNAL         Request signal NOT received.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_ReqWait().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) The request signal is ONLY signaled for the request waited on by its waiter (see
+*                   'dhcp-c.c  DHCPc_ReqWait()  Note #2').
+*********************************************************************************************************
+*/
+
+void  DHCPc_OS_ReqWait (CPU_INT16U   ix,
+                        CPU_INT32U   timeout_tick,
+                        DHCPc_ERR   *perr)
+{
+    INT8U  os_err;
+
+
+    OSSemPend((OS_EVENT *) DHCPc_OS_ReqSignalPtr[ix],           /* Wait until the DHCPc req completes ...               */
+              (INT32U    ) timeout_tick,                        /* ... or timeout.                                      */
+              (INT8U    *)&os_err);
+
+    switch (os_err) {
+        case OS_ERR_NONE:
+            *perr = DHCPc_OS_ERR_NONE;
+             break;
+
+
+        case OS_ERR_TIMEOUT:
+            *perr = DHCPc_OS_ERR_REQ_TIMEOUT;
+             break;
+
+
+        case OS_ERR_PEVENT_NULL:
+        case OS_ERR_EVENT_TYPE:
+        case OS_ERR_PEND_ISR:
+        case OS_ERR_PEND_LOCKED:
+        case OS_ERR_PEND_ABORT:
+        default:
+            *perr = DHCPc_OS_ERR_REQ_SIGNAL;
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_OS_ReqSignal()
+*
+* Description : Signal that a DHCPc request completed.
+*
+* Argument(s) : ix          Index of the request waiter's signal.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_ReqDone().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) Failure to signal only delays the waiting task until its timeout.
+*********************************************************************************************************
+*/
+
+void  DHCPc_OS_ReqSignal (CPU_INT16U  ix)
+{
+   (void)OSSemPost(DHCPc_OS_ReqSignalPtr[ix]);                  /* Signal DHCPc req completed (see Note #1).            */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_OS_ReqSignalClr()
+*
+* Description : Clear the signal of a DHCPc request waiter.
+*
+* Argument(s) : ix          Index of the request waiter's signal.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_ReqWait().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) A signal MAY remain from a previous waiter whose wait timed out before the signal was
+*                   posted (see 'dhcp-c.c  DHCPc_ReqWait()  Note #2c').
+*********************************************************************************************************
+*/
+
+void  DHCPc_OS_ReqSignalClr (CPU_INT16U  ix)
+{
+    INT8U  os_err;
+
+
+    OSSemSet((OS_EVENT *) DHCPc_OS_ReqSignalPtr[ix],            /* Clr any remaining signal (see Note #1).              */
+             (INT16U    ) 0u,
+             (INT8U    *)&os_err);
+
+   (void)&os_err;
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1178,9 +1462,9 @@ void  DHCPc_OS_TmrSignal (void)
 *
 * Return(s)   : Number of clock ticks elapsed since OS startup.
 *
-* Caller(s)   : DHCPc_TxMsgPrepare(),
-*               DHCPc_LeaseTimeCalc(),
-*               DHCPc_TmrTaskHandler().
+* Caller(s)   : DHCPc_Init(),
+*               DHCPc_TimeGet_sec(),
+*               DHCPc_AddrLocalLinkGet().
 *
 *               This function is an INTERNAL DHCP client function & MUST NOT be called by application
 *               function(s).
@@ -1188,7 +1472,7 @@ void  DHCPc_OS_TmrSignal (void)
 * Note(s)     : (1) The value returned by this function OS configuration dependent (number of ticks per
 *                   second), and hence cannot be interpreted directly by the caller.
 *
-*                   See 'DHCPc_OS_TimeCalcElapsed_sec()' for useful usage.
+*                   See 'DHCPc_OS_TimeGetRate_tick()' to convert it in units of seconds.
 *********************************************************************************************************
 */
 
@@ -1205,58 +1489,27 @@ CPU_INT32U  DHCPc_OS_TimeGet_tick (void)
 
 /*
 *********************************************************************************************************
-*                                   DHCPc_OS_TimeCalcElapsed_sec()
-*
-* Description : Calculate the number of seconds elapsed between start and stop time.
-*
-* Argument(s) : time_start      Start time (in clock ticks).
+*                                     DHCPc_OS_TimeGetRate_tick()
 *
-*               time_stop       Stop  time (in clock ticks).
+* Description : Get the clock tick rate.
 *
-* Return(s)   : Number of seconds elapsed, if NO errors.
+* Argument(s) : none.
 *
-*               0,                         otherwise.
+* Return(s)   : Number of clock ticks per second.
 *
-* Caller(s)   : DHCPc_LeaseTimeCalc().
+* Caller(s)   : DHCPc_TimeGet_sec().
 *
 *               This function is an INTERNAL DHCP client function & MUST NOT be called by application
 *               function(s).
 *
-* Note(s)     : (1) The values of the 'time_start' & 'time_stop' parameters are obtained from a call to
-*                   DHCPc_OS_TimeGet_tick().  Those values are clock tick dependent, and are converted
-*                   in units of seconds by this function.
-*
-*               (2) Elapsed time delta calculation adjusts ONLY for a single overflow time ticks.  Thus
-*                   if elapsed time is greater than the maximum 32-bit overflow threshold, then elapsed
-*                   time will incorrectly calculate a lower elaspsed time.  However, this should NEVER
-*                   occur since the maximum 32-bit overflow threshold for times measured in seconds is
-*                   136.2 years.
+* Note(s)     : (1) The DHCP client converts the values returned by DHCPc_OS_TimeGet_tick() in units of
+*                   seconds using this rate (see 'dhcp-c.c  DHCPc_TimeGet_sec()  Note #1').  A rate of 0
+*                   stops the DHCPc time.
 *********************************************************************************************************
 */
 
-CPU_INT32U  DHCPc_OS_TimeCalcElapsed_sec (CPU_INT32U  time_start,
-                                          CPU_INT32U  time_stop)
+CPU_INT32U  DHCPc_OS_TimeGetRate_tick (void)
 {
-#if (OS_TICKS_PER_SEC > 0u)
-    CPU_INT32U  time_delta_tick;
-    CPU_INT32U  time_sec;
-
-                                                                /* Calculate delta time (in ticks) [see Note #2].       */
-    if (time_start <= time_stop) {
-        time_delta_tick = time_stop - time_start;
-    } else {                                                    /* If stop time > start time, adjust for tick overflow. */
-        time_delta_tick = ((DEF_INT_32U_MAX_VAL - time_start) + 1u) + time_stop;
-    }
-
-    time_sec = time_delta_tick / OS_TICKS_PER_SEC;              /* Calculate time (in seconds).                         */
-
-    return (time_sec);
-
-#else
-   (void)&time_start;                                           /* Prevent 'variable unused' compiler warnings.         */
-   (void)&time_stop;
-
-    return (0u);
-#endif
+    return ((CPU_INT32U)OS_TICKS_PER_SEC);
 }
 
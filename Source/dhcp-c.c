@@ -30,8 +30,8 @@
 *                        with automatic renewal of lease if necessary
 *
 *            (2) To protect the validity & prevent the corruption of shared DHCP client resources,
-*                the primary tasks of the DHCP client are prevented from running concurrently
-*                through the use of a global DHCPc lock implementing protection by mutual exclusion.
+*                the tasks of the DHCP client access the shared resources through the use of a global
+*                DHCPc lock implementing protection by mutual exclusion (see 'dhcp-c.h  Note #2').
 *
 *                (a) The mechanism of protected mutual exclusion is irrelevant but MUST be implemented
 *                    in the following two functions :
@@ -47,9 +47,8 @@
 *                                <DHCPc>                       directory path for DHCPc module
 *                                <os>                          directory name for specific OS
 *
-*                (b) Since this global lock implements mutual exclusion at the DHCP client task
-*                    level, critical sections are NOT required to prevent task-level concurrency in
-*                    the DHCP client.
+*                (b) The global lock is held ONLY while the shared lists are accessed; the message &
+*                    communication object pools & the DHCPc time are protected by critical sections.
 *********************************************************************************************************
 */
 
@@ -67,6 +66,9 @@
 #include  <Source/net_cfg_net.h>
 #include  <Source/net_sock.h>
 #include  <IP/IPv4/net_ipv4.h>
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+#include  <IP/IPv6/net_ipv6.h>
+#endif
 #include  <IP/IPv4/net_arp.h>
 #include  <IF/net_if.h>
 #include  <IF/net_if_802x.h>
@@ -79,13 +81,67 @@
 *********************************************************************************************************
 */
 
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+#define  DHCPc_MD5_BLK_SIZE                               64    /* MD5 blk    size (in octets).                         */
+#define  DHCPc_MD5_DIGEST_LEN                             16    /* MD5 digest len  (in octets).                         */
+
+#define  DHCPc_HMAC_IPAD                                0x36    /* HMAC inner pad (see RFC #2104).                      */
+#define  DHCPc_HMAC_OPAD                                0x5C    /* HMAC outer pad (see RFC #2104).                      */
+#endif
+
 
 /*
 *********************************************************************************************************
 *                                           LOCAL CONSTANTS
+*
+* Note(s) : (1) Default interface configuration, built from the compile-time configuration values.
+*
+*               See also 'dhcp-c.h  DHCPc INTERFACE CONFIGURATION DATA TYPE  Note #1'.
 *********************************************************************************************************
 */
 
+#ifdef  NET_IPv4_MODULE_EN
+static  const  DHCPc_CFG_IF  DHCPc_CfgIF_Dflt = {               /* See Note #1.                                         */
+    DHCPc_CFG_NEGO_RETRY_CNT,
+    DHCPc_CFG_DISCOVER_RETRY_CNT,
+    DHCPc_CFG_REQUEST_RETRY_CNT,
+
+    DHCPc_BACKOFF_DLY_INITIAL_MS,
+    DHCPc_BACKOFF_DLY_MAX_MS,
+
+    DHCPc_CFG_MAX_RX_TIMEOUT_MS,
+    DHCP_ADDR_VALIDATE_WAIT_TIME_MS,
+
+    DHCPc_CFG_ADDR_VALIDATE_EN,
+    DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN,
+
+    DHCPc_REQ_PARAM_ALL,
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+    DHCPc_PARAM_APPLY_ALL,
+#endif
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    DHCPc_HW_TYPE_NONE,
+#endif
+
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)                           /* NO client id (i.e. IF's dflt client).                */
+    { 0u },
+    0u,
+#endif
+
+#if (DHCPc_CFG_VENDOR_CLASS_MAX_LEN > 0)                        /* NO vendor class id.                                  */
+    { 0u },
+    0u,
+#endif
+
+#if (DHCPc_CFG_VENDOR_INFO_MAX_LEN > 0)                         /* NO vendor-specific info.                             */
+    { 0u },
+    0u,
+#endif
+};
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -93,6 +149,14 @@
 *********************************************************************************************************
 */
 
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+typedef  struct  dhcpc_md5_ctx {
+    CPU_INT32U  State[4];                                       /* MD5 state (A, B, C, D).                              */
+    CPU_INT32U  Len;                                            /* Tot len of data processed (in octets).               */
+    CPU_INT08U  Buf[DHCPc_MD5_BLK_SIZE];                        /* Buf for partial blk.                                 */
+} DHCPc_MD5_CTX;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -119,14 +183,30 @@
 static  void            DHCPc_IF_InfoInit            (DHCPc_ERR          *perr);
 
 static  DHCPc_IF_INFO  *DHCPc_IF_InfoGet             (NET_IF_NBR          if_nbr,
+                                                      CPU_INT08U         *pclient_id,
+                                                      CPU_INT08U          client_id_len,
+                                                      CPU_INT16U          flags,
                                                       DHCPc_ERR          *perr);
 
-static  DHCPc_IF_INFO  *DHCPc_IF_InfoGetCfgd         (NET_IF_NBR          if_nbr);
+static  DHCPc_IF_INFO  *DHCPc_IF_InfoGetCfgd         (NET_IF_NBR          if_nbr,
+                                                      CPU_INT08U         *pclient_id,
+                                                      CPU_INT08U          client_id_len);
+
+static  CPU_BOOLEAN     DHCPc_IF_InfoAddrSharedChk   (DHCPc_IF_INFO      *pif_info);
+
+static  void            DHCPc_IF_InfoMsgSet          (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_MSG          *pmsg,
+                                                      DHCPc_ERR          *perr);
 
 static  void            DHCPc_IF_InfoFree            (DHCPc_IF_INFO      *pif_info);
 
 static  void            DHCPc_IF_InfoClr             (DHCPc_IF_INFO      *pif_info);
 
+static  void            DHCPc_ParamReqBuild          (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_OPT_CODE     *preq_param_tbl,
+                                                      CPU_INT08U          req_param_tbl_qty,
+                                                      DHCPc_ERR          *perr);
+
 
 
                                                                                     /* ---------- MSG FNCTS ----------- */
@@ -141,6 +221,11 @@ static  CPU_INT08U     *DHCPc_MsgGetOpt              (DHCPc_OPT_CODE      opt_co
                                                       CPU_INT16U          msg_buf_size,
                                                       CPU_INT08U         *popt_val_len);
 
+static  CPU_INT08U     *DHCPc_MsgGetOptSrch          (DHCPc_OPT_CODE      opt_code,
+                                                      CPU_INT08U         *popt_start,
+                                                      CPU_INT08U         *popt_end,
+                                                      CPU_INT08U         *popt_val_len);
+
 static  void            DHCPc_MsgFree                (DHCPc_MSG          *pmsg);
 
 static  void            DHCPc_MsgClr                 (DHCPc_MSG          *pmsg);
@@ -150,7 +235,7 @@ static  void            DHCPc_MsgClr                 (DHCPc_MSG          *pmsg);
                                                                                     /* ---------- COMM FNCTS ---------- */
 static  void            DHCPc_CommInit               (DHCPc_ERR          *perr);
 
-static  DHCPc_COMM     *DHCPc_CommGet                (NET_IF_NBR          if_nbr,
+static  DHCPc_COMM     *DHCPc_CommGet                (DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_COMM_MSG      comm_msg,
                                                       DHCPc_ERR          *perr);
 
@@ -160,22 +245,44 @@ static  void            DHCPc_CommClr                (DHCPc_COMM         *pcomm)
 
 
 
+                                                                                    /* ---------- REQ FNCTS ----------- */
+static  void            DHCPc_ReqAttach              (DHCPc_REQ          *preq,
+                                                      DHCPc_COMM         *pcomm);
+
+static  void            DHCPc_ReqDone                (DHCPc_REQ          *preq);
+
+
+
                                                                                     /* ---------- TMR FNCTS ----------- */
 static  void            DHCPc_TmrInit                (DHCPc_ERR          *perr);
 
 static  void            DHCPc_TmrCfg                 (DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_COMM_MSG      tmr_msg,
-                                                      CPU_INT32U          time_sec,
+                                                      CPU_INT32U          deadline_sec,
                                                       DHCPc_ERR          *perr);
 
 static  DHCPc_TMR      *DHCPc_TmrGet                 (void               *pobj,
-                                                      DHCPc_TMR_TICK      time,
+                                                      CPU_INT32U          deadline_sec,
                                                       DHCPc_ERR          *perr);
 
 static  void            DHCPc_TmrFree                (DHCPc_TMR          *ptmr);
 
 static  void            DHCPc_TmrClr                 (DHCPc_TMR          *ptmr);
 
+#if (DHCPc_CFG_RENEW_COALESCE_WIN_SEC > 0)
+static  CPU_INT32U      DHCPc_TmrRenewTimeGet        (CPU_INT32U          time_cur_sec);
+#endif
+
+
+                                                                                    /* ---------- TIME FNCTS ---------- */
+static  CPU_INT32U      DHCPc_TimeGet_sec            (void);
+
+static  CPU_BOOLEAN     DHCPc_TimeIsReached          (CPU_INT32U          time_cur_sec,
+                                                      CPU_INT32U          deadline_sec);
+
+static  CPU_INT32U      DHCPc_TimeRemainGet_sec      (CPU_INT32U          time_cur_sec,
+                                                      CPU_INT32U          deadline_sec);
+
 
                                                                                     /* ----- STATE HANDLER FNCTS ------ */
 static  NET_SOCK_ID     DHCPc_InitSock               (NET_IPv4_ADDR       ip_addr_local,
@@ -192,6 +299,9 @@ static  void            DHCPc_RenewRebindStateHandler(DHCPc_IF_INFO      *pif_in
 static  void            DHCPc_StopStateHandler       (DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_ERR          *perr);
 
+static  void            DHCPc_InformStateHandler     (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ERR          *perr);
+
 
 static  void            DHCPc_Discover               (NET_SOCK_ID         sock_id,
                                                       DHCPc_IF_INFO      *pif_info,
@@ -212,8 +322,21 @@ static  void            DHCPc_DeclineRelease         (NET_SOCK_ID         sock_i
                                                       CPU_INT08U          addr_hw_len,
                                                       DHCPc_ERR          *perr);
 
+static  void            DHCPc_ReleaseWait            (NET_IF_NBR          if_nbr,
+                                                      NET_IPv4_ADDR       addr_host,
+                                                      NET_IPv4_ADDR       addr_server);
+
+
+static  CPU_INT32U      DHCPc_CalcBackOff            (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT32U          timeout_ms);
+
+static  CPU_INT32U      DHCPc_CalcBackOffRand        (CPU_INT32U          dly_ms);
 
-static  CPU_INT16U      DHCPc_CalcBackOff            (CPU_INT16U          timeout_ms);
+
+static  void            DHCPc_RandSeed               (CPU_INT08U         *pdata,
+                                                      CPU_INT08U          data_len);
+
+static  CPU_INT32U      DHCPc_RandGet                (void);
 
 
 
@@ -229,6 +352,17 @@ static  void            DHCPc_AddrValidate           (NET_IF_NBR          if_nbr
 static  void            DHCPc_AddrCfg                (DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_ERR          *perr);
 
+static  NET_IPv4_ADDR   DHCPc_AddrHostGet            (NET_IF_NBR          if_nbr);
+
+static  CPU_INT08U      DHCPc_AddrHW_Get             (NET_IF_NBR          if_nbr,
+                                                      CPU_INT08U         *paddr_hw,
+                                                      DHCPc_ERR          *perr);
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+static  void            DHCPc_HW_TypeSet             (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ERR          *perr);
+#endif
+
 #if (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED)
 static  void            DHCPc_AddrLocalLinkCfg       (DHCPc_IF_INFO      *pif_info,
                                                       CPU_INT08U         *paddr_hw,
@@ -241,6 +375,67 @@ static  NET_IPv4_ADDR   DHCPc_AddrLocalLinkGet       (CPU_INT08U         *paddr_
 
 
 
+                                                                                    /* ---------- ROUTE FNCTS --------- */
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+static  NET_IPv4_ADDR   DHCPc_RouteGet               (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ERR          *perr);
+
+static  CPU_INT08U      DHCPc_RouteInsert            (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ROUTE        *proute,
+                                                      CPU_INT08U          route_qty);
+
+static  void            DHCPc_RouteInstall           (DHCPc_IF_INFO      *pif_info);
+
+static  void            DHCPc_RouteRemove            (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ERR          *perr);
+#endif
+
+
+
+                                                                                    /* ----------- SRV FNCTS ---------- */
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+static  CPU_BOOLEAN     DHCPc_SrvGet                 (DHCPc_IF_INFO      *pif_info);
+
+static  CPU_BOOLEAN     DHCPc_SrvAddrGet             (DHCPc_MSG          *pmsg,
+                                                      DHCPc_OPT_CODE      opt_code,
+                                                      NET_IPv4_ADDR      *paddr_tbl,
+                                                      CPU_INT08U         *paddr_qty);
+
+#if (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0)
+static  CPU_BOOLEAN     DHCPc_SrvDomainNameGet       (DHCPc_MSG          *pmsg,
+                                                      CPU_CHAR           *pdomain_name);
+#endif
+
+static  void            DHCPc_SrvPush                (DHCPc_IF_INFO      *pif_info);
+
+static  void            DHCPc_SrvClr                 (DHCPc_IF_INFO      *pif_info);
+#endif
+
+
+
+                                                                                    /* ------- PARAM APPLY FNCTS ------ */
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+static  void            DHCPc_ParamApply             (DHCPc_IF_INFO      *pif_info);
+
+static  void            DHCPc_ParamRevert            (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U          param_flags);
+
+static  void            DHCPc_ParamTTL_Set           (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U          ttl_ip,
+                                                      CPU_INT08U          ttl_tcp);
+#endif
+
+
+
+                                                                                    /* ---------- RELAY FNCTS --------- */
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+static  void            DHCPc_RelayInfoSet           (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U         *pmsg_buf,
+                                                      CPU_INT16U          msg_len);
+#endif
+
+
+
                                                                                     /* --------- LEASE FNCTS ---------- */
 static  void            DHCPc_LeaseTimeCalc          (DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_ERR          *perr);
@@ -250,6 +445,80 @@ static  void            DHCPc_LeaseTimeUpdate        (DHCPc_IF_INFO      *pif_in
                                                       DHCPc_ERR          *perr);
 
 
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+                                                                                    /* ------- FORCERENEW FNCTS ------- */
+static  void            DHCPc_ForceRenewNonceGet     (DHCPc_IF_INFO      *pif_info);
+
+static  void            DHCPc_ForceRenewListenStart  (void);
+
+static  void            DHCPc_ForceRenewListenStop   (void);
+
+static  void            DHCPc_ForceRenewChk          (void);
+
+static  CPU_BOOLEAN     DHCPc_ForceRenewValidate     (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U         *pmsg_buf,
+                                                      CPU_INT16U          msg_len);
+
+
+                                                                                    /* ---------- AUTH FNCTS ---------- */
+static  void            DHCPc_HMAC_MD5               (CPU_INT08U         *pkey,
+                                                      CPU_INT08U          key_len,
+                                                      CPU_INT08U         *pdata,
+                                                      CPU_INT16U          data_len,
+                                                      CPU_INT08U         *pdigest);
+
+static  void            DHCPc_MD5_Init               (DHCPc_MD5_CTX      *pctx);
+
+static  void            DHCPc_MD5_Update             (DHCPc_MD5_CTX      *pctx,
+                                                      CPU_INT08U         *pdata,
+                                                      CPU_INT32U          data_len);
+
+static  void            DHCPc_MD5_Final              (DHCPc_MD5_CTX      *pctx,
+                                                      CPU_INT08U         *pdigest);
+
+static  void            DHCPc_MD5_Blk                (CPU_INT32U         *pstate,
+                                                      CPU_INT08U         *pblk);
+#endif
+
+
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)                                             /* ---------- EMUL FNCTS ---------- */
+static  void            DHCPc_EmulClientStart        (NET_SOCK_ID         sock_id,
+                                                      CPU_INT16U          ix,
+                                                      CPU_INT08U          addr_hw_tag,
+                                                      DHCPc_EMUL_STATS   *pstats);
+
+static  DHCPc_IF_INFO  *DHCPc_EmulIF_InfoSet         (DHCPc_EMUL_CLIENT  *pclient);
+
+static  void            DHCPc_EmulTx                 (NET_SOCK_ID         sock_id,
+                                                      DHCPc_EMUL_CLIENT  *pclient,
+                                                      DHCPc_MSG_TYPE      msg_type,
+                                                      DHCPc_EMUL_STATS   *pstats,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_EmulRx                 (NET_SOCK_ID         sock_id,
+                                                      DHCPc_EMUL_CFG     *pcfg,
+                                                      DHCPc_EMUL_STATS   *pstats,
+                                                      CPU_INT32U          tick_rate);
+
+static  void            DHCPc_EmulTmrChk             (NET_SOCK_ID         sock_id,
+                                                      DHCPc_EMUL_CFG     *pcfg,
+                                                      DHCPc_EMUL_STATS   *pstats,
+                                                      CPU_INT32U          timeout_tick,
+                                                      CPU_INT32U          tick_rate);
+
+static  void            DHCPc_EmulClientDone         (DHCPc_EMUL_CLIENT  *pclient,
+                                                      DHCPc_MSG_TYPE      msg_type,
+                                                      DHCPc_EMUL_STATS   *pstats,
+                                                      CPU_INT32U          tick_rate);
+
+static  CPU_INT32U      DHCPc_EmulTimeGet_tick       (CPU_INT32U          time_ms,
+                                                      CPU_INT32U          tick_rate);
+
+static  CPU_INT32U      DHCPc_EmulTimeGet_ms         (CPU_INT32U          time_tick,
+                                                      CPU_INT32U          tick_rate);
+#endif
+
+
                                                                                     /* ----------- RX FNCTS ----------- */
 static  DHCPc_MSG_TYPE  DHCPc_RxReply                (NET_SOCK_ID         sock_id,
                                                       DHCPc_IF_INFO      *pif_info,
@@ -260,15 +529,26 @@ static  DHCPc_MSG_TYPE  DHCPc_RxReply                (NET_SOCK_ID         sock_i
                                                       CPU_INT16U         *pmsg_buf_len,
                                                       DHCPc_ERR          *perr);
 
+static  CPU_BOOLEAN     DHCPc_RxReplyValidate        (DHCPc_IF_INFO      *pif_info,
+                                                      NET_IPv4_ADDR       server_id,
+                                                      CPU_INT08U         *paddr_hw,
+                                                      CPU_INT08U          addr_hw_len,
+                                                      CPU_INT08U         *pmsg_buf,
+                                                      CPU_INT16U          msg_len);
+
 static  CPU_INT16U      DHCPc_Rx                     (NET_SOCK_ID         sock_id,
                                                       void               *pdata_buf,
                                                       CPU_INT16U          data_buf_len,
+                                                      CPU_INT32U          timeout_ms,
+                                                      CPU_INT16U          retry_max,
                                                       NET_SOCK_ADDR      *paddr_remote,
                                                       NET_SOCK_ADDR_LEN  *paddr_remote_len,
                                                       DHCPc_ERR          *perr);
 
 
                                                                                     /* ----------- TX FNCTS ----------- */
+static  void            DHCPc_TxOptTmplBuild         (DHCPc_IF_INFO      *pif_info);
+
 static  CPU_INT16U      DHCPc_TxMsgPrepare           (DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_MSG_TYPE      msg_type,
                                                       CPU_INT08U         *paddr_hw,
@@ -284,6 +564,95 @@ static  void            DHCPc_Tx                     (NET_SOCK_ID         sock_i
                                                       NET_SOCK_ADDR_LEN   addr_remote_len,
                                                       DHCPc_ERR          *perr);
 
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)                                              /* --------- DHCPv6 FNCTS --------- */
+static  DHCPc_IF_INFO  *DHCPc_IPv6_InfoGetCfgd       (NET_IF_NBR          if_nbr);
+
+static  void            DHCPc_IPv6_DUID_Set          (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ERR          *perr);
+
+static  NET_SOCK_ID     DHCPc_IPv6_InitSock          (NET_IF_NBR          if_nbr);
+
+static  void            DHCPc_IPv6_InitStateHandler  (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_RenewStateHandler (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_COMM_MSG      exp_tmr_msg,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_StopStateHandler  (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_Exchange          (NET_SOCK_ID         sock_id,
+                                                      DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U          msg_type,
+                                                      CPU_INT16U          retry_max,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_RxReply           (NET_SOCK_ID         sock_id,
+                                                      DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U          msg_type,
+                                                      CPU_INT08U         *pmsg_buf,
+                                                      CPU_INT16U         *pmsg_buf_len,
+                                                      DHCPc_ERR          *perr);
+
+static  CPU_BOOLEAN     DHCPc_IPv6_RxReplyValidate   (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U          msg_type,
+                                                      CPU_INT08U         *pmsg_buf,
+                                                      CPU_INT16U          msg_len);
+
+static  CPU_INT16U      DHCPc_IPv6_TxMsgPrepare      (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U          msg_type,
+                                                      CPU_INT08U         *pmsg_buf,
+                                                      CPU_INT16U          msg_buf_size,
+                                                      DHCPc_ERR          *perr);
+
+static  CPU_INT08U     *DHCPc_IPv6_OptHdrWr          (CPU_INT08U         *popt,
+                                                      CPU_INT16U          opt_code,
+                                                      CPU_INT16U          opt_len);
+
+static  CPU_INT08U     *DHCPc_IPv6_MsgGetOpt         (CPU_INT16U          opt_code,
+                                                      CPU_INT08U         *popts,
+                                                      CPU_INT16U          opts_len,
+                                                      CPU_INT16U         *popt_val_len);
+
+static  CPU_INT16U      DHCPc_IPv6_StatusGet         (CPU_INT08U         *popts,
+                                                      CPU_INT16U          opts_len);
+
+static  void            DHCPc_IPv6_LeaseParse        (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_IPv6_LEASE   *please,
+                                                      CPU_INT32U         *pt1,
+                                                      CPU_INT32U         *pt2,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_IA_Parse          (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT08U          ia,
+                                                      CPU_INT08U         *pia,
+                                                      CPU_INT16U          ia_len,
+                                                      DHCPc_IPv6_LEASE   *please,
+                                                      CPU_INT32U         *pt1,
+                                                      CPU_INT32U         *pt2);
+
+static  void            DHCPc_IPv6_LeaseSet          (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_IPv6_LEASE   *please,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_LeaseApply        (DHCPc_IF_INFO      *pif_info,
+                                                      DHCPc_IPv6_LEASE   *please,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_LeaseRevert       (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_BOOLEAN         lease_clr);
+
+static  void            DHCPc_IPv6_LeaseTimeCalc     (DHCPc_IF_INFO      *pif_info,
+                                                      CPU_INT32U          time_t1,
+                                                      CPU_INT32U          time_t2,
+                                                      DHCPc_ERR          *perr);
+
+static  void            DHCPc_IPv6_PrefixPush        (NET_IF_NBR          if_nbr,
+                                                      DHCPc_IPv6_LEASE   *please,
+                                                      CPU_BOOLEAN         valid);
+#endif
+
 #endif
 
 
@@ -292,15 +661,68 @@ static  void            DHCPc_Tx                     (NET_SOCK_ID         sock_i
 *                                           INITIALIZED DATA
 *
 * Note(s) : (1) This array is used for requesting parameters from the DHCP server.  Do NOT modify data type.
+*
+*           (2) The order of the parameters MUST match the system requested parameter flags (see 'dhcp-c.h
+*               DHCPc PARAMETER REQUEST LIST DEFINES  Note #2').
+*
+*           (3) MD5 per-step additive constants & per-round shift amounts (see RFC #1321, section 3.4).
+*
+*           (4) All_DHCP_Relay_Agents_and_Servers multicast address, FF02::1:2 (see RFC #8415, section
+*               'DHCP Multicast Addresses').
 *********************************************************************************************************
 */
 
-static  const  DHCPc_OPT_CODE  DHCPc_ReqParam[] = {
+static  const  DHCPc_OPT_CODE  DHCPc_ReqParam[DHCPc_REQ_PARAM_SYS_TBL_SIZE] = {
     DHCP_OPT_SUBNET_MASK,
     DHCP_OPT_ROUTER,
     DHCP_OPT_DOMAIN_NAME_SERVER,
-    DHCP_OPT_TIME_OFFSET
+    DHCP_OPT_TIME_OFFSET,
+    DHCP_OPT_CLASSLESS_STATIC_ROUTE,
+    DHCP_OPT_STATIC_ROUTE,
+    DHCP_OPT_NETWORK_TIME_PROTOCOL_SERVER,
+    DHCP_OPT_DOMAIN_NAME,
+    DHCP_OPT_DOMAIN_SEARCH,
+    DHCP_OPT_INTERFACE_MTU,
+    DHCP_OPT_ARP_CACHE_TIMEOUT,
+    DHCP_OPT_DEFAULT_IP_TIME_TO_LIVE,
+    DHCP_OPT_TCP_DEFAULT_TTL
+};
+
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+static  const  CPU_INT32U  DHCPc_MD5_Const[64] = {              /* See Note #3.                                         */
+    0xD76AA478u, 0xE8C7B756u, 0x242070DBu, 0xC1BDCEEEu,
+    0xF57C0FAFu, 0x4787C62Au, 0xA8304613u, 0xFD469501u,
+    0x698098D8u, 0x8B44F7AFu, 0xFFFF5BB1u, 0x895CD7BEu,
+    0x6B901122u, 0xFD987193u, 0xA679438Eu, 0x49B40821u,
+    0xF61E2562u, 0xC040B340u, 0x265E5A51u, 0xE9B6C7AAu,
+    0xD62F105Du, 0x02441453u, 0xD8A1E681u, 0xE7D3FBC8u,
+    0x21E1CDE6u, 0xC33707D6u, 0xF4D50D87u, 0x455A14EDu,
+    0xA9E3E905u, 0xFCEFA3F8u, 0x676F02D9u, 0x8D2A4C8Au,
+    0xFFFA3942u, 0x8771F681u, 0x6D9D6122u, 0xFDE5380Cu,
+    0xA4BEEA44u, 0x4BDECFA9u, 0xF6BB4B60u, 0xBEBFBC70u,
+    0x289B7EC6u, 0xEAA127FAu, 0xD4EF3085u, 0x04881D05u,
+    0xD9D4D039u, 0xE6DB99E5u, 0x1FA27CF8u, 0xC4AC5665u,
+    0xF4292244u, 0x432AFF97u, 0xAB9423A7u, 0xFC93A039u,
+    0x655B59C3u, 0x8F0CCC92u, 0xFFEFF47Du, 0x85845DD1u,
+    0x6FA87E4Fu, 0xFE2CE6E0u, 0xA3014314u, 0x4E0811A1u,
+    0xF7537E82u, 0xBD3AF235u, 0x2AD7D2BBu, 0xEB86D391u
+};
+
+static  const  CPU_INT08U  DHCPc_MD5_Shift[16] = {              /* See Note #3.                                         */
+     7u, 12u, 17u, 22u,
+     5u,  9u, 14u, 20u,
+     4u, 11u, 16u, 23u,
+     6u, 10u, 15u, 21u
+};
+#endif
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+                                                                /* See Note #4.                                         */
+static  const  CPU_INT08U  DHCPc_IPv6_AddrSrvAll[NET_IPv6_ADDR_SIZE] = {
+    0xFFu, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x02u
 };
+#endif
 
 
 /*
@@ -349,6 +771,9 @@ static  const  DHCPc_OPT_CODE  DHCPc_ReqParam[] = {
 *                       number(s) provides the corresponding error code label(s).  A search of the error
 *                       code label(s) provides the source code location of the DHCP initialization
 *                       error(s).
+*
+*               (5) No random number function is configured by default; the DHCP client's pseudo-random
+*                   number generator is then used until one is configured (see 'DHCPc_RandFnctSet()').
 *********************************************************************************************************
 */
 
@@ -356,12 +781,50 @@ DHCPc_ERR  DHCPc_Init (void)
 {
 #ifdef  NET_IPv4_MODULE_EN
     CPU_INT08U  i;
+    CPU_INT16U  ix;
     DHCPc_ERR   err;
 
 
     DHCPc_InitDone = DEF_NO;                                    /* Block DHCPc fncts/tasks until init complete.         */
 
                                                                 /* -------------- INIT DHCPc GLOBAL VAR --------------- */
+    DHCPc_TimeCur_sec  = 0;                                     /* Init DHCPc time base.                                */
+    DHCPc_TimeRef_tick = DHCPc_OS_TimeGet_tick();
+
+    for (ix = 0u; ix < DHCPc_NBR_REQ_WAIT; ix++) {              /* Init req waiters as free.                            */
+        DHCPc_ReqWaitTbl[ix] = (DHCPc_REQ *)0;
+    }
+
+    DHCPc_RandFnct     = (DHCPc_RAND_FNCT)0;                    /* Init rand nbr src (see Note #5).                     */
+    DHCPc_RandState    =  DHCPc_RAND_SEED_INIT;
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+    DHCPc_RouteFnct    = (DHCPc_ROUTE_FNCT)0;                   /* Init route fnct.                                     */
+#endif
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+    DHCPc_DNS_Fnct     = (DHCPc_DNS_FNCT)0;                     /* Init DNS & NTP fncts.                                */
+    DHCPc_NTP_Fnct     = (DHCPc_NTP_FNCT)0;
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+    DHCPc_TTL_Fnct     = (DHCPc_TTL_FNCT)0;                     /* Init TTL fnct.                                       */
+    DHCPc_ARP_CacheTimeoutCnt = 0u;                             /* Init ARP cache timeout cnt.                          */
+    Mem_Clr((void     *)&DHCPc_MTU_CntTbl[0],                   /* Init IF MTU cnts.                                    */
+            (CPU_SIZE_T) sizeof(DHCPc_MTU_CntTbl));
+#ifdef  NET_ARP_MODULE_EN
+                                                                /* Save ARP cache timeout cfg'd by app.                 */
+    DHCPc_ARP_CacheTimeoutPrev_sec = DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC;
+#endif
+#endif
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+    DHCPc_IPv6_PrefixFnct = (DHCPc_IPv6_PREFIX_FNCT)0;          /* Init DHCPv6 prefix fnct.                             */
+#endif
+
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)
+    DHCPc_EmulActive   = DEF_NO;                                /* Init client emulation state.                         */
+#endif
 
 
                                                                 /* ------- INIT DHCPc INFO, MSG BUF, & COMM OBJ ------- */
@@ -432,14 +895,8 @@ DHCPc_ERR  DHCPc_Init (void)
 *********************************************************************************************************
 *                                            DHCPc_Start()
 *
-* Description : (1) Start DHCP address configuration/management on specified interface :
-*
-*                   (a) Acquire  DHCPc lock
-*                   (b) Get      interface information structure
-*                   (c) Copy     requested DHCP options.
-*                   (d) Post     message to DHCP client task
-*                   (e) Release  DHCPc lock
-*
+* Description : Start DHCP address configuration/management on specified interface, using the default
+*               interface configuration.
 *
 * Argument(s) : if_nbr              Interface number to start DHCP configuration/management.
 *
@@ -449,22 +906,18 @@ DHCPc_ERR  DHCPc_Init (void)
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
+*                                                               ------ RETURNED BY DHCPc_StartExt() : ------
 *                               DHCPc_ERR_NONE                  Address DHCP negotiation successfully started.
 *                               DHCPc_ERR_NULL_PTR              Argument 'preq_param_tbl' passed a NULL pointer.
 *                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
 *                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
 *                               DHCPc_ERR_MSG_Q                 Error posting start command to message queue.
-*
-*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
 *                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
-*
-*                                                               ------- RETURNED BY DHCPc_IF_InfoGet() : -------
 *                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
 *                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_CLIENT_ID_NONE        NO hardware address & NO client identifier.
 *                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
-*
-*                                                               -------- RETURNED BY DHCPc_CommGet() : ---------
 *                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
 *
 * Return(s)   : none.
@@ -474,18 +927,7 @@ DHCPc_ERR  DHCPc_Init (void)
 *               This function is a DHCP client application programming interface (API) function &
 *               MAY be called by application function(s).
 *
-* Note(s)     : (2) DHCPc_Start() MUST be called AFTER the interface has been properly configured &
-*                   enabled.  Failure to do so could cause unknown results.
-*
-*               (3) DHCPc_Start() NOT executed until DHCP client initialization completes.
-*
-*               (4) DHCPc_Start() blocks ALL other DHCP client tasks by pending on & acquiring the
-*                   global DHCPc lock (see dhcp-c.h  Note #2').
-*
-*               (5) DHCPc_Start() execution is asynchronous--i.e. interface will NOT necessarily be
-*                   started upon return from this function.  The application SHOULD periodically call
-*                   DHCPc_ChkStatus() until the interface's DHCP management is successfully started
-*                   and configured.
+* Note(s)     : (1) See 'DHCPc_StartExt()  Note(s)'.
 *********************************************************************************************************
 */
 
@@ -494,32 +936,219 @@ void  DHCPc_Start (NET_IF_NBR       if_nbr,
                    CPU_INT08U       req_param_tbl_qty,
                    DHCPc_ERR       *perr)
 {
-#ifdef  NET_IPv4_MODULE_EN
-    CPU_BOOLEAN      if_en;
-    DHCPc_IF_INFO   *pif_info;
-    DHCPc_COMM      *pcomm;
-    DHCPc_COMM_MSG   comm_msg;
-    NET_ERR          err_net;
+    DHCPc_StartExt((NET_IF_NBR      ) if_nbr,
+                   (DHCPc_CFG_IF   *) 0,
+                   (DHCPc_OPT_CODE *) preq_param_tbl,
+                   (CPU_INT08U     ) req_param_tbl_qty,
+                   (DHCPc_ERR      *) perr);
+}
 
 
-#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
-        CPU_SW_EXCEPTION();
-    }
+/*
+*********************************************************************************************************
+*                                           DHCPc_StartExt()
+*
+* Description : Start DHCP address configuration/management on specified interface, using a specific
+*               interface configuration.
+*
+* Argument(s) : if_nbr              Interface number to start DHCP configuration/management.
+*
+*               pcfg                Pointer to interface configuration :
+*
+*                                       Pointer to interface configuration to use.
+*                                       NULL pointer, to use default interface configuration.
+*
+*               preq_param_tbl      Pointer to table of requested DHCP parameters.
+*
+*               req_param_tbl_qty   Size of requested parameter table.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               ----- RETURNED BY DHCPc_StartAsync() : -----
+*                               DHCPc_ERR_NONE                  Address DHCP negotiation successfully started.
+*                               DHCPc_ERR_NULL_PTR              Argument 'preq_param_tbl' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_INVALID_CFG           Invalid interface configuration.
+*                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
+*                               DHCPc_ERR_MSG_Q                 Error posting start command to message queue.
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_CLIENT_ID_NONE        NO hardware address & NO client identifier.
+*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Start(),
+*               Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'DHCPc_StartAsync()  Note(s)'.
+*********************************************************************************************************
+*/
 
-    if (req_param_tbl_qty > 0) {
-        if (preq_param_tbl == (DHCPc_OPT_CODE *)0) {
-           *perr = DHCPc_ERR_NULL_PTR;
-            return;
-        }
-    }
-#endif
+void  DHCPc_StartExt (NET_IF_NBR       if_nbr,
+                      DHCPc_CFG_IF    *pcfg,
+                      DHCPc_OPT_CODE  *preq_param_tbl,
+                      CPU_INT08U       req_param_tbl_qty,
+                      DHCPc_ERR       *perr)
+{
+    DHCPc_StartAsync((NET_IF_NBR      ) if_nbr,
+                     (DHCPc_CFG_IF   *) pcfg,
+                     (DHCPc_OPT_CODE *) preq_param_tbl,
+                     (CPU_INT08U     ) req_param_tbl_qty,
+                     (DHCPc_REQ      *) 0,
+                     (DHCPc_ERR      *) perr);
+}
 
-    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #3).            */
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_StartAsync()
+*
+* Description : (1) Start DHCP address configuration/management on specified interface, using a specific
+*                   interface configuration :
+*
+*                   (a) Validate interface configuration
+*                   (b) Acquire  DHCPc lock
+*                   (c) Get      interface information structure
+*                   (d) Copy     interface configuration
+*                   (e) Build    parameter request list
+*                   (f) Post     message to DHCP client task
+*                   (g) Attach   request handle
+*                   (h) Release  DHCPc lock
+*
+*
+* Argument(s) : if_nbr              Interface number to start DHCP configuration/management.
+*
+*               pcfg                Pointer to interface configuration (see Note #2) :
+*
+*                                       Pointer to interface configuration to use.
+*                                       NULL pointer, to use default interface configuration.
+*
+*               preq_param_tbl      Pointer to table of requested DHCP parameters.
+*
+*               req_param_tbl_qty   Size of requested parameter table.
+*
+*               preq                Pointer to request handle (see Note #7) :
+*
+*                                       Pointer to request handle to complete once started.
+*                                       NULL pointer, if completion NOT tracked.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Address DHCP negotiation successfully started.
+*                               DHCPc_ERR_NULL_PTR              Argument 'preq_param_tbl' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_INVALID_CFG           Invalid interface configuration.
+*                               DHCPc_ERR_REQ_IN_USE            Request handle already pending.
+*                               DHCPc_ERR_MSG_Q                 Error posting start command to message queue.
+*
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*
+*                                                               ------- RETURNED BY DHCPc_IF_InfoGet() : -------
+*                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_CLIENT_ID_NONE        NO hardware address & NO client identifier.
+*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
+*
+*                                                               ----- RETURNED BY DHCPc_ParamReqBuild() : ------
+*                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
+*
+*                                                               -------- RETURNED BY DHCPc_CommGet() : ---------
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StartExt(),
+*               Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (2) The interface configuration is copied into the interface information structure; the
+*                   application MAY re-use or free the configuration structure upon return.  The
+*                   configuration SHOULD be initialized with DHCPc_CfgIF_DfltGet() prior to modify any
+*                   of its fields.
+*
+*               (3) DHCPc_StartAsync() MUST be called AFTER the interface has been properly configured &
+*                   enabled.  Failure to do so could cause unknown results.
+*
+*               (4) DHCPc_StartAsync() NOT executed until DHCP client initialization completes.
+*
+*               (5) DHCPc_StartAsync() blocks ALL other DHCP client tasks by pending on & acquiring the
+*                   global DHCPc lock (see dhcp-c.h  Note #2').
+*
+*               (6) DHCPc_StartAsync() execution is asynchronous--i.e. interface will NOT necessarily be
+*                   started upon return from this function.  The application SHOULD either track the
+*                   request's completion (see Note #7) or periodically call DHCPc_ChkStatus() until the
+*                   interface's DHCP management is successfully started and configured.
+*
+*               (7) The request handle, if any, MUST have been initialized with DHCPc_ReqInit() & MUST NOT
+*                   be pending.  It is completed once the lease negotiation is over, with the interface's
+*                   DHCP status & the negotiation's return error code (see 'dhcp-c.h  DHCPc REQUEST DATA
+*                   TYPE  Note #2').
+*
+*               (8) Several logical clients MAY be started on the same interface, each with its own client
+*                   identifier (see 'dhcp-c.h  DHCPc INTERFACE CONFIGURATION DATA TYPE  Note #4').
+*                   DHCPc_ERR_IF_INFO_IF_USED is returned only if a client with the same client identifier
+*                   is already started on the interface.
+*
+*               (9) The address validation & the dynamic link-local address configuration rely on ARP &
+*                   are hence disabled on an interface whose hardware type is NOT Ethernet (see 'dhcp-c.h
+*                   DHCPc HARDWARE ADDRESS DEFINES  Note #2c').
+*
+*              (10) An interface whose hardware type is NOT configured MUST be an Ethernet interface (see
+*                   'DHCPc_HW_TypeSet()').
+*********************************************************************************************************
+*/
+
+void  DHCPc_StartAsync (NET_IF_NBR       if_nbr,
+                        DHCPc_CFG_IF    *pcfg,
+                        DHCPc_OPT_CODE  *preq_param_tbl,
+                        CPU_INT08U       req_param_tbl_qty,
+                        DHCPc_REQ       *preq,
+                        DHCPc_ERR       *perr)
+{
+#ifdef  NET_IPv4_MODULE_EN
+    CPU_BOOLEAN      if_en;
+    DHCPc_IF_INFO   *pif_info;
+    DHCPc_COMM      *pcomm;
+    DHCPc_COMM_MSG   comm_msg;
+    NET_ERR          err_net;
+
+
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+
+    if (req_param_tbl_qty > 0) {
+        if (preq_param_tbl == (DHCPc_OPT_CODE *)0) {
+           *perr = DHCPc_ERR_NULL_PTR;
+            return;
+        }
+    }
+#endif
+
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #4).            */
        *perr = DHCPc_ERR_INIT_INCOMPLETE;
         return;
     }
 
+    if (preq != (DHCPc_REQ *)0) {                               /* Validate req NOT pending (see Note #7).              */
+        if (preq->Pend == DEF_YES) {
+           *perr = DHCPc_ERR_REQ_IN_USE;
+            return;
+        }
+    }
+
 
     if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
     if (if_en != DEF_YES) {
@@ -527,19 +1156,78 @@ void  DHCPc_Start (NET_IF_NBR       if_nbr,
         return;
     }
 
-    if (req_param_tbl_qty > DHCPc_CFG_PARAM_REQ_TBL_SIZE) {     /* If param req qty > param req tbl, ...                */
-       *perr = DHCPc_ERR_PARAM_REQ_TBL_SIZE;                    /* ... rtn err.                                         */
+                                                                /* ------------------ VALIDATE IF CFG ----------------- */
+    if (pcfg == (DHCPc_CFG_IF *)0) {                            /* If NULL cfg, use dflt cfg (see Note #2).             */
+        pcfg = (DHCPc_CFG_IF *)&DHCPc_CfgIF_Dflt;
+    }
+
+    if ((pcfg->NegoRetryCnt     == 0u) ||                       /* Validate retry cnts.                                 */
+        (pcfg->DiscoverRetryCnt == 0u) ||
+        (pcfg->ReqRetryCnt      == 0u)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+    if ((pcfg->BackOffDlyInitial_ms == 0u) ||                   /* Validate back-off dly.                               */
+        (pcfg->BackOffDlyInitial_ms >  pcfg->BackOffDlyMax_ms)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+    if ((pcfg->RxTimeout_ms < NET_TIMEOUT_MIN_mS) ||            /* Validate rx timeout.                                 */
+        (pcfg->RxTimeout_ms > NET_TIMEOUT_MAX_mS)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+    if ((pcfg->ReqParamSys & ~DHCPc_REQ_PARAM_ALL) != 0u) {     /* Validate sys req'd param flags.                      */
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+    if ((pcfg->ParamApply & ~DHCPc_PARAM_APPLY_ALL) != 0u) {    /* Validate applied lease param flags.                  */
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+#endif
+
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    if ((pcfg->ClientID_Len != 0u) &&                           /* Validate client id len (see Note #8).                */
+       ((pcfg->ClientID_Len <  DHCP_CLIENT_ID_LEN_MIN) ||
+        (pcfg->ClientID_Len >  DHCPc_CFG_CLIENT_ID_MAX_LEN))) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+#endif
+
+#if (DHCPc_CFG_VENDOR_CLASS_MAX_LEN > 0)
+                                                                /* Validate vendor class id len.                        */
+    if (pcfg->VendorClass_Len > DHCPc_CFG_VENDOR_CLASS_MAX_LEN) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+#endif
+
+#if (DHCPc_CFG_VENDOR_INFO_MAX_LEN > 0)
+    if (pcfg->VendorInfo_Len > DHCPc_CFG_VENDOR_INFO_MAX_LEN) { /* Validate vendor info len.                            */
+       *perr = DHCPc_ERR_INVALID_CFG;
         return;
     }
+#endif
 
                                                                 /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
-    DHCPc_OS_Lock(perr);                                        /* See Note #4.                                         */
+    DHCPc_OS_Lock(perr);                                        /* See Note #5.                                         */
     if (*perr != DHCPc_OS_ERR_NONE) {
         return;
     }
 
                                                                 /* ------------------- GET IF INFO -------------------- */
-    pif_info = DHCPc_IF_InfoGet(if_nbr, perr);
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    pif_info = DHCPc_IF_InfoGet(if_nbr, &pcfg->ClientID[0], pcfg->ClientID_Len, DHCPc_FLAG_NONE, perr);
+#else
+    pif_info = DHCPc_IF_InfoGet(if_nbr, (CPU_INT08U *)0, 0u, DHCPc_FLAG_NONE, perr);
+#endif
     if (*perr != DHCPc_ERR_NONE) {
         DHCPc_OS_Unlock();
         return;
@@ -548,16 +1236,38 @@ void  DHCPc_Start (NET_IF_NBR       if_nbr,
     pif_info->ClientState = DHCP_STATE_INIT;                    /* Client in INIT state.                                */
 
 
-                                                                /* ----------------- COPY REQ DHCP OPT -----------------*/
-    Mem_Copy((void     *)&pif_info->ParamReqTbl[0],
-             (void     *) preq_param_tbl,
-             (CPU_SIZE_T) req_param_tbl_qty);
+                                                                /* ------------------- COPY IF CFG -------------------- */
+    Mem_Copy((void     *)&pif_info->Cfg,
+             (void     *) pcfg,
+             (CPU_SIZE_T) sizeof(pif_info->Cfg));
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    DHCPc_HW_TypeSet(pif_info, perr);                           /* Set hw type (see Note #10).                          */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    if (pif_info->Cfg.HW_Type != DHCP_HTYPE_ETHER) {            /* If IF NOT Ethernet, ARP NOT avail (see Note #9).     */
+        pif_info->Cfg.AddrValidateEn = DEF_DISABLED;
+        pif_info->Cfg.LocalLinkEn    = DEF_DISABLED;
+    }
+#endif
+
+                                                                /* ------------- BUILD PARAM REQ LIST ----------------- */
+    DHCPc_ParamReqBuild(pif_info, preq_param_tbl, req_param_tbl_qty, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-    pif_info->ParamReqQty = req_param_tbl_qty;
+                                                                /* --------------- BUILD TX OPT TMPL ------------------ */
+    DHCPc_TxOptTmplBuild(pif_info);
 
                                                                 /* -------------- POST MSG TO DHCP TASK --------------- */
     comm_msg = DHCPc_COMM_MSG_START;
-    pcomm    = DHCPc_CommGet(if_nbr, comm_msg, perr);
+    pcomm    = DHCPc_CommGet(pif_info, comm_msg, perr);
     if (*perr != DHCPc_ERR_NONE) {
         DHCPc_IF_InfoFree(pif_info);
         DHCPc_OS_Unlock();
@@ -574,6 +1284,11 @@ void  DHCPc_Start (NET_IF_NBR       if_nbr,
         return;
     }
 
+                                                                /* -------------------- ATTACH REQ -------------------- */
+    if (preq != (DHCPc_REQ *)0) {
+        DHCPc_ReqAttach(preq, pcomm);
+    }
+
                                                                 /* ---------------- RELEASE DHCPc LOCK ---------------- */
     DHCPc_OS_Unlock();
 
@@ -586,105 +1301,47 @@ void  DHCPc_Start (NET_IF_NBR       if_nbr,
 
 /*
 *********************************************************************************************************
-*                                            DHCPc_Stop()
-*
-* Description : (1) Stop DHCP address configuration/management on specified interface :
-*
-*                   (a) Acquire  DHCPc lock
-*                   (b) Post     message to DHCP client task
-*                   (c) Release  DHCPc lock
+*                                        DHCPc_CfgIF_DfltGet()
 *
+* Description : Get the default interface configuration.
 *
-* Argument(s) : if_nbr      Interface number to stop DHCP management.
+* Argument(s) : pcfg        Pointer to variable that will receive the default interface configuration.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  Interface DHCP configuration successfully
-*                                                                   stopped.
-*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
-*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
-*                               DHCPc_ERR_MSG_Q                 Error posting stop command to message queue.
-*
-*                                                               ------ RETURNED BY DHCPc_OS_Lock() : -------
-*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
-*
-*                                                               ------ RETURNED BY DHCPc_CommGet() : -------
-*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*                               DHCPc_ERR_NONE                  Default configuration successfully returned.
+*                               DHCPc_ERR_NULL_PTR              Argument 'pcfg' passed a NULL pointer.
 *
 * Return(s)   : none.
 *
 * Caller(s)   : Application.
 *
-*               This function is a DHCP client application programming interface (API) function & MAY be called by
-*               application function(s).
-*
-* Note(s)     : (2) DHCPc_Stop() MUST be called PRIOR to disable any interface having been configured
-*                   using DHCP.  Failure to do so could cause unknown behaviors.
-*
-*               (3) DHCPc_Stop() NOT executed until DHCP client initialization completes.
-*
-*               (4) DHCPc_Stop() blocks ALL other DHCP client tasks by pending on & acquiring the global
-*                   DHCPc lock (see dhcp-c.h  Note #2').
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
 *
-*               (5) DHCPc_Stop() execution is asynchronous--i.e. interface will NOT necessarily be
-*                   stopped upon return from this function.  The application SHOULD periodically call
-*                   DHCPc_ChkStatus() until the interface's DHCP management is successfully stopped and
-*                   un-configured.
+* Note(s)     : (1) The default interface configuration is built from the compile-time configuration
+*                   values (see 'dhcp-c.h  DHCPc INTERFACE CONFIGURATION DATA TYPE  Note #1').
 *********************************************************************************************************
 */
 
-void  DHCPc_Stop (NET_IF_NBR   if_nbr,
-                  DHCPc_ERR   *perr)
+void  DHCPc_CfgIF_DfltGet (DHCPc_CFG_IF  *pcfg,
+                           DHCPc_ERR     *perr)
 {
 #ifdef  NET_IPv4_MODULE_EN
-    DHCPc_IF_INFO   *pif_info;
-    DHCPc_COMM      *pcomm;
-    DHCPc_COMM_MSG   comm_msg;
-
-
 #if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
         CPU_SW_EXCEPTION();
     }
 #endif
 
-    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #3).            */
-       *perr = DHCPc_ERR_INIT_INCOMPLETE;
-        return;
-    }
-
-                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
-    DHCPc_OS_Lock(perr);                                        /* See Note #4.                                         */
-    if (*perr != DHCPc_OS_ERR_NONE) {
-        return;
-    }
-
-    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr);
-    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If IF NOT managed by DHCPc, ...                      */
-       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
-        DHCPc_OS_Unlock();
-        return;
-    }
-
-                                                                /* -------------- POST MSG TO DHCP TASK --------------- */
-    comm_msg = DHCPc_COMM_MSG_STOP;
-    pcomm    = DHCPc_CommGet(if_nbr, comm_msg, perr);
-    if (*perr != DHCPc_ERR_NONE) {
-        DHCPc_OS_Unlock();
+    if (pcfg == (DHCPc_CFG_IF *)0) {                            /* Validate cfg ptr.                                    */
+       *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
 
-    DHCPc_OS_MsgPost((void      *)pcomm,
-                     (DHCPc_ERR *)perr);
-    if (*perr != DHCPc_OS_ERR_NONE) {
-        *perr  = DHCPc_ERR_MSG_Q;
-         DHCPc_CommFree(pcomm);
-         DHCPc_OS_Unlock();
-         return;
-    }
-
-                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
-    DHCPc_OS_Unlock();
+    Mem_Copy((void     *) pcfg,
+             (void     *)&DHCPc_CfgIF_Dflt,
+             (CPU_SIZE_T) sizeof(DHCPc_CFG_IF));
 
    *perr = DHCPc_ERR_NONE;
 #else
@@ -695,2107 +1352,2523 @@ void  DHCPc_Stop (NET_IF_NBR   if_nbr,
 
 /*
 *********************************************************************************************************
-*                                          DHCPc_ChkStatus()
-*
-* Description : Check an interface's DHCP status & last error.
+*                                   DHCPc_CfgIF_ClientID_DUID_Set()
 *
-* Argument(s) : if_nbr      Interface number to check status.
-*
-*               perr_last   Pointer to variable that will receive the last error code for the specified
-*                           interface :
-*
-*                           DHCPc_ERR_NONE                      No error saved for this interface.
-*                           DHCPc_ERR_INIT_INCOMPLETE           DHCP client initialization NOT complete.
-*                           DHCPc_ERR_IF_NOT_MANAGED            Interface NOT managed by the DHCP client.
+* Description : Set the client identifier of an interface configuration from a DUID & an IAID.
 *
-*                           Specific initialization error code (see Note #2).
+* Argument(s) : pcfg        Pointer to interface configuration.
 *
-* Return(s)   : DHCP status for the interface :
-*
-*                   DHCP_STATUS_NONE,               NO status information available since DHCPc
-*                                                       services for this interface either :
+*               iaid        Identity Association Unique Identifier (IAID) of the client.
 *
-*                                                           NOT successfully started
-*                                                        OR     successfully stopped.
+*               pduid       Pointer to DHCP Unique Identifier (DUID) of the client.
 *
-*                   DHCP_STATUS_CFG_IN_PROGRESS,    DHCPc configuration still in progress.
+*               duid_len    Length of the DUID (in octets).
 *
-*                   DHCP_STATUS_CFGD,               DHCPc configuration successfully completed.
-*                   DHCP_STATUS_CFGD_NO_TMR,        DHCPc configuration successfully completed;
-*                                                       however, NO DHCP lease timer available.
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                   DHCP_STATUS_CFGD_LOCAL_LINK,    DHCPc failed to configure a globally-routable
-*                                                       address, but successfully configured a
-*                                                       Link-Local address.
+*                               DHCPc_ERR_NONE                  Client identifier successfully set.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) 'pcfg/pduid' passed a NULL
+*                                                                   pointer.
+*                               DHCPc_ERR_INVALID_CFG           Argument 'duid_len' invalid.
 *
-*                   DHCP_STATUS_FAIL,               DHCPc configuration failed.
+* Return(s)   : none.
 *
 * Caller(s)   : Application.
 *
-*               This function is a DHCP client application programming interface (API) function & MAY be
-*               called by application function(s).
-*
-* Note(s)     : (1) DHCPc_ChkStatus() NOT executed until DHCP client initialization completes.
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
 *
-*               (2) (a) If any DHCP error occurs, the specific error code is preserved.
+* Note(s)     : (1) The client identifier is built as defined by RFC #4361 (see 'dhcp-c.h  DHCP CLIENT
+*                   IDENTIFIER DEFINES  Note #3').  The DUID is NOT interpreted & MAY be of any DUID type.
 *
-*                   (b) DHCP error codes are listed in 'dhcp-c.h'.  A search of the specific error code
-*                       number(s) provides the corresponding error code label(s).
+*               (2) The configuration is applied when the interface is started with it (see
+*                   'DHCPc_StartExt()').  The client identifier identifies the logical client, which MUST
+*                   then be stopped with the same client identifier (see 'DHCPc_ClientStop()').
 *********************************************************************************************************
 */
 
-DHCPc_STATUS  DHCPc_ChkStatus (NET_IF_NBR   if_nbr,
-                               DHCPc_ERR   *perr_last)
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+void  DHCPc_CfgIF_ClientID_DUID_Set (DHCPc_CFG_IF  *pcfg,
+                                     CPU_INT32U     iaid,
+                                     CPU_INT08U    *pduid,
+                                     CPU_INT08U     duid_len,
+                                     DHCPc_ERR     *perr)
 {
 #ifdef  NET_IPv4_MODULE_EN
-    DHCPc_IF_INFO  *pif_info;
-    DHCPc_STATUS    status;
-    CPU_SR_ALLOC();
-
-
 #if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-    if (perr_last == DEF_NULL) {                                /* Validate perr_last ptr.                              */
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
         CPU_SW_EXCEPTION();
     }
 #endif
 
-    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #1).            */
-       *perr_last = DHCPc_ERR_INIT_INCOMPLETE;
-        return (DHCP_STATUS_NONE);
+    if ((pcfg  == (DHCPc_CFG_IF *)0) ||                         /* Validate ptrs.                                       */
+        (pduid == (CPU_INT08U   *)0)) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
     }
-
-    CPU_CRITICAL_ENTER();
-    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr);
-    if (pif_info != (DHCPc_IF_INFO *)0) {
-       *perr_last = pif_info->LastErr;
-        status    = pif_info->LeaseStatus;
-
-    } else {
-       *perr_last = DHCPc_ERR_IF_NOT_MANAGED;
-        status    = DHCP_STATUS_NONE;
+                                                                /* Validate DUID len.                                   */
+    if ((duid_len == 0u) ||
+        (duid_len >  (DHCPc_CFG_CLIENT_ID_MAX_LEN - DHCP_CLIENT_ID_DUID_OFFSET))) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
     }
-    CPU_CRITICAL_EXIT();
 
+                                                                /* ------------------ BUILD CLIENT ID ----------------- */
+    pcfg->ClientID[0] = DHCP_CLIENT_ID_TYPE_DUID;               /* See Note #1.                                         */
+    NET_UTIL_VAL_COPY_SET_NET_32(&pcfg->ClientID[1], &iaid);
+    Mem_Copy((void     *)&pcfg->ClientID[DHCP_CLIENT_ID_DUID_OFFSET],
+             (void     *) pduid,
+             (CPU_SIZE_T) duid_len);
+    pcfg->ClientID_Len = DHCP_CLIENT_ID_DUID_OFFSET + duid_len;
 
-    return (status);
+   *perr = DHCPc_ERR_NONE;
 #else
-   *perr_last = DHCPc_ERR_IPv4_NOT_PRESENT;
-    return (DHCP_STATUS_FAIL);
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
 #endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                          DHCPc_GetOptVal()
-*
-* Description : (1) Get the value of a specific DHCP option for a given interface :
-*
-*                   (a) Acquire DHCPc lock
-*                   (b) Get interface information structure
-*                   (c) Retrieve specific option's value
-*                   (d) Release DHCPc lock
-*
-*
-* Argument(s) : if_nbr          Interface number to get option value.
-*
-*               opt_code        Option code      to get value.
+*                                    DHCPc_CfgIF_VendorClassSet()
 *
-*               pval_buf        Pointer to buffer that will receive the option value.
+* Description : Set the vendor class identifier of an interface configuration.
 *
-*               pval_buf_len    Pointer to a variable to ... :
+* Argument(s) : pcfg                Pointer to interface configuration.
 *
-*                                   (a) Pass the size of the buffer, in octets, pointed to by 'pval_buf'.
-*                                   (b) (1) Return the actual length of the option, if NO errors;
-*                                       (2) Return an undefined value,              otherwise.
+*               pvendor_class       Pointer to vendor class identifier.
 *
-*                               See also Note #4.
+*               vendor_class_len    Length of the vendor class identifier (in octets), 0 to send NO
+*                                       vendor class identifier.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  Option value successfully returned.
-*                               DHCPc_ERR_NULL_PTR              Argument 'pval_buf/pval_buf_len' passed a NULL
-*                                                                   pointer.
-*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
-*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
-*                               DHCPc_ERR_IF_NOT_CFG            Interface NOT yet configured by the DHCP client.
-*                               DHCPc_ERR_IF_OPT_NONE           Option NOT present.
-*                               DHCPc_ERR_OPT_BUF_SIZE          Option value buffer size too small.
-*
-*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
-*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*                               DHCPc_ERR_NONE                  Vendor class identifier successfully set.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) 'pcfg/pvendor_class' passed a
+*                                                                   NULL pointer.
+*                               DHCPc_ERR_INVALID_CFG           Argument 'vendor_class_len' invalid.
 *
 * Return(s)   : none.
 *
 * Caller(s)   : Application.
 *
-*               This function is a DHCP client application programming interface (API) function & MAY be
-*               called by application function(s).
-*
-* Note(s)     : (2) DHCPc_ChkStatus() NOT executed until DHCP client initialization completes.
-*
-*               (3) DHCPc_Stop() blocks ALL other DHCP client tasks by pending on & acquiring the global
-*                   DHCPc lock (see dhcp-c.h  Note #2').
-*
-*               (4) Since 'pval_buf_len' parameter is both an input & output parameter
-*                   (see 'Argument(s) : pval_buf_len'), ... :
-*
-*                   (a) Its input value SHOULD be validated prior to use; ...
-*
-*                       (1) In the case that the 'pval_buf_len' parameter is passed a null pointer,
-*                           NO input value is validated or used.
-*
-*                       (2) The length of the option value buffer MUST be greater than or equal to the
-*                           length of the actual option value requested.
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
 *
-*                   (b) While its output value MUST be initially configured to return a default value
-*                       PRIOR to all other validation or function handling in case of any error(s).
+* Note(s)     : (1) The configuration is applied when the interface is started with it (see
+*                   'DHCPc_StartExt()').
 *********************************************************************************************************
 */
 
-void  DHCPc_GetOptVal (NET_IF_NBR       if_nbr,
-                       DHCPc_OPT_CODE   opt_code,
-                       CPU_INT08U      *pval_buf,
-                       CPU_INT16U      *pval_buf_len,
-                       DHCPc_ERR       *perr)
+#if (DHCPc_CFG_VENDOR_CLASS_MAX_LEN > 0)
+void  DHCPc_CfgIF_VendorClassSet (DHCPc_CFG_IF  *pcfg,
+                                  CPU_INT08U    *pvendor_class,
+                                  CPU_INT08U     vendor_class_len,
+                                  DHCPc_ERR     *perr)
 {
 #ifdef  NET_IPv4_MODULE_EN
-    DHCPc_IF_INFO  *pif_info;
-    DHCPc_MSG      *pmsg;
-    CPU_INT08U     *popt_val;
-    CPU_INT08U      opt_val_len;
-
-
-                                                                /* -------------- VALIDATE BUF & BUF LEN -------------- */
 #if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
         CPU_SW_EXCEPTION();
     }
+#endif
 
-    if ((pval_buf     == (CPU_INT08U *)0) ||
-        (pval_buf_len == (CPU_INT16U *)0)) {
+    if (pcfg == (DHCPc_CFG_IF *)0) {                            /* Validate cfg ptr.                                    */
        *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
-#endif
 
-    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #2).            */
-       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+    if (vendor_class_len > DHCPc_CFG_VENDOR_CLASS_MAX_LEN) {    /* Validate vendor class id len.                        */
+       *perr = DHCPc_ERR_INVALID_CFG;
         return;
     }
 
-                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
-    DHCPc_OS_Lock(perr);                                        /* See Note #3.                                         */
-    if (*perr != DHCPc_OS_ERR_NONE) {
+    if ((vendor_class_len >= DHCP_VENDOR_CLASS_LEN_MIN) &&      /* Validate vendor class id ptr.                        */
+        (pvendor_class    == (CPU_INT08U *)0)) {
+       *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
 
-    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr);
-    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If IF NOT managed by DHCPc, ...                      */
-       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
-        DHCPc_OS_Unlock();
-        return;
-    }
+    Mem_Copy((void     *)&pcfg->VendorClass[0],
+             (void     *) pvendor_class,
+             (CPU_SIZE_T) vendor_class_len);
+    pcfg->VendorClass_Len = vendor_class_len;
 
-    if (pif_info->LeaseStatus != DHCP_STATUS_CFGD) {            /* If IF NOT cfg'd, ...                                 */
-       *perr = DHCPc_ERR_IF_NOT_CFG;                            /* ... rtn err.                                         */
-        DHCPc_OS_Unlock();
-        return;
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     DHCPc_CfgIF_VendorInfoSet()
+*
+* Description : Set the vendor-specific information of an interface configuration.
+*
+* Argument(s) : pcfg                Pointer to interface configuration.
+*
+*               pvendor_info        Pointer to vendor-specific information (see Note #1).
+*
+*               vendor_info_len     Length of the vendor-specific information (in octets), 0 to send NO
+*                                       vendor-specific information.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Vendor-specific information successfully set.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) 'pcfg/pvendor_info' passed a
+*                                                                   NULL pointer.
+*                               DHCPc_ERR_INVALID_CFG           Argument 'vendor_info_len' invalid.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) The vendor-specific information is sent as is; it is usually encoded as a list of
+*                   code/length/value encapsulated vendor-specific options (see RFC #2132, section 'Vendor
+*                   Specific Information').
+*
+*               (2) The configuration is applied when the interface is started with it (see
+*                   'DHCPc_StartExt()').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_VENDOR_INFO_MAX_LEN > 0)
+void  DHCPc_CfgIF_VendorInfoSet (DHCPc_CFG_IF  *pcfg,
+                                 CPU_INT08U    *pvendor_info,
+                                 CPU_INT08U     vendor_info_len,
+                                 DHCPc_ERR     *perr)
+{
+#ifdef  NET_IPv4_MODULE_EN
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
     }
+#endif
 
-    pmsg = pif_info->MsgPtr;
-    if (pmsg == (DHCPc_MSG *)0) {                               /* If NO DHCP msg for IF, ...                           */
-       *perr = DHCPc_ERR_IF_NOT_CFG;                            /* ... rtn err.                                         */
-        DHCPc_OS_Unlock();
+    if (pcfg == (DHCPc_CFG_IF *)0) {                            /* Validate cfg ptr.                                    */
+       *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
 
-                                                                /* ------------------- GET OPT VAL -------------------- */
-    popt_val = DHCPc_MsgGetOpt( opt_code,
-                               &pmsg->MsgBuf[0],
-                                pmsg->MsgLen,
-                               &opt_val_len);
-
-    if (popt_val == (CPU_INT08U *)0) {                          /* If NO opt val rtn'd, ...                             */
-       *perr = DHCPc_ERR_IF_OPT_NONE;                           /* ... rtn err.                                         */
-        DHCPc_OS_Unlock();
+    if (vendor_info_len > DHCPc_CFG_VENDOR_INFO_MAX_LEN) {      /* Validate vendor info len.                            */
+       *perr = DHCPc_ERR_INVALID_CFG;
         return;
     }
 
-    if (opt_val_len > *pval_buf_len) {                          /* If opt val larger than val buf, ....                 */
-       *perr = DHCPc_ERR_OPT_BUF_SIZE;                          /* ... rtn err.                                         */
-        DHCPc_OS_Unlock();
+    if ((vendor_info_len >= DHCP_VENDOR_INFO_LEN_MIN) &&        /* Validate vendor info ptr.                            */
+        (pvendor_info    == (CPU_INT08U *)0)) {
+       *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
 
-    Mem_Copy((void     *)pval_buf,                              /* Copy opt val into val buf ..                         */
-             (void     *)popt_val,
-             (CPU_SIZE_T)opt_val_len);
-
-   *pval_buf_len = opt_val_len;                                 /* .. & set opt val len.                                */
-
-                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
-    DHCPc_OS_Unlock();
+    Mem_Copy((void     *)&pcfg->VendorInfo[0],
+             (void     *) pvendor_info,
+             (CPU_SIZE_T) vendor_info_len);
+    pcfg->VendorInfo_Len = vendor_info_len;
 
    *perr = DHCPc_ERR_NONE;
 #else
    *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
 #endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                         DHCPc_TaskHandler()
+*                                         DHCPc_RandFnctSet()
 *
-* Description : (1) Handle lease management :
+* Description : Configure the random number function used by the DHCP client.
 *
-*                   (a) Wait for message from DHCP client timer
-*                   (b) Acquire  DHCPc lock
-*                   (c) Handle   received message
-*                   (d) Release  DHCPc lock
+* Argument(s) : rand_fnct   Pointer to random number function (see Note #1), or NULL pointer to use the
+*                               DHCP client's pseudo-random number generator.
 *
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-* Argument(s) : none.
+*                               DHCPc_ERR_NONE                  Random number function successfully
+*                                                                   configured.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_OS_Task().
+* Caller(s)   : Application.
 *
-*               This function is a DHCP client to operating system (OS) function & SHOULD be called only
-*               by appropriate DHCPc-operating system port function(s).
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
 *
-* Note(s)     : (2) DHCPc_TaskHandler() blocked until DHCP client initialization completes.
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc RANDOM NUMBER FUNCTION DATA TYPE  Note(s)'.
 *
-*               (3) DHCPc_TaskHandler() blocks ALL other DHCP client tasks by pending on & acquiring
-*                   the global DHCPc lock (see dhcp-c.h  Note #2').
+*               (2) The random number function SHOULD be configured before any DHCP client is started
+*                   so that the first transaction ID of every interface is obtained from it.
 *********************************************************************************************************
 */
 
-void  DHCPc_TaskHandler (void)
+void  DHCPc_RandFnctSet (DHCPc_RAND_FNCT   rand_fnct,
+                         DHCPc_ERR        *perr)
 {
 #ifdef  NET_IPv4_MODULE_EN
-    void       *pmsg;
-    DHCPc_ERR   err;
+    CPU_SR_ALLOC();
 
 
-    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, ...                            */
-        DHCPc_OS_InitWait(&err);                                /* ... wait on DHCPc init (see Note #2).                */
-        if (err != DHCPc_OS_ERR_NONE) {
-            return;
-        }
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
     }
+#endif
 
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
 
-    while (DEF_ON) {
-                                                                /* ------------------- WAIT FOR MSG ------------------- */
-        do {
-            pmsg = DHCPc_OS_MsgWait(&err);
-        } while ((err  !=  DHCPc_OS_ERR_NONE) &&
-                 (pmsg != (void *)0));
-
-                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
-        DHCPc_OS_Lock(&err);                                    /* See Note #3.                                         */
-        if (err != DHCPc_OS_ERR_NONE) {
-            continue;
-        }
-
-                                                                /* -------------------- HANDLE MSG -------------------- */
-        DHCPc_MsgRxHandler((DHCPc_COMM *)pmsg);
+    CPU_CRITICAL_ENTER();
+    DHCPc_RandFnct = rand_fnct;
+    CPU_CRITICAL_EXIT();
 
-                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
-        DHCPc_OS_Unlock();
-    }
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
 #endif
 }
 
 
 /*
 *********************************************************************************************************
-*                                       DHCPc_TmrTaskHandler()
-*
-* Description : (1) Handle DHCP timers in the DHCPc Timer List :
-*
-*                   (a) Wait for signal from the DHCPc timer
-*
-*                   (b) Acquire DHCPc lock (see Note #2)
+*                                        DHCPc_RouteFnctSet()
 *
-*                   (c) Handle every  DHCPc timer in Timer List :
-*                       (1) Decrement DHCPc timer(s)
-*                       (2) For any timer that expires (see Note #3) :
-*                           (A) Free from Timer List
-*                           (B) Get  current time
-*                           (C) Post message to DHCPc Task
+* Description : Configure the route function used to install the routes of the DHCP clients into the IP stack.
 *
-*                   (d) Release DHCPc lock
+* Argument(s) : route_fnct  Pointer to route function (see Note #1), or NULL pointer to NOT install routes.
 *
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-* Argument(s) : none.
+*                               DHCPc_ERR_NONE                  Route function successfully configured.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_OS_TmrTask() [see 'dhcp-c_os.c'].
-*
-*               This function is a DHCP client to operating system (OS) function & SHOULD be called only
-*               by appropriate DHCPc-operating system port function(s).
-*
-* Note(s)     : (2) DHCPc_TaskHandler() blocked until DHCP client initialization completes.
+* Caller(s)   : Application.
 *
-*               (3) DHCPc_TmrTaskHandler() blocks ALL other DHCP client tasks by pending on & acquiring
-*                   the global DHCPc lock (see dhcp-c.h  Note #2').
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
 *
-*               (4) Since the DHCPc task executes asynchronously from the timer task handler, the
-*                   current time is kept into the interface information structure to prevent lease time
-*                   drifting.
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc ROUTE DATA TYPE  Note #2'.
 *
-*               (5) When a DHCP timer expires, the timer SHOULD be freed PRIOR to executing the timer
-*                   expiration function.  This ensures that at least one timer is available if the timer
-*                   expiration function requires a timer.
+*               (2) The route function SHOULD be configured before any DHCP client is started.  The routes
+*                   of a lease accepted while NO route function is configured are NOT installed.
 *********************************************************************************************************
 */
 
-void  DHCPc_TmrTaskHandler (void)
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+void  DHCPc_RouteFnctSet (DHCPc_ROUTE_FNCT   route_fnct,
+                          DHCPc_ERR         *perr)
 {
 #ifdef  NET_IPv4_MODULE_EN
-    DHCPc_TMR      *ptmr;
-    DHCPc_TMR      *ptmr_next;
-    DHCPc_COMM     *pcomm;
-    DHCPc_IF_INFO  *pif_info;
-    DHCPc_ERR       err;
+    CPU_SR_ALLOC();
 
 
-    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, ...                            */
-        DHCPc_OS_InitWait(&err);                                /* ... wait on DHCPc init (see Note #2).                */
-        if (err != DHCPc_OS_ERR_NONE) {
-            return;
-        }
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
     }
+#endif
 
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
 
-    while (DEF_ON) {
-                                                                /* ----------------- WAIT TMR SIGNAL ------------------ */
-        do {
-            DHCPc_OS_TmrWait(&err);
-        } while (err != DHCPc_OS_ERR_NONE);
-
+    CPU_CRITICAL_ENTER();
+    DHCPc_RouteFnct = route_fnct;
+    CPU_CRITICAL_EXIT();
 
-                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
-        DHCPc_OS_Lock(&err);                                    /* See Note #3.                                         */
-        if (err != DHCPc_OS_ERR_NONE) {
-            continue;
-        }
-
-                                                                /* --------------- HANDLE TMR TASK LIST --------------- */
-        ptmr = DHCPc_TmrListHead;                               /* Start @ Tmr List head.                               */
-        while (ptmr != (DHCPc_TMR *)0) {                        /* Handle  Tmr List tmrs.                               */
-
-            ptmr_next = ptmr->NextPtr;                          /* Set next tmr to update.                              */
-
-            if (ptmr->TmrVal > 1) {                             /* If tmr val > 1, dec tmr val.                         */
-                ptmr->TmrVal--;
-
-            } else {                                            /* Else tmr expired,              ...                   */
-
-                pcomm    = (DHCPc_COMM *)ptmr->Obj;             /* ... get obj                    ...                   */
-
-                pif_info = DHCPc_IF_InfoGetCfgd(pcomm->IF_Nbr); /* ... get if info                ...                   */
-                if (pif_info != ((DHCPc_IF_INFO *)0)) {
-                                                                /* ... get cur time (see Note #4) ...                   */
-                    pif_info->TmrExpirationTime = DHCPc_OS_TimeGet_tick();
-                }
-
-                DHCPc_TmrFree(ptmr);                            /* ... free tmr     (see Note #5) ...                   */
-                pif_info->Tmr = (DHCPc_TMR *)0;                 /* Prevents a double-free of the timer.                 */
-
-                DHCPc_OS_MsgPost((void      *) pcomm,           /* ... & post obj to DHCP client task.                  */
-                                 (DHCPc_ERR *)&err);
-            }
-
-            ptmr = ptmr_next;
-        }
-
-                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
-        DHCPc_OS_Unlock();
-    }
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
 #endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-#ifdef  NET_IPv4_MODULE_EN
-
-/*
-*********************************************************************************************************
-*                                         DHCPc_IF_InfoInit()
+*                                       DHCPc_RouteNextHopGet()
 *
-* Description : (1) Initialize DHCPc interface information :
+* Description : Get the next-hop to a destination from the routes of an interface's DHCP clients.
 *
-*                   (a) Initialize interface information pool
-*                   (b) Initialize interface information table
-*                   (c) Initialize interface information list pointer
+* Argument(s) : if_nbr      Interface number to get the next-hop on.
 *
+*               addr_dest   Destination address, in host order.
 *
-* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  DHCPc interface information successfully
-*                                                                   initialized.
+*                               DHCPc_ERR_NONE                  Next-hop successfully returned.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_ERR_ROUTE_NONE            NO route to the destination.
 *
-* Return(s)   : none.
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
 *
-* Caller(s)   : DHCPc_Init().
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : --------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
 *
-*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
-*               function(s).
+* Return(s)   : Next-hop address (in host order), if NO errors (see Note #3).
 *
-* Note(s)     : (2) Interface inforation pool MUST be initialized PRIOR to initializing the pool with
-*                   pointers to interface information.
+*               NET_IPv4_ADDR_NONE,                otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) The clients of the interface are found directly from the interface number (see 'dhcp-c.h
+*                   DHCPc INTERFACE INFORMATION DATA TYPE  Note #5'), without searching the interface
+*                   information list.
+*
+*               (2) The routes of each client are sorted by decreasing prefix length (see 'dhcp-c.h  DHCPc
+*                   INTERFACE INFORMATION DATA TYPE  Note #9') : the search of a client's routes stops at
+*                   its first matching route.  The most specific route of all the interface's clients is
+*                   returned.
+*
+*               (3) The destination address itself is returned for a destination on the interface's link
+*                   (see 'dhcp-c.h  DHCPc ROUTE DATA TYPE  Note #1').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_IF_InfoInit (DHCPc_ERR  *perr)
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+NET_IPv4_ADDR  DHCPc_RouteNextHopGet (NET_IF_NBR      if_nbr,
+                                      NET_IPv4_ADDR   addr_dest,
+                                      DHCPc_ERR      *perr)
 {
-    DHCPc_IF_INFO      *pif_info;
-    DHCPc_IF_INFO_QTY   i;
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO  *pif_info;
+    DHCPc_ROUTE    *proute;
+    NET_IPv4_ADDR   addr_next_hop;
+    NET_IPv4_ADDR   addr_mask;
+    CPU_BOOLEAN     route_found;
+    CPU_BOOLEAN     route_match;
+    CPU_INT08U      ix;
 
-                                                                /* ---------------- INIT IF INFO POOL ----------------- */
-    DHCPc_InfoPoolPtr = (DHCPc_IF_INFO *)0;                     /* Init-clr DHCPc IF info pool (see Note #2).           */
 
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+#endif
 
-                                                                /* ----------------- INIT IF INFO TBL ----------------- */
-    pif_info = &DHCPc_InfoTbl[0];
-    for (i = 0; i < DHCPc_NBR_IF_INFO; i++) {
-        pif_info->ID       = (DHCPc_IF_INFO_QTY)i;
-        pif_info->Flags    =  DHCPc_FLAG_NONE;                  /* Init each IF info as NOT used.                       */
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return (NET_IPv4_ADDR_NONE);
+    }
 
-#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-        DHCPc_IF_InfoClr(pif_info);
-#endif
+    if (if_nbr >= NET_IF_NBR_IF_TOT) {                          /* Validate IF nbr.                                     */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;
+        return (NET_IPv4_ADDR_NONE);
+    }
 
-        pif_info->NextPtr  =  DHCPc_InfoPoolPtr;                /* Free each IF info to info pool (see Note #2).        */
-        DHCPc_InfoPoolPtr  =  pif_info;
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return (NET_IPv4_ADDR_NONE);
+    }
 
-        pif_info++;
+    pif_info = DHCPc_InfoIF_Tbl[if_nbr];                        /* See Note #1.                                         */
+    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If IF NOT managed by DHCPc, ...                      */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return (NET_IPv4_ADDR_NONE);
     }
 
-                                                                /* ---------------- INIT INFO LIST PTR ---------------- */
-    DHCPc_InfoListHead = (DHCPc_IF_INFO *)0;
+                                                                /* ------------------- SRCH ROUTES -------------------- */
+    addr_next_hop = NET_IPv4_ADDR_NONE;
+    addr_mask     = NET_IPv4_ADDR_NONE;
+    route_found   = DEF_NO;
+
+    while (pif_info != (DHCPc_IF_INFO *)0) {
+        DHCPc_OS_IF_Lock(pif_info->ID, perr);
+        if (*perr != DHCPc_OS_ERR_NONE) {
+            DHCPc_OS_Unlock();
+            return (NET_IPv4_ADDR_NONE);
+        }
+
+        ix          = 0u;
+        route_match = DEF_NO;
+        while ((ix          <  pif_info->RouteQty) &&           /* Srch client's first matching route (see Note #2).    */
+               (route_match != DEF_YES)) {
+            proute = &pif_info->RouteTbl[ix];
+            if ((addr_dest & proute->AddrMask) == proute->AddrDest) {
+                route_match = DEF_YES;
+                                                                /* Keep most specific route of all clients.             */
+                if ((route_found      != DEF_YES) ||
+                    (proute->AddrMask >  addr_mask)) {
+                    route_found   = DEF_YES;
+                    addr_mask     = proute->AddrMask;
+                    addr_next_hop = proute->AddrNextHop;
+                }
+            }
+            ix++;
+        }
+
+        DHCPc_OS_IF_Unlock(pif_info->ID);
+
+        pif_info = pif_info->IF_NextPtr;
+    }
+
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+    DHCPc_OS_Unlock();
+
+    if (route_found != DEF_YES) {                               /* If NO route found, ...                               */
+       *perr = DHCPc_ERR_ROUTE_NONE;                            /* ... rtn err.                                         */
+        return (NET_IPv4_ADDR_NONE);
+    }
 
+    if (addr_next_hop == NET_IPv4_ADDR_NONE) {                  /* If dest on link, rtn dest (see Note #3).             */
+        addr_next_hop = addr_dest;
+    }
 
    *perr = DHCPc_ERR_NONE;
+
+    return (addr_next_hop);
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+
+    return (0u);
+#endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                         DHCPc_IF_InfoGet()
-*
-* Description : (1) Allocate & initialize a DHCPc interface information :
+*                                         DHCPc_SrvFnctSet()
 *
-*                   (a) Validate interface NOT attributed (see Note #2).
-*                   (b) Generate base transaction identifier
-*                   (c) Get        interface information
-*                   (d) Initialize interface information
-*                   (e) Insert     interface information at head of interface information list
-*                   (f) Return pointer to interface information
-*                         OR
-*                       Null pointer & error code, on failure
+* Description : Configure the functions the domain name servers & the NTP servers of the DHCP clients are
+*               pushed to.
 *
+* Argument(s) : dns_fnct    Pointer to DNS function (see Note #1), or NULL pointer to NOT push the domain
+*                               name servers.
 *
-* Argument(s) : if_nbr      Interface number to get the interface information structure.
-*               ------      Argument validated in DHCPc_Start().
+*               ntp_fnct    Pointer to NTP function (see Note #1), or NULL pointer to NOT push the NTP
+*                               servers.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  Interface information successfully allocated
-*                                                                   & initialized.
-*                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
-*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
-*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
-*
-* Return(s)   : Pointer to interface information, if NO errors.
-*
-*               Pointer to NULL,                  otherwise.
+*                               DHCPc_ERR_NONE                  Server functions successfully configured.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *
-* Caller(s)   : DHCPc_Start().
+* Return(s)   : none.
 *
-* Note(s)     : (2) Only one interface information may exist for a given interface number.
+* Caller(s)   : Application.
 *
-*               (3) #### This implementation of the DHCP client presumes an Ethernet hardware type.
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
 *
-*               (4) The transaction ID (xid) it generated by taking the 3 least significant bytes of
-*                   the hardware address, left-shifted by one octet.
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc SERVER FUNCTION DATA TYPE  Note #2'.
 *
-*               (5) The use of critical section is necessary to protect the data in the interface
-*                   information structures, since the function DHCPc_ChkStatus() does NOT get the DHCPc
-*                   lock when it access them.
+*               (2) The server functions SHOULD be configured before any DHCP client is started.  The
+*                   servers of a lease already bound are ONLY pushed once they change.
 *********************************************************************************************************
 */
 
-static  DHCPc_IF_INFO  *DHCPc_IF_InfoGet (NET_IF_NBR   if_nbr,
-                                          DHCPc_ERR   *perr)
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+void  DHCPc_SrvFnctSet (DHCPc_DNS_FNCT   dns_fnct,
+                        DHCPc_NTP_FNCT   ntp_fnct,
+                        DHCPc_ERR       *perr)
 {
-    DHCPc_IF_INFO  *pif_info;
-    CPU_INT08U      addr_hw_len;
-    CPU_INT08U      addr_hw[NET_IF_ETHER_ADDR_SIZE];
-    CPU_INT32U      transaction_id_base;
-    NET_ERR         err_net;
+#ifdef  NET_IPv4_MODULE_EN
     CPU_SR_ALLOC();
 
 
-                                                                /* --------------- VALIDATE IF NBR USED --------------- */
-    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr);
-    if (pif_info != ((DHCPc_IF_INFO *)0)) {                     /* If if nbr already has if info, ...                   */
-       *perr = DHCPc_ERR_IF_INFO_IF_USED;                       /* ... rtn err (see Note #2).                           */
-        return ((DHCPc_IF_INFO *)0);
-    }
-
-                                                                /* ---------- GENERATE TRANSACTION BASE NBR ----------- */
-    addr_hw_len = NET_IF_ETHER_ADDR_SIZE;                       /* See Note #3.                                         */
-    NetIF_AddrHW_Get(if_nbr,
-                    &addr_hw[0],
-                    &addr_hw_len,
-                    &err_net);
-
-    if ((err_net     != NET_IF_ERR_NONE) ||
-        (addr_hw_len != NET_IF_ETHER_ADDR_SIZE)) {
-       *perr = DHCPc_ERR_INVALID_HW_ADDR;
-        return ((DHCPc_IF_INFO *)0);
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
     }
+#endif
 
-                                                                /* Generate base transaction ID (see Note #4).          */
-    transaction_id_base = ((((CPU_INT32U)addr_hw[3]) << (3 * DEF_OCTET_NBR_BITS)) +
-                           (((CPU_INT32U)addr_hw[4]) << (2 * DEF_OCTET_NBR_BITS)) +
-                           (((CPU_INT32U)addr_hw[5]) << (1 * DEF_OCTET_NBR_BITS)));
-
-
-                                                                /* ------------------- GET IF INFO -------------------- */
-    if (DHCPc_InfoPoolPtr != (DHCPc_IF_INFO *)0) {              /* If if info pool NOT empty, get if info from pool.    */
-        pif_info           = (DHCPc_IF_INFO *)DHCPc_InfoPoolPtr;
-        DHCPc_InfoPoolPtr  = (DHCPc_IF_INFO *)pif_info->NextPtr;
-
-    } else {                                                    /* If none avail, rtn err.                              */
-       *perr = DHCPc_ERR_IF_INFO_NONE_AVAIL;
-        return ((DHCPc_IF_INFO *)0);
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
     }
 
-                                                                /* ------------------- INIT IF INFO ------------------- */
-    DHCPc_IF_InfoClr(pif_info);
-    pif_info->PrevPtr       = (DHCPc_IF_INFO *)0;
-    pif_info->NextPtr       = (DHCPc_IF_INFO *)DHCPc_InfoListHead;
-    pif_info->IF_Nbr        =  if_nbr;
-    pif_info->LeaseStatus   =  DHCP_STATUS_CFG_IN_PROGRESS;
-    pif_info->TransactionID =  transaction_id_base;
-    DEF_BIT_SET(pif_info->Flags, DHCPc_FLAG_USED);              /* Set if info as used.                                 */
-
-                                                                /* --------- INSERT IF INFO INTO IF INFO LIST --------- */
-    CPU_CRITICAL_ENTER();                                       /* See Note #5.                                         */
-    if (DHCPc_InfoListHead != (DHCPc_IF_INFO *)0) {             /* If list NOT empty, insert before head.               */
-        DHCPc_InfoListHead->PrevPtr = pif_info;
-    }
-    DHCPc_InfoListHead = pif_info;                              /* Insert if info @ list head.                          */
+    CPU_CRITICAL_ENTER();
+    DHCPc_DNS_Fnct = dns_fnct;
+    DHCPc_NTP_Fnct = ntp_fnct;
     CPU_CRITICAL_EXIT();
 
-
-   *perr =  DHCPc_ERR_NONE;
-
-    return (pif_info);
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                       DHCPc_IF_InfoGetCfgd()
+*                                         DHCPc_TTL_FnctSet()
 *
-* Description : Get interface information structure for configured interface.
+* Description : Configure the function the default IP & TCP TTLs of the DHCP clients are applied with.
 *
-* Argument(s) : if_nbr      Interface number to get the interface information structure.
+* Argument(s) : ttl_fnct    Pointer to TTL function (see Note #1), or NULL pointer to NOT apply the TTLs.
 *
-* Return(s)   : Pointer to interface information structure, if interface configured with DHCP.
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-*               Pointer to NULL,                            otherwise.
+*                               DHCPc_ERR_NONE                  TTL function successfully configured.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *
-* Caller(s)   : DHCPc_Stop(),
-*               DHCPc_ChkStatus(),
-*               DHCPc_TmrTaskHandler(),
-*               DHCPc_MsgRxHandler(),
-*               DHCPc_IF_InfoGet().
+* Return(s)   : none.
 *
-* Note(s)     : none.
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc TTL FUNCTION DATA TYPE'.
 *********************************************************************************************************
 */
 
-static  DHCPc_IF_INFO  *DHCPc_IF_InfoGetCfgd (NET_IF_NBR  if_nbr)
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+void  DHCPc_TTL_FnctSet (DHCPc_TTL_FNCT   ttl_fnct,
+                         DHCPc_ERR       *perr)
 {
-    DHCPc_IF_INFO  *pif_info;
-    CPU_BOOLEAN     if_cfgd;
-
-
-    pif_info = DHCPc_InfoListHead;
-    if_cfgd  = DEF_NO;
+#ifdef  NET_IPv4_MODULE_EN
+    CPU_SR_ALLOC();
 
-    while ((pif_info != (DHCPc_IF_INFO *)0) &&
-           (if_cfgd  !=  DEF_YES)) {
-        if (pif_info->IF_Nbr == if_nbr) {
-            if_cfgd = DEF_YES;
 
-        } else {
-            pif_info = pif_info->NextPtr;
-        }
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
     }
+#endif
 
-    if (if_cfgd != DEF_YES) {                                   /* If IF nbr NOT cfg'd, ...                             */
-        return ((DHCPc_IF_INFO *)0);                            /* ... rtn NULL ptr.                                    */
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
     }
 
-    return (pif_info);                                          /* Else, rth ptr to IF info struct for cfg'd IF.        */
+    CPU_CRITICAL_ENTER();
+    DHCPc_TTL_Fnct = ttl_fnct;
+    CPU_CRITICAL_EXIT();
+
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                         DHCPc_IF_InfoFree()
+*                                            DHCPc_Stop()
 *
-* Description : (1) Free a DHCPc inteface information :
+* Description : Stop DHCP address configuration/management on specified interface.
 *
-*                   (a) Remove interface information from    interface information list
-*                   (b) Clear  interface information controls
-*                   (c) Free   interface information back to interface information pool
+* Argument(s) : if_nbr      Interface number to stop DHCP management.
 *
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-* Argument(s) : pif_info    Pointer to a DHCPc interface information.
+*                                                               ----- RETURNED BY DHCPc_StopAsync() : ------
+*                               DHCPc_ERR_NONE                  Interface DHCP configuration successfully
+*                                                                   stopped.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_ERR_MSG_Q                 Error posting stop command to message queue.
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_Start(),
-*               DHCPc_StopStateHandler().
+* Caller(s)   : Application.
 *
-*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               This function is a DHCP client application programming interface (API) function & MAY be called by
 *               application function(s).
 *
-* Note(s)     : (2) #### To prevent freeing an interface information already freed via previous interface
-*                   information free, DHCPc_IF_InfoFree() checks the interface information's 'USED' flag
-*                   BEFORE freeing the interface information.
-*
-*                   This prevention is only best-effort since any invalid duplicate interface information
-*                   frees MAY be asynchronous to potentially valid interface information gets.  Thus the
-*                   invalid interface information free(s) MAY corrupt the interface information's valid
-*                   operation(s).
-*
-*                   However, since the primary tasks of the DHCP client are prevented from running
-*                   concurrently (see 'dhcp-c.h  Note #2'), it is NOT necessary to protect DHCPc
-*                   interface information resources from possible corruption since no asynchronous access
-*                   from other task is possible.
+* Note(s)     : (1) See 'DHCPc_StopAsync()  Note(s)'.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_IF_InfoFree (DHCPc_IF_INFO  *pif_info)
+void  DHCPc_Stop (NET_IF_NBR   if_nbr,
+                  DHCPc_ERR   *perr)
 {
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    CPU_BOOLEAN     used;
-#endif
-    DHCPc_IF_INFO  *pprev;
-    DHCPc_IF_INFO  *pnext;
-    CPU_SR_ALLOC();
-
-
-                                                                /* ------------------ VALIDATE PTR -------------------- */
-    if (pif_info == (DHCPc_IF_INFO *)0) {
-        return;
-    }
-
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-                                                                /* -------------- VALIDATE IF INFO USED --------------- */
-    used = DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_USED);
-    if (used != DEF_YES) {                                      /* If IF info NOT used, ...                             */
-        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
-    }
-#endif
-
-                                                                /* --------- REMOVE IF INFO FROM IF INFO LIST --------- */
-    CPU_CRITICAL_ENTER();                                       /* See 'DHCPc_IF_InfoGet()  Note #5'.                   */
-    pprev = pif_info->PrevPtr;
-    pnext = pif_info->NextPtr;
-    if (pprev != (DHCPc_IF_INFO *)0) {                          /* If pif_info is NOT   the head of IF info list, ...   */
-        pprev->NextPtr    = pnext;                              /* ... set pprev's NextPtr to skip pif_info.            */
-    } else {                                                    /* Else set pnext as head of IF info list.              */
-        DHCPc_InfoListHead = pnext;
-    }
-    if (pnext != (DHCPc_IF_INFO *)0) {                          /* If pif_info is NOT @ the tail of IF info list, ...   */
-        pnext->PrevPtr    = pprev;                              /* ... set pnext's PrevPtr to skip pif_info.            */
-    }
-    CPU_CRITICAL_EXIT();
-
-                                                                /* ------------------- CLR IF INFO -------------------- */
-    DEF_BIT_CLR(pif_info->Flags, DHCPc_FLAG_USED);              /* Set IF info as NOT used.                             */
-#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-    DHCPc_IF_InfoClr(pif_info);
-#endif
-
-                                                                /* ------------------- FREE IF INFO ------------------- */
-    pif_info->NextPtr = DHCPc_InfoPoolPtr;
-    DHCPc_InfoPoolPtr = pif_info;
+    DHCPc_StopAsync((NET_IF_NBR ) if_nbr,
+                    (DHCPc_REQ *) 0,
+                    (DHCPc_ERR *) perr);
 }
 
 
 /*
 *********************************************************************************************************
-*                                         DHCPc_IF_InfoClr()
+*                                          DHCPc_StopAsync()
 *
-* Description : Clear DHCPc interface information controls.
+* Description : Stop DHCP address configuration/management on specified interface & track its completion.
 *
-* Argument(s) : pif_info    Pointer to a DHCPc interface information.
-*               --------    Argument validated in DHCPc_IF_InfoInit(),
-*                                    checked   in DHCPc_IF_InfoGet(),
-*                                    checked   in DHCPc_IF_InfoFree().
+* Argument(s) : if_nbr      Interface number to stop DHCP management.
+*
+*               preq        Pointer to request handle :
+*
+*                               Pointer to request handle to complete once stopped.
+*                               NULL pointer, if completion NOT tracked.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               ----- RETURNED BY DHCPc_ClientStop() : -----
+*                               DHCPc_ERR_NONE                  Interface DHCP configuration successfully
+*                                                                   stopped.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_ERR_REQ_IN_USE            Request handle already pending.
+*                               DHCPc_ERR_MSG_Q                 Error posting stop command to message queue.
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_IF_InfoInit(),
-*               DHCPc_IF_InfoGet(),
-*               DHCPc_IF_InfoFree().
+* Caller(s)   : DHCPc_Stop(),
+*               Application.
 *
-* Note(s)     : none.
+*               This function is a DHCP client application programming interface (API) function & MAY be called by
+*               application function(s).
+*
+* Note(s)     : (1) Stops the interface's default client (see 'DHCPc_ClientStop()  Note(s)').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_IF_InfoClr (DHCPc_IF_INFO  *pif_info)
+void  DHCPc_StopAsync (NET_IF_NBR   if_nbr,
+                       DHCPc_REQ   *preq,
+                       DHCPc_ERR   *perr)
 {
-    pif_info->PrevPtr           = (DHCPc_IF_INFO *)0;
-    pif_info->NextPtr           = (DHCPc_IF_INFO *)0;
-
-    pif_info->IF_Nbr            =  NET_IF_NBR_NONE;
-    pif_info->ServerID          =  NET_IPv4_ADDR_NONE;
-
-    Mem_Clr((void     *)&pif_info->ParamReqTbl[0],
-            (CPU_SIZE_T) DHCPc_CFG_PARAM_REQ_TBL_SIZE);
-
-    pif_info->ParamReqQty       =  0;
-
-    pif_info->MsgPtr            = (DHCPc_MSG     *)0;
-
-    pif_info->ClientState       =  DHCP_STATE_NONE;
-    pif_info->LeaseStatus       =  DHCP_STATUS_NONE;
-    pif_info->LastErr           =  DHCPc_ERR_NONE;
-
-    pif_info->TransactionID     =  0;
-
-    pif_info->NegoStartTime     =  0;
-    pif_info->TmrExpirationTime =  0;
-
-    pif_info->LeaseTime_sec     =  0;
-    pif_info->T1_Time_sec       =  0;
-    pif_info->T2_Time_sec       =  0;
-
-    pif_info->Tmr               = (DHCPc_TMR     *)0;
-
-    pif_info->Flags             =  DHCPc_FLAG_NONE;
+    DHCPc_ClientStop((NET_IF_NBR  ) if_nbr,
+                     (CPU_INT08U *) 0,
+                     (CPU_INT08U  ) 0u,
+                     (DHCPc_REQ  *) preq,
+                     (DHCPc_ERR  *) perr);
 }
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_MsgInit()
+*                                          DHCPc_ClientStop()
 *
-* Description : (1) Initialize DHCPc messages :
+* Description : (1) Stop DHCP address configuration/management for specified logical client of an interface :
 *
-*                   (a) Initialize message pool
-*                   (b) Initialize message table
-*                   (c) Initialize message list pointer
+*                   (a) Acquire  DHCPc lock
+*                   (b) Post     message to DHCP client task
+*                   (c) Attach   request handle
+*                   (d) Release  DHCPc lock
 *
 *
-* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+* Argument(s) : if_nbr          Interface number to stop DHCP management.
 *
-*                               DHCPc_ERR_NONE                  DHCPc message successfully initialized.
+*               pclient_id      Pointer to client identifier of the logical client (see Note #7).
+*
+*               client_id_len   Length of the client identifier (in octets) :
+*
+*                                   0,                  the interface's default client.
+*                                   Any other value,    length of the client identifier.
+*
+*               preq            Pointer to request handle (see Note #6) :
+*
+*                                   Pointer to request handle to complete once stopped.
+*                                   NULL pointer, if completion NOT tracked.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Interface DHCP configuration successfully
+*                                                                   stopped.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_ERR_REQ_IN_USE            Request handle already pending.
+*                               DHCPc_ERR_MSG_Q                 Error posting stop command to message queue.
+*
+*                                                               ------ RETURNED BY DHCPc_OS_Lock() : -------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*
+*                                                               ------ RETURNED BY DHCPc_CommGet() : -------
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_Init().
+* Caller(s)   : DHCPc_StopAsync(),
+*               Application.
 *
-*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
-*               function(s).
+*               This function is a DHCP client application programming interface (API) function & MAY be called by
+*               application function(s).
 *
-* Note(s)     : (2) Message pool MUST be initialized PRIOR to initializing the pool with pointers to
-*                   message.
+* Note(s)     : (2) DHCPc_ClientStop() MUST be called PRIOR to disable any interface having been
+*                   configured using DHCP.  Failure to do so could cause unknown behaviors.
+*
+*               (3) DHCPc_ClientStop() NOT executed until DHCP client initialization completes.
+*
+*               (4) DHCPc_ClientStop() blocks ALL other DHCP client tasks by pending on & acquiring the
+*                   global DHCPc lock (see dhcp-c.h  Note #2').
+*
+*               (5) DHCPc_ClientStop() execution is asynchronous--i.e. interface will NOT necessarily be
+*                   stopped upon return from this function.  The application SHOULD either track the
+*                   request's completion (see Note #6) or periodically call DHCPc_ChkStatus() until the
+*                   interface's DHCP management is successfully stopped and un-configured.
+*
+*               (6) The request handle, if any, MUST have been initialized with DHCPc_ReqInit() & MUST NOT
+*                   be pending.  It is completed once the interface's information structure is freed; DHCP
+*                   management MAY then be re-started on the interface without DHCPc_ERR_IF_INFO_IF_USED
+*                   being returned.
+*
+*               (7) The logical client is identified by the client identifier it was started with (see
+*                   'dhcp-c.h  DHCPc INTERFACE CONFIGURATION DATA TYPE  Note #4').  Only the address
+*                   configured by this client is removed while other logical clients hold an address on
+*                   the same interface.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_MsgInit (DHCPc_ERR  *perr)
+void  DHCPc_ClientStop (NET_IF_NBR   if_nbr,
+                        CPU_INT08U  *pclient_id,
+                        CPU_INT08U   client_id_len,
+                        DHCPc_REQ   *preq,
+                        DHCPc_ERR   *perr)
 {
-    DHCPc_MSG      *pmsg;
-    DHCPc_MSG_QTY   i;
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO   *pif_info;
+    DHCPc_COMM      *pcomm;
+    DHCPc_COMM_MSG   comm_msg;
 
-                                                                /* ------------------ INIT MSG POOL ------------------- */
-    DHCPc_MsgPoolPtr = (DHCPc_MSG *)0;                          /* Init-clr DHCPc msg pool (see Note #2).               */
 
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+#endif
 
-                                                                /* ------------------- INIT MSG TBL ------------------- */
-    pmsg = &DHCPc_MsgTbl[0];
-    for (i = 0; i < DHCPc_NBR_MSG_BUF; i++) {
-        pmsg->ID         = (DHCPc_MSG_QTY)i;
-        pmsg->Flags      =  DHCPc_FLAG_NONE;                    /* Init each msg as NOT used.                           */
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #3).            */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
 
-#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-        DHCPc_MsgClr(pmsg);
-#endif
+    if (preq != (DHCPc_REQ *)0) {                               /* Validate req NOT pending (see Note #6).              */
+        if (preq->Pend == DEF_YES) {
+           *perr = DHCPc_ERR_REQ_IN_USE;
+            return;
+        }
+    }
 
-        pmsg->NextPtr    =  DHCPc_MsgPoolPtr;                   /* Free each msg to msg pool (see Note #2).             */
-        DHCPc_MsgPoolPtr =  pmsg;
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #4.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
 
-        pmsg++;
+    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr, pclient_id, client_id_len);
+    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If client NOT managed by DHCPc, ...                  */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return;
     }
 
-                                                                /* ---------------- INIT MSG LIST PTR ----------------- */
-    DHCPc_MsgListHead = (DHCPc_MSG *)0;
+                                                                /* -------------- POST MSG TO DHCP TASK --------------- */
+    comm_msg = DHCPc_COMM_MSG_STOP;
+    pcomm    = DHCPc_CommGet(pif_info, comm_msg, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    DHCPc_OS_MsgPost((void      *)pcomm,
+                     (DHCPc_ERR *)perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        *perr  = DHCPc_ERR_MSG_Q;
+         DHCPc_CommFree(pcomm);
+         DHCPc_OS_Unlock();
+         return;
+    }
+
+                                                                /* -------------------- ATTACH REQ -------------------- */
+    if (preq != (DHCPc_REQ *)0) {
+        DHCPc_ReqAttach(preq, pcomm);
+    }
 
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+    DHCPc_OS_Unlock();
 
    *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
 
-
 /*
 *********************************************************************************************************
-*                                        DHCPc_MsgRxHandler()
+*                                           DHCPc_Inform()
 *
-* Description : (1) Handle messages received from timers and DHCP API functions :
+* Description : (1) Obtain configuration parameters for a statically addressed interface :
 *
-*                   (a) Get interface information structure
-*                   (b) Demultiplex message
+*                   (a) Acquire  DHCPc lock
+*                   (b) Get      interface information structure
+*                   (c) Build    parameter request list
+*                   (d) Post     message to DHCP client task
+*                   (e) Release  DHCPc lock
 *
 *
-* Argument(s) : pcomm       Pointer to DHCP communication object.
-*               -----       Argument checked in DHCPc_TaskHandler().
+* Argument(s) : if_nbr              Interface number to obtain configuration parameters for.
 *
-* Return(s)   : none.
+*               preq_param_tbl      Pointer to table of requested DHCP parameters.
 *
-* Caller(s)   : DHCPc_TaskHandler().
+*               req_param_tbl_qty   Size of requested parameter table.
 *
-* Note(s)     : (2) The communication object SHOULD be freed PRIOR to executing the appropriate action.
-*                   This ensures that at least one communication object is available if the taken action
-*                   requires a communication object.
-*********************************************************************************************************
-*/
-
-static  void  DHCPc_MsgRxHandler (DHCPc_COMM  *pcomm)
-{
-    NET_IF_NBR       if_nbr;
-    DHCPc_IF_INFO   *pif_info;
-    DHCPc_COMM_MSG   msg;
-    DHCPc_ERR        err;
-    CPU_SR_ALLOC();
-
-
-    if_nbr = pcomm->IF_Nbr;
-    msg    = pcomm->CommMsg;
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCP INFORM exchange successfully started.
+*                               DHCPc_ERR_NULL_PTR              Argument 'preq_param_tbl' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_MSG_Q                 Error posting inform command to message queue.
+*
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*
+*                                                               ------- RETURNED BY DHCPc_IF_InfoGet() : -------
+*                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_CLIENT_ID_NONE        NO hardware address & NO client identifier.
+*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
+*
+*                                                               ----- RETURNED BY DHCPc_ParamReqBuild() : ------
+*                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
+*
+*                                                               -------- RETURNED BY DHCPc_CommGet() : ---------
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (2) RFC #2131, section 'Client parameters in DHCP' states that "a client that already has
+*                   an IP address from some other source [...] sends a DHCPINFORM message to obtain other
+*                   local configuration parameters".  The interface's address configuration is NEVER
+*                   modified & NO address validation is performed.
+*
+*               (3) DHCPc_Inform() MUST be called AFTER the interface has been statically configured with
+*                   an IPv4 address.
+*
+*               (4) DHCPc_Inform() NOT executed until DHCP client initialization completes.
+*
+*               (5) DHCPc_Inform() execution is asynchronous--i.e. configuration parameters will NOT
+*                   necessarily be available upon return from this function.  The application SHOULD
+*                   periodically call DHCPc_ChkStatus() until the status is DHCP_STATUS_INFORMED; the
+*                   parameters can then be retrieved with DHCPc_GetOptVal().
+*
+*               (6) DHCPc_Stop() MUST be called to release the interface information once the
+*                   configuration parameters are no longer needed.  The interface's address
+*                   configuration is NOT removed.
+*********************************************************************************************************
+*/
 
-    DHCPc_CommFree(pcomm);                                      /* Free comm obj (see Note #2).                         */
+void  DHCPc_Inform (NET_IF_NBR       if_nbr,
+                    DHCPc_OPT_CODE  *preq_param_tbl,
+                    CPU_INT08U       req_param_tbl_qty,
+                    DHCPc_ERR       *perr)
+{
+#ifdef  NET_IPv4_MODULE_EN
+    CPU_BOOLEAN      if_en;
+    DHCPc_IF_INFO   *pif_info;
+    DHCPc_COMM      *pcomm;
+    DHCPc_COMM_MSG   comm_msg;
+    NET_ERR          err_net;
 
 
-                                                                /* ---------- GET IF INFO STRUCT FROM IF NBR ---------- */
-    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr);
-    if (pif_info == ((DHCPc_IF_INFO *)0)) {                     /* If IF NOT cfg'd, ...                                 */
-        return;                                                 /* ... rtn.                                             */
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
     }
 
-                                                                /* -------------------- DEMUX MSG --------------------- */
-    switch (msg) {
-        case DHCPc_COMM_MSG_START:                              /* If nego starting ...                                 */
-        case DHCPc_COMM_MSG_LEASE_EXPIRED:                      /* ... or lease expired, ...                            */
-             CPU_CRITICAL_ENTER();
-             pif_info->LeaseStatus = DHCP_STATUS_CFG_IN_PROGRESS;
-             CPU_CRITICAL_EXIT();
-
-             DHCPc_InitStateHandler(pif_info, &err);            /* ... go into INIT state.                              */
-             switch (err) {
-                 case DHCPc_ERR_NONE:
-                      CPU_CRITICAL_ENTER();
-                      pif_info->LeaseStatus = DHCP_STATUS_CFGD;
-                      CPU_CRITICAL_EXIT();
-                      break;
-
-
-                 case DHCPc_ERR_NONE_NO_TMR:
-                      CPU_CRITICAL_ENTER();
-                      pif_info->LeaseStatus = DHCP_STATUS_CFGD_NO_TMR;
-                      CPU_CRITICAL_EXIT();
-                      break;
+    if (req_param_tbl_qty > 0) {
+        if (preq_param_tbl == (DHCPc_OPT_CODE *)0) {
+           *perr = DHCPc_ERR_NULL_PTR;
+            return;
+        }
+    }
+#endif
 
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #4).            */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
 
-                 case DHCPc_ERR_NONE_LOCAL_LINK:
-                      CPU_CRITICAL_ENTER();
-                      pif_info->LeaseStatus = DHCP_STATUS_CFGD_LOCAL_LINK;
-                      CPU_CRITICAL_EXIT();
-                      break;
 
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {
+       *perr = DHCPc_ERR_IF_INVALID;
+        return;
+    }
 
-                 default:
-                      CPU_CRITICAL_ENTER();
-                      pif_info->LeaseStatus = DHCP_STATUS_FAIL;
-                      pif_info->LastErr     = err;
-                      CPU_CRITICAL_EXIT();
-                      break;
-             }
-             break;
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
 
+                                                                /* ------------------- GET IF INFO -------------------- */
+    pif_info = DHCPc_IF_InfoGet(if_nbr, (CPU_INT08U *)0, 0u, DHCPc_FLAG_NONE, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-        case DHCPc_COMM_MSG_T1_EXPIRED:                         /* If T1 or T2 expired, ...                             */
-        case DHCPc_COMM_MSG_T2_EXPIRED:
-             DHCPc_RenewRebindStateHandler(pif_info, msg, &err);/* ... go into RENEWING/REBINDING state.                */
-             switch (err) {
-                 case DHCPc_ERR_NONE:
-                 case DHCPc_ERR_INIT_SOCK:
-                      break;                                    /* Already cfg'd, status set.                           */
+    pif_info->ClientState = DHCP_STATE_INFORM;                  /* Client in INFORM state.                              */
 
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+                                                                /* ------------------- SET HW TYPE -------------------- */
+    DHCPc_HW_TypeSet(pif_info, perr);                           /* See 'DHCPc_HW_TypeSet()  Note #1'.                   */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
+#endif
 
-                 case DHCPc_ERR_NONE_NO_TMR:
-                      CPU_CRITICAL_ENTER();
-                      pif_info->LeaseStatus = DHCP_STATUS_CFGD_NO_TMR;
-                      CPU_CRITICAL_EXIT();
-                      break;
 
+                                                                /* ------------- BUILD PARAM REQ LIST ----------------- */
+    DHCPc_ParamReqBuild(pif_info, preq_param_tbl, req_param_tbl_qty, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-                 default:
-                      CPU_CRITICAL_ENTER();
-                      pif_info->LeaseStatus = DHCP_STATUS_FAIL;
-                      pif_info->LastErr     = err;
-                      CPU_CRITICAL_EXIT();
-                      break;
-             }
-             break;
+                                                                /* --------------- BUILD TX OPT TMPL ------------------ */
+    DHCPc_TxOptTmplBuild(pif_info);
 
+                                                                /* -------------- POST MSG TO DHCP TASK --------------- */
+    comm_msg = DHCPc_COMM_MSG_INFORM;
+    pcomm    = DHCPc_CommGet(pif_info, comm_msg, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-        case DHCPc_COMM_MSG_STOP:                               /* If nego stopping, ...                                */
-             DHCPc_StopStateHandler(pif_info, &err);            /* ... go into STOP state.                              */
-             break;
+    DHCPc_OS_MsgPost((void      *)pcomm,
+                     (DHCPc_ERR *)perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+       *perr = DHCPc_ERR_MSG_Q;
+        DHCPc_CommFree(pcomm);
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
 
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+    DHCPc_OS_Unlock();
 
-        case DHCPc_COMM_MSG_NONE:                               /* Else, ...                                            */
-        default:
-             break;                                             /* ... do nothing.                                      */
-    }
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_MsgGet()
-*
-* Description : (1) Allocate & initialize a DHCPc message :
-*
-*                   (a) Get        message
-*                   (b) Initialize message
-*                   (c) Insert     message at head of message list
-*                   (d) Return pointer to message
-*                         OR
-*                       Null pointer & error code, on failure
+*                                          DHCPc_ChkStatus()
 *
+* Description : Check an interface's DHCP status & last error.
 *
-* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+* Argument(s) : if_nbr      Interface number to check status.
 *
-*                               DHCPc_ERR_NONE                  Message successfully allocated & initialized.
-*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*               perr_last   Pointer to variable that will receive the last error code for the specified
+*                           interface (see 'DHCPc_ClientChkStatus()').
 *
-* Return(s)   : Pointer to message, if NO errors.
+* Return(s)   : DHCP status for the interface (see 'DHCPc_ClientChkStatus()').
 *
-*               Pointer to NULL,    otherwise.
+* Caller(s)   : Application.
 *
-* Caller(s)   : DHCPc_Discover(),
-*               DHCPc_Req(),
-*               DHCPc_DeclineRelease().
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) Checks the interface's default client (see 'DHCPc_ClientChkStatus()  Note(s)').
 *********************************************************************************************************
 */
 
-static  DHCPc_MSG  *DHCPc_MsgGet (DHCPc_ERR  *perr)
+DHCPc_STATUS  DHCPc_ChkStatus (NET_IF_NBR   if_nbr,
+                               DHCPc_ERR   *perr_last)
 {
-    DHCPc_MSG  *pmsg;
-
-                                                                /* --------------------- GET MSG ---------------------- */
-    if (DHCPc_MsgPoolPtr != (DHCPc_MSG *)0) {                   /* If msg pool NOT empty, get msg from pool.            */
-        pmsg              = (DHCPc_MSG *)DHCPc_MsgPoolPtr;
-        DHCPc_MsgPoolPtr  = (DHCPc_MSG *)pmsg->NextPtr;
-
-    } else {                                                    /* If none avail, rtn err.                              */
-       *perr = DHCPc_ERR_MSG_NONE_AVAIL;
-        return ((DHCPc_MSG *)0);
-    }
-
-                                                                /* --------------------- INIT MSG --------------------- */
-    DHCPc_MsgClr(pmsg);
-    pmsg->PrevPtr = (DHCPc_MSG *)0;
-    pmsg->NextPtr = (DHCPc_MSG *)DHCPc_MsgListHead;
-    DEF_BIT_SET(pmsg->Flags, DHCPc_FLAG_USED);                  /* Set msg as used.                                     */
-
-                                                                /* ------------- INSERT MSG INTO MSG LIST ------------- */
-    if (DHCPc_MsgListHead != (DHCPc_MSG *)0) {                  /* If list NOT empty, insert before head.               */
-        DHCPc_MsgListHead->PrevPtr = pmsg;
-    }
-    DHCPc_MsgListHead = pmsg;                                   /* Insert msg @ list head.                              */
+    DHCPc_STATUS  status;
 
 
-   *perr =  DHCPc_ERR_NONE;
+    status = DHCPc_ClientChkStatus((NET_IF_NBR  ) if_nbr,
+                                   (CPU_INT08U *) 0,
+                                   (CPU_INT08U  ) 0u,
+                                   (DHCPc_ERR  *) perr_last);
 
-    return (pmsg);
+    return (status);
 }
 
 
 /*
 *********************************************************************************************************
-*                                          DHCPc_MsgGetOpt()
+*                                       DHCPc_ClientChkStatus()
 *
-* Description : Retrieve the specified option value from a DHCP message buffer.
+* Description : Check a logical client's DHCP status & last error.
 *
-* Argument(s) : opt_code            Option code to return value of.
+* Argument(s) : if_nbr          Interface number to check status.
 *
-*               pmsg_buf            Pointer to DHCP message buffer to search.
+*               pclient_id      Pointer to client identifier of the logical client (see Note #3).
 *
-*               msg_buf_size        Size of message buffer (in octets).
+*               client_id_len   Length of the client identifier (in octets) :
 *
-*               popt_val_len        Pointer to variable that will receive the length of the option value.
+*                                   0,                  the interface's default client.
+*                                   Any other value,    length of the client identifier.
 *
-* Return(s)   : Pointer to the specified option value, if option found without error.
+*               perr_last       Pointer to variable that will receive the last error code for the specified
+*                               client :
 *
-*               Pointer tu NULL,                       otherwise.
+*                               DHCPc_ERR_NONE                  No error saved for this client.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Client NOT managed by the DHCP client.
 *
-* Caller(s)   : DHCPc_Discover(),
-*               DHCPc_LeaseTimeCalc(),
-*               DHCPc_AddrCfg(),
-*               DHCPc_RxReply().
+*                               Specific initialization error code (see Note #2).
 *
-* Note(s)     : none.
-*********************************************************************************************************
-*/
-
-static  CPU_INT08U  *DHCPc_MsgGetOpt (DHCPc_OPT_CODE   opt_code,
-                                      CPU_INT08U      *pmsg_buf,
-                                      CPU_INT16U       msg_buf_size,
-                                      CPU_INT08U      *popt_val_len)
-{
-    CPU_INT32U    magic_cookie;
-    CPU_BOOLEAN   opt_start;
-    CPU_BOOLEAN   opt_found;
-    CPU_INT08U   *popt;
-    CPU_INT08U   *popt_val;
-    CPU_INT08U   *pend_msg;
-
-
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* ------------------- VALIDATE PTR ------------------- */
-    if (popt_val_len == (CPU_INT08U *)0) {
-        return ((CPU_INT08U *)0);
-    }
-
-    if (pmsg_buf == (CPU_INT08U *)0) {
-        return ((CPU_INT08U *)0);
-    }
-#endif
-
-   *popt_val_len =  0;                                          /* Cfg rtn opt val len for err.                         */
-
-
-    popt = pmsg_buf + DHCP_MSG_HDR_SIZE;
-
-                                                                /* -------- VALIDATE BEGINNING OF OPT SECTION --------- */
-    magic_cookie = NET_UTIL_HOST_TO_NET_32(DHCP_MAGIC_COOKIE);
-    opt_start = Mem_Cmp((void     *) popt,
-                        (void     *)&magic_cookie,
-                        (CPU_SIZE_T) DHCP_MAGIC_COOKIE_SIZE);
-
-    if (opt_start != DEF_YES) {                                 /* If magic cookie NOT here, ...                        */
-        return ((CPU_INT08U *)0);                               /* ... rtn.                                             */
-    }
-
-    popt += DHCP_MAGIC_COOKIE_SIZE;                             /* Go to first opt.                                     */
-
-
-                                                                /* --------------------- SRCH OPT --------------------- */
-    opt_found = DEF_NO;
-    pend_msg  = pmsg_buf + msg_buf_size;
-
-    while ((opt_found != DEF_YES)      &&                       /* Srch until opt found,                                */
-           (*popt     != DHCP_OPT_END) &&                       /* & opt end    NOT reached,                            */
-           ( popt     <= pend_msg)) {                           /* & end of msg NOT reached.                            */
-
-        if (*popt == opt_code) {                                /* If popt equals srch'd opt code, ...                  */
-            opt_found = DEF_YES;                                /* ... opt found.                                       */
-
-        } else if (*popt == DHCP_OPT_PAD) {                     /* If popt is padding, ...                              */
-            popt++;                                             /* ... advance.                                         */
-
-        } else {                                                /* Else, another opt found,  ...                        */
-                                                                /* ... skip to next opt.                                */
-            popt += ((*(popt + DHCP_OPT_FIELD_CODE_LEN)) + DHCP_OPT_FIELD_HDR_LEN);
-        }
-    }
-
-
-    if (opt_found != DEF_YES) {
-        return ((CPU_INT08U *)0);
-    }
-
-   *popt_val_len = *(popt + DHCP_OPT_FIELD_CODE_LEN);          /* Set opt val len ...                                  */
-    popt_val     =   popt + DHCP_OPT_FIELD_HDR_LEN;            /* ... & set opt val ptr.                               */
-
-    return (popt_val);
-}
-
-
-/*
-*********************************************************************************************************
-*                                           DHCPc_MsgFree()
+* Return(s)   : DHCP status for the interface :
 *
-* Description : (1) Free a DHCPc message :
+*                   DHCP_STATUS_NONE,               NO status information available since DHCPc
+*                                                       services for this interface either :
 *
-*                   (a) Remove message from    message list
-*                   (b) Clear  message controls
-*                   (c) Free   message back to message pool
+*                                                           NOT successfully started
+*                                                        OR     successfully stopped.
 *
+*                   DHCP_STATUS_CFG_IN_PROGRESS,    DHCPc configuration still in progress.
 *
-* Argument(s) : pmsg        Pointer to a DHCPc message.
+*                   DHCP_STATUS_CFGD,               DHCPc configuration successfully completed.
+*                   DHCP_STATUS_CFGD_NO_TMR,        DHCPc configuration successfully completed;
+*                                                       however, NO DHCP lease timer available.
 *
-* Return(s)   : none.
+*                   DHCP_STATUS_CFGD_LOCAL_LINK,    DHCPc failed to configure a globally-routable
+*                                                       address, but successfully configured a
+*                                                       Link-Local address.
 *
-* Caller(s)   : DHCPc_StopStateHandler(),
-*               DHCPc_Discover(),
-*               DHCPc_Req(),
-*               DHCPc_DeclineRelease().
+*                   DHCP_STATUS_FAIL,               DHCPc configuration failed.
 *
-*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
-*               application function(s).
+*                   DHCP_STATUS_INFORMED,           DHCPc successfully obtained the configuration
+*                                                       parameters of a statically configured
+*                                                       interface (see 'DHCPc_Inform()').
 *
-* Note(s)     : (2) #### To prevent freeing a message already freed via previous message free,
-*                   DHCPc_MsgFree() checks the message's 'USED' flag BEFORE freeing the message.
+* Caller(s)   : DHCPc_ChkStatus(),
+*               Application.
 *
-*                   This prevention is only best-effort since any invalid duplicate message frees MAY be
-*                   asynchronous to potentially valid message gets.  Thus the invalid message free(s) MAY
-*                   corrupt the message's valid operation(s).
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
 *
-*                   However, since the primary tasks of the DHCP client are prevented from running
-*                   concurrently (see 'dhcp-c.h  Note #2'), it is NOT necessary to protect DHCPc
-*                   message resources from possible corruption since no asynchronous access from other
-*                   task is possible.
+* Note(s)     : (1) DHCPc_ClientChkStatus() NOT executed until DHCP client initialization completes.
+*
+*               (2) (a) If any DHCP error occurs, the specific error code is preserved.
+*
+*                   (b) DHCP error codes are listed in 'dhcp-c.h'.  A search of the specific error code
+*                       number(s) provides the corresponding error code label(s).
+*
+*               (3) See 'DHCPc_ClientStop()  Note #7'.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_MsgFree (DHCPc_MSG  *pmsg)
+DHCPc_STATUS  DHCPc_ClientChkStatus (NET_IF_NBR   if_nbr,
+                                     CPU_INT08U  *pclient_id,
+                                     CPU_INT08U   client_id_len,
+                                     DHCPc_ERR   *perr_last)
 {
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    CPU_BOOLEAN   used;
-#endif
-    DHCPc_MSG    *pprev;
-    DHCPc_MSG    *pnext;
-
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO  *pif_info;
+    DHCPc_STATUS    status;
+    CPU_SR_ALLOC();
 
-                                                                /* ------------------ VALIDATE PTR -------------------- */
-    if (pmsg == (DHCPc_MSG *)0) {
-        return;
-    }
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-                                                                /* ---------------- VALIDATE MSG USED ----------------- */
-    used = DEF_BIT_IS_SET(pmsg->Flags, DHCPc_FLAG_USED);
-    if (used != DEF_YES) {                                      /* If msg NOT used, ...                                 */
-        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr_last == DEF_NULL) {                                /* Validate perr_last ptr.                              */
+        CPU_SW_EXCEPTION();
     }
 #endif
 
-                                                                /* ------------- REMOVE MSG FROM MSG LIST ------------- */
-    pprev = pmsg->PrevPtr;
-    pnext = pmsg->NextPtr;
-    if (pprev != (DHCPc_MSG *)0) {                              /* If pmsg is NOT   the head of msg list, ...           */
-        pprev->NextPtr    = pnext;                              /* ... set pprev's NextPtr to skip pmsg.                */
-    } else {                                                    /* Else set pnext as head of msg list.                  */
-        DHCPc_MsgListHead = pnext;
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #1).            */
+       *perr_last = DHCPc_ERR_INIT_INCOMPLETE;
+        return (DHCP_STATUS_NONE);
     }
-    if (pnext != (DHCPc_MSG *)0) {                              /* If pmsg is NOT @ the tail of msg list, ...           */
-        pnext->PrevPtr    = pprev;                              /* ... set pnext's PrevPtr to skip pmsg.                */
+
+    CPU_CRITICAL_ENTER();
+    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr, pclient_id, client_id_len);
+    if (pif_info != (DHCPc_IF_INFO *)0) {
+       *perr_last = pif_info->LastErr;
+        status    = pif_info->LeaseStatus;
+
+    } else {
+       *perr_last = DHCPc_ERR_IF_NOT_MANAGED;
+        status    = DHCP_STATUS_NONE;
     }
+    CPU_CRITICAL_EXIT();
 
-                                                                /* ---------------------- CLR MSG --------------------- */
-    DEF_BIT_CLR(pmsg->Flags, DHCPc_FLAG_USED);                  /* Set msg as NOT used.                                 */
-#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-    DHCPc_MsgClr(pmsg);
-#endif
 
-                                                                /* --------------------- FREE MSG --------------------- */
-    pmsg->NextPtr    = DHCPc_MsgPoolPtr;
-    DHCPc_MsgPoolPtr = pmsg;
+    return (status);
+#else
+   *perr_last = DHCPc_ERR_IPv4_NOT_PRESENT;
+    return (DHCP_STATUS_FAIL);
+#endif
 }
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_MsgClr()
-*
-* Description : Clear DHCPc message controls.
-*
-* Argument(s) : pmsg        Pointer to a DHCPc message.
-*               ----        Argument validated in DHCPc_MsgInit(),
-*                                    checked   in DHCPc_MsgGet(),
-*                                    checked   in DHCPc_MsgFree().
-*
-* Return(s)   : none.
+*                                          DHCPc_GetOptVal()
 *
-* Caller(s)   : DHCPc_MsgInit(),
-*               DHCPc_MsgGet(),
-*               DHCPc_MsgFree().
+* Description : Get the value of a specific DHCP option for a given interface.
 *
-* Note(s)     : none.
-*********************************************************************************************************
-*/
-
-static  void  DHCPc_MsgClr (DHCPc_MSG  *pmsg)
-{
-    pmsg->PrevPtr = (DHCPc_MSG *)0;
-    pmsg->NextPtr = (DHCPc_MSG *)0;
-
-    Mem_Clr((void     *)&pmsg->MsgBuf[0],
-            (CPU_SIZE_T) DHCP_MSG_BUF_SIZE);
-
-    pmsg->MsgLen  =  0;
-    pmsg->Flags   =  DHCPc_FLAG_NONE;
-}
-
-
-/*
-*********************************************************************************************************
-*                                          DHCPc_CommInit()
+* Argument(s) : if_nbr          Interface number to get option value.
 *
-* Description : (1) Initialize DHCPc communication objects :
+*               opt_code        Option code      to get value.
 *
-*                   (a) Initialize communication object pool
-*                   (b) Initialize communication object table
-*                   (c) Initialize communication object list pointer
+*               pval_buf        Pointer to buffer that will receive the option value.
 *
+*               pval_buf_len    Pointer to a variable to pass the size of the buffer & return the actual
+*                                   length of the option (see 'DHCPc_ClientGetOptVal()').
 *
-* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  DHCPc communication objects successfully
-*                                                                   initialized.
+*                                                               --- RETURNED BY DHCPc_ClientGetOptVal() : ---
+*                               DHCPc_ERR_NONE                  Option value successfully returned.
+*                               DHCPc_ERR_NULL_PTR              Argument 'pval_buf/pval_buf_len' passed a NULL
+*                                                                   pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_ERR_IF_NOT_CFG            Interface NOT yet configured by the DHCP client.
+*                               DHCPc_ERR_IF_OPT_NONE           Option NOT present.
+*                               DHCPc_ERR_OPT_BUF_SIZE          Option value buffer size too small.
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_Init().
+* Caller(s)   : Application.
 *
-*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
-*               function(s).
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
 *
-* Note(s)     : (2) Communication object pool MUST be initialized PRIOR to initializing the pool with
-*                   pointers to communication objects.
+* Note(s)     : (1) Gets the option of the interface's default client (see 'DHCPc_ClientGetOptVal()
+*                   Note(s)').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_CommInit (DHCPc_ERR  *perr)
+void  DHCPc_GetOptVal (NET_IF_NBR       if_nbr,
+                       DHCPc_OPT_CODE   opt_code,
+                       CPU_INT08U      *pval_buf,
+                       CPU_INT16U      *pval_buf_len,
+                       DHCPc_ERR       *perr)
 {
-    DHCPc_COMM      *pcomm;
-    DHCPc_COMM_QTY   i;
-
-                                                                /* ---------------- INIT COMM OBJ POOL ---------------- */
-    DHCPc_CommPoolPtr = (DHCPc_COMM *)0;                        /* Init-clr DHCPc comm obj pool (see Note #2).          */
-
-
-                                                                /* ----------------- INIT COMM OBJ TBL ---------------- */
-    pcomm = &DHCPc_CommTbl[0];
-    for (i = 0; i < DHCPc_NBR_COMM; i++) {
-        pcomm->ID         = (DHCPc_COMM_QTY)i;
-        pcomm->Flags      =  DHCPc_FLAG_NONE;                   /* Init each comm obj as NOT used.                      */
-
-#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-        DHCPc_CommClr(pcomm);
-#endif
-
-        pcomm->NextPtr    = DHCPc_CommPoolPtr;                  /* Free each comm obj to comm obj pool (see Note #2).   */
-        DHCPc_CommPoolPtr = pcomm;
-
-        pcomm++;
-    }
-
-                                                                /* -------------- INIT COMM OBJ LIST PTR -------------- */
-    DHCPc_CommListHead = (DHCPc_COMM *)0;
-
-
-   *perr = DHCPc_ERR_NONE;
+    DHCPc_ClientGetOptVal((NET_IF_NBR     ) if_nbr,
+                          (CPU_INT08U    *) 0,
+                          (CPU_INT08U     ) 0u,
+                          (DHCPc_OPT_CODE ) opt_code,
+                          (CPU_INT08U    *) pval_buf,
+                          (CPU_INT16U    *) pval_buf_len,
+                          (DHCPc_ERR     *) perr);
 }
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_CommGet()
+*                                       DHCPc_ClientGetOptVal()
 *
-* Description : (1) Allocate & initialize a DHCPc communication object :
+* Description : (1) Get the value of a specific DHCP option for a given logical client of an interface :
 *
-*                   (a) Get        communication object
-*                   (b) Initialize communication object
-*                   (c) Insert     communication object at head of communication object list
-*                   (d) Return pointer to communication object
-*                         OR
-*                       Null pointer & error code, on failure
+*                   (a) Acquire DHCPc lock
+*                   (b) Get interface information structure
+*                   (c) Retrieve specific option's value
+*                   (d) Release DHCPc lock
 *
 *
-* Argument(s) : if_nbr          Interface number requesting a communication object.
+* Argument(s) : if_nbr          Interface number to get option value.
 *
-*               comm_msg        Message to pass.
+*               pclient_id      Pointer to client identifier of the logical client (see Note #5).
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
+*               client_id_len   Length of the client identifier (in octets) :
 *
-*                               DHCPc_ERR_NONE                  Communication object successfully allocated
-*                                                                   & initialized.
-*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*                                   0,                  the interface's default client.
+*                                   Any other value,    length of the client identifier.
 *
-* Return(s)   : Pointer to communication object, if NO errors.
+*               opt_code        Option code      to get value.
 *
-*               Pointer to NULL,                 otherwise.
+*               pval_buf        Pointer to buffer that will receive the option value.
 *
-* Caller(s)   : DHCPc_Start(),
-*               DHCPc_Stop(),
-*               DHCPc_TmrCfg().
+*               pval_buf_len    Pointer to a variable to ... :
 *
-* Note(s)     : none.
-*********************************************************************************************************
-*/
-
-static  DHCPc_COMM  *DHCPc_CommGet (NET_IF_NBR       if_nbr,
-                                    DHCPc_COMM_MSG   comm_msg,
-                                    DHCPc_ERR       *perr)
-{
-    DHCPc_COMM  *pcomm;
-
-
-                                                                /* ------------------- GET COMM OBJ ------------------- */
-    if (DHCPc_CommPoolPtr != (DHCPc_COMM *)0) {                 /* If comm obj pool NOT empty, get comm obj from pool   */
-        pcomm              = (DHCPc_COMM *)DHCPc_CommPoolPtr;
-        DHCPc_CommPoolPtr  = (DHCPc_COMM *)pcomm->NextPtr;
-
-    } else {                                                    /* If none avail, rtn err.                              */
-       *perr = DHCPc_ERR_COMM_NONE_AVAIL;
-        return ((DHCPc_COMM *)0);
-    }
-
-                                                                /* ------------------ INIT COMM OBJ ------------------- */
-    DHCPc_CommClr(pcomm);
-    pcomm->PrevPtr = (DHCPc_COMM *)0;
-    pcomm->NextPtr = (DHCPc_COMM *)DHCPc_CommListHead;
-    pcomm->IF_Nbr  =  if_nbr;
-    pcomm->CommMsg =  comm_msg;
-    DEF_BIT_SET(pcomm->Flags, DHCPc_FLAG_USED);                 /* Set comm obj as used.                                */
-
-                                                                /* -------- INSERT COMM OBJ INTO COMM OBJ LIST -------- */
-    if (DHCPc_CommListHead != (DHCPc_COMM *)0) {                /* If list NOT empty, insert before head.               */
-        DHCPc_CommListHead->PrevPtr = pcomm;
-    }
-    DHCPc_CommListHead = pcomm;                                 /* Insert comm obj @ list head.                         */
-
-
-   *perr =  DHCPc_ERR_NONE;
-
-    return (pcomm);
-}
-
-
-/*
-*********************************************************************************************************
-*                                          DHCPc_CommFree()
+*                                   (a) Pass the size of the buffer, in octets, pointed to by 'pval_buf'.
+*                                   (b) (1) Return the actual length of the option, if NO errors;
+*                                       (2) Return an undefined value,              otherwise.
 *
-* Description : (1) Free a DHCPc communication object :
+*                               See also Note #4.
 *
-*                   (a) Remove communication object from    communication object list
-*                   (b) Clear  communication object controls
-*                   (c) Free   communication object back to communication object pool
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
+*                               DHCPc_ERR_NONE                  Option value successfully returned.
+*                               DHCPc_ERR_NULL_PTR              Argument 'pval_buf/pval_buf_len' passed a NULL
+*                                                                   pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_ERR_IF_NOT_CFG            Interface NOT yet configured by the DHCP client.
+*                               DHCPc_ERR_IF_OPT_NONE           Option NOT present.
+*                               DHCPc_ERR_OPT_BUF_SIZE          Option value buffer size too small.
 *
-* Argument(s) : pcomm       Pointer to a DHCPc communication object.
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : --------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_Start(),
-*               DHCPc_Stop(),
-*               DHCPc_MsgRxHandler(),
-*               DHCPc_TmrCfg().
+* Caller(s)   : DHCPc_GetOptVal(),
+*               Application.
 *
-*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
-*               application function(s).
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
 *
-* Note(s)     : (2) #### To prevent freeing a communication object already freed via previous communication
-*                   object free, DHCPc_CommFree() checks the communication object's 'USED' flag BEFORE
-*                   freeing the communication object.
+* Note(s)     : (2) DHCPc_ClientGetOptVal() NOT executed until DHCP client initialization completes.
 *
-*                   This prevention is only best-effort since any invalid duplicate communication object
-*                   frees MAY be asynchronous to potentially valid communication object gets.  Thus the
-*                   invalid communication object free(s) MAY corrupt the communicatino object's valid
-*                   operation(s).
+*               (3) DHCPc_ClientGetOptVal() acquires the global DHCPc lock to get the interface information &
+*                   the interface lock to read its current DHCP message (see 'dhcp-c.h  Note #2d').  Both
+*                   locks are held ONLY while the option value is copied.
 *
-*                   However, since the primary tasks of the DHCP client are prevented from running
-*                   concurrently (see 'dhcp-c.h  Note #2'), it is NOT necessary to protect DHCPc
-*                   communication object resources from possible corruption since no asynchronous access
-*                   from other task is possible.
+*               (4) Since 'pval_buf_len' parameter is both an input & output parameter
+*                   (see 'Argument(s) : pval_buf_len'), ... :
+*
+*                   (a) Its input value SHOULD be validated prior to use; ...
+*
+*                       (1) In the case that the 'pval_buf_len' parameter is passed a null pointer,
+*                           NO input value is validated or used.
+*
+*                       (2) The length of the option value buffer MUST be greater than or equal to the
+*                           length of the actual option value requested.
+*
+*                   (b) While its output value MUST be initially configured to return a default value
+*                       PRIOR to all other validation or function handling in case of any error(s).
+*
+*               (5) See 'DHCPc_ClientStop()  Note #7'.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_CommFree (DHCPc_COMM  *pcomm)
+void  DHCPc_ClientGetOptVal (NET_IF_NBR       if_nbr,
+                             CPU_INT08U      *pclient_id,
+                             CPU_INT08U       client_id_len,
+                             DHCPc_OPT_CODE   opt_code,
+                             CPU_INT08U      *pval_buf,
+                             CPU_INT16U      *pval_buf_len,
+                             DHCPc_ERR       *perr)
 {
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    CPU_BOOLEAN   used;
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO  *pif_info;
+    DHCPc_MSG      *pmsg;
+    CPU_INT08U     *popt_val;
+    CPU_INT08U      opt_val_len;
+
+
+                                                                /* -------------- VALIDATE BUF & BUF LEN -------------- */
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+
+    if ((pval_buf     == (CPU_INT08U *)0) ||
+        (pval_buf_len == (CPU_INT16U *)0)) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
+    }
 #endif
-    DHCPc_COMM   *pprev;
-    DHCPc_COMM   *pnext;
 
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #2).            */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
 
-                                                                /* ------------------ VALIDATE PTR -------------------- */
-    if (pcomm == (DHCPc_COMM *)0) {
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #3.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
         return;
     }
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-                                                                /* -------------- VALIDATE COMM OBJ USED -------------- */
-    used = DEF_BIT_IS_SET(pcomm->Flags, DHCPc_FLAG_USED);
-    if (used != DEF_YES) {                                      /* If comm obj NOT used, ...                            */
-        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
+    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr, pclient_id, client_id_len);
+    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If client NOT managed by DHCPc, ...                  */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return;
     }
-#endif
 
-                                                                /* -------- REMOVE COMM OBJ FROM COMM OBJ LIST -------- */
-    pprev = pcomm->PrevPtr;
-    pnext = pcomm->NextPtr;
-    if (pprev != (DHCPc_COMM *)0) {                             /* If pcomm is NOT   the head of comm obj list, ...     */
-        pprev->NextPtr     = pnext;                             /* ... set pprev's NextPtr to skip pcomm.               */
-    } else {                                                    /* Else set pnext as head of comm obj list.             */
-        DHCPc_CommListHead = pnext;
+                                                                /* ------------------ ACQUIRE IF LOCK ----------------- */
+    DHCPc_OS_IF_Lock(pif_info->ID, perr);                       /* See Note #3.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
     }
-    if (pnext != (DHCPc_COMM *)0) {                             /* If pcomm is NOT @ the tail of comm obj list, ...     */
-        pnext->PrevPtr     = pprev;                             /* ... set pnext's PrevPtr to skip pcomm.               */
+
+    if ((pif_info->LeaseStatus != DHCP_STATUS_CFGD) &&          /* If IF NOT cfg'd ...                                  */
+        (pif_info->LeaseStatus != DHCP_STATUS_INFORMED)) {      /* ... nor informed, ...                                */
+       *perr = DHCPc_ERR_IF_NOT_CFG;                            /* ... rtn err.                                         */
+        DHCPc_OS_IF_Unlock(pif_info->ID);
+        DHCPc_OS_Unlock();
+        return;
     }
 
-                                                                /* ------------------- CLR COMM OBJ ------------------- */
-    DEF_BIT_CLR(pcomm->Flags, DHCPc_FLAG_USED);                 /* Set comm obj as NOT used.                            */
-#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-    DHCPc_CommClr(pcomm);
-#endif
+    pmsg = pif_info->MsgPtr;
+    if (pmsg == (DHCPc_MSG *)0) {                               /* If NO DHCP msg for IF, ...                           */
+       *perr = DHCPc_ERR_IF_NOT_CFG;                            /* ... rtn err.                                         */
+        DHCPc_OS_IF_Unlock(pif_info->ID);
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-                                                                /* ------------------ FREE COMM OBJ ------------------- */
-    pcomm->NextPtr    = DHCPc_CommPoolPtr;
-    DHCPc_CommPoolPtr = pcomm;
+                                                                /* ------------------- GET OPT VAL -------------------- */
+    popt_val = DHCPc_MsgGetOpt( opt_code,
+                               &pmsg->MsgBuf[0],
+                                pmsg->MsgLen,
+                               &opt_val_len);
+
+    if (popt_val == (CPU_INT08U *)0) {                          /* If NO opt val rtn'd, ...                             */
+       *perr = DHCPc_ERR_IF_OPT_NONE;                           /* ... rtn err.                                         */
+        DHCPc_OS_IF_Unlock(pif_info->ID);
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    if (opt_val_len > *pval_buf_len) {                          /* If opt val larger than val buf, ....                 */
+       *perr = DHCPc_ERR_OPT_BUF_SIZE;                          /* ... rtn err.                                         */
+        DHCPc_OS_IF_Unlock(pif_info->ID);
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    Mem_Copy((void     *)pval_buf,                              /* Copy opt val into val buf ..                         */
+             (void     *)popt_val,
+             (CPU_SIZE_T)opt_val_len);
+
+   *pval_buf_len = opt_val_len;                                 /* .. & set opt val len.                                */
+
+                                                                /* ---------------- RELEASE DHCPc LOCKS --------------- */
+    DHCPc_OS_IF_Unlock(pif_info->ID);
+    DHCPc_OS_Unlock();
+
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_CommClr()
+*                                        DHCPc_RelayInfoGet()
 *
-* Description : Clear DHCPc communication object controls.
+* Description : Get the relay information of a given interface.
 *
-* Argument(s) : pcomm       Pointer to a DHCPc communication object.
-*               ----        Argument validated in DHCPc_CommInit(),
-*                                    checked   in DHCPc_CommGet(),
-*                                    checked   in DHCPc_CommFree().
+* Argument(s) : if_nbr          Interface number to get relay information.
+*
+*               prelay_info     Pointer to variable that will receive the relay information.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               - RETURNED BY DHCPc_ClientRelayInfoGet() : -
+*                               DHCPc_ERR_NONE                  Relay information successfully returned.
+*                               DHCPc_ERR_NULL_PTR              Argument 'prelay_info' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_CommInit(),
-*               DHCPc_CommGet(),
-*               DHCPc_CommFree().
+* Caller(s)   : Application.
 *
-* Note(s)     : none.
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) Gets the relay information of the interface's default client (see
+*                   'DHCPc_ClientRelayInfoGet()  Note(s)').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_CommClr (DHCPc_COMM  *pcomm)
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+void  DHCPc_RelayInfoGet (NET_IF_NBR         if_nbr,
+                          DHCPc_RELAY_INFO  *prelay_info,
+                          DHCPc_ERR         *perr)
 {
-    pcomm->PrevPtr = (DHCPc_COMM *)0;
-    pcomm->NextPtr = (DHCPc_COMM *)0;
-
-    pcomm->IF_Nbr  =  0;
-    pcomm->CommMsg =  DHCPc_COMM_MSG_NONE;
-
-    pcomm->Flags   =  DHCPc_FLAG_NONE;
+    DHCPc_ClientRelayInfoGet((NET_IF_NBR        ) if_nbr,
+                             (CPU_INT08U       *) 0,
+                             (CPU_INT08U        ) 0u,
+                             (DHCPc_RELAY_INFO *) prelay_info,
+                             (DHCPc_ERR        *) perr);
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_TmrInit()
+*                                     DHCPc_ClientRelayInfoGet()
 *
-* Description : (1) Initialize DHCPc :
+* Description : Get the relay information of a given logical client of an interface.
 *
-*                   (a) Perform Timer/OS initialization
-*                   (b) Perform Task/OS  initialization
-*                   (c) Initialize timer pool
-*                   (d) Initialize timer table
-*                   (e) Initialize timer list pointer
+* Argument(s) : if_nbr          Interface number to get relay information.
 *
+*               pclient_id      Pointer to client identifier of the logical client (see Note #3).
 *
-* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*               client_id_len   Length of the client identifier (in octets) :
 *
-*                               DHCPc_ERR_NONE                      DHCPc timer module successfully initialized.
+*                                   0,                  the interface's default client.
+*                                   Any other value,    length of the client identifier.
 *
-*                                                                   ----- RETURNED BY DHCPc_OS_TmrInit() : ------
-*                               DHCPc_OS_ERR_INIT_TMR               DHCPc timer                NOT successfully
-*                                                                       initialized.
-*                               DHCPc_OS_ERR_INIT_TMR_SIGNAL        DHCPc timer    signal      NOT successfully
-*                                                                       initialized.
-*                               DHCPc_OS_ERR_INIT_TMR_SIGNAL_NAME   DHCPc timer    signal name NOT successfully
-*                                                                       initialized.
-*                               DHCPc_OS_ERR_INIT_TMR_TASK          DHCPc timer    task        NOT successfully
-*                                                                       initialized.
-*                               DHCPc_OS_ERR_INIT_TMR_TASK_NAME     DHCPc timer    task name   NOT successfully
-*                                                                       configured.
+*               prelay_info     Pointer to variable that will receive the relay information.
 *
-*                                                                   ----- RETURNED BY DHCPc_OS_TaskInit() : -----
-*                               DHCPc_OS_ERR_INIT_TASK              DHCPc task      NOT successfully initialized.
-*                               DHCPc_OS_ERR_INIT_TASK_NAME         DHCPc task name NOT successfully configured.
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-* Return(s)   : none.
+*                               DHCPc_ERR_NONE                  Relay information successfully returned.
+*                               DHCPc_ERR_NULL_PTR              Argument 'prelay_info' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
 *
-* Caller(s)   : DHCPc_Init().
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
 *
-*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
-*               function(s).
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : --------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
 *
-* Note(s)     : (2) Timer pool MUST be initialized PRIOR to initializing the pool with pointers to timers.
-*********************************************************************************************************
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_RelayInfoGet(),
+*               Application.
+*
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) The relay information is returned at any client state, to help troubleshooting a lease
+*                   negotiation in progress (see 'dhcp-c.h  DHCPc RELAY INFORMATION DATA TYPE  Note #1').
+*
+*               (2) DHCPc_ClientRelayInfoGet() acquires the global DHCPc lock to get the interface
+*                   information & the interface lock to read its relay information (see 'dhcp-c.h
+*                   Note #2d').
+*
+*               (3) See 'DHCPc_ClientStop()  Note #7'.
+*********************************************************************************************************
 */
 
-static  void  DHCPc_TmrInit (DHCPc_ERR  *perr)
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+void  DHCPc_ClientRelayInfoGet (NET_IF_NBR         if_nbr,
+                                CPU_INT08U        *pclient_id,
+                                CPU_INT08U         client_id_len,
+                                DHCPc_RELAY_INFO  *prelay_info,
+                                DHCPc_ERR         *perr)
 {
-    DHCPc_TMR      *ptmr;
-    DHCPc_TMR_QTY   i;
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO  *pif_info;
 
 
-                                                                /* -------------- PERFORM TIMER/OS INIT --------------- */
-    DHCPc_OS_TmrInit(perr);                                     /* Create DHCPc Tmr & Tmr Task.                         */
-    if (*perr != DHCPc_OS_ERR_NONE) {
-        return;
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
     }
 
-                                                                /* --------------- PERFORM TASK/OS INIT --------------- */
-    DHCPc_OS_TaskInit(perr);                                    /* Create DHCPc Task.                                   */
-    if (*perr != DHCPc_OS_ERR_NONE) {
-         return;
+    if (prelay_info == (DHCPc_RELAY_INFO *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
     }
+#endif
 
-                                                                /* ------------------ INIT TMR POOL ------------------- */
-    DHCPc_TmrPoolPtr = (DHCPc_TMR *)0;                          /* Init-clr DHCPc tmr pool (see Note #2).               */
-
-
-                                                                /* ------------------ INIT TMR TBL -------------------- */
-    ptmr = &DHCPc_TmrTbl[0];
-    for (i = 0; i < DHCPc_NBR_TMR; i++) {
-        ptmr->ID    = (DHCPc_TMR_QTY)i;
-        ptmr->Flags =  DHCPc_FLAG_NONE;                         /* Init each tmr as NOT used.                           */
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
 
-#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-        DHCPc_TmrClr(ptmr);
-#endif
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #2.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
 
-        ptmr->NextPtr    = DHCPc_TmrPoolPtr;                    /* Free each tmr to tmr pool (see Note #2).             */
-        DHCPc_TmrPoolPtr = ptmr;
+    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr, pclient_id, client_id_len);
+    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If client NOT managed by DHCPc, ...                  */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-        ptmr++;
+                                                                /* ------------------ ACQUIRE IF LOCK ----------------- */
+    DHCPc_OS_IF_Lock(pif_info->ID, perr);                       /* See Note #2.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
     }
 
-                                                                /* ---------------- INIT TMR LIST PTR ----------------- */
-    DHCPc_TmrListHead = (DHCPc_TMR *)0;
+                                                                /* ------------------ COPY RELAY INFO ----------------- */
+    Mem_Copy((void     *) prelay_info,
+             (void     *)&pif_info->Relay,
+             (CPU_SIZE_T) sizeof(DHCPc_RELAY_INFO));
 
+                                                                /* ---------------- RELEASE DHCPc LOCKS --------------- */
+    DHCPc_OS_IF_Unlock(pif_info->ID);
+    DHCPc_OS_Unlock();
 
    *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
-
+#endif
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_TmrCfg()
+*                                         DHCPc_IPv6_Start()
 *
-* Description : (1) Configure & insert a timer.
+* Description : (1) Start a DHCPv6 client on an interface & track its completion :
 *
-*                   (a) Get communication object
-*                   (b) Get timer
+*                   (a) Validate interface configuration & requested identity associations
+*                   (b) Acquire  DHCPc lock
+*                   (c) Get      interface information structure
+*                   (d) Copy     interface configuration
+*                   (e) Set      client DUID & IAID
+*                   (f) Post     message to DHCP client task
+*                   (g) Attach   request handle
+*                   (h) Release  DHCPc lock
 *
 *
-* Argument(s) : pif_info        Pointer to DHCP interface information structure.
-*               --------        Argument checked   in DHCPc_MsgRxHandler(),
-*                                        validated in DHCPc_LeaseTimeCalc(),
-*                                                     DHCPc_LeaseTimeUpdate().
+* Argument(s) : if_nbr      Interface number to start the DHCPv6 client on.
 *
-*               tmr_msg         Timer expiration message.
+*               pcfg        Pointer to interface configuration (see Note #4) :
+*
+*                               Pointer to interface configuration to use.
+*                               NULL pointer, to use default interface configuration.
 *
-*               time_sec        Initial timer value (in seconds) [see Note #2].
+*               ia_req      Identity associations to request (see 'dhcp-c.h  DHCPv6 DEFINES  Note #3') :
+*
+*                               DHCPc_IPv6_IA_NA                Request an address.
+*                               DHCPc_IPv6_IA_PD                Request a  delegated prefix.
+*                               DHCPc_IPv6_IA_ALL               Request both.
+*
+*               preq        Pointer to request handle (see 'DHCPc_StartAsync()  Note #7') :
+*
+*                               Pointer to request handle to complete once started.
+*                               NULL pointer, if completion NOT tracked.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  Timer successfully configured.
-*                               DHCPc_ERR_TMR_INVALID_MSG       Invalid timer message.
+*                               DHCPc_ERR_NONE                  DHCPv6 negotiation successfully started.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_INVALID_CFG           Invalid interface configuration or identity
+*                                                                   associations.
+*                               DHCPc_ERR_REQ_IN_USE            Request handle already pending.
+*                               DHCPc_ERR_MSG_Q                 Error posting start command to message queue.
 *
-*                                                               --- RETURNED BY DHCPc_MsgGet() : ---
-*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
 *
-*                                                               --- RETURNED BY DHCPc_TmrGet() : ---
-*                               DHCPc_ERR_TMR_NONE_AVAIL        Timer pool empty.
+*                                                               ------- RETURNED BY DHCPc_IF_InfoGet() : -------
+*                               DHCPc_ERR_IF_INFO_IF_USED       DHCPv6 client already started on interface.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_CLIENT_ID_NONE        NO hardware address & NO client identifier.
+*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
+*
+*                                                               -------- RETURNED BY DHCPc_CommGet() : ---------
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_MsgRxHandler(),
-*               DHCPc_LeaseTimeCalc(),
-*               DHCPc_LeaseTimeUpdate().
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (2) A single DHCPv6 client MAY run on an interface, alongside the interface's DHCP client(s).
+*                   It is handled by the same DHCPc task, lease timers & message buffers, but uses
+*                   its own interface information (see 'dhcp-c.h  DHCPc TIMER, INTERFACE INFORMATION, &
+*                   MESSAGE QUANTITY DEFINES  Note #5').
+*
+*               (3) DHCPc_IPv6_Start() execution is asynchronous (see 'DHCPc_StartAsync()  Note #6').  The
+*                   application SHOULD either track the request's completion or periodically call
+*                   DHCPc_IPv6_ChkStatus(); the lease is then retrieved with DHCPc_IPv6_LeaseGet().
 *
-* Note(s)     : (2) Timer value of 0 ticks/seconds allowed; next tick will expire timer.
+*               (4) The interface configuration is copied as for DHCPc_StartAsync().  Only the following
+*                   fields are used by the DHCPv6 client :
+*
+*                   (a) 'NegoRetryCnt', the number of negotiation retries.
+*                   (b) 'DiscoverRetryCnt' & 'ReqRetryCnt', the number of SOLICIT & of REQUEST, RENEW,
+*                           REBIND & DECLINE transmissions, respectively.
+*                   (c) 'BackOffDlyInitial_ms', 'BackOffDlyMax_ms' & 'RxTimeout_ms', the retransmission
+*                           delays (see 'DHCPc_IPv6_Exchange()  Note #3').
+*                   (d) The client identifier & the hardware type (see Note #5).
+*
+*               (5) A client identifier of type DHCP_CLIENT_ID_TYPE_DUID, if configured, provides the IAID
+*                   & the DUID of the DHCPv6 client (see 'dhcp-c.h  DHCPv6 DEFINES  Note #2').  Otherwise,
+*                   the client uses a DUID-LL built from the interface's hardware address & the interface
+*                   number as IAID.
+*
+*               (6) The interface MUST have a link-local IPv6 address, used as source address of the
+*                   DHCPv6 messages.
+*
+*               (7) #### The DHCPv6 client relies on the DHCPc objects of the IPv4 module & hence requires
+*                   the IPv4 module of the network protocol suite.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_TmrCfg (DHCPc_IF_INFO   *pif_info,
-                            DHCPc_COMM_MSG   tmr_msg,
-                            CPU_INT32U       time_sec,
-                            DHCPc_ERR       *perr)
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+void  DHCPc_IPv6_Start (NET_IF_NBR     if_nbr,
+                        DHCPc_CFG_IF  *pcfg,
+                        CPU_INT08U     ia_req,
+                        DHCPc_REQ     *preq,
+                        DHCPc_ERR     *perr)
 {
+#ifdef  NET_IPv4_MODULE_EN
+    CPU_BOOLEAN      if_en;
+    DHCPc_IF_INFO   *pif_info;
     DHCPc_COMM      *pcomm;
-    DHCPc_TMR_TICK   time_tick;
+    DHCPc_COMM_MSG   comm_msg;
+    NET_ERR          err_net;
 
 
-                                                                /* ----------------- VALIDATE TMR MSG ----------------- */
-    switch (tmr_msg) {
-        case DHCPc_COMM_MSG_START:
-        case DHCPc_COMM_MSG_T1_EXPIRED:
-        case DHCPc_COMM_MSG_T2_EXPIRED:
-        case DHCPc_COMM_MSG_LEASE_EXPIRED:
-             break;
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+#endif
 
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
 
-        default:
-            *perr = DHCPc_ERR_TMR_INVALID_MSG;
-             return;
+    if (preq != (DHCPc_REQ *)0) {                               /* Validate req NOT pending.                            */
+        if (preq->Pend == DEF_YES) {
+           *perr = DHCPc_ERR_REQ_IN_USE;
+            return;
+        }
     }
 
 
-    if (time_sec == DHCP_LEASE_INFINITE) {                      /* If time infinite, ...                                */
-       *perr = DHCPc_ERR_NONE;                                  /* ... rtn.                                             */
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {
+       *perr = DHCPc_ERR_IF_INVALID;
         return;
     }
 
-                                                                /* --------------------- CFG TMR ---------------------- */
-                                                                /* Get comm obj,                                        */
-    pcomm = DHCPc_CommGet((NET_IF_NBR    )pif_info->IF_Nbr,
-                          (DHCPc_COMM_MSG)tmr_msg,
-                          (DHCPc_ERR    *)perr);
+                                                                /* ------------------ VALIDATE IF CFG ----------------- */
+    if ((ia_req == DHCPc_IPv6_IA_NONE) ||                       /* Validate req'd IAs.                                  */
+       ((ia_req & ~DHCPc_IPv6_IA_ALL) != 0u)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+    if (pcfg == (DHCPc_CFG_IF *)0) {                            /* If NULL cfg, use dflt cfg (see Note #4).             */
+        pcfg = (DHCPc_CFG_IF *)&DHCPc_CfgIF_Dflt;
+    }
+
+    if ((pcfg->NegoRetryCnt     == 0u) ||                       /* Validate retry cnts.                                 */
+        (pcfg->DiscoverRetryCnt == 0u) ||
+        (pcfg->ReqRetryCnt      == 0u)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+    if ((pcfg->BackOffDlyInitial_ms == 0u) ||                   /* Validate back-off dly.                               */
+        (pcfg->BackOffDlyInitial_ms >  pcfg->BackOffDlyMax_ms)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+    if ((pcfg->RxTimeout_ms < NET_TIMEOUT_MIN_mS) ||            /* Validate rx timeout.                                 */
+        (pcfg->RxTimeout_ms > NET_TIMEOUT_MAX_mS)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    if ((pcfg->ClientID_Len != 0u) &&                           /* Validate DUID client id (see Note #5).               */
+       ((pcfg->ClientID_Len <= DHCP_CLIENT_ID_DUID_OFFSET)  ||
+        (pcfg->ClientID_Len >  DHCPc_CFG_CLIENT_ID_MAX_LEN) ||
+        (pcfg->ClientID[0]  != DHCP_CLIENT_ID_TYPE_DUID))) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+#endif
+
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+                                                                /* -------------------- GET IF INFO ------------------- */
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    pif_info = DHCPc_IF_InfoGet(if_nbr, &pcfg->ClientID[0], pcfg->ClientID_Len, DHCPc_FLAG_IPv6, perr);
+#else
+    pif_info = DHCPc_IF_InfoGet(if_nbr, (CPU_INT08U *)0, 0u, DHCPc_FLAG_IPv6, perr);
+#endif
     if (*perr != DHCPc_ERR_NONE) {
-         return;
+        DHCPc_OS_Unlock();
+        return;
     }
 
-                                                                /* ... & set tmr.                                       */
-    time_tick     = (time_sec / DHCPc_TMR_PERIOD_SEC);
-    pif_info->Tmr =  DHCPc_TmrGet((void         *)pcomm,
-                                  (DHCPc_TMR_TICK)time_tick,
-                                  (DHCPc_ERR    *)perr);
+    pif_info->ClientState = DHCP_STATE_INIT;                    /* Client in INIT state.                                */
+
+
+                                                                /* -------------------- COPY IF CFG ------------------- */
+    Mem_Copy((void     *)&pif_info->Cfg,
+             (void     *) pcfg,
+             (CPU_SIZE_T) sizeof(pif_info->Cfg));
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    DHCPc_HW_TypeSet(pif_info, perr);                           /* Set hw type (see Note #5).                           */
     if (*perr != DHCPc_ERR_NONE) {
-         DHCPc_CommFree(pcomm);
-         return;
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
+#endif
+
+                                                                /* ------------------ SET CLIENT DUID ----------------- */
+    pif_info->IPv6.IA_Req = ia_req;
+
+    DHCPc_IPv6_DUID_Set(pif_info, perr);                        /* See Note #5.                                         */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+                                                                /* --------------- POST MSG TO DHCP TASK -------------- */
+    comm_msg = DHCPc_COMM_MSG_START;
+    pcomm    = DHCPc_CommGet(pif_info, comm_msg, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    DHCPc_OS_MsgPost((void      *)pcomm,
+                     (DHCPc_ERR *)perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+       *perr = DHCPc_ERR_MSG_Q;
+        DHCPc_CommFree(pcomm);
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
     }
+
+                                                                /* -------------------- ATTACH REQ -------------------- */
+    if (preq != (DHCPc_REQ *)0) {
+        DHCPc_ReqAttach(preq, pcomm);
+    }
+
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+    DHCPc_OS_Unlock();
+
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_TmrGet()
+*                                          DHCPc_IPv6_Stop()
 *
-* Description : (1) Allocate & initialize a DHCPc timer :
+* Description : Stop the DHCPv6 client of an interface & track its completion.
 *
-*                   (a) Get        timer
-*                   (b) Validate   timer
-*                   (c) Initialize timer
-*                   (d) Insert     timer at head of timer list
-*                   (e) Return pointer to timer
-*                         OR
-*                       Null pointer & error code, on failure
+* Argument(s) : if_nbr      Interface number to stop the DHCPv6 client of.
 *
-*               (2) The timer pool is implemented as a stack :
+*               preq        Pointer to request handle (see 'DHCPc_ClientStop()  Note #6') :
 *
-*                   (a) 'DHCPc_TmrPoolPtr' points to the head of the timer pool.
+*                               Pointer to request handle to complete once stopped.
+*                               NULL pointer, if completion NOT tracked.
 *
-*                   (b) Timers' 'NextPtr's link each timer to form   the timer pool stack.
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                   (c) Timers are inserted & removed at the head of the timer pool stack.
+*                               DHCPc_ERR_NONE                  DHCPv6 client successfully stopped.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        NO DHCPv6 client started on the interface.
+*                               DHCPc_ERR_REQ_IN_USE            Request handle already pending.
+*                               DHCPc_ERR_MSG_Q                 Error posting stop command to message queue.
 *
+*                                                               ------ RETURNED BY DHCPc_OS_Lock() : -------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
 *
-*                                        Timers are
-*                                    inserted & removed
-*                                        at the head
-*                                      (see Note #2c)
+*                                                               ------ RETURNED BY DHCPc_CommGet() : -------
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
 *
-*                                             |                NextPtr
-*                                             |            (see Note #2b)
-*                                             v                   |
-*                                                                 |
-*                                          -------       -------  v    -------       -------
-*                         Timer Pool  ---->|     |------>|     |------>|     |------>|     |
-*                          Pointer         |     |       |     |       |     |       |     |
-*                                          |     |       |     |       |     |       |     |
-*                       (see Note #2a)     -------       -------       -------       -------
+* Return(s)   : none.
 *
-*                                          |                                               |
-*                                          |<------------ Pool of Free Timers ------------>|
-*                                          |                 (see Note #2)                 |
+* Caller(s)   : Application.
 *
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
 *
-* Argument(s) : pobj        Pointer to object that requests a timer.
-*               ----        Argument validated in DHCPc_TmrCfg().
-*
-*               time_tick   Initial timer value (in 'DHCPc_TMR_TICK' ticks) [see Note #3].
-*
-*               perr        Pointer to variable that will receive the return error code from this function :
-*
-*                               DHCPc_ERR_NONE                  Timer successfully allocated & initialized.
-*                               DHCPc_ERR_TMR_NONE_AVAIL        Timer pool empty.
-*
-* Return(s)   : Pointer to timer, if NO errors.
-*
-*               Pointer to NULL,  otherwise.
-*
-* Caller(s)   : DHCPc_TmrCfg().
+* Note(s)     : (1) The leased address is removed from the interface & the delegated prefix is withdrawn
+*                   before the lease is released (see 'DHCPc_IPv6_StopStateHandler()  Note #2').
 *
-* Note(s)     : (3) Timer value of 0 ticks/seconds allowed; next tick will expire timer.
+*               (2) DHCPc_IPv6_Stop() execution is asynchronous (see 'DHCPc_ClientStop()  Note #5').
 *********************************************************************************************************
 */
 
-static  DHCPc_TMR  *DHCPc_TmrGet (void            *pobj,
-                                  DHCPc_TMR_TICK   time_tick,
-                                  DHCPc_ERR       *perr)
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+void  DHCPc_IPv6_Stop (NET_IF_NBR   if_nbr,
+                       DHCPc_REQ   *preq,
+                       DHCPc_ERR   *perr)
 {
-    DHCPc_TMR  *ptmr;
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO   *pif_info;
+    DHCPc_COMM      *pcomm;
+    DHCPc_COMM_MSG   comm_msg;
 
 
-                                                                /* --------------------- GET TMR ---------------------- */
-    if (DHCPc_TmrPoolPtr != (DHCPc_TMR *)0) {                   /* If tmr pool NOT empty, get tmr from pool.            */
-        ptmr              = (DHCPc_TMR *)DHCPc_TmrPoolPtr;
-        DHCPc_TmrPoolPtr  = (DHCPc_TMR *)ptmr->NextPtr;
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+#endif
 
-    } else {                                                    /* If none avail, rtn err.                              */
-       *perr = DHCPc_ERR_TMR_NONE_AVAIL;
-        return ((DHCPc_TMR *)0);
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
     }
 
+    if (preq != (DHCPc_REQ *)0) {                               /* Validate req NOT pending.                            */
+        if (preq->Pend == DEF_YES) {
+           *perr = DHCPc_ERR_REQ_IN_USE;
+            return;
+        }
+    }
 
-                                                                /* --------------------- INIT TMR --------------------- */
-    DHCPc_TmrClr(ptmr);
-    ptmr->PrevPtr = (DHCPc_TMR *)0;
-    ptmr->NextPtr = (DHCPc_TMR *)DHCPc_TmrListHead;
-    ptmr->Obj     = pobj;
-    ptmr->TmrVal  = time_tick;                                  /* Set tmr val (in ticks).                              */
-    DEF_BIT_SET(ptmr->Flags, DHCPc_FLAG_USED);                  /* Set tmr as used.                                     */
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
 
-                                                                /* ------------- INSERT TMR INTO TMR LIST ------------- */
-    if (DHCPc_TmrListHead != (DHCPc_TMR *)0) {                  /* If list NOT empty, insert before head.               */
-        DHCPc_TmrListHead->PrevPtr = ptmr;
+    pif_info = DHCPc_IPv6_InfoGetCfgd(if_nbr);
+    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If NO DHCPv6 client on IF, ...                       */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return;
     }
-    DHCPc_TmrListHead = ptmr;                                   /* Insert tmr @ list head.                              */
 
+                                                                /* --------------- POST MSG TO DHCP TASK -------------- */
+    comm_msg = DHCPc_COMM_MSG_STOP;
+    pcomm    = DHCPc_CommGet(pif_info, comm_msg, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-   *perr =  DHCPc_ERR_NONE;
+    DHCPc_OS_MsgPost((void      *)pcomm,
+                     (DHCPc_ERR *)perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+       *perr = DHCPc_ERR_MSG_Q;
+        DHCPc_CommFree(pcomm);
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-    return (ptmr);
+                                                                /* -------------------- ATTACH REQ -------------------- */
+    if (preq != (DHCPc_REQ *)0) {
+        DHCPc_ReqAttach(preq, pcomm);
+    }
+
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+    DHCPc_OS_Unlock();
 
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_TmrFree()
-*
-* Description : (1) Free a DHCPc timer :
-*
-*                   (a) Remove timer from    timer list
-*                   (b) Clear  timer controls
-*                   (c) Free   timer back to timer pool
+*                                       DHCPc_IPv6_ChkStatus()
 *
+* Description : Return the DHCPv6 status & the last error of the DHCPv6 client of an interface.
 *
-* Argument(s) : ptmr        Pointer to a DHCPc timer.
+* Argument(s) : if_nbr      Interface number to check status.
 *
-* Return(s)   : none.
+*               perr_last   Pointer to variable that will receive the last error code of the DHCPv6 client,
+*                               or DHCPc_ERR_IF_NOT_MANAGED if NO DHCPv6 client is started on the interface.
 *
-* Caller(s)   : DHCPc_TmrTaskHandler(),
-*               DHCPc_StopStateHandler().
+* Return(s)   : DHCP status of the DHCPv6 client (see 'DHCPc_ClientChkStatus()  Return(s)') :
 *
-*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
-*               application function(s).
+*                   DHCP_STATUS_NONE,               NO DHCPv6 client on the interface.
+*                   DHCP_STATUS_CFG_IN_PROGRESS,    DHCPv6 negotiation still in progress.
+*                   DHCP_STATUS_CFGD,               DHCPv6 lease successfully obtained.
+*                   DHCP_STATUS_CFGD_NO_TMR,        DHCPv6 lease successfully obtained; however, NO
+*                                                       lease timer available.
+*                   DHCP_STATUS_FAIL,               DHCPv6 negotiation failed.
 *
-* Note(s)     : (2) #### To prevent freeing a timer already freed via previous timer free,
-*                   DHCPc_TmrFree() checks the timer's 'USED' flag BEFORE freeing the timer.
+* Caller(s)   : Application.
 *
-*                   This prevention is only best-effort since any invalid duplicate timer frees MAY be
-*                   asynchronous to potentially valid timer gets.  Thus the invalid timer free(s) MAY
-*                   corrupt the timer's valid operation(s).
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
 *
-*                   However, since the primary tasks of the DHCP client are prevented from running
-*                   concurrently (see 'dhcp-c.h  Note #2'), it is NOT necessary to protect DHCPc
-*                   timer resources from possible corruption since no asynchronous access from other
-*                   task is possible.
+* Note(s)     : (1) See 'DHCPc_ClientChkStatus()  Note #2'.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_TmrFree (DHCPc_TMR  *ptmr)
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+DHCPc_STATUS  DHCPc_IPv6_ChkStatus (NET_IF_NBR   if_nbr,
+                                    DHCPc_ERR   *perr_last)
 {
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    CPU_BOOLEAN   used;
-#endif
-    DHCPc_TMR    *pprev;
-    DHCPc_TMR    *pnext;
-
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO  *pif_info;
+    DHCPc_STATUS    status;
+    CPU_SR_ALLOC();
 
-                                                                /* ------------------ VALIDATE PTR -------------------- */
-    if (ptmr == (DHCPc_TMR *)0) {
-        return;
-    }
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-                                                                /* ---------------- VALIDATE TMR USED ----------------- */
-    used = DEF_BIT_IS_SET(ptmr->Flags, DHCPc_FLAG_USED);
-    if (used != DEF_YES) {                                      /* If tmr NOT used, ...                                 */
-        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr_last == DEF_NULL) {                                /* Validate perr_last ptr.                              */
+        CPU_SW_EXCEPTION();
     }
 #endif
 
-                                                                /* ------------- REMOVE TMR FROM MSG LIST ------------- */
-    pprev = ptmr->PrevPtr;
-    pnext = ptmr->NextPtr;
-    if (pprev != (DHCPc_TMR *)0) {                              /* If ptmr is NOT   the head of tmr list, ...           */
-        pprev->NextPtr    = pnext;                              /* ... set pprev's NextPtr to skip ptmr.                */
-    } else {                                                    /* Else set pnext as head of tmr list.                  */
-        DHCPc_TmrListHead = pnext;
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr_last = DHCPc_ERR_INIT_INCOMPLETE;
+        return (DHCP_STATUS_NONE);
     }
-    if (pnext != (DHCPc_TMR *)0) {                              /* If ptmr is NOT @ the tail of tmr list, ...           */
-        pnext->PrevPtr    = pprev;                              /* ... set pnext's PrevPtr to skip ptmr.                */
+
+    CPU_CRITICAL_ENTER();
+    pif_info = DHCPc_IPv6_InfoGetCfgd(if_nbr);
+    if (pif_info != (DHCPc_IF_INFO *)0) {
+       *perr_last = pif_info->LastErr;
+        status    = pif_info->LeaseStatus;
+
+    } else {
+       *perr_last = DHCPc_ERR_IF_NOT_MANAGED;
+        status    = DHCP_STATUS_NONE;
     }
+    CPU_CRITICAL_EXIT();
 
-                                                                /* ---------------------- CLR TMR --------------------- */
-    DEF_BIT_CLR(ptmr->Flags, DHCPc_FLAG_USED);                  /* Set tmr as NOT used.                                 */
-#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
-    DHCPc_TmrClr(ptmr);
-#endif
 
-                                                                /* --------------------- FREE TMR --------------------- */
-    ptmr->NextPtr    = DHCPc_TmrPoolPtr;
-    DHCPc_TmrPoolPtr = ptmr;
+    return (status);
+#else
+   *perr_last = DHCPc_ERR_IPv4_NOT_PRESENT;
+    return (DHCP_STATUS_FAIL);
+#endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_TmrClr()
+*                                        DHCPc_IPv6_LeaseGet()
 *
-* Description : Clear DHCPc timer controls.
+* Description : Get the DHCPv6 lease of an interface.
 *
-* Argument(s) : ptmr        Pointer to a DHCPc timer.
-*               ----        Argument validated in DHCPc_TmrInit(),
-*                                    checked   in DHCPc_TmrGet(),
-*                                    checked   in DHCPc_TmrFree().
+* Argument(s) : if_nbr      Interface number to get the DHCPv6 lease of.
+*
+*               please      Pointer to variable that will receive the DHCPv6 lease.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPv6 lease successfully returned.
+*                               DHCPc_ERR_NULL_PTR              Argument 'please' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        NO DHCPv6 client started on the interface.
+*
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : --------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : NetTmr_Init(),
-*               DHCPc_TmrGet(),
-*               DHCPc_TmrFree().
+* Caller(s)   : Application.
 *
-* Note(s)     : none.
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) The lease returned is the lease applied to the interface; a lease ONLY offered by a
+*                   server is NEVER returned (see 'dhcp-c.h  DHCPc DHCPv6 INFORMATION DATA TYPE  Note #3').
+*                   Its identity associations are cleared while NO lease is held (see 'dhcp-c.h  DHCPc
+*                   DHCPv6 LEASE DATA TYPE  Note #1').
+*
+*               (2) DHCPc_IPv6_LeaseGet() acquires the global DHCPc lock to get the interface information
+*                   & the interface lock to read its lease (see 'dhcp-c.h  Note #2d').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_TmrClr (DHCPc_TMR  *ptmr)
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+void  DHCPc_IPv6_LeaseGet (NET_IF_NBR         if_nbr,
+                           DHCPc_IPv6_LEASE  *please,
+                           DHCPc_ERR         *perr)
 {
-    ptmr->PrevPtr = (DHCPc_TMR     *)0;
-    ptmr->NextPtr = (DHCPc_TMR     *)0;
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO  *pif_info;
+
+
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+
+    if (please == (DHCPc_IPv6_LEASE *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
+
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #2.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+    pif_info = DHCPc_IPv6_InfoGetCfgd(if_nbr);
+    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If NO DHCPv6 client on IF, ...                       */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+                                                                /* ------------------ ACQUIRE IF LOCK ----------------- */
+    DHCPc_OS_IF_Lock(pif_info->ID, perr);                       /* See Note #2.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
+    }
 
-    ptmr->Obj     = (void          *)0;
-    ptmr->TmrVal  =  0;
+                                                                /* -------------------- COPY LEASE -------------------- */
+    Mem_Copy((void     *) please,
+             (void     *)&pif_info->IPv6.Lease,
+             (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
+
+                                                                /* ---------------- RELEASE DHCPc LOCKS --------------- */
+    DHCPc_OS_IF_Unlock(pif_info->ID);
+    DHCPc_OS_Unlock();
 
-    ptmr->Flags   =  DHCPc_FLAG_NONE;
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                          DHCPc_InitSock()
+*                                     DHCPc_IPv6_PrefixFnctSet()
 *
-* Description : Initialize a socket.
+* Description : Configure the function that receives the prefixes delegated to the DHCPv6 clients.
 *
-* Argument(s) : ip_addr_local       Local IP address to bind to, in network order.
+* Argument(s) : prefix_fnct     Pointer to prefix function :
 *
-* Return(s)   : Socket descriptor/handle identifier, if NO errors.
+*                                   Pointer to function to call on each delegated prefix change.
+*                                   NULL pointer, if NO prefix function.
 *
-*               NET_SOCK_BSD_ERR_OPEN,               otherwise.
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-* Caller(s)   : DHCPc_InitStateHandler(),
-*               DHCPc_RenewRebindStateHandler(),
-*               DHCPc_StopStateHandler().
+*                               DHCPc_ERR_NONE                  Prefix function successfully configured.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *
-* Note(s)     : none.
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc DHCPv6 PREFIX FUNCTION DATA TYPE'.
 *********************************************************************************************************
 */
 
-static  NET_SOCK_ID  DHCPc_InitSock (NET_IPv4_ADDR  ip_addr_local,
-                                     NET_IF_NBR     if_nbr)
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+void  DHCPc_IPv6_PrefixFnctSet (DHCPc_IPv6_PREFIX_FNCT   prefix_fnct,
+                                DHCPc_ERR               *perr)
 {
-    NET_SOCK_ID         sock_id;
-    NET_SOCK_ADDR_IPv4  local_addr;
-    NET_SOCK_ADDR_LEN   local_addr_size;
-    CPU_BOOLEAN         rtn_status;
-    CPU_BOOLEAN         success;
-    NET_ERR             err_net;
-
+#ifdef  NET_IPv4_MODULE_EN
+    CPU_SR_ALLOC();
 
-                                                                /* -------------------- OPEN SOCK --------------------- */
-    sock_id = NetApp_SockOpen((NET_SOCK_PROTOCOL_FAMILY) NET_SOCK_ADDR_FAMILY_IP_V4,
-                              (NET_SOCK_TYPE           ) NET_SOCK_TYPE_DATAGRAM,
-                              (NET_SOCK_PROTOCOL       ) NET_SOCK_PROTOCOL_UDP,
-                              (CPU_INT16U              ) 0,
-                              (CPU_INT32U              ) 0,
-                              (NET_ERR                *)&err_net);
 
-    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
-        return (NET_SOCK_BSD_ERR_OPEN);
-    }
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+#endif
 
-                                                                /* ------------ SET IF NBR FOR THE SOCKET ------------ */
-    success = NetSock_CfgIF(sock_id,
-                            if_nbr,
-                           &err_net);
-    if (success != DEF_OK) {
-        return (NET_SOCK_BSD_ERR_OPEN);
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
     }
 
-                                                                /* ------------------ SET LOCAL ADDR ------------------ */
-    local_addr_size = sizeof(local_addr);
-    Mem_Clr((void     *)&local_addr,
-            (CPU_SIZE_T) local_addr_size);
-    local_addr.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
-    local_addr.Addr       = ip_addr_local;
-    local_addr.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_CLIENT);
+    CPU_CRITICAL_ENTER();
+    DHCPc_IPv6_PrefixFnct = prefix_fnct;
+    CPU_CRITICAL_EXIT();
 
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
+}
+#endif
 
-                                                                /* -------------------- BIND SOCK --------------------- */
-    rtn_status = NetApp_SockBind((NET_SOCK_ID      ) sock_id,
-                                 (NET_SOCK_ADDR   *)&local_addr,
-                                 (NET_SOCK_ADDR_LEN) local_addr_size,
-                                 (CPU_INT16U       ) 0,
-                                 (CPU_INT32U       ) 0,
-                                 (NET_ERR         *)&err_net);
 
-    if (rtn_status != DEF_OK) {
-        NetApp_SockClose((NET_SOCK_ID ) sock_id,
-                         (CPU_INT32U  ) 0,
-                         (NET_ERR    *)&err_net);
 
-        return (NET_SOCK_BSD_ERR_OPEN);
+/*
+*********************************************************************************************************
+*                                           DHCPc_ReqInit()
+*
+* Description : Initialize a request handle.
+*
+* Argument(s) : preq            Pointer to request handle to initialize.
+*
+*               callback_fnct   Pointer to request completion callback function (see Note #2) :
+*
+*                                   Pointer to callback function to call once request completes.
+*                                   NULL pointer, if NO callback function.
+*
+*               p_callback_arg  Pointer to argument passed to the callback function.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Request handle successfully initialized.
+*                               DHCPc_ERR_NULL_PTR              Argument 'preq' passed a NULL pointer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) The request handle MUST be initialized once before its first use & MUST NOT be
+*                   re-initialized while pending; it MAY be re-used for any number of requests, one at a
+*                   time.
+*
+*               (2) See 'dhcp-c.h  DHCPc REQUEST DATA TYPE  Note #3'.
+*********************************************************************************************************
+*/
+
+void  DHCPc_ReqInit (DHCPc_REQ                *preq,
+                     DHCPc_REQ_CALLBACK_FNCT   callback_fnct,
+                     void                     *p_callback_arg,
+                     DHCPc_ERR                *perr)
+{
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+#endif
+
+    if (preq == (DHCPc_REQ *)0) {                               /* Validate req ptr.                                    */
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
     }
 
+    preq->IF_Nbr       =  0;
+    preq->Pend         =  DEF_NO;
+    preq->Status       =  DHCP_STATUS_NONE;
+    preq->Err          =  DHCPc_ERR_NONE;
+    preq->CallbackFnct =  callback_fnct;
+    preq->CallbackArg  =  p_callback_arg;
 
-    return (sock_id);
+   *perr = DHCPc_ERR_NONE;
 }
 
 
 /*
 *********************************************************************************************************
-*                                      DHCPc_InitStateHandler()
+*                                           DHCPc_ReqWait()
 *
-* Description : (1) Perform actions associated with the INIT state :
+* Description : (1) Wait for a request to complete :
 *
-*                   (a) Get      interface's hardware address
-*                   (b) Initialize socket
-*                   (c) Start    interface's dynamic configuration
-*                   (d) Transmit DISCOVER & select OFFER
-*                   (e) Transmit REQUEST  & get    reply
-*                   (f) Configure interface & lease timer
+*                   (a) Check    request completion & register as request waiter
+*                   (b) Wait  on request waiter's completion signal
+*                   (c) Check    request completion & free request waiter
+*                   (d) Return   request's result
 *
 *
-* Argument(s) : pif_info    Pointer to DHCP interface information.
-*               --------    Argument validated in DHCPc_MsgRxHandler().
+* Argument(s) : preq        Pointer to request handle to wait on.
+*
+*               timeout_ms  Maximum time to wait (in milliseconds) :
+*
+*                               0,                  wait forever.
+*                               Any other value,    number of milliseconds to wait.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  DHCP lease successfully negotiated &
-*                                                                   interface configured (timer     set).
-*                               DHCPc_ERR_NONE_NO_TMR           DHCP lease successfully negotiated &
-*                                                                   interface configured (timer NOT set).
-*                               DHCPc_ERR_NONE_LOCAL_LINK       DHCP lease negotiation error, interface
-*                                                                   configured with a link-local address.
-*                               DHCPc_ERR_LOCAL_LINK            Error configuring dynamic link-local address.
+*                               DHCPc_ERR_NULL_PTR              Argument 'preq' passed a NULL pointer.
+*                               DHCPc_ERR_REQ_WAIT_NONE_AVAIL   NO request waiter available.
+*                               DHCPc_ERR_REQ_TIMEOUT           Request NOT completed before timeout.
+*
+*                                                               ------- RETURNED BY DHCPc_OS_Lock() : --------
+*                               DHCPc_OS_ERR_LOCK               Error acquiring DHCPc lock.
+*
+*                                                               ------ RETURNED BY DHCPc_OS_ReqWait() : ------
+*                               DHCPc_OS_ERR_REQ_SIGNAL         Request signal NOT received.
+*
+*                                                               ------------- REQUEST RESULT : ---------------
+*                               Request's return error code, once completed.
+*
+* Return(s)   : Interface's DHCP status, once request completed (see Note #3).
+*
+*               DHCP_STATUS_CFG_IN_PROGRESS,                     otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (2) Each waiting task uses its own request waiter, i.e. its own completion signal, which is
+*                   ONLY signaled by the completion of the request it waits on (see 'DHCPc_ReqDone()
+*                   Note #2') :
+*
+*                   (a) The request completion is checked & the request waiter registered with the DHCPc
+*                       lock acquired; since the request is set as completed with the same lock acquired,
+*                       its completion can NOT be missed between the check & the wait.
+*
+*                   (b) Once awakened, the request completion is checked again; the request's state, &
+*                       NOT the signal, determines whether the request completed.
+*
+*                   (c) A completion signal MAY remain from a previous waiter whose wait timed out just
+*                       before the signal was posted; it is hence cleared when the request waiter is
+*                       registered.
+*
+*                   ####  Up to DHCPc_NBR_REQ_WAIT tasks MAY wait on requests at the same time (see
+*                   'dhcp-c.h  DHCPc TIMER, INTERFACE INFORMATION, & MESSAGE QUANTITY DEFINES  Note #6').
+*
+*               (3) See 'dhcp-c.h  DHCPc REQUEST DATA TYPE  Note #2'.
+*
+*               (4) DHCPc_ReqWait() MUST NOT be called from the request's callback function.
+*********************************************************************************************************
+*/
+
+DHCPc_STATUS  DHCPc_ReqWait (DHCPc_REQ   *preq,
+                             CPU_INT32U   timeout_ms,
+                             DHCPc_ERR   *perr)
+{
+    CPU_INT32U    tick_rate;
+    CPU_INT32U    timeout_tick;
+    CPU_INT16U    ix;
+    CPU_BOOLEAN   done;
+    DHCPc_ERR     err;
+    CPU_SR_ALLOC();
+
+
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
+#endif
+
+    if (preq == (DHCPc_REQ *)0) {                               /* Validate req ptr.                                    */
+       *perr = DHCPc_ERR_NULL_PTR;
+        return (DHCP_STATUS_NONE);
+    }
+
+                                                                /* Conv timeout to ticks, rounded up, w/o ovf.          */
+    tick_rate     =  DHCPc_OS_TimeGetRate_tick();
+    timeout_tick  = (timeout_ms / DEF_TIME_NBR_mS_PER_SEC) * tick_rate;
+    timeout_tick += (((timeout_ms % DEF_TIME_NBR_mS_PER_SEC) * tick_rate) + (DEF_TIME_NBR_mS_PER_SEC - 1u)) /
+                       DEF_TIME_NBR_mS_PER_SEC;
+
+                                                                /* ---------------- CHK REQ COMPLETION ---------------- */
+    DHCPc_OS_Lock(&err);                                        /* See Note #2a.                                        */
+    if (err != DHCPc_OS_ERR_NONE) {
+       *perr = err;
+        return (DHCP_STATUS_CFG_IN_PROGRESS);
+    }
+
+    done = (preq->Pend != DEF_YES) ? DEF_YES : DEF_NO;
+
+    if (done != DEF_YES) {                                      /* If req pending, ...                                  */
+        ix = 0u;                                                /* ... get free req waiter ...                          */
+        while ((ix                   <  DHCPc_NBR_REQ_WAIT) &&
+               (DHCPc_ReqWaitTbl[ix] != (DHCPc_REQ *)0)) {
+            ix++;
+        }
+
+        if (ix >= DHCPc_NBR_REQ_WAIT) {
+            DHCPc_OS_Unlock();
+           *perr = DHCPc_ERR_REQ_WAIT_NONE_AVAIL;
+            return (DHCP_STATUS_CFG_IN_PROGRESS);
+        }
+
+        DHCPc_ReqWaitTbl[ix] = preq;                            /* ... & register as its waiter (see Note #2c).         */
+        DHCPc_OS_ReqSignalClr(ix);
+    }
+
+    DHCPc_OS_Unlock();
+
+    if (done != DEF_YES) {
+                                                                /* ------------- WAIT ON REQ COMPLETION --------------- */
+        DHCPc_OS_ReqWait(ix, timeout_tick, &err);
+
+                                                                /* ---------- CHK REQ COMPLETION & FREE WAITER -------- */
+        CPU_CRITICAL_ENTER();
+        done                 = (preq->Pend != DEF_YES) ? DEF_YES : DEF_NO;
+        DHCPc_ReqWaitTbl[ix] = (DHCPc_REQ *)0;                  /* See Note #2b.                                        */
+        CPU_CRITICAL_EXIT();
+
+        if ((done != DEF_YES)                 &&
+            (err  != DHCPc_OS_ERR_NONE)       &&
+            (err  != DHCPc_OS_ERR_REQ_TIMEOUT)) {
+           *perr = err;
+            return (DHCP_STATUS_CFG_IN_PROGRESS);
+        }
+    }
+
+    if (done != DEF_YES) {
+       *perr = DHCPc_ERR_REQ_TIMEOUT;
+        return (DHCP_STATUS_CFG_IN_PROGRESS);
+    }
+
+                                                                /* ------------------ RTN REQ RESULT ------------------ */
+   *perr = preq->Err;
+
+    return (preq->Status);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_EmulRun()
+*
+* Description : (1) Run the client emulation to load test a DHCP server :
+*
+*                   (a) Validate  interface & emulation configuration
+*                   (b) Prepare   shared interface information
+*                   (c) Open      emulation socket
+*                   (d) Run       emulation event loop :
+*
+*                       (1) Start virtual clients at the configured arrival rate
+*                       (2) Receive & dispatch server replies
+*                       (3) Retransmit unanswered messages
+*
+*                   (e) Compute   emulation statistics
+*
+*
+* Argument(s) : if_nbr      Interface number to run the emulation on.
+*
+*               pcfg        Pointer to emulation configuration (see 'dhcp-c.h  DHCPc EMULATION DATA TYPES').
+*
+*               pstats      Pointer to variable that will receive the emulation statistics.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Emulation successfully completed.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_INVALID_CFG           Invalid emulation configuration.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
-*                               DHCPc_ERR_IF_CFG_STATE          Error setting interface configuration state.
 *                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_EMUL_IN_USE           Client emulation already running.
 *                               DHCPc_ERR_INIT_SOCK             Error initializing socket.
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
 *
-*                                                               -------- RETURNED BY DHCPc_Discover() : ---------
-*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
-*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
-*                               DHCPc_ERR_TX                    Transmit error.
-*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
-*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
-*                               DHCPc_ERR_RX                    Receive error.
+*                                                               ---- RETURNED BY DHCPc_ParamReqBuild() : ----
+*                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
 *
-*                                                               ---------- RETURNED BY DHCPc_Req() : ------------
-*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
-*                               DHCPc_ERR_RX_NAK                NAK message received from server.
-*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
-*                               DHCPc_ERR_TX                    Transmit error.
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
-*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
-*                               DHCPc_ERR_RX                    Receive error.
+* Return(s)   : none.
 *
-*                                                               -------- RETURNED BY DHCPc_AddrCfg() : ----------
-*                               DHCPc_ERR_IF_CFG                Error configuring the interface's network.
+* Caller(s)   : Application.
 *
-* Return(s)   : none.
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
 *
-* Caller(s)   : DHCPc_MsgRxHandler().
+* Note(s)     : (2) The emulation runs in the caller's task & returns only once every virtual client is
+*                   either bound, refused or failed.  The global DHCPc lock is NOT acquired (see 'dhcp-c.h
+*                   Note #2c'), so the DHCPc tasks keep managing the leases of the configured interfaces.
 *
-* Note(s)     : (2) #### This implementation of the DHCP client presumes an Ethernet hardware type.
+*               (3) The virtual clients share a single interface information structure, loaded with the
+*                   state of a virtual client before each message is built with DHCPc_TxMsgPrepare() or
+*                   validated with DHCPc_RxReplyValidate(), so that the emulation exercises the same code
+*                   paths as the real client.
 *
-*               (3) From RFC 2131, section 'Constructing and sending DHCP messages', "DHCP messages broadcast
-*                   by a client prior to that client obtaining its IP address must have the source address
-*                   field in the IP header set to 0".  Starting the dynamic configuration results in all
-*                   addresses being removed from the interface and set to 0.
+*                   Its last received message is a separate buffer, loaded with the address offered to the
+*                   virtual client, so that the reply in the receive buffer is NEVER modified.
 *
-*               (4) RFC #2131, section 'Client-Server interaction - allocating a network address', states
-*                   that "The client SHOULD wait a mininum of ten seconds before restarting the
-*                   configuration process to avoid excessive network traffic in case of looping".
+*               (4) The shared interface information is flagged as sharing its interface (see
+*                   'DHCPc_TxMsgPrepare()  Note #10'), so that the server broadcasts its replies to the
+*                   virtual clients.
+*
+*               (5) #### The emulation socket is bound to the client port of the interface.  No DHCP
+*                   negotiation should be in progress on the same interface while the emulation runs.
+*
+*                   #### The rate at which the server replies are received is bounded by the socket receive
+*                   queue size of the network stack (see 'net_cfg.h  NET_SOCK_CFG_RX_Q_SIZE_OCTET').
+*
+*               (6) The emulation configuration is validated even when DHCPc_CFG_ARG_CHK_EXT_EN is disabled,
+*                   since a null number of clients, arrival rate or timeout would never end the emulation.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
-                                      DHCPc_ERR      *perr)
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)
+void  DHCPc_EmulRun (NET_IF_NBR         if_nbr,
+                     DHCPc_EMUL_CFG    *pcfg,
+                     DHCPc_EMUL_STATS  *pstats,
+                     DHCPc_ERR         *perr)
 {
-    NET_IF_NBR      if_nbr;
+#ifdef  NET_IPv4_MODULE_EN
     CPU_BOOLEAN     if_en;
     CPU_INT08U      addr_hw_len;
     CPU_INT08U      addr_hw[NET_IF_ETHER_ADDR_SIZE];
+    DHCPc_IF_INFO  *pif_info;
     NET_SOCK_ID     sock_id;
-    CPU_INT16U      nego_retry_cnt;
-    CPU_BOOLEAN     nego_done;
-    CPU_BOOLEAN     nego_dly;
-#if (DHCPc_CFG_ADDR_VALIDATE_EN == DEF_ENABLED)
-    DHCPc_MSG      *pmsg;
-    DHCP_MSG_HDR   *pmsg_hdr;
-    NET_IPv4_ADDR   proposed_addr;
-#endif
+    CPU_INT32U      tick_rate;
+    CPU_INT32U      timeout_tick;
+    CPU_INT32U      tmr_period_tick;
+    CPU_INT32U      time_start_tick;
+    CPU_INT32U      time_tmr_tick;
+    CPU_INT32U      time_cur_tick;
+    CPU_INT32U      time_elapsed_tick;
+    CPU_INT32U      client_due;
+    CPU_INT16U      ix;
     NET_ERR         err_net;
 
 
-    if_nbr = pif_info->IF_Nbr;
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (perr == DEF_NULL) {                                     /* Validate perr ptr.                                   */
+        CPU_SW_EXCEPTION();
+    }
 
-    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
-    if (if_en != DEF_YES) {                                     /* If IF NOT enabled, ...                               */
-       *perr = DHCPc_ERR_IF_INVALID;                            /* ... rtn err.                                         */
+    if ((pcfg   == (DHCPc_EMUL_CFG   *)0) ||                    /* Validate cfg & stats ptrs.                           */
+        (pstats == (DHCPc_EMUL_STATS *)0)) {
+       *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
+#endif
 
-                                                                /* ------------------- GET HW ADDR -------------------- */
-    addr_hw_len = NET_IF_ETHER_ADDR_SIZE;                       /* See Note #2.                                         */
+    if ((pcfg->ClientNbr   == 0u) ||                            /* Validate emulation cfg (see Note #6).                */
+        (pcfg->ArrivalRate == 0u) ||
+        (pcfg->Timeout_ms  == 0u)) {
+       *perr = DHCPc_ERR_INVALID_CFG;
+        return;
+    }
+
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit.                          */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
+
+                                                                /* ------------------ VALIDATE IF --------------------- */
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);
+    if (if_en != DEF_YES) {
+       *perr = DHCPc_ERR_IF_INVALID;
+        return;
+    }
+
+    addr_hw_len = NET_IF_ETHER_ADDR_SIZE;
     NetIF_AddrHW_Get( if_nbr,
                      &addr_hw[0],
                      &addr_hw_len,
@@ -2806,95 +3879,108 @@ static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
         return;
     }
 
-                                                                /* -------------------- INIT SOCK --------------------- */
-    sock_id = DHCPc_InitSock(NET_IPv4_ADDR_THIS_HOST, if_nbr);
-    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
-       *perr = DHCPc_ERR_INIT_SOCK;
+    tick_rate = DHCPc_OS_TimeGetRate_tick();
+    if (tick_rate == 0u) {
+       *perr = DHCPc_ERR_INVALID_CFG;
         return;
     }
 
-                                                                /* ---------------- START DYNAMIC CFG ----------------- */
-    NetIPv4_CfgAddrAddDynamicStart(if_nbr, &err_net);           /* See Note #3.                                         */
-    if (err_net != NET_IPv4_ERR_NONE) {
-       *perr = DHCPc_ERR_IF_CFG_STATE;
+                                                                /* ---------------- ACQUIRE EMULATION ----------------- */
+    DHCPc_OS_Lock(perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
         return;
     }
 
+    if (DHCPc_EmulActive == DEF_YES) {
+        DHCPc_OS_Unlock();
+       *perr = DHCPc_ERR_EMUL_IN_USE;
+        return;
+    }
 
-                                                                /* ------------ TX DISCOVER & SELECT OFFER ------------ */
-    nego_retry_cnt = 0;
-    nego_done      = DEF_NO;
-    nego_dly       = DEF_NO;
+    DHCPc_EmulActive = DEF_YES;
+    DHCPc_OS_Unlock();
 
-    while ((nego_retry_cnt <  DHCPc_CFG_NEGO_RETRY_CNT) &&
-           (nego_done      != DEF_YES)) {
 
-        pif_info->ClientState = DHCP_STATE_INIT;
+                                                                /* ------------- PREPARE SHARED IF INFO --------------- */
+    pif_info = &DHCPc_EmulIF_Info;                              /* See Note #3.                                         */
+    DHCPc_IF_InfoClr(pif_info);
 
-        if (nego_dly == DEF_YES) {                              /* Dly nego, if req'd (see Note #4).                    */
-            KAL_Dly(DHCP_INIT_DLY_MS);
-        }
+    pif_info->IF_Nbr    =  if_nbr;
+    pif_info->MsgPtr    = &DHCPc_EmulMsgLast;                   /* See Note #3.                                         */
+    Mem_Clr((void     *)&DHCPc_EmulMsgLast,
+            (CPU_SIZE_T) sizeof(DHCPc_EmulMsgLast));
+    pif_info->Flags     =  DHCPc_FLAG_ADDR_SHARED;              /* See Note #4.                                         */
 
-        DHCPc_Discover(sock_id, pif_info, &addr_hw[0], addr_hw_len, perr);
-        if (*perr != DHCPc_ERR_NONE) {
-            nego_retry_cnt++;
-            nego_dly = DEF_YES;
+    pif_info->Cfg.ClientID[0]  = DHCP_HTYPE_ETHER;              /* Client id : hw type + hw addr.                       */
+    pif_info->Cfg.ClientID_Len = DHCPc_EMUL_CLIENT_ID_LEN;
 
-        } else {                                                /* DISCOVER tx'd & OFFER(s) rx'd, ..                    */
-                                                                /* .. tx REQUEST & get reply.                           */
-            pif_info->ClientState = DHCP_STATE_SELECTING;
+    DHCPc_ParamReqBuild(pif_info, (DHCPc_OPT_CODE *)0, 0u, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_EmulActive = DEF_NO;
+        return;
+    }
 
-            DHCPc_Req(sock_id, pif_info, &addr_hw[0], addr_hw_len, perr);
+    DHCPc_TxOptTmplBuild(pif_info);
 
-            switch (*perr) {
-                case DHCPc_ERR_NONE:
-#if (DHCPc_CFG_ADDR_VALIDATE_EN == DEF_ENABLED)
-                                                                /* Get proposed addr.                                   */
-                     pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;
-                     pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+    for (ix = 0u; ix < DHCPc_CFG_EMUL_MAX_NBR_CLIENT; ix++) {
+        DHCPc_EmulClientTbl[ix].ClientState = DHCP_STATE_NONE;
+    }
 
-                     NET_UTIL_VAL_COPY_32(&proposed_addr, &pmsg_hdr->yiaddr);
+    Mem_Clr((void     *)pstats,
+            (CPU_SIZE_T)sizeof(DHCPc_EMUL_STATS));
+    pstats->LatencyMin_ms = DEF_INT_32U_MAX_VAL;
 
-                                                                /* Validate proposed addr.                              */
-                     DHCPc_AddrValidate(               if_nbr,
-                                        (NET_IPv4_ADDR)proposed_addr,
-                                        (CPU_INT32U   )DHCP_ADDR_VALIDATE_WAIT_TIME_MS,
-                                        (DHCPc_ERR   *)perr);
-                     switch (*perr) {
-                         case DHCPc_ERR_NONE:
-                         case DHCPc_ERR_ADDR_VALIDATE:
-                              nego_done = DEF_YES;
-                              break;
+    DHCPc_EmulClientCnt      = 0u;
+    DHCPc_EmulLatencySum_sec = 0u;
+    DHCPc_EmulLatencySum_ms  = 0u;
+
+                                                                /* --------------------- OPEN SOCK -------------------- */
+    sock_id = DHCPc_InitSock(NET_IPv4_ADDR_THIS_HOST, if_nbr);  /* See Note #5.                                         */
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
+        DHCPc_EmulActive = DEF_NO;
+       *perr = DHCPc_ERR_INIT_SOCK;
+        return;
+    }
 
+                                                                /* ------------------ RUN EVENT LOOP ------------------ */
+    timeout_tick    = DHCPc_EmulTimeGet_tick(pcfg->Timeout_ms, tick_rate);
+    tmr_period_tick = DHCPc_EmulTimeGet_tick(DHCPc_EMUL_TMR_PERIOD_MS, tick_rate);
 
-                         case DHCPc_ERR_ADDR_USED:
-                         default:
-                             DHCPc_DeclineRelease((NET_SOCK_ID    ) sock_id,
-                                                  (DHCPc_IF_INFO *) pif_info,
-                                                  (DHCPc_MSG_TYPE ) DHCP_MSG_DECLINE,
-                                                  (CPU_INT08U    *)&addr_hw[0],
-                                                  (CPU_INT08U     ) addr_hw_len,
-                                                  (DHCPc_ERR     *) perr);
-                             nego_retry_cnt++;
-                             nego_dly = DEF_YES;
-                             break;
-                     }
-#else
-                     nego_done = DEF_YES;
-#endif
-                     break;
+    time_start_tick = DHCPc_OS_TimeGet_tick();
+    time_tmr_tick   = time_start_tick;
+    ix              = 0u;
 
+    while ((pstats->ClientStartCtr <  pcfg->ClientNbr) ||
+           (DHCPc_EmulClientCnt    >  0u)) {
 
-                case DHCPc_ERR_RX_NAK:
-                     nego_retry_cnt++;
-                     nego_dly = DEF_YES;
-                     break;
+        time_cur_tick     = DHCPc_OS_TimeGet_tick();
+        time_elapsed_tick = time_cur_tick - time_start_tick;
 
+                                                                /* Start clients due at arrival rate (see Note #1d1).   */
+        client_due  = (time_elapsed_tick / tick_rate) * pcfg->ArrivalRate;
+        client_due += ((time_elapsed_tick % tick_rate) * pcfg->ArrivalRate) / tick_rate;
+        if (client_due > pcfg->ClientNbr) {
+            client_due = pcfg->ClientNbr;
+        }
 
-                default:
-                     nego_done = DEF_YES;
-                     break;
+        while ((pstats->ClientStartCtr <  client_due) &&
+               (DHCPc_EmulClientCnt    <  DHCPc_CFG_EMUL_MAX_NBR_CLIENT)) {
+            while (DHCPc_EmulClientTbl[ix].ClientState != DHCP_STATE_NONE) {
+                ix++;                                           /* Srch free client from last started client.           */
+                if (ix >= DHCPc_CFG_EMUL_MAX_NBR_CLIENT) {
+                    ix = 0u;
+                }
             }
+
+            DHCPc_EmulClientStart(sock_id, ix, addr_hw[NET_IF_ETHER_ADDR_SIZE - 1u], pstats);
+        }
+
+        DHCPc_EmulRx(sock_id, pcfg, pstats, tick_rate);         /* Rx & dispatch reply (see Note #1d2).                 */
+
+                                                                /* Retransmit unanswered msgs (see Note #1d3).          */
+        if ((time_cur_tick - time_tmr_tick) >= tmr_period_tick) {
+            DHCPc_EmulTmrChk(sock_id, pcfg, pstats, timeout_tick, tick_rate);
+            time_tmr_tick = time_cur_tick;
         }
     }
 
@@ -2902,2344 +3988,11039 @@ static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
                      (CPU_INT32U  ) 0,
                      (NET_ERR    *)&err_net);
 
+                                                                /* ------------------ COMPUTE STATS ------------------- */
+    time_elapsed_tick  = DHCPc_OS_TimeGet_tick() - time_start_tick;
+    pstats->Elapsed_ms = DHCPc_EmulTimeGet_ms(time_elapsed_tick, tick_rate);
 
-                                                                /* ------------- CFG IF WITH NEGO'D LEASE ------------- */
-    switch (*perr) {
-        case DHCPc_ERR_NONE:                                    /* If lease successfully acquired, ...                  */
-
-             DHCPc_AddrCfg(pif_info, perr);                     /* ... cfg net addr                ...                  */
-             if (*perr == DHCPc_ERR_NONE) {
-                 DHCPc_LeaseTimeCalc(pif_info, perr);           /* ... calc lease time & set tmr.                       */
-                 if (*perr != DHCPc_ERR_NONE) {                 /* If err setting tmr, ...                              */
-                    *perr = DHCPc_ERR_NONE_NO_TMR;              /* ... rtn err         ...                              */
-                 }
-
-                 pif_info->ClientState = DHCP_STATE_BOUND;      /* ... & set client state to BOUND.                     */
-
-             } else {                                           /* If err cfg'ing IF, ...                               */
-                                                                /* ... stop dynamic cfg & set client state to NONE.     */
-                 NetIPv4_CfgAddrAddDynamicStop(if_nbr, &err_net);
-                 pif_info->ClientState = DHCP_STATE_NONE;
-             }
-             break;
-
+    if (pstats->Elapsed_ms > 0u) {                              /* Calc completed transactions per sec, w/o ovf.        */
+        pstats->TransPerSec  =  (pstats->ClientBoundCtr / pstats->Elapsed_ms) * DEF_TIME_NBR_mS_PER_SEC;
+        pstats->TransPerSec += ((pstats->ClientBoundCtr % pstats->Elapsed_ms) * DEF_TIME_NBR_mS_PER_SEC) /
+                                 pstats->Elapsed_ms;
+    }
 
-        case DHCPc_ERR_RX_NAK:                                  /* ... Else if err, ..                                  */
-        default:
-#if (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED)           /*     .. & dyn link local ENABLED, ...                 */
-                                                                /*        ... cfg using link local addr.                */
-             DHCPc_AddrLocalLinkCfg(pif_info, &addr_hw[0], addr_hw_len, perr);
-             if (*perr == DHCPc_ERR_NONE) {
-                 pif_info->ClientState = DHCP_STATE_LOCAL_LINK;
-                *perr                  = DHCPc_ERR_NONE_LOCAL_LINK;
+    if (pstats->ClientBoundCtr > 0u) {                          /* Calc avg latency, w/o ovf.                           */
+        pstats->LatencyAvg_ms  =   (DHCPc_EmulLatencySum_sec / pstats->ClientBoundCtr) * DEF_TIME_NBR_mS_PER_SEC;
+        pstats->LatencyAvg_ms += (((DHCPc_EmulLatencySum_sec % pstats->ClientBoundCtr) * DEF_TIME_NBR_mS_PER_SEC) +
+                                    DHCPc_EmulLatencySum_ms) / pstats->ClientBoundCtr;
+    } else {
+        pstats->LatencyMin_ms  =    0u;
+    }
 
-             } else {
-                 NetIPv4_CfgAddrAddDynamicStop(if_nbr, &err_net);
+    DHCPc_EmulActive = DEF_NO;
 
-                 pif_info->ClientState = DHCP_STATE_NONE;
-                *perr                  = DHCPc_ERR_LOCAL_LINK;
-             }
+   *perr = DHCPc_ERR_NONE;
 #else
-             NetIPv4_CfgAddrAddDynamicStop(if_nbr, &err_net);
-             pif_info->ClientState = DHCP_STATE_NONE;
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
 #endif
-             break;
-    }
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                   DHCPc_RenewRebindStateHandler()
-*
-* Description : (1) Perform actions associated with the RENEW/REBIND state :
-*
-*                   (b) Get interface's hardware address
-*                   (c) Initialize socket
-*                   (e) Transmit REQUEST & get reply
-*                   (f) Configure lease timer
-*
+*                                         DHCPc_TaskHandler()
 *
-* Argument(s) : pif_info        Pointer to DHCP interface information.
-*               --------        Argument validated in DHCPc_MsgRxHandler().
+* Description : (1) Handle lease management :
 *
-*               exp_tmr_msg     Expired timer message.
+*                   (a) Wait for message from DHCP client timer & API functions
+*                   (b) Get      request attached to the message (see Note #3)
+*                   (c) Handle   received message
+*                   (d) Complete request, if any
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  DHCP lease successfully renewed/rebound.
-*                               DHCPc_ERR_NONE_NO_TMR           Error setting timer, lease might NOT have
-*                                                                   been renewed/rebound (see Note #4).
-*                               DHCPc_ERR_INVALID_MSG           Invalid timer expiration message.
-*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
-*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
-*                               DHCPc_ERR_INIT_SOCK             Error initializing socket.
+* Argument(s) : none.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_MsgRxHandler().
+* Caller(s)   : DHCPc_OS_Task().
 *
-* Note(s)     : (2) #### This implementation of the DHCP client presumes an Ethernet hardware type.
+*               This function is a DHCP client to operating system (OS) function & SHOULD be called only
+*               by appropriate DHCPc-operating system port function(s).
 *
-*               (3) If the socket cannot be opened, the DHCP lease is updated, and a new timer is set
-*                   so that the renewing/rebinding process can take place later.
+* Note(s)     : (2) DHCPc_TaskHandler() blocked until DHCP client initialization completes.
 *
-*               (4) A DHCPc_ERR_NONE_NO_TMR error indicates that there was an error either calculating
-*                   the new lease time if it was successfully  renewed/rebound, or the update lease time
-*                   was not successful should the lease not be renewed/rebound.
+*               (3) The global DHCPc lock is acquired ONLY to get the request attached to the message,
+*                   since the request is attached AFTER the message is posted (see 'DHCPc_ReqAttach()
+*                   Note #1').  The message is handled without the global DHCPc lock so that the API
+*                   functions are NOT blocked during a negotiation (see 'dhcp-c.h  Note #2b').
 *
-*                   In both cases, the lease then becomes technically infinite since NO timer is set.
-*                   This could cause an expired lease to still be used by this host, which would violate
-*                   RFC #2131.
+*               (4) The request attached to the message is completed only once the DHCPc lock is released,
+*                   so that its callback function MAY call any DHCPc API function (see 'dhcp-c.h  DHCPc
+*                   REQUEST DATA TYPE  Note #3').
+*
+*               (5) The messages of ALL the interfaces are handled by this single task, since the DHCP
+*                   client port can be bound by ONE socket at a time (see 'dhcp-c.h  DHCPc DEFAULT CFG
+*                   Note #7').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_RenewRebindStateHandler (DHCPc_IF_INFO   *pif_info,
-                                             DHCPc_COMM_MSG   exp_tmr_msg,
-                                             DHCPc_ERR       *perr)
+void  DHCPc_TaskHandler (void)
 {
-#if (DHCPc_CFG_BROADCAST_BIT_EN != DEF_ENABLED)
-    DHCPc_MSG      *pmsg;
-    DHCP_MSG_HDR   *pmsg_hdr;
-#endif
-    NET_IF_NBR      if_nbr;
-    CPU_BOOLEAN     if_en;
-    CPU_INT08U      addr_hw_len;
-    CPU_INT08U      addr_hw[NET_IF_ETHER_ADDR_SIZE];
-    NET_IPv4_ADDR   addr_host;
-    NET_SOCK_ID     sock_id;
-    NET_ERR         err_net;
-
-
-    switch (exp_tmr_msg) {                                      /* Set cur client state.                                */
-        case DHCPc_COMM_MSG_T1_EXPIRED:
-             pif_info->ClientState = DHCP_STATE_RENEWING;
-             break;
-
-
-        case DHCPc_COMM_MSG_T2_EXPIRED:
-             pif_info->ClientState = DHCP_STATE_REBINDING;
-             break;
-
-
-        default:
-            *perr = DHCPc_ERR_INVALID_MSG;
-             return;
-    }
-
-
-    if_nbr = pif_info->IF_Nbr;
-
-    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
-    if (if_en != DEF_YES) {                                     /* If IF NOT enabled, ...                               */
-       *perr = DHCPc_ERR_IF_INVALID;                            /* ... rtn err.                                         */
-        return;
-    }
-
-                                                                /* ------------------- GET HW ADDR -------------------- */
-    addr_hw_len = NET_IF_ETHER_ADDR_SIZE;                       /* See Note #2.                                         */
-    NetIF_AddrHW_Get( if_nbr,
-                     &addr_hw[0],
-                     &addr_hw_len,
-                     &err_net);
-    if ((err_net     != NET_IF_ERR_NONE) ||
-        (addr_hw_len != NET_IF_ETHER_ADDR_SIZE)) {
-       *perr = DHCPc_ERR_INVALID_HW_ADDR;
-        return;
-    }
-
-                                                                /* -------------------- INIT SOCK --------------------- */
-#if (DHCPc_CFG_BROADCAST_BIT_EN != DEF_ENABLED)
-    pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;               /* Get host addr from cur OFFER.                        */
-    pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
-    NET_UTIL_VAL_COPY_32(&addr_host, &pmsg_hdr->yiaddr);
-#else
-    addr_host = NET_IPv4_ADDR_THIS_HOST;
-#endif
+#ifdef  NET_IPv4_MODULE_EN
+    void       *pmsg;
+    DHCPc_REQ  *preq;
+    DHCPc_ERR   err;
 
-    sock_id = DHCPc_InitSock(addr_host, if_nbr);
-    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {                     /* If sock NOT opened,            ...                   */
-        DHCPc_LeaseTimeUpdate(pif_info, exp_tmr_msg, perr);     /* ... update cur lease & cfg tmr ...                   */
-        if (*perr == DHCPc_ERR_NONE) {
-           *perr = DHCPc_ERR_INIT_SOCK;                         /* ... & set err (see Note #3).                         */
 
-        } else {
-           *perr = DHCPc_ERR_NONE_NO_TMR;
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, ...                            */
+        DHCPc_OS_InitWait(&err);                                /* ... wait on DHCPc init (see Note #2).                */
+        if (err != DHCPc_OS_ERR_NONE) {
+            return;
         }
-
-        return;
     }
 
-                                                                /* -------------- TX REQUEST & GET REPLY -------------- */
 
-                                                                /* Tx REQUEST & get reply.                              */
-    DHCPc_Req(sock_id, pif_info, &addr_hw[0], addr_hw_len, perr);
+    while (DEF_ON) {
+                                                                /* ------------------- WAIT FOR MSG ------------------- */
+        do {
+            pmsg = DHCPc_OS_MsgWait(&err);
+        } while ((err  !=  DHCPc_OS_ERR_NONE) &&
+                 (pmsg != (void *)0));
 
-    NetApp_SockClose((NET_SOCK_ID ) sock_id,
-                     (CPU_INT32U  ) 0,
-                     (NET_ERR    *)&err_net);
+                                                                /* --------------------- GET REQ ---------------------- */
+        DHCPc_OS_Lock(&err);                                    /* See Note #3.                                         */
+        if (err != DHCPc_OS_ERR_NONE) {
+            continue;
+        }
 
-    if (*perr == DHCPc_ERR_NONE) {                              /* If lease renewed/rebound,       ...                  */
-        DHCPc_LeaseTimeCalc(pif_info, perr);                    /* ... calc lease time & cfg tmr.                       */
+        preq = ((DHCPc_COMM *)pmsg)->ReqPtr;                    /* Get req before comm is freed.                        */
 
-    } else {                                                    /* Else lease NOT renewed/rebound, ...                  */
-        DHCPc_LeaseTimeUpdate(pif_info, exp_tmr_msg, perr);     /* ... update cur lease & cfg tmr.                      */
-    }
+        DHCPc_OS_Unlock();
 
+                                                                /* -------------------- HANDLE MSG -------------------- */
+        DHCPc_MsgRxHandler((DHCPc_COMM *)pmsg);
 
-    if (*perr != DHCPc_ERR_NONE) {                              /* If err setting tmr, ...                              */
-       *perr = DHCPc_ERR_NONE_NO_TMR;                           /* ... rtn err (see Note #4).                           */
+                                                                /* ------------------- COMPLETE REQ ------------------- */
+        if (preq != (DHCPc_REQ *)0) {
+            DHCPc_ReqDone(preq);                                /* See Note #4.                                         */
+        }
     }
-
-    pif_info->ClientState = DHCP_STATE_BOUND;
+#endif
 }
 
 
 /*
 *********************************************************************************************************
-*                                      DHCPc_StopStateHandler()
+*                                       DHCPc_TmrTaskHandler()
 *
-* Description : (1) Perform actions associated with the STOPPING state :
+* Description : (1) Handle DHCP timers in the DHCPc Timer List :
 *
-*                   (a) Transmit RELEASE message, if necessary
-*                   (b) Free     interface's  objects
-*                   (c) Remove   interface IP address
+*                   (a) Wait for signal from the DHCPc timer
 *
+*                   (b) Acquire DHCPc lock (see Note #2)
 *
-* Argument(s) : pif_info    Pointer to DHCP interface information.
-*               --------    Argument checked   in DHCPc_MsgRxHandler(),
-*                                    validated in DHCPc_InitStateHandler(),
-*                                              in DHCPc_RenewRebindStateHandler().
+*                   (c) Handle every  DHCPc timer in Timer List :
+*                       (1) Get current DHCPc time (see Note #4)
+*                       (2) Get renewal coalescing time (see Note #7)
+*                       (3) For any timer whose deadline is reached :
+*                           (A) Free from Timer List
+*                           (B) Post message to DHCPc task
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
+*                   (d) Check FORCERENEW listeners (see Note #6)
+*
+*                   (e) Release DHCPc lock
 *
-*                               DHCPc_ERR_NONE                  Interface DHCP configuration successfully
-*                                                                   stopped.
-*                               DHCPc_ERR_IF_CFG                Error removing interface IP address from
-*                                                                   stack.
+*
+* Argument(s) : none.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_MsgRxHandler().
+* Caller(s)   : DHCPc_OS_TmrTask() [see 'dhcp-c_os.c'].
 *
-*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
-*               function(s).
+*               This function is a DHCP client to operating system (OS) function & SHOULD be called only
+*               by appropriate DHCPc-operating system port function(s).
 *
-* Note(s)     : (2) #### This implementation of the DHCP client presumes an Ethernet hardware type.
+* Note(s)     : (2) DHCPc_TaskHandler() blocked until DHCP client initialization completes.
 *
-*               (3) RFC #2131, section 'DHCP client behaviour - DHCPRELEASE', states that "if the client
-*                   no longer requires use of its assigned network address [...], the client sends a
-*                   DHCPRELEASE message to the server.  Note that the correct operation of DHCP does not
-*                   depend on the transmission of DHCPRELEASE messages."
+*               (3) DHCPc_TmrTaskHandler() acquires the global DHCPc lock to access the timer list & the
+*                   FORCERENEW listen sockets (see 'dhcp-c.h  Note #2b').  Since the global DHCPc lock is
+*                   NEVER held during a lease negotiation, timers are handled on every timer period even
+*                   while interfaces are being configured.
 *
-*                   Hence, if an error occurs while attempting to transmit a DHCPRELEASE message, no
-*                   error handling is performed.
+*               (4) Timers hold absolute deadlines (see 'DHCPc_TmrCfg()  Note #2') compared against the
+*                   current DHCPc time.  A timer hence expires at most DHCPc_TMR_PERIOD_SEC seconds late,
+*                   but this delay NEVER accumulates since following deadlines are NOT computed from the
+*                   time the timer is handled.
+*
+*                   Getting the DHCPc time on every timer period also guarantees the OS tick counter is
+*                   sampled often enough for its wrap-around to be handled (see 'DHCPc_TimeGet_sec()
+*                   Note #2').
+*
+*               (5) When a DHCP timer expires, the timer SHOULD be freed PRIOR to executing the timer
+*                   expiration function.  This ensures that at least one timer is available if the timer
+*                   expiration function requires a timer.
+*
+*               (6) The FORCERENEW listen sockets are polled, without blocking, once every
+*                   DHCPc_TMR_PERIOD_SEC seconds; a FORCERENEW message is hence handled at most
+*                   DHCPc_TMR_PERIOD_SEC seconds after its reception.
+*
+*               (7) When DHCPc_CFG_RENEW_COALESCE_WIN_SEC is configured, T1 timers due within the window
+*                   are expired early whenever any other timer expires on the same timer period, so that
+*                   the renewals of several interfaces are handled in a single wake-up rather than in
+*                   separate ones a few minutes apart.
+*
+*                   Only T1 timers are expired early; T2 & lease expiration times are NEVER advanced.
+*
+*               (8) The interface information of an expired timer is ONLY updated if it has NOT been freed
+*                   & re-used since the timer was configured (see 'dhcp-c.h  DHCPc COMMUNICATION DATA TYPE
+*                   Note #1').  The message of a stale timer is discarded by DHCPc_MsgRxHandler().
 *********************************************************************************************************
 */
 
-static  void  DHCPc_StopStateHandler (DHCPc_IF_INFO  *pif_info,
-                                      DHCPc_ERR      *perr)
+void  DHCPc_TmrTaskHandler (void)
 {
-    DHCPc_STATE     client_state;
-    CPU_BOOLEAN     tx_decline;
-    CPU_INT08U      addr_hw_len;
-    CPU_INT08U      addr_hw[NET_IF_ETHER_ADDR_SIZE];
-    DHCPc_MSG      *pmsg;
-    DHCP_MSG_HDR   *pmsg_hdr;
-    NET_IPv4_ADDR   addr_host;
-    NET_SOCK_ID     sock_id;
+#ifdef  NET_IPv4_MODULE_EN
     DHCPc_TMR      *ptmr;
+    DHCPc_TMR      *ptmr_next;
     DHCPc_COMM     *pcomm;
-    NET_IF_NBR      if_nbr;
-    NET_ERR         err_net;
+    DHCPc_IF_INFO  *pif_info;
+    CPU_INT32U      time_cur_sec;
+#if (DHCPc_CFG_RENEW_COALESCE_WIN_SEC > 0)
+    CPU_INT32U      time_renew_sec;
+#endif
+    CPU_BOOLEAN     expired;
+    DHCPc_ERR       err;
 
 
-    if_nbr                = pif_info->IF_Nbr;
-    client_state          = pif_info->ClientState;              /* Get client state ...                                 */
-    pif_info->ClientState = DHCP_STATE_STOPPING;                /* ... and set it to STOPPING.                          */
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, ...                            */
+        DHCPc_OS_InitWait(&err);                                /* ... wait on DHCPc init (see Note #2).                */
+        if (err != DHCPc_OS_ERR_NONE) {
+            return;
+        }
+    }
 
-                                                                /* -------------------- TX RELEASE -------------------- */
-    switch (client_state) {
-        case DHCP_STATE_REQUESTING:
-        case DHCP_STATE_BOUND:
-        case DHCP_STATE_RENEWING:
-        case DHCP_STATE_REBINDING:
-             tx_decline = DEF_YES;
-             break;
 
+    while (DEF_ON) {
+                                                                /* ----------------- WAIT TMR SIGNAL ------------------ */
+        do {
+            DHCPc_OS_TmrWait(&err);
+        } while (err != DHCPc_OS_ERR_NONE);
 
-        default:
-             tx_decline = DEF_NO;
-             break;
-    }
 
-    if (tx_decline == DEF_YES) {
-                                                                /* ------------------- GET HW ADDR -------------------- */
-        addr_hw_len = NET_IF_ETHER_ADDR_SIZE;                   /* See Note #2.                                         */
-        NetIF_AddrHW_Get( if_nbr,
-                         &addr_hw[0],
-                         &addr_hw_len,
-                         &err_net);
-        if ((err_net     == NET_IF_ERR_NONE) &&                 /* See Note #3.                                         */
-            (addr_hw_len == NET_IF_ETHER_ADDR_SIZE)) {
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+        DHCPc_OS_Lock(&err);                                    /* See Note #3.                                         */
+        if (err != DHCPc_OS_ERR_NONE) {
+            continue;
+        }
 
-                                                                /* -------------------- INIT SOCK --------------------- */
-            pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;       /* Get host addr from cur OFFER.                        */
-            pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
-            NET_UTIL_VAL_COPY_32(&addr_host, &pmsg_hdr->yiaddr);
+                                                                /* --------------- HANDLE TMR TASK LIST --------------- */
+        time_cur_sec   = DHCPc_TimeGet_sec();                   /* Get cur time (see Note #4).                          */
+#if (DHCPc_CFG_RENEW_COALESCE_WIN_SEC > 0)
+        time_renew_sec = DHCPc_TmrRenewTimeGet(time_cur_sec);  /* Get renew time (see Note #7).                         */
+#endif
 
-            sock_id = DHCPc_InitSock(addr_host, if_nbr);
-            if (sock_id != NET_SOCK_BSD_ERR_OPEN) {
+        ptmr = DHCPc_TmrListHead;                               /* Start @ Tmr List head.                               */
+        while (ptmr != (DHCPc_TMR *)0) {                        /* Handle  Tmr List tmrs.                               */
 
-                DHCPc_DeclineRelease((NET_SOCK_ID    ) sock_id,
-                                     (DHCPc_IF_INFO *) pif_info,
-                                     (DHCPc_MSG_TYPE ) DHCP_MSG_RELEASE,
-                                     (CPU_INT08U    *)&addr_hw[0],
-                                     (CPU_INT08U     ) addr_hw_len,
-                                     (DHCPc_ERR     *) perr);
+            ptmr_next = ptmr->NextPtr;                          /* Set next tmr to update.                              */
+            pcomm     = (DHCPc_COMM *)ptmr->Obj;
 
-                                                                /* Dly to resolve dest addr.                            */
-                KAL_Dly((CPU_INT32U)(DHCP_RELEASE_DLY_S * DEF_TIME_NBR_mS_PER_SEC));
+            expired   = DHCPc_TimeIsReached(time_cur_sec, ptmr->Deadline_sec);
+#if (DHCPc_CFG_RENEW_COALESCE_WIN_SEC > 0)
+            if ((expired        != DEF_YES) &&                  /* If T1 tmr due within window, expire it early.        */
+                (pcomm->CommMsg == DHCPc_COMM_MSG_T1_EXPIRED)) {
+                expired = DHCPc_TimeIsReached(time_renew_sec, ptmr->Deadline_sec);
+            }
+#endif
 
-                NetApp_SockClose((NET_SOCK_ID ) sock_id,        /* Close sock.                                          */
-                                 (CPU_INT32U  ) 0,
-                                 (NET_ERR    *)&err_net);
+            if (expired == DEF_YES) {                           /* If tmr deadline reached, ...                         */
+
+                pif_info = pcomm->IF_InfoPtr;                   /* ... get if info                ...                   */
+
+                DHCPc_TmrFree(ptmr);                            /* ... free tmr     (see Note #5) ...                   */
+                                                                /* If IF info NOT re-used (see Note #8), ...            */
+                if ((pif_info      != ((DHCPc_IF_INFO *)0)) &&
+                    (pif_info->Gen == pcomm->IF_InfoGen)) {
+                    pif_info->Tmr = (DHCPc_TMR *)0;             /* ... prevents a double-free of the timer.             */
+                }
+
+                DHCPc_OS_MsgPost((void      *) pcomm,           /* ... & post obj to DHCP client task.                  */
+                                 (DHCPc_ERR *)&err);
             }
-        }
-    }
 
-                                                                /* ---------------- FREE IF'S DATA OBJ ---------------- */
-    ptmr = pif_info->Tmr;
-    if (ptmr != (DHCPc_TMR *)0) {                               /* If lease tmr not NULL, ...                           */
-        pcomm = (DHCPc_COMM *)ptmr->Obj;
-        if (pcomm != (DHCPc_COMM *)0) {
-            DHCPc_CommFree(pcomm);                              /* ...    free comm       ...                           */
+            ptmr = ptmr_next;
         }
 
-        DHCPc_TmrFree(ptmr);                                    /* ...  & free tmr.                                     */
-        pif_info->Tmr = (DHCPc_TMR *)0;                         /* Prevents a double-free of the timer.                 */
-    }
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+                                                                /* -------------- CHK FORCERENEW LISTEN --------------- */
+        DHCPc_ForceRenewChk();                                  /* See Note #6.                                         */
+#endif
 
-    pmsg = pif_info->MsgPtr;
-    if (pmsg != (DHCPc_MSG *)0) {                               /* If msg       not NULL, ...                           */
-        DHCPc_MsgFree(pmsg);                                    /* ... free msg.                                        */
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+        DHCPc_OS_Unlock();
     }
+#endif
+}
 
-    DHCPc_IF_InfoFree(pif_info);
 
-                                                                /* ----------------- REM IF'S IP ADDR ----------------- */
-    NetIPv4_CfgAddrRemoveAll(if_nbr, &err_net);
-    if (err_net != NET_IPv4_ERR_NONE) {
-       *perr = DHCPc_ERR_IF_CFG;
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
 
-    } else {
-       *perr = DHCPc_ERR_NONE;
+#ifdef  NET_IPv4_MODULE_EN
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_IF_InfoInit()
+*
+* Description : (1) Initialize DHCPc interface information :
+*
+*                   (a) Initialize interface information pool
+*                   (b) Initialize interface information table
+*                   (c) Initialize interface information list pointer
+*
+*
+* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPc interface information successfully
+*                                                                   initialized.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Init().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) Interface inforation pool MUST be initialized PRIOR to initializing the pool with
+*                   pointers to interface information.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_IF_InfoInit (DHCPc_ERR  *perr)
+{
+    DHCPc_IF_INFO      *pif_info;
+    DHCPc_IF_INFO_QTY   i;
+    NET_IF_NBR          if_nbr;
+
+                                                                /* ---------------- INIT IF INFO POOL ----------------- */
+    DHCPc_InfoPoolPtr = (DHCPc_IF_INFO *)0;                     /* Init-clr DHCPc IF info pool (see Note #2).           */
+
+
+                                                                /* ----------------- INIT IF INFO TBL ----------------- */
+    pif_info = &DHCPc_InfoTbl[0];
+    for (i = 0; i < DHCPc_NBR_IF_INFO; i++) {
+        pif_info->ID       = (DHCPc_IF_INFO_QTY)i;
+        pif_info->Gen      =  0u;
+        pif_info->Flags    =  DHCPc_FLAG_NONE;                  /* Init each IF info as NOT used.                       */
+
+#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+        DHCPc_IF_InfoClr(pif_info);
+#endif
+
+        pif_info->NextPtr  =  DHCPc_InfoPoolPtr;                /* Free each IF info to info pool (see Note #2).        */
+        DHCPc_InfoPoolPtr  =  pif_info;
+
+        pif_info++;
     }
+
+                                                                /* ---------------- INIT INFO LIST PTR ---------------- */
+    DHCPc_InfoListHead = (DHCPc_IF_INFO *)0;
+
+                                                                /* ----------------- INIT INFO IF TBL ----------------- */
+    for (if_nbr = 0u; if_nbr < NET_IF_NBR_IF_TOT; if_nbr++) {
+        DHCPc_InfoIF_Tbl[if_nbr] = (DHCPc_IF_INFO *)0;
+    }
+
+
+   *perr = DHCPc_ERR_NONE;
 }
 
 
 /*
 *********************************************************************************************************
-*                                          DHCPc_Discover()
+*                                         DHCPc_IF_InfoGet()
 *
-* Description : (1) Perform the DISCOVER phase of the lease negotiation :
+* Description : (1) Allocate & initialize a DHCPc interface information :
 *
-*                   (a) Get message
-*                   (b) Generate new 'xid' (see Note #2)
-*                   (c) Prepare  DISCOVER message
-*                   (d) Transmit DISCOVER message
-*                   (e) Get reply from server(s)
-*                   (f) Copy lease OFFER
+*                   (a) Validate client NOT attributed (see Note #2).
+*                   (b) Generate base transaction identifier
+*                   (c) Get        interface information
+*                   (d) Initialize interface information
+*                   (e) Insert     interface information at head of interface information list
+*                                                            & of interface's     information list
+*                   (f) Return pointer to interface information
+*                         OR
+*                       Null pointer & error code, on failure
 *
 *
-* Argument(s) : sock_id         Socket ID of socket to transmit & receive DHCPc data.
+* Argument(s) : if_nbr          Interface number to get the interface information structure.
+*               ------          Argument validated in DHCPc_StartAsync(),
+*                                                     DHCPc_Inform(),
+*                                                     DHCPc_IPv6_Start().
 *
-*               pif_info        Pointer to DHCP interface information.
-*               --------        Argument checked in DHCPc_InitStateHandler().
+*               pclient_id      Pointer to client identifier of the logical client.
+*               ----------      Argument validated in DHCPc_StartAsync(),
+*                                                     DHCPc_IPv6_Start().
 *
-*               paddr_hw        Pointer to hardware address buffer.
+*               client_id_len   Length of the client identifier (in octets), 0 for the default client.
 *
-*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*               flags           Client flags to set in the interface information :
+*
+*                                   DHCPc_FLAG_NONE             DHCP   client.
+*                                   DHCPc_FLAG_IPv6             DHCPv6 client (see Note #6).
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  DISCOVER successfully transmitted & OFFER(S)
-*                                                                   received (see Note #2).
-*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
-*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
+*                               DHCPc_ERR_NONE                  Interface information successfully allocated
+*                                                                   & initialized.
+*                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
+*                               DHCPc_ERR_CLIENT_ID_NONE        NO hardware address & NO client identifier.
+*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
 *
-*                                                               --------- RETURNED BY DHCPc_MsgGet() : ----------
-*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*                                                               ------- RETURNED BY DHCPc_AddrHW_Get() : -------
+*                               DHCPc_ERR_IF_INVALID            Invalid interface.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
 *
-*                                                               ------ RETURNED BY DHCPc_TxMsgPrepare() : -------
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+* Return(s)   : Pointer to interface information, if NO errors.
 *
-*                                                               ----------- RETURNED BY DHCPc_Tx() : ------------
-*                               DHCPc_ERR_TX                    Transmit error.
+*               Pointer to NULL,                  otherwise.
 *
-*                                                               -------- RETURNED BY DHCPc_RxReply() : ----------
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
-*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
-*                               DHCPc_ERR_RX                    Receive error.
+* Caller(s)   : DHCPc_StartAsync(),
+*               DHCPc_Inform(),
+*               DHCPc_IPv6_Start().
 *
-* Return(s)   : none.
+* Note(s)     : (2) Only one interface information may exist for a given interface number & client
+*                   identifier (see 'dhcp-c.h  DHCP CLIENT IDENTIFIER DEFINES  Note #1').
 *
-* Caller(s)   : DHCPc_InitStateHandler().
+*               (3) An interface without a hardware address fitting the 'chaddr' field can ONLY be
+*                   identified by a client identifier (see 'dhcp-c.h  DHCPc HARDWARE ADDRESS DEFINES
+*                   Note #2a').
 *
-* Note(s)     : (1) RFC #2131, section 'Constructing and sending DHCP messages', states that "selecting
-*                   a new 'xid' for each retransmission is an implementation decision.  A client may
-*                   choose to reuse the same 'xid' or select a new 'xid' for each retransmitted message".
-*
-*                   This implementation increments the previously used 'xid' and used that new value as
-*                   the transaction ID.
-*
-*               (2) When the function returns DHCPc_ERR_NONE, the OFFER message's parameters are copied
-*                   into the structure pointed to by 'pif_info' so that a REQUEST message can be crafted.
+*               (4) The random number generator is seeded from the hardware address & the client
+*                   identifier, if any, so that interfaces & devices booting at the same time do NOT
+*                   share their transaction IDs (xid).  The base transaction ID is then taken from the
+*                   random number generator (see 'DHCPc_RandGet()').
 *
-*               (3) If NO DHCP OFFER is received following a DHCP DISCOVER transmission, the caller is
-*                   responsible of the retransmission handling--i.e. this function will NOT attempt to
-*                   send another DISCOVER.
+*               (5) The use of critical section is necessary to protect the data in the interface
+*                   information structures, since the function DHCPc_ChkStatus() does NOT get the DHCPc
+*                   lock when it access them.
 *
-*               (4) In the event of a surge of DHCP OFFER datagrams coming from multiple hosts on the
-*                   network attempting to acquire an IP address from a DHCP server, the socket receive
-*                   queue should be closed during a backoff delay in order to prevent Rx buffers from
-*                   being consumed. This is due to the fact that DHCP OFFER datagrams are sent to the
-*                   broadcast address (255.255.255.255) on port 68 and thus the uC/TCPIP stack will accept
-*                   them. Since the DHCP client does not process any offers during a backoff delay, these
-*                   incoming datagrams will get queued until the client consumes them after the delay
-*                   which may last up to 64 seconds (See Note #1 in DHCPc_CalcBackOff()). Closing the
-*                   socket receive queue prompts the TCP IP stack to drop those datagrams before they're
-*                   ever queued.
+*               (6) Only one DHCPv6 client may exist for a given interface number, regardless of its
+*                   client identifier (see 'DHCPc_IPv6_InfoGetCfgd()  Note #1').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_Discover (NET_SOCK_ID     sock_id,
-                              DHCPc_IF_INFO  *pif_info,
-                              CPU_INT08U     *paddr_hw,
-                              CPU_INT08U      addr_hw_len,
-                              DHCPc_ERR      *perr)
+static  DHCPc_IF_INFO  *DHCPc_IF_InfoGet (NET_IF_NBR   if_nbr,
+                                          CPU_INT08U  *pclient_id,
+                                          CPU_INT08U   client_id_len,
+                                          CPU_INT16U   flags,
+                                          DHCPc_ERR   *perr)
 {
-    DHCPc_MSG           *pmsg;
-    CPU_INT16U           discover_retry_cnt;
-    CPU_BOOLEAN          discover_done;
-    CPU_BOOLEAN          discover_dly;
-    CPU_INT16U           dly_ms;
-    CPU_INT16U           discover_msg_len;
-    NET_SOCK_ADDR_IPv4   addr_server;
-    NET_SOCK_ADDR_LEN    addr_server_size;
-    CPU_BOOLEAN          rx_done;
-    DHCPc_MSG_TYPE       dhcp_rx_msg_type;
-    CPU_INT08U          *popt;
-    CPU_INT08U           opt_val_len;
-    NET_ERR              net_err;
-
+    DHCPc_IF_INFO  *pif_info;
+    CPU_INT08U      addr_hw_len;
+    CPU_INT08U      addr_hw[DHCPc_HW_ADDR_LEN_MAX];
+    CPU_INT32U      transaction_id_base;
+    CPU_SR_ALLOC();
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
-    if (paddr_hw == (CPU_INT08U *)0) {
-       *perr = DHCPc_ERR_NULL_PTR;
-        return;
-    }
 
-    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
-       *perr = DHCPc_ERR_INVALID_HW_ADDR;
-        return;
+                                                                /* --------------- VALIDATE CLIENT USED --------------- */
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+    if (DEF_BIT_IS_SET(flags, DHCPc_FLAG_IPv6) == DEF_YES) {
+        pif_info = DHCPc_IPv6_InfoGetCfgd(if_nbr);              /* See Note #6.                                         */
+    } else {
+        pif_info = DHCPc_IF_InfoGetCfgd(if_nbr, pclient_id, client_id_len);
     }
+#else
+    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr, pclient_id, client_id_len);
 #endif
+    if (pif_info != ((DHCPc_IF_INFO *)0)) {                     /* If client already has if info, ...                   */
+       *perr = DHCPc_ERR_IF_INFO_IF_USED;                       /* ... rtn err (see Note #2).                           */
+        return ((DHCPc_IF_INFO *)0);
+    }
 
-                                                                /* --------------------- GET MSG ---------------------- */
-    pmsg = DHCPc_MsgGet(perr);
+                                                                /* ---------- GENERATE TRANSACTION BASE NBR ----------- */
+    addr_hw_len = DHCPc_AddrHW_Get(if_nbr, &addr_hw[0], perr);
     if (*perr != DHCPc_ERR_NONE) {
-        return;
+        return ((DHCPc_IF_INFO *)0);
     }
 
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    if ((addr_hw_len   == 0u) &&                                /* If NO hw addr & NO client id, ...                    */
+        (client_id_len == 0u)) {
+       *perr = DHCPc_ERR_CLIENT_ID_NONE;                        /* ... client can NOT be identified (see Note #3).      */
+        return ((DHCPc_IF_INFO *)0);
+    }
+#endif
 
-    discover_retry_cnt = 0;
-    discover_done      = DEF_NO;
-    discover_dly       = DEF_NO;
-    dly_ms             = 0;
+    DHCPc_RandSeed(&addr_hw[0], addr_hw_len);                   /* Seed rand nbr generator (see Note #4).               */
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    DHCPc_RandSeed(pclient_id, client_id_len);
+#endif
 
-                                                                /* While DISCOVER retry < max retry ...                 */
-                                                                /* ... & DISCOVER NOT done,         ...                 */
-    while ((discover_retry_cnt <  DHCPc_CFG_DISCOVER_RETRY_CNT) &&
-           (discover_done      != DEF_YES)) {
+    transaction_id_base = DHCPc_RandGet();                      /* Generate base transaction ID.                        */
 
-        if (discover_dly == DEF_YES) {                          /* Dly DISCOVER, if req'd.                              */
-            dly_ms = DHCPc_CalcBackOff(dly_ms);
-                                                                /* Close Rx Q before delay to prevent Rx buffers ...    */
-            (void)NetSock_CfgRxQ_Size( sock_id,                 /* ... from exhausting. (See Note #4).                  */
-                                       NET_SOCK_DATA_SIZE_MIN,
-                                      &net_err);
-            KAL_Dly(dly_ms);
 
-            (void)NetSock_CfgRxQ_Size( sock_id,                 /* Re-configure Rx Q size to its original value.        */
-                                       NET_SOCK_CFG_RX_Q_SIZE_OCTET,
-                                      &net_err);
-        }
+                                                                /* ------------------- GET IF INFO -------------------- */
+    if (DHCPc_InfoPoolPtr != (DHCPc_IF_INFO *)0) {              /* If if info pool NOT empty, get if info from pool.    */
+        pif_info           = (DHCPc_IF_INFO *)DHCPc_InfoPoolPtr;
+        DHCPc_InfoPoolPtr  = (DHCPc_IF_INFO *)pif_info->NextPtr;
 
-                                                                /* ------------------ GENERATE 'XID' ------------------ */
-        pif_info->TransactionID++;                              /* Inc last transaction ID (see Note #1).               */
+    } else {                                                    /* If none avail, rtn err.                              */
+       *perr = DHCPc_ERR_IF_INFO_NONE_AVAIL;
+        return ((DHCPc_IF_INFO *)0);
+    }
 
+                                                                /* ------------------- INIT IF INFO ------------------- */
+    DHCPc_IF_InfoClr(pif_info);
+    pif_info->PrevPtr       = (DHCPc_IF_INFO *)0;
+    pif_info->NextPtr       = (DHCPc_IF_INFO *)DHCPc_InfoListHead;
+    pif_info->IF_NextPtr    = (DHCPc_IF_INFO *)DHCPc_InfoIF_Tbl[if_nbr];
+    pif_info->IF_Nbr        =  if_nbr;
+    pif_info->LeaseStatus   =  DHCP_STATUS_CFG_IN_PROGRESS;
+    pif_info->TransactionID =  transaction_id_base;
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    Mem_Copy((void     *)&pif_info->Cfg.ClientID[0],            /* Set client id.                                       */
+             (void     *) pclient_id,
+             (CPU_SIZE_T) client_id_len);
+    pif_info->Cfg.ClientID_Len = client_id_len;
+#endif
+    DEF_BIT_SET(pif_info->Flags, DHCPc_FLAG_USED);              /* Set if info as used.                                 */
+    DEF_BIT_SET(pif_info->Flags, flags);                        /* Set client flags.                                    */
 
-                                                                /* --------------- PREPARE DISCOVER MSG --------------- */
-        discover_msg_len = DHCPc_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
-                                              (DHCPc_MSG_TYPE ) DHCP_MSG_DISCOVER,
-                                              (CPU_INT08U    *) paddr_hw,
-                                              (CPU_INT08U     ) addr_hw_len,
-                                              (CPU_INT08U    *)&pmsg->MsgBuf[0],
-                                              (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
-                                              (DHCPc_ERR     *) perr);
-        if (*perr != DHCPc_ERR_NONE) {
-            DHCPc_MsgFree(pmsg);
-            return;
-        }
+                                                                /* --------- INSERT IF INFO INTO IF INFO LIST --------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #5.                                         */
+    if (DHCPc_InfoListHead != (DHCPc_IF_INFO *)0) {             /* If list NOT empty, insert before head.               */
+        DHCPc_InfoListHead->PrevPtr = pif_info;
+    }
+    DHCPc_InfoListHead = pif_info;                              /* Insert if info @ list head.                          */
+    DHCPc_InfoIF_Tbl[if_nbr] = pif_info;                        /* Insert if info @ IF's list head.                     */
+    CPU_CRITICAL_EXIT();
 
-                                                                /* ---------------------- TX MSG ---------------------- */
-        addr_server_size = sizeof(addr_server);
-        Mem_Clr((void     *)&addr_server,
-                (CPU_SIZE_T) addr_server_size);
-        addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
-        addr_server.Addr       = NET_UTIL_HOST_TO_NET_32(NET_IPv4_ADDR_BROADCAST);
-        addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_SERVER);
 
-        DHCPc_Tx((NET_SOCK_ID      ) sock_id,
-                 (void            *)&pmsg->MsgBuf[0],
-                 (CPU_INT16U       ) discover_msg_len,
-                 (NET_SOCK_ADDR   *)&addr_server,
-                 (NET_SOCK_ADDR_LEN) addr_server_size,
-                 (DHCPc_ERR       *) perr);
-        if (*perr != DHCPc_ERR_NONE) {
-            discover_done = DEF_YES;
+   *perr =  DHCPc_ERR_NONE;
 
-        } else {
+    return (pif_info);
+}
 
-                                                                /* ------------- RX REPLY FROM SERVER(S) -------------- */
-            rx_done = DEF_FALSE;
 
+/*
+*********************************************************************************************************
+*                                       DHCPc_IF_InfoGetCfgd()
+*
+* Description : Get interface information structure for configured logical client of an interface.
+*
+* Argument(s) : if_nbr          Interface number to get the interface information structure.
+*
+*               pclient_id      Pointer to client identifier of the logical client.
+*
+*               client_id_len   Length of the client identifier (in octets), 0 for the default client.
+*
+* Return(s)   : Pointer to interface information structure, if client configured with DHCP.
+*
+*               Pointer to NULL,                            otherwise.
+*
+* Caller(s)   : DHCPc_ClientStop(),
+*               DHCPc_ClientChkStatus(),
+*               DHCPc_ClientGetOptVal(),
+*               DHCPc_IF_InfoGet().
+*
+* Note(s)     : (1) The logical clients of an interface are identified by their client identifier (see
+*                   'dhcp-c.h  DHCP CLIENT IDENTIFIER DEFINES  Note #1').
+*
+*               (2) The interface information is looked up directly in the interface information table
+*                   indexed by the interface number (see 'dhcp-c.h  DHCPc INTERFACE INFORMATION DATA TYPE
+*                   Note #5').  Only the logical clients of the interface are then searched.
+*
+*               (3) DHCPv6 clients are NOT logical DHCP clients & are skipped (see 'DHCPc_IPv6_InfoGetCfgd()').
+*********************************************************************************************************
+*/
 
-            while (rx_done != DEF_YES) {
+static  DHCPc_IF_INFO  *DHCPc_IF_InfoGetCfgd (NET_IF_NBR   if_nbr,
+                                              CPU_INT08U  *pclient_id,
+                                              CPU_INT08U   client_id_len)
+{
+    DHCPc_IF_INFO  *pif_info;
+    CPU_BOOLEAN     if_cfgd;
 
-                pmsg->MsgLen = DHCP_MSG_BUF_SIZE;
-                dhcp_rx_msg_type = DHCPc_RxReply((NET_SOCK_ID    ) sock_id,
-                                                 (DHCPc_IF_INFO *) pif_info,
-                                                 (NET_IPv4_ADDR  ) NET_IPv4_ADDR_NONE,
-                                                 (CPU_INT08U    *) paddr_hw,
-                                                 (CPU_INT08U     ) addr_hw_len,
-                                                 (CPU_INT08U    *)&pmsg->MsgBuf[0],
-                                                 (CPU_INT16U    *)&pmsg->MsgLen,
-                                                 (DHCPc_ERR     *) perr);
 
-                switch (*perr) {
-                    case DHCPc_ERR_NONE:                        /* If NO err                    ...                     */
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN == 0)
+   (void)&pclient_id;                                           /* Prevent 'variable unused' compiler warning.          */
+#endif
 
-                         switch (dhcp_rx_msg_type) {
-                             case DHCP_MSG_OFFER:               /* ... & rx'd msg is OFFER,     ...                     */
-                                  rx_done       = DEF_YES;      /* ... rx         done          ...                     */
-                                  discover_done = DEF_YES;      /* ... & DISCOVER done.                                 */
-                                  break;
+    if (if_nbr >= NET_IF_NBR_IF_TOT) {                          /* If IF nbr invalid, ...                               */
+        return ((DHCPc_IF_INFO *)0);                            /* ... rtn NULL ptr.                                    */
+    }
 
+    pif_info = DHCPc_InfoIF_Tbl[if_nbr];                        /* See Note #2.                                         */
+    if_cfgd  = DEF_NO;
 
-                             default:                           /* ... Else rx'd msg NOT OFFER, ...                     */
-                                  rx_done = DEF_NO;             /* ... rx NOT done.                                     */
-                                  break;
-                         }
-                         break;
+    while ((pif_info != (DHCPc_IF_INFO *)0) &&
+           (if_cfgd  !=  DEF_YES)) {
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)                           /* See Note #1.                                         */
+        if (pif_info->Cfg.ClientID_Len == client_id_len) {
+            if (client_id_len == 0u) {
+                if_cfgd = DEF_YES;
+            } else {
+                if_cfgd = Mem_Cmp((void     *)&pif_info->Cfg.ClientID[0],
+                                  (void     *) pclient_id,
+                                  (CPU_SIZE_T) client_id_len);
+            }
+        }
+#else
+        if (client_id_len == 0u) {
+            if_cfgd = DEF_YES;
+        }
+#endif
 
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+                                                                /* Skip DHCPv6 client (see Note #3).                    */
+        if (DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_IPv6) == DEF_YES) {
+            if_cfgd = DEF_NO;
+        }
+#endif
 
-                    default:                                    /* If rx err,                   ...                     */
-                         rx_done      = DEF_YES;
-                         discover_dly = DEF_YES;
-                         discover_retry_cnt++;                  /* ... restart DISCOVER.                                */
-                         break;
-                }
-            }
+        if (if_cfgd != DEF_YES) {
+            pif_info = pif_info->IF_NextPtr;
         }
     }
 
-    if (*perr != DHCPc_ERR_NONE) {
-        DHCPc_MsgFree(pmsg);
-        return;
+    if (if_cfgd != DEF_YES) {                                   /* If IF nbr NOT cfg'd, ...                             */
+        return ((DHCPc_IF_INFO *)0);                            /* ... rtn NULL ptr.                                    */
     }
 
-                                                                /* ----------- COPY OFFER IN IF INFO STRUCT ----------- */
-    if (pif_info->MsgPtr != (DHCPc_MSG *)0) {                   /* If msg ptr NOT NULL, ...                             */
-        DHCPc_MsgFree(pif_info->MsgPtr);                        /* ... free msg         ...                             */
+    return (pif_info);                                          /* Else, rth ptr to IF info struct for cfg'd IF.        */
+}
+
+
+/*
+*********************************************************************************************************
+*                                    DHCPc_IF_InfoAddrSharedChk()
+*
+* Description : Check if other logical client(s) hold an address on the interface of a client.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information of the client.
+*               --------    Argument validated in DHCPc_InitStateHandler(),
+*                                                 DHCPc_StopStateHandler().
+*
+* Return(s)   : DEF_YES, if any other client configured an address on the same interface.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_StopStateHandler().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DHCPc_IF_InfoAddrSharedChk (DHCPc_IF_INFO  *pif_info)
+{
+    DHCPc_IF_INFO  *pif_info_other;
+    CPU_BOOLEAN     shared;
+
+
+    pif_info_other = DHCPc_InfoIF_Tbl[pif_info->IF_Nbr];        /* Search IF's info list only.                          */
+    shared         = DEF_NO;
+
+    while ((pif_info_other != (DHCPc_IF_INFO *)0) &&
+           (shared         !=  DEF_YES)) {
+        if ((pif_info_other           != pif_info) &&
+            (pif_info_other->AddrCfgd != NET_IPv4_ADDR_NONE)) {
+            shared = DEF_YES;
+        }
+
+        pif_info_other = pif_info_other->IF_NextPtr;
     }
 
-    pif_info->MsgPtr = pmsg;                                    /* ... & set msg ptr to rx'd OFFER.                     */
+    return (shared);
+}
+
 
-                                                                /* Get server id.                                       */
-    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SERVER_IDENTIFIER,
-                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
-                           (CPU_INT16U    ) pmsg->MsgLen,
-                           (CPU_INT08U   *)&opt_val_len);
-    if (popt != (CPU_INT08U *)0) {
-        NET_UTIL_VAL_COPY_32(&pif_info->ServerID, popt);
+/*
+*********************************************************************************************************
+*                                        DHCPc_IF_InfoMsgSet()
+*
+* Description : Replace the current DHCP message of an interface, freeing the previous message.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_Discover(),
+*                                                 DHCPc_Req(),
+*                                                 DHCPc_StopStateHandler().
+*
+*               pmsg        Pointer to new current message, or NULL pointer to only free the current message.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Current message successfully replaced.
+*
+*                                                               --- RETURNED BY DHCPc_OS_IF_Lock() : ---
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_Req(),
+*               DHCPc_StopStateHandler(),
+*               DHCPc_IPv6_Exchange(),
+*               DHCPc_IPv6_StopStateHandler().
+*
+* Note(s)     : (1) The current message is read by the DHCP client API functions & is hence replaced with
+*                   the interface lock acquired (see 'dhcp-c.h  Note #2d').  The previous message is freed
+*                   outside of the interface lock.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_IF_InfoMsgSet (DHCPc_IF_INFO  *pif_info,
+                                   DHCPc_MSG      *pmsg,
+                                   DHCPc_ERR      *perr)
+{
+    DHCPc_MSG  *pmsg_prev;
+
+
+    DHCPc_OS_IF_Lock(pif_info->ID, perr);                       /* See Note #1.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+    pmsg_prev        = pif_info->MsgPtr;
+    pif_info->MsgPtr = pmsg;
+
+    DHCPc_OS_IF_Unlock(pif_info->ID);
+
+    if (pmsg_prev != (DHCPc_MSG *)0) {                          /* If prev msg NOT NULL, ...                            */
+        DHCPc_MsgFree(pmsg_prev);                               /* ... free prev msg.                                   */
+    }
+
+   *perr = DHCPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_IF_InfoFree()
+*
+* Description : (1) Free a DHCPc inteface information :
+*
+*                   (a) Remove interface information from    interface information list
+*                                                          & from interface's     information list
+*                   (b) Clear  interface information controls
+*                   (c) Free   interface information back to interface information pool
+*
+*
+* Argument(s) : pif_info    Pointer to a DHCPc interface information.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Start(),
+*               DHCPc_StopStateHandler(),
+*               DHCPc_IPv6_Start(),
+*               DHCPc_IPv6_StopStateHandler().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (2) #### To prevent freeing an interface information already freed via previous interface
+*                   information free, DHCPc_IF_InfoFree() checks the interface information's 'USED' flag
+*                   BEFORE freeing the interface information.
+*
+*                   This prevention is only best-effort since any invalid duplicate interface information
+*                   frees MAY be asynchronous to potentially valid interface information gets.  Thus the
+*                   invalid interface information free(s) MAY corrupt the interface information's valid
+*                   operation(s).
+*
+*                   However, since interface information resources are ONLY accessed with the global DHCPc
+*                   lock acquired (see 'dhcp-c.h  Note #2b'), it is NOT necessary to further protect them
+*                   from possible corruption since no asynchronous access from other task is possible.
+*
+*               (3) The generation of the interface information is incremented, so that the timer &
+*                   FORCERENEW messages still pending for the freed client are discarded (see 'dhcp-c.h
+*                   DHCPc INTERFACE INFORMATION DATA TYPE  Note #14').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_IF_InfoFree (DHCPc_IF_INFO  *pif_info)
+{
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    CPU_BOOLEAN     used;
+#endif
+    DHCPc_IF_INFO  *pprev;
+    DHCPc_IF_INFO  *pnext;
+    DHCPc_IF_INFO **pif_prev_next;
+    CPU_SR_ALLOC();
+
+
+                                                                /* ------------------ VALIDATE PTR -------------------- */
+    if (pif_info == (DHCPc_IF_INFO *)0) {
+        return;
+    }
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* -------------- VALIDATE IF INFO USED --------------- */
+    used = DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_USED);
+    if (used != DEF_YES) {                                      /* If IF info NOT used, ...                             */
+        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
+    }
+#endif
+
+                                                                /* --------- REMOVE IF INFO FROM IF INFO LIST --------- */
+    CPU_CRITICAL_ENTER();                                       /* See 'DHCPc_IF_InfoGet()  Note #5'.                   */
+    pprev = pif_info->PrevPtr;
+    pnext = pif_info->NextPtr;
+    if (pprev != (DHCPc_IF_INFO *)0) {                          /* If pif_info is NOT   the head of IF info list, ...   */
+        pprev->NextPtr    = pnext;                              /* ... set pprev's NextPtr to skip pif_info.            */
+    } else {                                                    /* Else set pnext as head of IF info list.              */
+        DHCPc_InfoListHead = pnext;
+    }
+    if (pnext != (DHCPc_IF_INFO *)0) {                          /* If pif_info is NOT @ the tail of IF info list, ...   */
+        pnext->PrevPtr    = pprev;                              /* ... set pnext's PrevPtr to skip pif_info.            */
+    }
+
+    pif_prev_next = &DHCPc_InfoIF_Tbl[pif_info->IF_Nbr];        /* Search pif_info in IF's info list ...                */
+    while ((*pif_prev_next != (DHCPc_IF_INFO *)0) &&
+           (*pif_prev_next != pif_info)) {
+        pif_prev_next = &(*pif_prev_next)->IF_NextPtr;
+    }
+    if (*pif_prev_next == pif_info) {                           /* ... & unlink it.                                     */
+       *pif_prev_next = pif_info->IF_NextPtr;
+    }
+    pif_info->Gen++;                                            /* Invalidate comm objs of IF info (see Note #3).       */
+    CPU_CRITICAL_EXIT();
+
+                                                                /* ------------------- CLR IF INFO -------------------- */
+    DEF_BIT_CLR(pif_info->Flags, DHCPc_FLAG_USED);              /* Set IF info as NOT used.                             */
+#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+    DHCPc_IF_InfoClr(pif_info);
+#endif
+
+                                                                /* ------------------- FREE IF INFO ------------------- */
+    pif_info->NextPtr = DHCPc_InfoPoolPtr;
+    DHCPc_InfoPoolPtr = pif_info;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_IF_InfoClr()
+*
+* Description : Clear DHCPc interface information controls.
+*
+* Argument(s) : pif_info    Pointer to a DHCPc interface information.
+*               --------    Argument validated in DHCPc_IF_InfoInit(),
+*                                    checked   in DHCPc_IF_InfoGet(),
+*                                    checked   in DHCPc_IF_InfoFree().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IF_InfoInit(),
+*               DHCPc_IF_InfoGet(),
+*               DHCPc_IF_InfoFree(),
+*               DHCPc_EmulRun().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_IF_InfoClr (DHCPc_IF_INFO  *pif_info)
+{
+    pif_info->PrevPtr           = (DHCPc_IF_INFO *)0;
+    pif_info->NextPtr           = (DHCPc_IF_INFO *)0;
+    pif_info->IF_NextPtr        = (DHCPc_IF_INFO *)0;
+
+    pif_info->IF_Nbr            =  NET_IF_NBR_NONE;
+    pif_info->ServerID          =  NET_IPv4_ADDR_NONE;
+
+    Mem_Clr((void     *)&pif_info->ParamReqTbl[0],
+            (CPU_SIZE_T) DHCPc_PARAM_REQ_TBL_SIZE);
+
+    pif_info->ParamReqQty       =  0;
+
+    Mem_Copy((void     *)&pif_info->Cfg,                        /* Reset IF cfg to dflt cfg.                            */
+             (void     *)&DHCPc_CfgIF_Dflt,
+             (CPU_SIZE_T) sizeof(pif_info->Cfg));
+
+    pif_info->AddrCfgd          =  NET_IPv4_ADDR_NONE;
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+    pif_info->RouteQty          =  0u;
+#endif
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+    pif_info->DNS_SrvQty        =  0u;
+    pif_info->NTP_SrvQty        =  0u;
+#if (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0)
+    pif_info->DomainName[0]     = (CPU_CHAR)'\0';
+#endif
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+    pif_info->ParamApplied         =  DHCPc_PARAM_APPLY_NONE;
+    pif_info->MTU                  =  0u;
+    pif_info->ARP_CacheTimeout_sec =  0u;
+    pif_info->TTL_IP               =  0u;
+    pif_info->TTL_TCP              =  0u;
+#endif
+
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+    Mem_Clr((void     *)&pif_info->Relay,
+            (CPU_SIZE_T) sizeof(pif_info->Relay));
+    pif_info->Relay.AddrRelay      =  NET_IPv4_ADDR_NONE;
+#endif
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+    Mem_Clr((void     *)&pif_info->IPv6,
+            (CPU_SIZE_T) sizeof(pif_info->IPv6));
+#endif
+
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+    pif_info->ForceRenewSockID     =  NET_SOCK_BSD_ERR_OPEN;
+    pif_info->ForceRenewNonceValid =  DEF_NO;
+
+    Mem_Clr((void     *)&pif_info->ForceRenewNonce[0],
+            (CPU_SIZE_T) DHCP_AUTH_NONCE_LEN);
+    Mem_Clr((void     *)&pif_info->ForceRenewReplay[0],
+            (CPU_SIZE_T) DHCP_AUTH_REPLAY_LEN);
+#endif
+
+    pif_info->MsgPtr            = (DHCPc_MSG     *)0;
+
+    pif_info->ClientState       =  DHCP_STATE_NONE;
+    pif_info->LeaseStatus       =  DHCP_STATUS_NONE;
+    pif_info->LastErr           =  DHCPc_ERR_NONE;
+
+    pif_info->TransactionID        =  0;
+    pif_info->TransactionID_WinLen =  0;
+    pif_info->TransactionID_Req    =  0;
+    pif_info->AcqStartTime         =  0;
+
+    pif_info->NegoStartTime     =  0;
+
+    pif_info->LeaseDeadline_sec =  0;
+    pif_info->T1_Deadline_sec   =  0;
+    pif_info->T2_Deadline_sec   =  0;
+
+    pif_info->Tmr               = (DHCPc_TMR     *)0;
+
+    pif_info->Flags             =  DHCPc_FLAG_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_ParamReqBuild()
+*
+* Description : Build the parameter request list of an interface.
+*
+* Argument(s) : pif_info            Pointer to DHCP interface information.
+*               --------            Argument checked in DHCPc_StartExt().
+*
+*               preq_param_tbl      Pointer to table of application requested DHCP parameters.
+*               --------------      Argument checked in DHCPc_StartExt().
+*
+*               req_param_tbl_qty   Size of application requested parameter table.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Parameter request list successfully built.
+*                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StartExt(),
+*               DHCPc_EmulRun().
+*
+* Note(s)     : (1) The system requested parameters enabled in the interface configuration are first
+*                   added to the list, followed by the application requested parameters NOT already
+*                   present in the list.  Each parameter is thus requested only once.
+*
+*                   See also 'dhcp-c.h  DHCPc PARAMETER REQUEST LIST DEFINES  Note #1'.
+*
+*               (2) The PAD & END options are NOT valid parameters & are silently discarded.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ParamReqBuild (DHCPc_IF_INFO   *pif_info,
+                                   DHCPc_OPT_CODE  *preq_param_tbl,
+                                   CPU_INT08U       req_param_tbl_qty,
+                                   DHCPc_ERR       *perr)
+{
+    DHCPc_OPT_CODE  opt_code;
+    CPU_INT08U      param_qty;
+    CPU_INT08U      ix;
+    CPU_INT08U      ix_list;
+    CPU_BOOLEAN     found;
+
+
+    param_qty = 0;
+                                                                /* ---------------- ADD SYS REQ'D PARAM --------------- */
+    for (ix = 0; ix < DHCPc_REQ_PARAM_SYS_TBL_SIZE; ix++) {
+        if (DEF_BIT_IS_SET(pif_info->Cfg.ReqParamSys, DEF_BIT(ix)) == DEF_YES) {
+            pif_info->ParamReqTbl[param_qty] = DHCPc_ReqParam[ix];
+            param_qty++;
+        }
+    }
+
+                                                                /* ---------------- ADD APP REQ'D PARAM --------------- */
+    for (ix = 0; ix < req_param_tbl_qty; ix++) {
+        opt_code = preq_param_tbl[ix];
+        if ((opt_code == DHCP_OPT_PAD) ||                       /* Discard PAD & END opt (see Note #2).                 */
+            (opt_code == DHCP_OPT_END)) {
+            continue;
+        }
+
+        found   = DEF_NO;                                       /* Srch list for dup param (see Note #1).               */
+        ix_list = 0;
+        while ((ix_list <  param_qty) &&
+               (found   == DEF_NO)) {
+            if (pif_info->ParamReqTbl[ix_list] == opt_code) {
+                found = DEF_YES;
+            }
+            ix_list++;
+        }
+
+        if (found == DEF_NO) {
+            if (param_qty >= DHCPc_PARAM_REQ_TBL_SIZE) {        /* If param req tbl full, ...                           */
+                pif_info->ParamReqQty = 0;
+               *perr = DHCPc_ERR_PARAM_REQ_TBL_SIZE;            /* ... rtn err.                                         */
+                return;
+            }
+            pif_info->ParamReqTbl[param_qty] = opt_code;
+            param_qty++;
+        }
+    }
+
+    pif_info->ParamReqQty = param_qty;
+
+   *perr = DHCPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_MsgInit()
+*
+* Description : (1) Initialize DHCPc messages :
+*
+*                   (a) Initialize message pool
+*                   (b) Initialize message table
+*                   (c) Initialize message list pointer
+*
+*
+* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPc message successfully initialized.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Init().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) Message pool MUST be initialized PRIOR to initializing the pool with pointers to
+*                   message.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_MsgInit (DHCPc_ERR  *perr)
+{
+    DHCPc_MSG      *pmsg;
+    DHCPc_MSG_QTY   i;
+
+                                                                /* ------------------ INIT MSG POOL ------------------- */
+    DHCPc_MsgPoolPtr = (DHCPc_MSG *)0;                          /* Init-clr DHCPc msg pool (see Note #2).               */
+
+
+                                                                /* ------------------- INIT MSG TBL ------------------- */
+    pmsg = &DHCPc_MsgTbl[0];
+    for (i = 0; i < DHCPc_NBR_MSG_BUF; i++) {
+        pmsg->ID         = (DHCPc_MSG_QTY)i;
+        pmsg->Flags      =  DHCPc_FLAG_NONE;                    /* Init each msg as NOT used.                           */
+
+#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+        DHCPc_MsgClr(pmsg);
+#endif
+
+        pmsg->NextPtr    =  DHCPc_MsgPoolPtr;                   /* Free each msg to msg pool (see Note #2).             */
+        DHCPc_MsgPoolPtr =  pmsg;
+
+        pmsg++;
+    }
+
+                                                                /* ---------------- INIT MSG LIST PTR ----------------- */
+    DHCPc_MsgListHead = (DHCPc_MSG *)0;
+
+
+   *perr = DHCPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_MsgRxHandler()
+*
+* Description : (1) Handle messages received from timers and DHCP API functions :
+*
+*                   (a) Validate interface information structure
+*                   (b) Stop  FORCERENEW listeners (see Note #3)
+*                   (c) Demultiplex message
+*                   (d) Set   request result       (see Note #4)
+*                   (e) Start FORCERENEW listeners (see Note #3)
+*
+*
+* Argument(s) : pcomm       Pointer to DHCP communication object.
+*               -----       Argument checked in DHCPc_TaskHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_TaskHandler().
+*
+* Note(s)     : (2) The communication object SHOULD be freed PRIOR to executing the appropriate action.
+*                   This ensures that at least one communication object is available if the taken action
+*                   requires a communication object.
+*
+*               (3) The FORCERENEW listen sockets are bound to the DHCP client port.  They are closed
+*                   while a message is handled so that they never prevent the socket(s) opened by the
+*                   taken action from being bound, & are then re-opened for every interface left in the
+*                   BOUND state.
+*
+*                   The listen sockets are closed & re-opened with the global DHCPc lock acquired, since
+*                   they are also accessed by DHCPc_ForceRenewChk().
+*
+*               (4) The result of the request attached to the message, if any, is set for the request to be
+*                   completed by DHCPc_TaskHandler().  Once stopped, the interface's DHCP status is always
+*                   DHCP_STATUS_NONE since its interface information structure has been freed.
+*
+*               (5) A message is discarded if its interface information has been freed, even if re-used
+*                   since by another client of the same interface : the generation carried by the message
+*                   then differs from the interface information's (see 'dhcp-c.h  DHCPc COMMUNICATION
+*                   DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_MsgRxHandler (DHCPc_COMM  *pcomm)
+{
+    NET_IF_NBR       if_nbr;
+    CPU_INT16U       if_info_gen;
+    DHCPc_IF_INFO   *pif_info;
+    DHCPc_REQ       *preq;
+    DHCPc_COMM_MSG   msg;
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+    CPU_BOOLEAN      listen_stop;
+#endif
+    DHCPc_ERR        err;
+    CPU_SR_ALLOC();
+
+
+    if_nbr      = pcomm->IF_Nbr;
+    pif_info    = pcomm->IF_InfoPtr;
+    if_info_gen = pcomm->IF_InfoGen;
+    msg         = pcomm->CommMsg;
+    preq        = pcomm->ReqPtr;
+
+    DHCPc_CommFree(pcomm);                                      /* Free comm obj (see Note #2).                         */
+
+
+                                                                /* ---------- VALIDATE IF INFO STRUCT OF COMM --------- */
+    if (pif_info != ((DHCPc_IF_INFO *)0)) {                     /* If IF info freed or re-used (see Note #5), ...       */
+        if ((DEF_BIT_IS_CLR(pif_info->Flags, DHCPc_FLAG_USED) == DEF_YES) ||
+            (pif_info->IF_Nbr != if_nbr)                                  ||
+            (pif_info->Gen    != if_info_gen)) {
+            pif_info = (DHCPc_IF_INFO *)0;                      /* ... client NOT cfg'd.                                */
+        }
+    }
+
+    if (pif_info == ((DHCPc_IF_INFO *)0)) {                     /* If IF NOT cfg'd, ...                                 */
+        if (preq != (DHCPc_REQ *)0) {
+            preq->Status = DHCP_STATUS_NONE;
+            preq->Err    = DHCPc_ERR_IF_NOT_MANAGED;
+        }
+        return;                                                 /* ... rtn.                                             */
+    }
+
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+                                                                /* ------------- STOP FORCERENEW LISTEN --------------- */
+    listen_stop = DEF_NO;
+    DHCPc_OS_Lock(&err);                                        /* See Note #3.                                         */
+    if (err == DHCPc_OS_ERR_NONE) {
+        DHCPc_ForceRenewListenStop();                           /* Close listen socks.                                  */
+        listen_stop = DEF_YES;
+        DHCPc_OS_Unlock();
+    }
+#endif
+
+                                                                /* -------------------- DEMUX MSG --------------------- */
+    switch (msg) {
+        case DHCPc_COMM_MSG_START:                              /* If nego starting ...                                 */
+        case DHCPc_COMM_MSG_LEASE_EXPIRED:                      /* ... or lease expired, ...                            */
+             CPU_CRITICAL_ENTER();
+             pif_info->LeaseStatus = DHCP_STATUS_CFG_IN_PROGRESS;
+             CPU_CRITICAL_EXIT();
+
+             DHCPc_InitStateHandler(pif_info, &err);            /* ... go into INIT state.                              */
+             switch (err) {
+                 case DHCPc_ERR_NONE:
+                      CPU_CRITICAL_ENTER();
+                      pif_info->LeaseStatus = DHCP_STATUS_CFGD;
+                      CPU_CRITICAL_EXIT();
+                      break;
+
+
+                 case DHCPc_ERR_NONE_NO_TMR:
+                      CPU_CRITICAL_ENTER();
+                      pif_info->LeaseStatus = DHCP_STATUS_CFGD_NO_TMR;
+                      CPU_CRITICAL_EXIT();
+                      break;
+
+
+                 case DHCPc_ERR_NONE_LOCAL_LINK:
+                      CPU_CRITICAL_ENTER();
+                      pif_info->LeaseStatus = DHCP_STATUS_CFGD_LOCAL_LINK;
+                      CPU_CRITICAL_EXIT();
+                      break;
+
+
+                 default:
+                      CPU_CRITICAL_ENTER();
+                      pif_info->LeaseStatus = DHCP_STATUS_FAIL;
+                      pif_info->LastErr     = err;
+                      CPU_CRITICAL_EXIT();
+                      break;
+             }
+             break;
+
+
+        case DHCPc_COMM_MSG_T1_EXPIRED:                         /* If T1 or T2 expired, ...                             */
+        case DHCPc_COMM_MSG_T2_EXPIRED:
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+        case DHCPc_COMM_MSG_FORCERENEW:                         /* ... or FORCERENEW rx'd, ...                          */
+#endif
+             DHCPc_RenewRebindStateHandler(pif_info, msg, &err);/* ... go into RENEWING/REBINDING state.                */
+             switch (err) {
+                 case DHCPc_ERR_NONE:
+                 case DHCPc_ERR_INIT_SOCK:
+                      break;                                    /* Already cfg'd, status set.                           */
+
+
+                 case DHCPc_ERR_NONE_NO_TMR:
+                      CPU_CRITICAL_ENTER();
+                      pif_info->LeaseStatus = DHCP_STATUS_CFGD_NO_TMR;
+                      CPU_CRITICAL_EXIT();
+                      break;
+
+
+                 default:
+                      CPU_CRITICAL_ENTER();
+                      pif_info->LeaseStatus = DHCP_STATUS_FAIL;
+                      pif_info->LastErr     = err;
+                      CPU_CRITICAL_EXIT();
+                      break;
+             }
+             break;
+
+
+        case DHCPc_COMM_MSG_STOP:                               /* If nego stopping, ...                                */
+             DHCPc_StopStateHandler(pif_info, &err);            /* ... go into STOP state.                              */
+             break;
+
+
+        case DHCPc_COMM_MSG_INFORM:                             /* If INFORM req'd, ...                                 */
+             CPU_CRITICAL_ENTER();
+             pif_info->LeaseStatus = DHCP_STATUS_CFG_IN_PROGRESS;
+             CPU_CRITICAL_EXIT();
+
+             DHCPc_InformStateHandler(pif_info, &err);          /* ... tx INFORM & get reply.                           */
+             CPU_CRITICAL_ENTER();
+             if (err == DHCPc_ERR_NONE) {
+                 pif_info->LeaseStatus = DHCP_STATUS_INFORMED;
+             } else {
+                 pif_info->LeaseStatus = DHCP_STATUS_FAIL;
+                 pif_info->LastErr     = err;
+             }
+             CPU_CRITICAL_EXIT();
+             break;
+
+
+        case DHCPc_COMM_MSG_NONE:                               /* Else, ...                                            */
+        default:
+             err = DHCPc_ERR_NONE;
+             break;                                             /* ... do nothing.                                      */
+    }
+
+                                                                /* ------------------ SET REQ RESULT ------------------ */
+    if (preq != (DHCPc_REQ *)0) {                               /* See Note #4.                                         */
+        if (msg == DHCPc_COMM_MSG_STOP) {
+            preq->Status = DHCP_STATUS_NONE;
+        } else {
+            preq->Status = pif_info->LeaseStatus;
+        }
+        preq->Err = err;
+    }
+
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+                                                                /* ------------- START FORCERENEW LISTEN -------------- */
+    if (listen_stop == DEF_YES) {
+        DHCPc_OS_Lock(&err);                                    /* See Note #3.                                         */
+        if (err == DHCPc_OS_ERR_NONE) {
+            DHCPc_ForceRenewListenStart();                      /* Re-open listen socks.                                */
+            DHCPc_OS_Unlock();
+        }
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_MsgGet()
+*
+* Description : (1) Allocate & initialize a DHCPc message :
+*
+*                   (a) Get        message
+*                   (b) Initialize message
+*                   (c) Insert     message at head of message list
+*                   (d) Return pointer to message
+*                         OR
+*                       Null pointer & error code, on failure
+*
+*
+* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Message successfully allocated & initialized.
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*
+* Return(s)   : Pointer to message, if NO errors.
+*
+*               Pointer to NULL,    otherwise.
+*
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_Req(),
+*               DHCPc_DeclineRelease(),
+*               DHCPc_ForceRenewChk(),
+*               DHCPc_IPv6_Exchange().
+*
+* Note(s)     : (2) The message pool & list are accessed by the DHCPc task without the global DHCPc
+*                   lock & are hence protected by critical sections (see 'dhcp-c.h  Note #2c').  The
+*                   message buffer is cleared outside of the critical sections.
+*********************************************************************************************************
+*/
+
+static  DHCPc_MSG  *DHCPc_MsgGet (DHCPc_ERR  *perr)
+{
+    DHCPc_MSG  *pmsg;
+    CPU_SR_ALLOC();
+
+                                                                /* --------------------- GET MSG ---------------------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    if (DHCPc_MsgPoolPtr != (DHCPc_MSG *)0) {                   /* If msg pool NOT empty, get msg from pool.            */
+        pmsg              = (DHCPc_MSG *)DHCPc_MsgPoolPtr;
+        DHCPc_MsgPoolPtr  = (DHCPc_MSG *)pmsg->NextPtr;
+        CPU_CRITICAL_EXIT();
+
+    } else {                                                    /* If none avail, rtn err.                              */
+        CPU_CRITICAL_EXIT();
+       *perr = DHCPc_ERR_MSG_NONE_AVAIL;
+        return ((DHCPc_MSG *)0);
+    }
+
+                                                                /* --------------------- INIT MSG --------------------- */
+    DHCPc_MsgClr(pmsg);
+    DEF_BIT_SET(pmsg->Flags, DHCPc_FLAG_USED);                  /* Set msg as used.                                     */
+
+                                                                /* ------------- INSERT MSG INTO MSG LIST ------------- */
+    CPU_CRITICAL_ENTER();
+    pmsg->PrevPtr = (DHCPc_MSG *)0;
+    pmsg->NextPtr = (DHCPc_MSG *)DHCPc_MsgListHead;
+    if (DHCPc_MsgListHead != (DHCPc_MSG *)0) {                  /* If list NOT empty, insert before head.               */
+        DHCPc_MsgListHead->PrevPtr = pmsg;
+    }
+    DHCPc_MsgListHead = pmsg;                                   /* Insert msg @ list head.                              */
+    CPU_CRITICAL_EXIT();
+
+
+   *perr =  DHCPc_ERR_NONE;
+
+    return (pmsg);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_MsgGetOpt()
+*
+* Description : Retrieve the specified option value from a DHCP message buffer.
+*
+* Argument(s) : opt_code            Option code to return value of.
+*
+*               pmsg_buf            Pointer to DHCP message buffer to search.
+*
+*               msg_buf_size        Size of message buffer (in octets).
+*
+*               popt_val_len        Pointer to variable that will receive the length of the option value.
+*
+* Return(s)   : Pointer to the specified option value, if option found without error.
+*
+*               Pointer tu NULL,                       otherwise.
+*
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_LeaseTimeCalc(),
+*               DHCPc_AddrCfg(),
+*               DHCPc_RxReply().
+*
+* Note(s)     : (1) RFC #2131, section 'Options' states that "if the options in a DHCP message extend
+*                   into the 'sname' and 'file' fields, the 'option overload' option MUST appear in the
+*                   'options' field, with value 1, 2 or 3".  It also specifies that "options in the
+*                   'options' field MUST be interpreted first, so that any 'option overload' options may
+*                   be interpreted.  The 'file' field MUST be interpreted next (if the 'option overload'
+*                   option indicates that the 'file' field contains DHCP options), followed by the
+*                   'sname' field".
+*
+*                   See also 'dhcp-c.h  DHCP OPTION DEFINES  Note #2'.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *DHCPc_MsgGetOpt (DHCPc_OPT_CODE   opt_code,
+                                      CPU_INT08U      *pmsg_buf,
+                                      CPU_INT16U       msg_buf_size,
+                                      CPU_INT08U      *popt_val_len)
+{
+    DHCP_MSG_HDR  *pmsg_hdr;
+    CPU_INT32U     magic_cookie;
+    CPU_BOOLEAN    opt_start;
+    CPU_INT08U    *popt;
+    CPU_INT08U    *popt_val;
+    CPU_INT08U    *pend_msg;
+    CPU_INT08U     overload;
+    CPU_INT08U     overload_len;
+
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* ------------------- VALIDATE PTR ------------------- */
+    if (popt_val_len == (CPU_INT08U *)0) {
+        return ((CPU_INT08U *)0);
+    }
+
+    if (pmsg_buf == (CPU_INT08U *)0) {
+        return ((CPU_INT08U *)0);
+    }
+#endif
+
+   *popt_val_len =  0;                                          /* Cfg rtn opt val len for err.                         */
+
+    if (msg_buf_size < (DHCP_MSG_HDR_SIZE + DHCP_MAGIC_COOKIE_SIZE)) {
+        return ((CPU_INT08U *)0);
+    }
+
+    pmsg_hdr = (DHCP_MSG_HDR *)pmsg_buf;
+    popt     =  pmsg_buf + DHCP_MSG_HDR_SIZE;
+
+                                                                /* -------- VALIDATE BEGINNING OF OPT SECTION --------- */
+    magic_cookie = NET_UTIL_HOST_TO_NET_32(DHCP_MAGIC_COOKIE);
+    opt_start = Mem_Cmp((void     *) popt,
+                        (void     *)&magic_cookie,
+                        (CPU_SIZE_T) DHCP_MAGIC_COOKIE_SIZE);
+
+    if (opt_start != DEF_YES) {                                 /* If magic cookie NOT here, ...                        */
+        return ((CPU_INT08U *)0);                               /* ... rtn.                                             */
+    }
+
+    popt += DHCP_MAGIC_COOKIE_SIZE;                             /* Go to first opt.                                     */
+
+
+                                                                /* ---------------- SRCH OPT IN OPT FIELD ------------- */
+    pend_msg = pmsg_buf + msg_buf_size;
+    popt_val = DHCPc_MsgGetOptSrch(opt_code, popt, pend_msg, popt_val_len);
+    if ((popt_val != (CPU_INT08U *)0) ||                        /* If opt found              ...                        */
+        (opt_code == DHCP_OPT_OPTION_OVERLOAD)) {               /* ... or srch'd opt is overload, rtn (see Note #1).    */
+        return (popt_val);
+    }
+
+                                                                /* ------------------ GET OVERLOAD -------------------- */
+    popt_val = DHCPc_MsgGetOptSrch(DHCP_OPT_OPTION_OVERLOAD, popt, pend_msg, &overload_len);
+    if ((popt_val     == (CPU_INT08U *)0) ||                    /* If overload opt NOT present or invalid, ...          */
+        (overload_len != 1u)) {
+        return ((CPU_INT08U *)0);                               /* ... opt NOT found.                                   */
+    }
+    overload = *popt_val;
+
+                                                                /* -------------- SRCH OPT IN 'file' FIELD ------------ */
+    if ((overload == DHCP_OPT_OVERLOAD_FILE) ||
+        (overload == DHCP_OPT_OVERLOAD_BOTH)) {
+        popt_val = DHCPc_MsgGetOptSrch((DHCPc_OPT_CODE) opt_code,
+                                       (CPU_INT08U   *)&pmsg_hdr->file[0],
+                                       (CPU_INT08U   *)&pmsg_hdr->file[sizeof(pmsg_hdr->file)],
+                                       (CPU_INT08U   *) popt_val_len);
+        if (popt_val != (CPU_INT08U *)0) {
+            return (popt_val);
+        }
+    }
+
+                                                                /* ------------- SRCH OPT IN 'sname' FIELD ------------ */
+    if ((overload == DHCP_OPT_OVERLOAD_SNAME) ||
+        (overload == DHCP_OPT_OVERLOAD_BOTH)) {
+        popt_val = DHCPc_MsgGetOptSrch((DHCPc_OPT_CODE) opt_code,
+                                       (CPU_INT08U   *)&pmsg_hdr->sname[0],
+                                       (CPU_INT08U   *)&pmsg_hdr->sname[sizeof(pmsg_hdr->sname)],
+                                       (CPU_INT08U   *) popt_val_len);
+        if (popt_val != (CPU_INT08U *)0) {
+            return (popt_val);
+        }
+    }
+
+    return ((CPU_INT08U *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_MsgGetOptSrch()
+*
+* Description : Search the specified option in a DHCP option area.
+*
+* Argument(s) : opt_code            Option code to return value of.
+*
+*               popt_start          Pointer to the first option of the option area.
+*               ----------          Argument validated in DHCPc_MsgGetOpt().
+*
+*               popt_end            Pointer to the end of the option area.
+*
+*               popt_val_len        Pointer to variable that will receive the length of the option value.
+*               ------------        Argument validated in DHCPc_MsgGetOpt().
+*
+* Return(s)   : Pointer to the specified option value, if option found without error.
+*
+*               Pointer to NULL,                       otherwise.
+*
+* Caller(s)   : DHCPc_MsgGetOpt().
+*
+* Note(s)     : (1) An option whose value extends past the end of the option area is considered invalid.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *DHCPc_MsgGetOptSrch (DHCPc_OPT_CODE   opt_code,
+                                          CPU_INT08U      *popt_start,
+                                          CPU_INT08U      *popt_end,
+                                          CPU_INT08U      *popt_val_len)
+{
+    CPU_BOOLEAN   opt_found;
+    CPU_INT08U   *popt;
+
+
+    opt_found = DEF_NO;
+    popt      = popt_start;
+
+    while ((opt_found != DEF_YES)      &&                       /* Srch until opt found,                                */
+           ( popt     <  popt_end)     &&                       /* & end of opt area NOT reached,                       */
+           (*popt     != DHCP_OPT_END)) {                       /* & opt end         NOT reached.                       */
+
+        if (*popt == opt_code) {                                /* If popt equals srch'd opt code, ...                  */
+            opt_found = DEF_YES;                                /* ... opt found.                                       */
+
+        } else if (*popt == DHCP_OPT_PAD) {                     /* If popt is padding, ...                              */
+            popt++;                                             /* ... advance.                                         */
+
+        } else if ((popt + DHCP_OPT_FIELD_CODE_LEN) < popt_end) {
+                                                                /* Else, another opt found,  ...                        */
+                                                                /* ... skip to next opt.                                */
+            popt += ((*(popt + DHCP_OPT_FIELD_CODE_LEN)) + DHCP_OPT_FIELD_HDR_LEN);
+
+        } else {
+            break;
+        }
+    }
+
+
+    if (opt_found != DEF_YES) {
+        return ((CPU_INT08U *)0);
+    }
+
+    if ((popt + DHCP_OPT_FIELD_HDR_LEN) > popt_end) {           /* Validate opt len (see Note #1).                      */
+        return ((CPU_INT08U *)0);
+    }
+
+    if ((popt + DHCP_OPT_FIELD_HDR_LEN + *(popt + DHCP_OPT_FIELD_CODE_LEN)) > popt_end) {
+        return ((CPU_INT08U *)0);
+    }
+
+   *popt_val_len = *(popt + DHCP_OPT_FIELD_CODE_LEN);           /* Set opt val len ...                                  */
+
+    return (popt + DHCP_OPT_FIELD_HDR_LEN);                     /* ... & rtn opt val ptr.                               */
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_MsgFree()
+*
+* Description : (1) Free a DHCPc message :
+*
+*                   (a) Remove message from    message list
+*                   (b) Clear  message controls
+*                   (c) Free   message back to message pool
+*
+*
+* Argument(s) : pmsg        Pointer to a DHCPc message.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StopStateHandler(),
+*               DHCPc_Discover(),
+*               DHCPc_Req(),
+*               DHCPc_DeclineRelease(),
+*               DHCPc_IPv6_Exchange().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (2) #### To prevent freeing a message already freed via previous message free,
+*                   DHCPc_MsgFree() checks the message's 'USED' flag BEFORE freeing the message.
+*
+*                   This prevention is only best-effort since any invalid duplicate message frees MAY be
+*                   asynchronous to potentially valid message gets.  Thus the invalid message free(s) MAY
+*                   corrupt the message's valid operation(s).
+*
+*               (3) The message pool & list are protected by critical sections (see 'DHCPc_MsgGet()
+*                   Note #2').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_MsgFree (DHCPc_MSG  *pmsg)
+{
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    CPU_BOOLEAN   used;
+#endif
+    DHCPc_MSG    *pprev;
+    DHCPc_MSG    *pnext;
+    CPU_SR_ALLOC();
+
+
+                                                                /* ------------------ VALIDATE PTR -------------------- */
+    if (pmsg == (DHCPc_MSG *)0) {
+        return;
+    }
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE MSG USED ----------------- */
+    used = DEF_BIT_IS_SET(pmsg->Flags, DHCPc_FLAG_USED);
+    if (used != DEF_YES) {                                      /* If msg NOT used, ...                                 */
+        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
+    }
+#endif
+
+                                                                /* ------------- REMOVE MSG FROM MSG LIST ------------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    pprev = pmsg->PrevPtr;
+    pnext = pmsg->NextPtr;
+    if (pprev != (DHCPc_MSG *)0) {                              /* If pmsg is NOT   the head of msg list, ...           */
+        pprev->NextPtr    = pnext;                              /* ... set pprev's NextPtr to skip pmsg.                */
+    } else {                                                    /* Else set pnext as head of msg list.                  */
+        DHCPc_MsgListHead = pnext;
+    }
+    if (pnext != (DHCPc_MSG *)0) {                              /* If pmsg is NOT @ the tail of msg list, ...           */
+        pnext->PrevPtr    = pprev;                              /* ... set pnext's PrevPtr to skip pmsg.                */
+    }
+    CPU_CRITICAL_EXIT();
+
+                                                                /* ---------------------- CLR MSG --------------------- */
+    DEF_BIT_CLR(pmsg->Flags, DHCPc_FLAG_USED);                  /* Set msg as NOT used.                                 */
+#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+    DHCPc_MsgClr(pmsg);
+#endif
+
+                                                                /* --------------------- FREE MSG --------------------- */
+    CPU_CRITICAL_ENTER();
+    pmsg->NextPtr    = DHCPc_MsgPoolPtr;
+    DHCPc_MsgPoolPtr = pmsg;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_MsgClr()
+*
+* Description : Clear DHCPc message controls.
+*
+* Argument(s) : pmsg        Pointer to a DHCPc message.
+*               ----        Argument validated in DHCPc_MsgInit(),
+*                                    checked   in DHCPc_MsgGet(),
+*                                    checked   in DHCPc_MsgFree().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgInit(),
+*               DHCPc_MsgGet(),
+*               DHCPc_MsgFree().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_MsgClr (DHCPc_MSG  *pmsg)
+{
+    pmsg->PrevPtr = (DHCPc_MSG *)0;
+    pmsg->NextPtr = (DHCPc_MSG *)0;
+
+    Mem_Clr((void     *)&pmsg->MsgBuf[0],
+            (CPU_SIZE_T) DHCP_MSG_BUF_SIZE);
+
+    pmsg->MsgLen  =  0;
+    pmsg->Flags   =  DHCPc_FLAG_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_CommInit()
+*
+* Description : (1) Initialize DHCPc communication objects :
+*
+*                   (a) Initialize communication object pool
+*                   (b) Initialize communication object table
+*                   (c) Initialize communication object list pointer
+*
+*
+* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPc communication objects successfully
+*                                                                   initialized.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Init().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) Communication object pool MUST be initialized PRIOR to initializing the pool with
+*                   pointers to communication objects.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_CommInit (DHCPc_ERR  *perr)
+{
+    DHCPc_COMM      *pcomm;
+    DHCPc_COMM_QTY   i;
+
+                                                                /* ---------------- INIT COMM OBJ POOL ---------------- */
+    DHCPc_CommPoolPtr = (DHCPc_COMM *)0;                        /* Init-clr DHCPc comm obj pool (see Note #2).          */
+
+
+                                                                /* ----------------- INIT COMM OBJ TBL ---------------- */
+    pcomm = &DHCPc_CommTbl[0];
+    for (i = 0; i < DHCPc_NBR_COMM; i++) {
+        pcomm->ID         = (DHCPc_COMM_QTY)i;
+        pcomm->Flags      =  DHCPc_FLAG_NONE;                   /* Init each comm obj as NOT used.                      */
+
+#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+        DHCPc_CommClr(pcomm);
+#endif
+
+        pcomm->NextPtr    = DHCPc_CommPoolPtr;                  /* Free each comm obj to comm obj pool (see Note #2).   */
+        DHCPc_CommPoolPtr = pcomm;
+
+        pcomm++;
+    }
+
+                                                                /* -------------- INIT COMM OBJ LIST PTR -------------- */
+    DHCPc_CommListHead = (DHCPc_COMM *)0;
+
+
+   *perr = DHCPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_CommGet()
+*
+* Description : (1) Allocate & initialize a DHCPc communication object :
+*
+*                   (a) Get        communication object
+*                   (b) Initialize communication object
+*                   (c) Insert     communication object at head of communication object list
+*                   (d) Return pointer to communication object
+*                         OR
+*                       Null pointer & error code, on failure
+*
+*
+* Argument(s) : if_nbr          Interface number requesting a communication object.
+*
+*               comm_msg        Message to pass.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Communication object successfully allocated
+*                                                                   & initialized.
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*
+* Return(s)   : Pointer to communication object, if NO errors.
+*
+*               Pointer to NULL,                 otherwise.
+*
+* Caller(s)   : DHCPc_Start(),
+*               DHCPc_Stop(),
+*               DHCPc_TmrCfg(),
+*               DHCPc_ForceRenewChk().
+*
+* Note(s)     : (2) The communication object pool & list are accessed by the DHCPc task without
+*                   the global DHCPc lock & are hence protected by critical sections (see 'dhcp-c.h
+*                   Note #2c').
+*********************************************************************************************************
+*/
+
+static  DHCPc_COMM  *DHCPc_CommGet (DHCPc_IF_INFO   *pif_info,
+                                    DHCPc_COMM_MSG   comm_msg,
+                                    DHCPc_ERR       *perr)
+{
+    DHCPc_COMM  *pcomm;
+    CPU_SR_ALLOC();
+
+
+                                                                /* ------------------- GET COMM OBJ ------------------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    if (DHCPc_CommPoolPtr != (DHCPc_COMM *)0) {                 /* If comm obj pool NOT empty, get comm obj from pool   */
+        pcomm              = (DHCPc_COMM *)DHCPc_CommPoolPtr;
+        DHCPc_CommPoolPtr  = (DHCPc_COMM *)pcomm->NextPtr;
+
+    } else {                                                    /* If none avail, rtn err.                              */
+        CPU_CRITICAL_EXIT();
+       *perr = DHCPc_ERR_COMM_NONE_AVAIL;
+        return ((DHCPc_COMM *)0);
+    }
+
+                                                                /* ------------------ INIT COMM OBJ ------------------- */
+    DHCPc_CommClr(pcomm);
+    pcomm->PrevPtr = (DHCPc_COMM *)0;
+    pcomm->NextPtr    = (DHCPc_COMM *)DHCPc_CommListHead;
+    pcomm->IF_Nbr     =  pif_info->IF_Nbr;
+    pcomm->IF_InfoPtr =  pif_info;
+    pcomm->IF_InfoGen =  pif_info->Gen;
+    pcomm->CommMsg    =  comm_msg;
+    DEF_BIT_SET(pcomm->Flags, DHCPc_FLAG_USED);                 /* Set comm obj as used.                                */
+
+                                                                /* -------- INSERT COMM OBJ INTO COMM OBJ LIST -------- */
+    if (DHCPc_CommListHead != (DHCPc_COMM *)0) {                /* If list NOT empty, insert before head.               */
+        DHCPc_CommListHead->PrevPtr = pcomm;
+    }
+    DHCPc_CommListHead = pcomm;                                 /* Insert comm obj @ list head.                         */
+    CPU_CRITICAL_EXIT();
+
+
+   *perr =  DHCPc_ERR_NONE;
+
+    return (pcomm);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_CommFree()
+*
+* Description : (1) Free a DHCPc communication object :
+*
+*                   (a) Remove communication object from    communication object list
+*                   (b) Clear  communication object controls
+*                   (c) Free   communication object back to communication object pool
+*
+*
+* Argument(s) : pcomm       Pointer to a DHCPc communication object.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StartAsync(),
+*               DHCPc_StopAsync(),
+*               DHCPc_MsgRxHandler(),
+*               DHCPc_TmrCfg().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (2) #### To prevent freeing a communication object already freed via previous communication
+*                   object free, DHCPc_CommFree() checks the communication object's 'USED' flag BEFORE
+*                   freeing the communication object.
+*
+*                   This prevention is only best-effort since any invalid duplicate communication object
+*                   frees MAY be asynchronous to potentially valid communication object gets.  Thus the
+*                   invalid communication object free(s) MAY corrupt the communicatino object's valid
+*                   operation(s).
+*
+*               (3) The communication object pool & list are protected by critical sections (see
+*                   'DHCPc_CommGet()  Note #2').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_CommFree (DHCPc_COMM  *pcomm)
+{
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    CPU_BOOLEAN   used;
+#endif
+    DHCPc_COMM   *pprev;
+    DHCPc_COMM   *pnext;
+    CPU_SR_ALLOC();
+
+
+                                                                /* ------------------ VALIDATE PTR -------------------- */
+    if (pcomm == (DHCPc_COMM *)0) {
+        return;
+    }
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* -------------- VALIDATE COMM OBJ USED -------------- */
+    used = DEF_BIT_IS_SET(pcomm->Flags, DHCPc_FLAG_USED);
+    if (used != DEF_YES) {                                      /* If comm obj NOT used, ...                            */
+        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
+    }
+#endif
+
+                                                                /* -------- REMOVE COMM OBJ FROM COMM OBJ LIST -------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    pprev = pcomm->PrevPtr;
+    pnext = pcomm->NextPtr;
+    if (pprev != (DHCPc_COMM *)0) {                             /* If pcomm is NOT   the head of comm obj list, ...     */
+        pprev->NextPtr     = pnext;                             /* ... set pprev's NextPtr to skip pcomm.               */
+    } else {                                                    /* Else set pnext as head of comm obj list.             */
+        DHCPc_CommListHead = pnext;
+    }
+    if (pnext != (DHCPc_COMM *)0) {                             /* If pcomm is NOT @ the tail of comm obj list, ...     */
+        pnext->PrevPtr     = pprev;                             /* ... set pnext's PrevPtr to skip pcomm.               */
+    }
+
+                                                                /* ------------------- CLR COMM OBJ ------------------- */
+    DEF_BIT_CLR(pcomm->Flags, DHCPc_FLAG_USED);                 /* Set comm obj as NOT used.                            */
+#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+    DHCPc_CommClr(pcomm);
+#endif
+
+                                                                /* ------------------ FREE COMM OBJ ------------------- */
+    pcomm->NextPtr    = DHCPc_CommPoolPtr;
+    DHCPc_CommPoolPtr = pcomm;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_CommClr()
+*
+* Description : Clear DHCPc communication object controls.
+*
+* Argument(s) : pcomm       Pointer to a DHCPc communication object.
+*               ----        Argument validated in DHCPc_CommInit(),
+*                                    checked   in DHCPc_CommGet(),
+*                                    checked   in DHCPc_CommFree().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_CommInit(),
+*               DHCPc_CommGet(),
+*               DHCPc_CommFree().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_CommClr (DHCPc_COMM  *pcomm)
+{
+    pcomm->PrevPtr = (DHCPc_COMM *)0;
+    pcomm->NextPtr = (DHCPc_COMM *)0;
+
+    pcomm->IF_Nbr     =  0;
+    pcomm->IF_InfoPtr = (DHCPc_IF_INFO *)0;
+    pcomm->IF_InfoGen =  0u;
+    pcomm->CommMsg    =  DHCPc_COMM_MSG_NONE;
+
+    pcomm->Flags      =  DHCPc_FLAG_NONE;
+
+    pcomm->ReqPtr     = (DHCPc_REQ *)0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_ReqAttach()
+*
+* Description : Attach a request handle to a communication object.
+*
+* Argument(s) : preq        Pointer to request handle.
+*               ----        Argument validated in DHCPc_StartAsync(),
+*                                                 DHCPc_StopAsync().
+*
+*               pcomm       Pointer to DHCPc communication object the request is completed on.
+*               -----       Argument validated in DHCPc_StartAsync(),
+*                                                 DHCPc_StopAsync().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StartAsync(),
+*               DHCPc_StopAsync().
+*
+* Note(s)     : (1) The request handle MUST be attached with the DHCPc lock acquired & AFTER the
+*                   communication object has been posted; the request is then completed by the DHCPc
+*                   task only once the calling function releases the DHCPc lock.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ReqAttach (DHCPc_REQ   *preq,
+                               DHCPc_COMM  *pcomm)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    preq->IF_Nbr  =  pcomm->IF_Nbr;
+    preq->Status  =  DHCP_STATUS_CFG_IN_PROGRESS;
+    preq->Err     =  DHCPc_ERR_NONE;
+    preq->Pend    =  DEF_YES;                                   /* Set req as pending.                                  */
+    CPU_CRITICAL_EXIT();
+
+    pcomm->ReqPtr =  preq;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_ReqDone()
+*
+* Description : (1) Complete a request :
+*
+*                   (a) Set    request as completed
+*                   (b) Signal waiting task(s)
+*                   (c) Call   request callback function
+*
+*
+* Argument(s) : preq        Pointer to request handle.
+*               ----        Argument checked in DHCPc_TaskHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_TaskHandler().
+*
+* Note(s)     : (2) The request is set as completed & its waiters are signaled with the DHCPc lock acquired,
+*                   so that a task can NOT register as waiter between both (see 'DHCPc_ReqWait()  Note #2').
+*                   If the DHCPc lock can NOT be acquired, the request is still set as completed; its
+*                   waiters then return on their timeout.
+*
+*               (3) The request's result is copied PRIOR to setting the request as completed since the
+*                   application MAY re-use or free the request handle as soon as it is completed.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ReqDone (DHCPc_REQ  *preq)
+{
+    DHCPc_REQ_CALLBACK_FNCT   callback_fnct;
+    void                     *p_callback_arg;
+    NET_IF_NBR                if_nbr;
+    DHCPc_STATUS              status;
+    DHCPc_ERR                 err;
+    DHCPc_ERR                 err_lock;
+    CPU_INT16U                ix;
+    CPU_SR_ALLOC();
+
+
+                                                                /* --------------- SET REQ AS COMPLETED --------------- */
+    DHCPc_OS_Lock(&err_lock);                                   /* See Note #2.                                         */
+
+    CPU_CRITICAL_ENTER();
+    callback_fnct  = preq->CallbackFnct;                        /* Copy req result (see Note #3).                       */
+    p_callback_arg = preq->CallbackArg;
+    if_nbr         = preq->IF_Nbr;
+    status         = preq->Status;
+    err            = preq->Err;
+
+    preq->Pend     = DEF_NO;
+    CPU_CRITICAL_EXIT();
+
+                                                                /* --------------- SIGNAL WAITING TASKS --------------- */
+    if (err_lock == DHCPc_OS_ERR_NONE) {
+        for (ix = 0u; ix < DHCPc_NBR_REQ_WAIT; ix++) {
+            if (DHCPc_ReqWaitTbl[ix] == preq) {                 /* Signal ONLY the req's waiters.                       */
+                DHCPc_OS_ReqSignal(ix);
+            }
+        }
+
+        DHCPc_OS_Unlock();
+    }
+
+                                                                /* ------------------- CALL CALLBACK ------------------ */
+    if (callback_fnct != (DHCPc_REQ_CALLBACK_FNCT)0) {
+        callback_fnct(if_nbr, status, err, p_callback_arg);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_TmrInit()
+*
+* Description : (1) Initialize DHCPc :
+*
+*                   (a) Perform Timer/OS initialization
+*                   (b) Perform Task/OS  initialization
+*                   (c) Initialize timer pool
+*                   (d) Initialize timer table
+*                   (e) Initialize timer list pointer
+*
+*
+* Argument(s) : perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                      DHCPc timer module successfully initialized.
+*
+*                                                                   ----- RETURNED BY DHCPc_OS_TmrInit() : ------
+*                               DHCPc_OS_ERR_INIT_TMR               DHCPc timer                NOT successfully
+*                                                                       initialized.
+*                               DHCPc_OS_ERR_INIT_TMR_SIGNAL        DHCPc timer    signal      NOT successfully
+*                                                                       initialized.
+*                               DHCPc_OS_ERR_INIT_TMR_SIGNAL_NAME   DHCPc timer    signal name NOT successfully
+*                                                                       initialized.
+*                               DHCPc_OS_ERR_INIT_TMR_TASK          DHCPc timer    task        NOT successfully
+*                                                                       initialized.
+*                               DHCPc_OS_ERR_INIT_TMR_TASK_NAME     DHCPc timer    task name   NOT successfully
+*                                                                       configured.
+*
+*                                                                   ----- RETURNED BY DHCPc_OS_TaskInit() : -----
+*                               DHCPc_OS_ERR_INIT_TASK              DHCPc task      NOT successfully initialized.
+*                               DHCPc_OS_ERR_INIT_TASK_NAME         DHCPc task name NOT successfully configured.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Init().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) Timer pool MUST be initialized PRIOR to initializing the pool with pointers to timers.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_TmrInit (DHCPc_ERR  *perr)
+{
+    DHCPc_TMR      *ptmr;
+    DHCPc_TMR_QTY   i;
+
+
+                                                                /* -------------- PERFORM TIMER/OS INIT --------------- */
+    DHCPc_OS_TmrInit(perr);                                     /* Create DHCPc Tmr & Tmr Task.                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+                                                                /* --------------- PERFORM TASK/OS INIT --------------- */
+    DHCPc_OS_TaskInit(perr);                                    /* Create DHCPc Task.                                   */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+         return;
+    }
+
+                                                                /* ------------------ INIT TMR POOL ------------------- */
+    DHCPc_TmrPoolPtr = (DHCPc_TMR *)0;                          /* Init-clr DHCPc tmr pool (see Note #2).               */
+
+
+                                                                /* ------------------ INIT TMR TBL -------------------- */
+    ptmr = &DHCPc_TmrTbl[0];
+    for (i = 0; i < DHCPc_NBR_TMR; i++) {
+        ptmr->ID    = (DHCPc_TMR_QTY)i;
+        ptmr->Flags =  DHCPc_FLAG_NONE;                         /* Init each tmr as NOT used.                           */
+
+#if (DHCPc_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+        DHCPc_TmrClr(ptmr);
+#endif
+
+        ptmr->NextPtr    = DHCPc_TmrPoolPtr;                    /* Free each tmr to tmr pool (see Note #2).             */
+        DHCPc_TmrPoolPtr = ptmr;
+
+        ptmr++;
+    }
+
+                                                                /* ---------------- INIT TMR LIST PTR ----------------- */
+    DHCPc_TmrListHead = (DHCPc_TMR *)0;
+
+
+   *perr = DHCPc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_TmrCfg()
+*
+* Description : (1) Configure & insert a timer.
+*
+*                   (a) Get communication object
+*                   (b) Get timer
+*
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information structure.
+*               --------        Argument checked   in DHCPc_MsgRxHandler(),
+*                                        validated in DHCPc_LeaseTimeCalc(),
+*                                                     DHCPc_LeaseTimeUpdate().
+*
+*               tmr_msg         Timer expiration message.
+*
+*               deadline_sec    Timer deadline (in DHCPc seconds) [see Note #2].
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Timer successfully configured.
+*                               DHCPc_ERR_TMR_INVALID_MSG       Invalid timer message.
+*
+*                                                               --- RETURNED BY DHCPc_MsgGet() : ---
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*
+*                                                               --- RETURNED BY DHCPc_TmrGet() : ---
+*                               DHCPc_ERR_TMR_NONE_AVAIL        Timer pool empty.
+*
+*                                                               --- RETURNED BY DHCPc_OS_Lock() : ---
+*                               DHCPc_OS_ERR_LOCK               Error acquiring DHCPc lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgRxHandler(),
+*               DHCPc_LeaseTimeCalc(),
+*               DHCPc_LeaseTimeUpdate(),
+*               DHCPc_IPv6_LeaseTimeCalc().
+*
+* Note(s)     : (2) The timer deadline is an absolute time on the DHCPc time base (see 'DHCPc_TimeGet_sec()').
+*                   A deadline already reached is allowed; next timer period will expire timer.
+*
+*               (3) DHCPc_TmrCfg() is called by the DHCPc task without the global DHCPc lock; the
+*                   lock is acquired to insert the timer in the timer list, which is shared with the DHCPc
+*                   Timer Task (see 'dhcp-c.h  Note #2b').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_TmrCfg (DHCPc_IF_INFO   *pif_info,
+                            DHCPc_COMM_MSG   tmr_msg,
+                            CPU_INT32U       deadline_sec,
+                            DHCPc_ERR       *perr)
+{
+    DHCPc_COMM  *pcomm;
+
+
+                                                                /* ----------------- VALIDATE TMR MSG ----------------- */
+    switch (tmr_msg) {
+        case DHCPc_COMM_MSG_START:
+        case DHCPc_COMM_MSG_T1_EXPIRED:
+        case DHCPc_COMM_MSG_T2_EXPIRED:
+        case DHCPc_COMM_MSG_LEASE_EXPIRED:
+             break;
+
+
+        default:
+            *perr = DHCPc_ERR_TMR_INVALID_MSG;
+             return;
+    }
+
+
+    if (deadline_sec == DHCP_LEASE_INFINITE) {                  /* If time infinite, ...                                */
+       *perr = DHCPc_ERR_NONE;                                  /* ... rtn.                                             */
+        return;
+    }
+
+                                                                /* --------------------- CFG TMR ---------------------- */
+                                                                /* Get comm obj,                                        */
+    pcomm = DHCPc_CommGet((DHCPc_IF_INFO *)pif_info,
+                          (DHCPc_COMM_MSG )tmr_msg,
+                          (DHCPc_ERR     *)perr);
+    if (*perr != DHCPc_ERR_NONE) {
+         return;
+    }
+
+    DHCPc_OS_Lock(perr);                                        /* See Note #3.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+         DHCPc_CommFree(pcomm);
+         return;
+    }
+                                                                /* ... & set tmr.                                       */
+    pif_info->Tmr = DHCPc_TmrGet((void      *)pcomm,
+                                 (CPU_INT32U )deadline_sec,
+                                 (DHCPc_ERR *)perr);
+    DHCPc_OS_Unlock();
+    if (*perr != DHCPc_ERR_NONE) {
+         DHCPc_CommFree(pcomm);
+         return;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_TmrGet()
+*
+* Description : (1) Allocate & initialize a DHCPc timer :
+*
+*                   (a) Get        timer
+*                   (b) Validate   timer
+*                   (c) Initialize timer
+*                   (d) Insert     timer at head of timer list
+*                   (e) Return pointer to timer
+*                         OR
+*                       Null pointer & error code, on failure
+*
+*               (2) The timer pool is implemented as a stack :
+*
+*                   (a) 'DHCPc_TmrPoolPtr' points to the head of the timer pool.
+*
+*                   (b) Timers' 'NextPtr's link each timer to form   the timer pool stack.
+*
+*                   (c) Timers are inserted & removed at the head of the timer pool stack.
+*
+*
+*                                        Timers are
+*                                    inserted & removed
+*                                        at the head
+*                                      (see Note #2c)
+*
+*                                             |                NextPtr
+*                                             |            (see Note #2b)
+*                                             v                   |
+*                                                                 |
+*                                          -------       -------  v    -------       -------
+*                         Timer Pool  ---->|     |------>|     |------>|     |------>|     |
+*                          Pointer         |     |       |     |       |     |       |     |
+*                                          |     |       |     |       |     |       |     |
+*                       (see Note #2a)     -------       -------       -------       -------
+*
+*                                          |                                               |
+*                                          |<------------ Pool of Free Timers ------------>|
+*                                          |                 (see Note #2)                 |
+*
+*
+* Argument(s) : pobj        Pointer to object that requests a timer.
+*               ----        Argument validated in DHCPc_TmrCfg().
+*
+*               deadline_sec    Timer deadline (in DHCPc seconds) [see Note #3].
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Timer successfully allocated & initialized.
+*                               DHCPc_ERR_TMR_NONE_AVAIL        Timer pool empty.
+*
+* Return(s)   : Pointer to timer, if NO errors.
+*
+*               Pointer to NULL,  otherwise.
+*
+* Caller(s)   : DHCPc_TmrCfg().
+*
+* Note(s)     : (3) A deadline already reached is allowed; next timer period will expire timer.
+*
+*               (4) The timer list is accessed with the global DHCPc lock acquired (see 'DHCPc_TmrCfg()
+*                   Note #3') whereas the timer pool is protected by a critical section (see 'dhcp-c.h
+*                   Note #2c').
+*********************************************************************************************************
+*/
+
+static  DHCPc_TMR  *DHCPc_TmrGet (void        *pobj,
+                                  CPU_INT32U   deadline_sec,
+                                  DHCPc_ERR   *perr)
+{
+    DHCPc_TMR  *ptmr;
+    CPU_SR_ALLOC();
+
+
+                                                                /* --------------------- GET TMR ---------------------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #4.                                         */
+    if (DHCPc_TmrPoolPtr != (DHCPc_TMR *)0) {                   /* If tmr pool NOT empty, get tmr from pool.            */
+        ptmr              = (DHCPc_TMR *)DHCPc_TmrPoolPtr;
+        DHCPc_TmrPoolPtr  = (DHCPc_TMR *)ptmr->NextPtr;
+        CPU_CRITICAL_EXIT();
+
+    } else {                                                    /* If none avail, rtn err.                              */
+        CPU_CRITICAL_EXIT();
+       *perr = DHCPc_ERR_TMR_NONE_AVAIL;
+        return ((DHCPc_TMR *)0);
+    }
+
+
+                                                                /* --------------------- INIT TMR --------------------- */
+    DHCPc_TmrClr(ptmr);
+    ptmr->PrevPtr      = (DHCPc_TMR *)0;
+    ptmr->NextPtr      = (DHCPc_TMR *)DHCPc_TmrListHead;
+    ptmr->Obj          = pobj;
+    ptmr->Deadline_sec = deadline_sec;                          /* Set tmr deadline (in DHCPc sec).                     */
+    DEF_BIT_SET(ptmr->Flags, DHCPc_FLAG_USED);                  /* Set tmr as used.                                     */
+
+                                                                /* ------------- INSERT TMR INTO TMR LIST ------------- */
+    if (DHCPc_TmrListHead != (DHCPc_TMR *)0) {                  /* If list NOT empty, insert before head.               */
+        DHCPc_TmrListHead->PrevPtr = ptmr;
+    }
+    DHCPc_TmrListHead = ptmr;                                   /* Insert tmr @ list head.                              */
+
+
+   *perr =  DHCPc_ERR_NONE;
+
+    return (ptmr);
+
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_TmrFree()
+*
+* Description : (1) Free a DHCPc timer :
+*
+*                   (a) Remove timer from    timer list
+*                   (b) Clear  timer controls
+*                   (c) Free   timer back to timer pool
+*
+*
+* Argument(s) : ptmr        Pointer to a DHCPc timer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_TmrTaskHandler(),
+*               DHCPc_StopStateHandler().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (2) #### To prevent freeing a timer already freed via previous timer free,
+*                   DHCPc_TmrFree() checks the timer's 'USED' flag BEFORE freeing the timer.
+*
+*                   This prevention is only best-effort since any invalid duplicate timer frees MAY be
+*                   asynchronous to potentially valid timer gets.  Thus the invalid timer free(s) MAY
+*                   corrupt the timer's valid operation(s).
+*
+*                   However, since the timer list is ONLY accessed with the global DHCPc lock acquired
+*                   (see 'dhcp-c.h  Note #2b'), it is NOT necessary to further protect timers from possible
+*                   corruption since no asynchronous access from other task is possible.
+*
+*               (3) The timer pool is protected by a critical section (see 'DHCPc_TmrGet()  Note #4').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_TmrFree (DHCPc_TMR  *ptmr)
+{
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    CPU_BOOLEAN   used;
+#endif
+    DHCPc_TMR    *pprev;
+    DHCPc_TMR    *pnext;
+    CPU_SR_ALLOC();
+
+
+                                                                /* ------------------ VALIDATE PTR -------------------- */
+    if (ptmr == (DHCPc_TMR *)0) {
+        return;
+    }
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE TMR USED ----------------- */
+    used = DEF_BIT_IS_SET(ptmr->Flags, DHCPc_FLAG_USED);
+    if (used != DEF_YES) {                                      /* If tmr NOT used, ...                                 */
+        return;                                                 /* ... rtn but do NOT free (see Note #2).               */
+    }
+#endif
+
+                                                                /* ------------- REMOVE TMR FROM MSG LIST ------------- */
+    pprev = ptmr->PrevPtr;
+    pnext = ptmr->NextPtr;
+    if (pprev != (DHCPc_TMR *)0) {                              /* If ptmr is NOT   the head of tmr list, ...           */
+        pprev->NextPtr    = pnext;                              /* ... set pprev's NextPtr to skip ptmr.                */
+    } else {                                                    /* Else set pnext as head of tmr list.                  */
+        DHCPc_TmrListHead = pnext;
+    }
+    if (pnext != (DHCPc_TMR *)0) {                              /* If ptmr is NOT @ the tail of tmr list, ...           */
+        pnext->PrevPtr    = pprev;                              /* ... set pnext's PrevPtr to skip ptmr.                */
+    }
+
+                                                                /* ---------------------- CLR TMR --------------------- */
+    DEF_BIT_CLR(ptmr->Flags, DHCPc_FLAG_USED);                  /* Set tmr as NOT used.                                 */
+#if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
+    DHCPc_TmrClr(ptmr);
+#endif
+
+                                                                /* --------------------- FREE TMR --------------------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    ptmr->NextPtr    = DHCPc_TmrPoolPtr;
+    DHCPc_TmrPoolPtr = ptmr;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_TmrClr()
+*
+* Description : Clear DHCPc timer controls.
+*
+* Argument(s) : ptmr        Pointer to a DHCPc timer.
+*               ----        Argument validated in DHCPc_TmrInit(),
+*                                    checked   in DHCPc_TmrGet(),
+*                                    checked   in DHCPc_TmrFree().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_Init(),
+*               DHCPc_TmrGet(),
+*               DHCPc_TmrFree().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_TmrClr (DHCPc_TMR  *ptmr)
+{
+    ptmr->PrevPtr      = (DHCPc_TMR     *)0;
+    ptmr->NextPtr      = (DHCPc_TMR     *)0;
+
+    ptmr->Obj          = (void          *)0;
+    ptmr->Deadline_sec =  0;
+
+    ptmr->Flags        =  DHCPc_FLAG_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_TmrRenewTimeGet()
+*
+* Description : Get the time up to which T1 timers are expired on the current timer period.
+*
+* Argument(s) : time_cur_sec    Current DHCPc time (in seconds).
+*
+* Return(s)   : Current time + DHCPc_CFG_RENEW_COALESCE_WIN_SEC, if any timer expires on this period.
+*
+*               Current time,                                    otherwise.
+*
+* Caller(s)   : DHCPc_TmrTaskHandler().
+*
+* Note(s)     : (1) Early renewals are only performed along with an expiring timer, so that enabling the
+*                   renewal window NEVER adds a wake-up (see 'DHCPc_TmrTaskHandler()  Note #7').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_RENEW_COALESCE_WIN_SEC > 0)
+static  CPU_INT32U  DHCPc_TmrRenewTimeGet (CPU_INT32U  time_cur_sec)
+{
+    DHCPc_TMR    *ptmr;
+    CPU_BOOLEAN   reached;
+
+
+    ptmr = DHCPc_TmrListHead;
+    while (ptmr != (DHCPc_TMR *)0) {                            /* Srch Tmr List for expiring tmr (see Note #1).        */
+        reached = DHCPc_TimeIsReached(time_cur_sec, ptmr->Deadline_sec);
+        if (reached == DEF_YES) {
+            return (time_cur_sec + DHCPc_CFG_RENEW_COALESCE_WIN_SEC);
+        }
+
+        ptmr = ptmr->NextPtr;
+    }
+
+    return (time_cur_sec);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_TimeGet_sec()
+*
+* Description : Get current DHCPc time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Current DHCPc time (in seconds).
+*
+* Caller(s)   : DHCPc_TmrTaskHandler(),
+*               DHCPc_LeaseTimeUpdate(),
+*               DHCPc_TxMsgPrepare(),
+*               DHCPc_IPv6_Exchange(),
+*               DHCPc_IPv6_TxMsgPrepare().
+*
+* Note(s)     : (1) The DHCPc time is a monotonic count of seconds since DHCPc initialization, advanced from
+*                   the OS tick counter.  Only whole seconds are added to the DHCPc time; the reference
+*                   tick is advanced by the exact number of ticks accounted for, so the remaining ticks
+*                   are carried over to the next call & NO time is lost.
+*
+*               (2) The elapsed number of ticks is calculated with unsigned arithmetic & therefore stays
+*                   valid across an OS tick counter wrap-around, as long as this function is called at
+*                   least once per tick counter period.  DHCPc_TmrTaskHandler() calls it every
+*                   DHCPc_TMR_PERIOD_SEC seconds.
+*
+*               (3) DHCPc time is accessed by the DHCPc task without the global DHCPc lock & is
+*                   hence updated in a critical section (see 'dhcp-c.h  Note #2c').
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DHCPc_TimeGet_sec (void)
+{
+    CPU_INT32U  time_cur_tick;
+    CPU_INT32U  time_elapsed_tick;
+    CPU_INT32U  time_elapsed_sec;
+    CPU_INT32U  time_cur_sec;
+    CPU_INT32U  tick_rate;
+    CPU_SR_ALLOC();
+
+
+    tick_rate = DHCPc_OS_TimeGetRate_tick();
+    if (tick_rate == 0) {
+        return (DHCPc_TimeCur_sec);
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    time_cur_tick     = DHCPc_OS_TimeGet_tick();
+    time_elapsed_tick = time_cur_tick - DHCPc_TimeRef_tick;     /* See Note #2.                                         */
+    time_elapsed_sec  = time_elapsed_tick / tick_rate;
+
+    DHCPc_TimeCur_sec  += time_elapsed_sec;                     /* See Note #1.                                         */
+    DHCPc_TimeRef_tick += time_elapsed_sec * tick_rate;
+    time_cur_sec        = DHCPc_TimeCur_sec;
+    CPU_CRITICAL_EXIT();
+
+    return (time_cur_sec);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_TimeIsReached()
+*
+* Description : Check if a deadline is reached.
+*
+* Argument(s) : time_cur_sec    Current DHCPc time (in seconds).
+*
+*               deadline_sec    Deadline           (in DHCPc seconds).
+*
+* Return(s)   : DEF_YES, if deadline reached.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_TmrTaskHandler(),
+*               DHCPc_TimeRemainGet_sec().
+*
+* Note(s)     : (1) Times are compared through their signed difference, which remains valid across a
+*                   DHCPc time wrap-around for deadlines up to DHCP_LEASE_TIME_MAX_SEC seconds away.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DHCPc_TimeIsReached (CPU_INT32U  time_cur_sec,
+                                          CPU_INT32U  deadline_sec)
+{
+    CPU_INT32S  time_diff_sec;
+
+
+    time_diff_sec = (CPU_INT32S)(time_cur_sec - deadline_sec);  /* See Note #1.                                         */
+    if (time_diff_sec < 0) {
+        return (DEF_NO);
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_TimeRemainGet_sec()
+*
+* Description : Get the time remaining until a deadline.
+*
+* Argument(s) : time_cur_sec    Current DHCPc time (in seconds).
+*
+*               deadline_sec    Deadline           (in DHCPc seconds).
+*
+* Return(s)   : Remaining time (in seconds), if deadline NOT reached.
+*
+*               0,                           otherwise.
+*
+* Caller(s)   : DHCPc_LeaseTimeUpdate().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DHCPc_TimeRemainGet_sec (CPU_INT32U  time_cur_sec,
+                                             CPU_INT32U  deadline_sec)
+{
+    CPU_BOOLEAN  reached;
+
+
+    reached = DHCPc_TimeIsReached(time_cur_sec, deadline_sec);
+    if (reached == DEF_YES) {
+        return (0);
+    }
+
+    return (deadline_sec - time_cur_sec);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_InitSock()
+*
+* Description : Initialize a socket.
+*
+* Argument(s) : ip_addr_local       Local IP address to bind to, in network order.
+*
+* Return(s)   : Socket descriptor/handle identifier, if NO errors.
+*
+*               NET_SOCK_BSD_ERR_OPEN,               otherwise.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler(),
+*               DHCPc_StopStateHandler(),
+*               DHCPc_EmulRun().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  NET_SOCK_ID  DHCPc_InitSock (NET_IPv4_ADDR  ip_addr_local,
+                                     NET_IF_NBR     if_nbr)
+{
+    NET_SOCK_ID         sock_id;
+    NET_SOCK_ADDR_IPv4  local_addr;
+    NET_SOCK_ADDR_LEN   local_addr_size;
+    CPU_BOOLEAN         rtn_status;
+    CPU_BOOLEAN         success;
+    NET_ERR             err_net;
+
+
+                                                                /* -------------------- OPEN SOCK --------------------- */
+    sock_id = NetApp_SockOpen((NET_SOCK_PROTOCOL_FAMILY) NET_SOCK_ADDR_FAMILY_IP_V4,
+                              (NET_SOCK_TYPE           ) NET_SOCK_TYPE_DATAGRAM,
+                              (NET_SOCK_PROTOCOL       ) NET_SOCK_PROTOCOL_UDP,
+                              (CPU_INT16U              ) 0,
+                              (CPU_INT32U              ) 0,
+                              (NET_ERR                *)&err_net);
+
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
+        return (NET_SOCK_BSD_ERR_OPEN);
+    }
+
+                                                                /* ------------ SET IF NBR FOR THE SOCKET ------------ */
+    success = NetSock_CfgIF(sock_id,
+                            if_nbr,
+                           &err_net);
+    if (success != DEF_OK) {
+        return (NET_SOCK_BSD_ERR_OPEN);
+    }
+
+                                                                /* ------------------ SET LOCAL ADDR ------------------ */
+    local_addr_size = sizeof(local_addr);
+    Mem_Clr((void     *)&local_addr,
+            (CPU_SIZE_T) local_addr_size);
+    local_addr.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+    local_addr.Addr       = ip_addr_local;
+    local_addr.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_CLIENT);
+
+
+                                                                /* -------------------- BIND SOCK --------------------- */
+    rtn_status = NetApp_SockBind((NET_SOCK_ID      ) sock_id,
+                                 (NET_SOCK_ADDR   *)&local_addr,
+                                 (NET_SOCK_ADDR_LEN) local_addr_size,
+                                 (CPU_INT16U       ) 0,
+                                 (CPU_INT32U       ) 0,
+                                 (NET_ERR         *)&err_net);
+
+    if (rtn_status != DEF_OK) {
+        NetApp_SockClose((NET_SOCK_ID ) sock_id,
+                         (CPU_INT32U  ) 0,
+                         (NET_ERR    *)&err_net);
+
+        return (NET_SOCK_BSD_ERR_OPEN);
+    }
+
+
+    return (sock_id);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_InitStateHandler()
+*
+* Description : (1) Perform actions associated with the INIT state :
+*
+*                   (a) Get      interface's hardware address
+*                   (b) Initialize socket
+*                   (c) Revert   interface's routes, servers & parameters of a previous lease
+*                   (d) Start    interface's dynamic configuration
+*                   (e) Transmit DISCOVER & select OFFER
+*                   (f) Transmit REQUEST  & get    reply
+*                   (g) Configure interface & lease timer
+*
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_MsgRxHandler().
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCP lease successfully negotiated &
+*                                                                   interface configured (timer     set).
+*                               DHCPc_ERR_NONE_NO_TMR           DHCP lease successfully negotiated &
+*                                                                   interface configured (timer NOT set).
+*                               DHCPc_ERR_NONE_LOCAL_LINK       DHCP lease negotiation error, interface
+*                                                                   configured with a link-local address.
+*                               DHCPc_ERR_LOCAL_LINK            Error configuring dynamic link-local address.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_IF_CFG_STATE          Error setting interface configuration state.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_INIT_SOCK             Error initializing socket.
+*
+*                                                               --------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               Error acquiring DHCPc lock.
+*
+*                                                               -------- RETURNED BY DHCPc_Discover() : ---------
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*                               DHCPc_ERR_TX                    Transmit error.
+*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+*                                                               ---------- RETURNED BY DHCPc_Req() : ------------
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_RX_NAK                NAK message received from server.
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*                               DHCPc_ERR_TX                    Transmit error.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+*                                                               -------- RETURNED BY DHCPc_AddrCfg() : ----------
+*                               DHCPc_ERR_IF_CFG                Error configuring the interface's network.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgRxHandler().
+*
+* Note(s)     : (2) See 'DHCPc_AddrHW_Get()  Note #1'.
+*
+*               (3) From RFC 2131, section 'Constructing and sending DHCP messages', "DHCP messages broadcast
+*                   by a client prior to that client obtaining its IP address must have the source address
+*                   field in the IP header set to 0".  Starting the dynamic configuration results in all
+*                   addresses being removed from the interface and set to 0.
+*
+*               (4) RFC #2131, section 'Client-Server interaction - allocating a network address', states
+*                   that "The client SHOULD wait a mininum of ten seconds before restarting the
+*                   configuration process to avoid excessive network traffic in case of looping".
+*
+*               (5) The address validation & the dynamic link-local address configuration are performed
+*                   only if enabled both at compile-time & in the interface configuration (see 'dhcp-c.h
+*                   DHCPc INTERFACE CONFIGURATION DATA TYPE  Note #2').
+*
+*               (6) When another logical client already holds an address on the interface, starting the
+*                   dynamic configuration would remove that address (see Note #3).  The client then only
+*                   removes its own previous address, requests broadcast replies & configures the leased
+*                   address as an additional address of the interface.  Dynamic link-local address
+*                   configuration is NOT performed for such a client.
+*
+*                   #### The source address of the messages of such a client is NOT 0.0.0.0 & the network
+*                   stack MUST be configured to accept several addresses per interface.
+*
+*               (7) The interface information list is shared with the other DHCPc tasks & is hence
+*                   walked with the global DHCPc lock acquired (see 'dhcp-c.h  Note #2b').
+*
+*               (8) The address acquisition starts before the first DISCOVER message.  The 'secs' field of
+*                   the messages hence accounts for every retransmission & negotiation retry (see
+*                   'DHCPc_TxMsgPrepare()  Note #13').
+*
+*               (9) DHCPv6 clients share the DHCPc tasks, timers & pools, but negotiate their lease with
+*                   their own state handler (see 'DHCPc_IPv6_InitStateHandler()').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
+                                      DHCPc_ERR      *perr)
+{
+    NET_IF_NBR      if_nbr;
+    CPU_BOOLEAN     if_en;
+    CPU_BOOLEAN     addr_shared;
+    CPU_INT08U      addr_hw_len;
+    CPU_INT08U      addr_hw[DHCPc_HW_ADDR_LEN_MAX];
+    NET_SOCK_ID     sock_id;
+    CPU_INT16U      nego_retry_cnt;
+    CPU_BOOLEAN     nego_done;
+    CPU_BOOLEAN     nego_dly;
+#if (DHCPc_CFG_ADDR_VALIDATE_EN == DEF_ENABLED)
+    DHCPc_MSG      *pmsg;
+    DHCP_MSG_HDR   *pmsg_hdr;
+    NET_IPv4_ADDR   proposed_addr;
+#endif
+    NET_ERR         err_net;
+
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+                                                                /* If DHCPv6 client, handle DHCPv6 state (see Note #9). */
+    if (DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_IPv6) == DEF_YES) {
+        DHCPc_IPv6_InitStateHandler(pif_info, perr);
+        return;
+    }
+#endif
+
+    if_nbr = pif_info->IF_Nbr;
+
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {                                     /* If IF NOT enabled, ...                               */
+       *perr = DHCPc_ERR_IF_INVALID;                            /* ... rtn err.                                         */
+        return;
+    }
+
+                                                                /* ------------------- GET HW ADDR -------------------- */
+    addr_hw_len = DHCPc_AddrHW_Get(if_nbr, &addr_hw[0], perr);  /* See Note #2.                                         */
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+                                                                /* -------------------- INIT SOCK --------------------- */
+    sock_id = DHCPc_InitSock(NET_IPv4_ADDR_THIS_HOST, if_nbr);
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
+       *perr = DHCPc_ERR_INIT_SOCK;
+        return;
+    }
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+                                                                /* ------------------ REM PREV ROUTES ----------------- */
+    DHCPc_RouteRemove(pif_info, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        NetApp_SockClose((NET_SOCK_ID ) sock_id,
+                         (CPU_INT32U  ) 0,
+                         (NET_ERR    *)&err_net);
+        return;
+    }
+#endif
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+    DHCPc_SrvClr(pif_info);                                     /* Clr prev srvs.                                       */
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+    DHCPc_ParamRevert(pif_info, DHCPc_PARAM_APPLY_ALL);         /* Revert prev lease params.                            */
+#endif
+
+                                                                /* ---------------- START DYNAMIC CFG ----------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #7.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        NetApp_SockClose((NET_SOCK_ID ) sock_id,
+                         (CPU_INT32U  ) 0,
+                         (NET_ERR    *)&err_net);
+        return;
+    }
+    addr_shared = DHCPc_IF_InfoAddrSharedChk(pif_info);
+    DHCPc_OS_Unlock();
+
+    if (addr_shared == DEF_YES) {                               /* If addr shared with other client (see Note #6), ...  */
+        DEF_BIT_SET(pif_info->Flags, DHCPc_FLAG_ADDR_SHARED);
+        if (pif_info->AddrCfgd != NET_IPv4_ADDR_NONE) {         /* ... rem own addr only.                               */
+            NetIPv4_CfgAddrRemove(if_nbr, pif_info->AddrCfgd, &err_net);
+            pif_info->AddrCfgd = NET_IPv4_ADDR_NONE;
+        }
+
+    } else {
+        DEF_BIT_CLR(pif_info->Flags, DHCPc_FLAG_ADDR_SHARED);
+        NetIPv4_CfgAddrAddDynamicStart(if_nbr, &err_net);       /* See Note #3.                                         */
+        if (err_net != NET_IPv4_ERR_NONE) {
+           *perr = DHCPc_ERR_IF_CFG_STATE;
+            return;
+        }
+        pif_info->AddrCfgd = NET_IPv4_ADDR_NONE;
+    }
+
+
+                                                                /* ------------ TX DISCOVER & SELECT OFFER ------------ */
+    nego_retry_cnt = 0;
+    nego_done      = DEF_NO;
+    nego_dly       = DEF_NO;
+
+    pif_info->AcqStartTime = DHCPc_TimeGet_sec();               /* Start addr acquisition (see Note #8).                */
+
+    while ((nego_retry_cnt <  pif_info->Cfg.NegoRetryCnt) &&
+           (nego_done      != DEF_YES)) {
+
+        pif_info->ClientState = DHCP_STATE_INIT;
+
+        if (nego_dly == DEF_YES) {                              /* Dly nego, if req'd (see Note #4).                    */
+            KAL_Dly(DHCP_INIT_DLY_MS);
+        }
+
+        DHCPc_Discover(sock_id, pif_info, &addr_hw[0], addr_hw_len, perr);
+        if (*perr != DHCPc_ERR_NONE) {
+            nego_retry_cnt++;
+            nego_dly = DEF_YES;
+
+        } else {                                                /* DISCOVER tx'd & OFFER(s) rx'd, ..                    */
+                                                                /* .. tx REQUEST & get reply.                           */
+            pif_info->ClientState = DHCP_STATE_SELECTING;
+
+            DHCPc_Req(sock_id, pif_info, &addr_hw[0], addr_hw_len, perr);
+
+            switch (*perr) {
+                case DHCPc_ERR_NONE:
+#if (DHCPc_CFG_ADDR_VALIDATE_EN == DEF_ENABLED)
+                                                                /* If addr validation DISABLED on IF, ...               */
+                     if (pif_info->Cfg.AddrValidateEn != DEF_ENABLED) {
+                         nego_done = DEF_YES;                   /* ... nego done (see Note #5).                         */
+                         break;
+                     }
+                                                                /* Get proposed addr.                                   */
+                     pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;
+                     pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+
+                     NET_UTIL_VAL_COPY_32(&proposed_addr, &pmsg_hdr->yiaddr);
+
+                                                                /* Validate proposed addr.                              */
+                     DHCPc_AddrValidate(               if_nbr,
+                                        (NET_IPv4_ADDR)proposed_addr,
+                                        (CPU_INT32U   )pif_info->Cfg.AddrValidateWait_ms,
+                                        (DHCPc_ERR   *)perr);
+                     switch (*perr) {
+                         case DHCPc_ERR_NONE:
+                         case DHCPc_ERR_ADDR_VALIDATE:
+                              nego_done = DEF_YES;
+                              break;
+
+
+                         case DHCPc_ERR_ADDR_USED:
+                         default:
+                             DHCPc_DeclineRelease((NET_SOCK_ID    ) sock_id,
+                                                  (DHCPc_IF_INFO *) pif_info,
+                                                  (DHCPc_MSG_TYPE ) DHCP_MSG_DECLINE,
+                                                  (CPU_INT08U    *)&addr_hw[0],
+                                                  (CPU_INT08U     ) addr_hw_len,
+                                                  (DHCPc_ERR     *) perr);
+                             nego_retry_cnt++;
+                             nego_dly = DEF_YES;
+                             break;
+                     }
+#else
+                     nego_done = DEF_YES;
+#endif
+                     break;
+
+
+                case DHCPc_ERR_RX_NAK:
+                     nego_retry_cnt++;
+                     nego_dly = DEF_YES;
+                     break;
+
+
+                default:
+                     nego_done = DEF_YES;
+                     break;
+            }
+        }
+    }
+
+    NetApp_SockClose((NET_SOCK_ID ) sock_id,                    /* Close sock.                                          */
+                     (CPU_INT32U  ) 0,
+                     (NET_ERR    *)&err_net);
+
+
+                                                                /* ------------- CFG IF WITH NEGO'D LEASE ------------- */
+    switch (*perr) {
+        case DHCPc_ERR_NONE:                                    /* If lease successfully acquired, ...                  */
+
+             DHCPc_AddrCfg(pif_info, perr);                     /* ... cfg net addr                ...                  */
+             if (*perr == DHCPc_ERR_NONE) {
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+                 DHCPc_ForceRenewNonceGet(pif_info);            /* ... get FORCERENEW nonce,       ...                  */
+#endif
+                 DHCPc_LeaseTimeCalc(pif_info, perr);           /* ... calc lease time & set tmr.                       */
+                 if (*perr != DHCPc_ERR_NONE) {                 /* If err setting tmr, ...                              */
+                    *perr = DHCPc_ERR_NONE_NO_TMR;              /* ... rtn err         ...                              */
+                 }
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+                 if (DHCPc_SrvGet(pif_info) == DEF_YES) {       /* Push lease srvs.                                     */
+                     DHCPc_SrvPush(pif_info);
+                 }
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+                 DHCPc_ParamApply(pif_info);                    /* Apply lease params.                                  */
+#endif
+
+                 pif_info->ClientState = DHCP_STATE_BOUND;      /* ... & set client state to BOUND.                     */
+
+             } else {                                           /* If err cfg'ing IF, ...                               */
+                 if (addr_shared != DEF_YES) {                  /* ... stop dynamic cfg & set client state to NONE.     */
+                     NetIPv4_CfgAddrAddDynamicStop(if_nbr, &err_net);
+                 }
+                 pif_info->ClientState = DHCP_STATE_NONE;
+             }
+             break;
+
+
+        case DHCPc_ERR_RX_NAK:                                  /* ... Else if err, ..                                  */
+        default:
+             if (addr_shared == DEF_YES) {                      /*     .. & addr shared (see Note #6), ...              */
+                 pif_info->ClientState = DHCP_STATE_NONE;       /*        ... set client state to NONE.                 */
+                 break;
+             }
+
+#if (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED)           /*     .. & dyn link local ENABLED, ...                 */
+             if (pif_info->Cfg.LocalLinkEn != DEF_ENABLED) {    /*        ... but DISABLED on IF (see Note #5), ...     */
+                 NetIPv4_CfgAddrAddDynamicStop(if_nbr, &err_net);
+                 pif_info->ClientState = DHCP_STATE_NONE;
+                 break;
+             }
+                                                                /*        ... cfg using link local addr.                */
+             DHCPc_AddrLocalLinkCfg(pif_info, &addr_hw[0], addr_hw_len, perr);
+             if (*perr == DHCPc_ERR_NONE) {
+                 pif_info->ClientState = DHCP_STATE_LOCAL_LINK;
+                *perr                  = DHCPc_ERR_NONE_LOCAL_LINK;
+
+             } else {
+                 NetIPv4_CfgAddrAddDynamicStop(if_nbr, &err_net);
+
+                 pif_info->ClientState = DHCP_STATE_NONE;
+                *perr                  = DHCPc_ERR_LOCAL_LINK;
+             }
+#else
+             NetIPv4_CfgAddrAddDynamicStop(if_nbr, &err_net);
+             pif_info->ClientState = DHCP_STATE_NONE;
+#endif
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                   DHCPc_RenewRebindStateHandler()
+*
+* Description : (1) Perform actions associated with the RENEW/REBIND state :
+*
+*                   (b) Get interface's hardware address
+*                   (c) Initialize socket
+*                   (e) Transmit REQUEST & get reply
+*                   (f) Configure lease timer
+*
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_MsgRxHandler().
+*
+*               exp_tmr_msg     Expired timer message.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCP lease successfully renewed/rebound, or
+*                                                                   FORCERENEW handled (see Note #5).
+*                               DHCPc_ERR_NONE_NO_TMR           Error setting timer, lease might NOT have
+*                                                                   been renewed/rebound (see Note #4).
+*                               DHCPc_ERR_INVALID_MSG           Invalid timer expiration message.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_INIT_SOCK             Error initializing socket.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgRxHandler().
+*
+* Note(s)     : (2) See 'DHCPc_AddrHW_Get()  Note #1'.
+*
+*               (3) If the socket cannot be opened, the DHCP lease is updated, and a new timer is set
+*                   so that the renewing/rebinding process can take place later.
+*
+*               (4) A DHCPc_ERR_NONE_NO_TMR error indicates that there was an error either calculating
+*                   the new lease time if it was successfully  renewed/rebound, or the update lease time
+*                   was not successful should the lease not be renewed/rebound.
+*
+*                   In both cases, the lease then becomes technically infinite since NO timer is set.
+*                   This could cause an expired lease to still be used by this host, which would violate
+*                   RFC #2131.
+*
+*               (5) As stated by RFC #3203, a client receiving a valid DHCPFORCERENEW message enters the
+*                   RENEWING state.  The message is ignored if the client is NOT in the BOUND state.
+*
+*                   Since the current lease timer is still pending, it is freed only once the lease has
+*                   been renewed.  Should the renewal fail, the client goes back to the BOUND state & the
+*                   current lease timer is kept.
+*
+*                   The timer list is shared with the DHCPc Timer Task & the pending timer is hence freed
+*                   with the global DHCPc lock acquired (see 'dhcp-c.h  Note #2b').
+*
+*               (6) The renewal starts when the client leaves the BOUND state.  The 'secs' field of the
+*                   REQUEST messages is computed from that time, including once the client entered the
+*                   REBINDING state (see 'DHCPc_TxMsgPrepare()  Note #13').
+*
+*               (7) DHCPv6 clients renew & rebind their lease with their own state handler (see
+*                   'DHCPc_IPv6_RenewStateHandler()').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_RenewRebindStateHandler (DHCPc_IF_INFO   *pif_info,
+                                             DHCPc_COMM_MSG   exp_tmr_msg,
+                                             DHCPc_ERR       *perr)
+{
+#if (DHCPc_CFG_BROADCAST_BIT_EN != DEF_ENABLED)
+    DHCPc_MSG      *pmsg;
+    DHCP_MSG_HDR   *pmsg_hdr;
+#endif
+    NET_IF_NBR      if_nbr;
+    CPU_BOOLEAN     if_en;
+    CPU_INT08U      addr_hw_len;
+    CPU_INT08U      addr_hw[DHCPc_HW_ADDR_LEN_MAX];
+    NET_IPv4_ADDR   addr_host;
+    NET_SOCK_ID     sock_id;
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+    DHCPc_TMR      *ptmr;
+    DHCPc_COMM     *pcomm;
+#endif
+    NET_ERR         err_net;
+
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+                                                                /* If DHCPv6 client, handle DHCPv6 state (see Note #7). */
+    if (DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_IPv6) == DEF_YES) {
+        DHCPc_IPv6_RenewStateHandler(pif_info, exp_tmr_msg, perr);
+        return;
+    }
+#endif
+
+    if (pif_info->ClientState == DHCP_STATE_BOUND) {            /* If client bound, start renewal (see Note #6).        */
+        pif_info->AcqStartTime = DHCPc_TimeGet_sec();
+    }
+
+    switch (exp_tmr_msg) {                                      /* Set cur client state.                                */
+        case DHCPc_COMM_MSG_T1_EXPIRED:
+             pif_info->ClientState = DHCP_STATE_RENEWING;
+             break;
+
+
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+        case DHCPc_COMM_MSG_FORCERENEW:                         /* See Note #5.                                         */
+             if (pif_info->ClientState != DHCP_STATE_BOUND) {   /* If NOT bound, ...                                    */
+                *perr = DHCPc_ERR_NONE;                         /* ... ignore FORCERENEW.                               */
+                 return;
+             }
+             pif_info->ClientState = DHCP_STATE_RENEWING;
+             break;
+#endif
+
+
+        case DHCPc_COMM_MSG_T2_EXPIRED:
+             pif_info->ClientState = DHCP_STATE_REBINDING;
+             break;
+
+
+        default:
+            *perr = DHCPc_ERR_INVALID_MSG;
+             return;
+    }
+
+
+    if_nbr = pif_info->IF_Nbr;
+
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {                                     /* If IF NOT enabled, ...                               */
+       *perr = DHCPc_ERR_IF_INVALID;                            /* ... rtn err.                                         */
+        return;
+    }
+
+                                                                /* ------------------- GET HW ADDR -------------------- */
+    addr_hw_len = DHCPc_AddrHW_Get(if_nbr, &addr_hw[0], perr);  /* See Note #2.                                         */
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+                                                                /* -------------------- INIT SOCK --------------------- */
+#if (DHCPc_CFG_BROADCAST_BIT_EN != DEF_ENABLED)
+    pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;               /* Get host addr from cur OFFER.                        */
+    pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+    NET_UTIL_VAL_COPY_32(&addr_host, &pmsg_hdr->yiaddr);
+#else
+    addr_host = NET_IPv4_ADDR_THIS_HOST;
+#endif
+
+    sock_id = DHCPc_InitSock(addr_host, if_nbr);
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {                     /* If sock NOT opened,            ...                   */
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+        if (exp_tmr_msg == DHCPc_COMM_MSG_FORCERENEW) {         /* ... keep cur lease tmr on FORCERENEW (see Note #5).  */
+            pif_info->ClientState = DHCP_STATE_BOUND;
+           *perr                  = DHCPc_ERR_INIT_SOCK;
+            return;
+        }
+#endif
+        DHCPc_LeaseTimeUpdate(pif_info, exp_tmr_msg, perr);     /* ... update cur lease & cfg tmr ...                   */
+        if (*perr == DHCPc_ERR_NONE) {
+           *perr = DHCPc_ERR_INIT_SOCK;                         /* ... & set err (see Note #3).                         */
+
+        } else {
+           *perr = DHCPc_ERR_NONE_NO_TMR;
+        }
+
+        return;
+    }
+
+                                                                /* -------------- TX REQUEST & GET REPLY -------------- */
+
+                                                                /* Tx REQUEST & get reply.                              */
+    DHCPc_Req(sock_id, pif_info, &addr_hw[0], addr_hw_len, perr);
+
+    NetApp_SockClose((NET_SOCK_ID ) sock_id,
+                     (CPU_INT32U  ) 0,
+                     (NET_ERR    *)&err_net);
+
+    if (*perr == DHCPc_ERR_NONE) {                              /* If lease renewed/rebound,       ...                  */
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+        DHCPc_ForceRenewNonceGet(pif_info);                     /* ... get FORCERENEW nonce,       ...                  */
+
+        DHCPc_OS_Lock(perr);
+        if (*perr != DHCPc_OS_ERR_NONE) {
+           *perr = DHCPc_ERR_NONE_NO_TMR;
+            pif_info->ClientState = DHCP_STATE_BOUND;
+            return;
+        }
+        ptmr = pif_info->Tmr;
+        if (ptmr != (DHCPc_TMR *)0) {                           /* ... free cur lease tmr (see Note #5), ...            */
+            pcomm = (DHCPc_COMM *)ptmr->Obj;
+            if (pcomm != (DHCPc_COMM *)0) {
+                DHCPc_CommFree(pcomm);
+            }
+
+            DHCPc_TmrFree(ptmr);
+            pif_info->Tmr = (DHCPc_TMR *)0;                     /* Prevents a double-free of the timer.                 */
+        }
+        DHCPc_OS_Unlock();
+#endif
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+        if (DHCPc_SrvGet(pif_info) == DEF_YES) {                /* ... push srvs if changed,       ...                  */
+            DHCPc_SrvPush(pif_info);
+        }
+#endif
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+        DHCPc_ParamApply(pif_info);                             /* ... apply lease params,         ...                  */
+#endif
+        DHCPc_LeaseTimeCalc(pif_info, perr);                    /* ... calc lease time & cfg tmr.                       */
+
+    } else {                                                    /* Else lease NOT renewed/rebound, ...                  */
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+        if (exp_tmr_msg == DHCPc_COMM_MSG_FORCERENEW) {         /* ... keep cur lease tmr on FORCERENEW (see Note #5).  */
+            pif_info->ClientState = DHCP_STATE_BOUND;
+           *perr                  = DHCPc_ERR_NONE;
+            return;
+        }
+#endif
+        DHCPc_LeaseTimeUpdate(pif_info, exp_tmr_msg, perr);     /* ... update cur lease & cfg tmr.                      */
+    }
+
+
+    if (*perr != DHCPc_ERR_NONE) {                              /* If err setting tmr, ...                              */
+       *perr = DHCPc_ERR_NONE_NO_TMR;                           /* ... rtn err (see Note #4).                           */
+    }
+
+    pif_info->ClientState = DHCP_STATE_BOUND;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_StopStateHandler()
+*
+* Description : (1) Perform actions associated with the STOPPING state :
+*
+*                   (a) Transmit RELEASE message, if necessary
+*                   (b) Revert   interface's  routes, servers & parameters
+*                   (c) Free     interface's  objects
+*                   (d) Remove   interface IP address
+*
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument checked   in DHCPc_MsgRxHandler(),
+*                                    validated in DHCPc_InitStateHandler(),
+*                                              in DHCPc_RenewRebindStateHandler().
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Interface DHCP configuration successfully
+*                                                                   stopped.
+*                               DHCPc_ERR_IF_CFG                Error removing interface IP address from
+*                                                                   stack.
+*
+*                                                               ----- RETURNED BY DHCPc_OS_Lock() : -----
+*                               DHCPc_OS_ERR_LOCK               Error acquiring DHCPc lock.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgRxHandler().
+*
+*               This function is an INTERNAL DHCP client function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) See 'DHCPc_AddrHW_Get()  Note #1'.
+*
+*               (3) RFC #2131, section 'DHCP client behaviour - DHCPRELEASE', states that "if the client
+*                   no longer requires use of its assigned network address [...], the client sends a
+*                   DHCPRELEASE message to the server.  Note that the correct operation of DHCP does not
+*                   depend on the transmission of DHCPRELEASE messages."
+*
+*                   Hence, if an error occurs while attempting to transmit a DHCPRELEASE message, no
+*                   error handling is performed.
+*
+*               (4) The address of an interface on which only an INFORM exchange was performed is
+*                   statically configured & is hence NOT removed (see 'DHCPc_Inform()  Note #6').
+*
+*               (5) The interface address is NOT removed until the RELEASE message is sent out; the wait
+*                   ends as soon as the server's hardware address is resolved (see 'DHCP TIME DEFINES
+*                   Note #3').
+*
+*               (6) When other logical client(s) still hold an address on the interface, only the address
+*                   of the stopped client is removed (see 'DHCPc_InitStateHandler()  Note #6').
+*
+*               (7) The interface's objects are freed with the global DHCPc lock acquired, since the timer
+*                   & interface information lists are shared with the other DHCPc tasks (see 'dhcp-c.h
+*                   Note #2b').
+*
+*               (8) DHCPv6 clients release their lease with their own state handler (see
+*                   'DHCPc_IPv6_StopStateHandler()').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_StopStateHandler (DHCPc_IF_INFO  *pif_info,
+                                      DHCPc_ERR      *perr)
+{
+    DHCPc_STATE     client_state;
+    CPU_BOOLEAN     addr_shared;
+    NET_IPv4_ADDR   addr_cfgd;
+    CPU_BOOLEAN     tx_decline;
+    CPU_INT08U      addr_hw_len;
+    CPU_INT08U      addr_hw[DHCPc_HW_ADDR_LEN_MAX];
+    DHCPc_MSG      *pmsg;
+    DHCP_MSG_HDR   *pmsg_hdr;
+    NET_IPv4_ADDR   addr_host;
+    NET_SOCK_ID     sock_id;
+    DHCPc_TMR      *ptmr;
+    DHCPc_COMM     *pcomm;
+    NET_IF_NBR      if_nbr;
+    NET_ERR         err_net;
+
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+                                                                /* If DHCPv6 client, handle DHCPv6 state (see Note #8). */
+    if (DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_IPv6) == DEF_YES) {
+        DHCPc_IPv6_StopStateHandler(pif_info, perr);
+        return;
+    }
+#endif
+
+    if_nbr                = pif_info->IF_Nbr;
+    client_state          = pif_info->ClientState;              /* Get client state ...                                 */
+    pif_info->ClientState = DHCP_STATE_STOPPING;                /* ... and set it to STOPPING.                          */
+
+                                                                /* -------------------- TX RELEASE -------------------- */
+    switch (client_state) {
+        case DHCP_STATE_REQUESTING:
+        case DHCP_STATE_BOUND:
+        case DHCP_STATE_RENEWING:
+        case DHCP_STATE_REBINDING:
+             tx_decline = DEF_YES;
+             break;
+
+
+        default:
+             tx_decline = DEF_NO;
+             break;
+    }
+
+    if (tx_decline == DEF_YES) {
+                                                                /* ------------------- GET HW ADDR -------------------- */
+                                                                /* See Note #2.                                         */
+        addr_hw_len = DHCPc_AddrHW_Get(if_nbr, &addr_hw[0], perr);
+        if (*perr == DHCPc_ERR_NONE) {                          /* See Note #3.                                         */
+
+                                                                /* -------------------- INIT SOCK --------------------- */
+            pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;       /* Get host addr from cur OFFER.                        */
+            pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+            NET_UTIL_VAL_COPY_32(&addr_host, &pmsg_hdr->yiaddr);
+
+            sock_id = DHCPc_InitSock(addr_host, if_nbr);
+            if (sock_id != NET_SOCK_BSD_ERR_OPEN) {
+
+                DHCPc_DeclineRelease((NET_SOCK_ID    ) sock_id,
+                                     (DHCPc_IF_INFO *) pif_info,
+                                     (DHCPc_MSG_TYPE ) DHCP_MSG_RELEASE,
+                                     (CPU_INT08U    *)&addr_hw[0],
+                                     (CPU_INT08U     ) addr_hw_len,
+                                     (DHCPc_ERR     *) perr);
+
+                if (*perr == DHCPc_ERR_NONE) {                  /* Wait to resolve dest addr (see Note #5).             */
+                    DHCPc_ReleaseWait(if_nbr, addr_host, pif_info->ServerID);
+                }
+
+                NetApp_SockClose((NET_SOCK_ID ) sock_id,        /* Close sock.                                          */
+                                 (CPU_INT32U  ) 0,
+                                 (NET_ERR    *)&err_net);
+            }
+        }
+    }
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+                                                                /* ------------------ REM IF'S ROUTES ----------------- */
+    DHCPc_RouteRemove(pif_info, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+                                                                /* ------------------- CLR IF'S SRVS ------------------ */
+    DHCPc_SrvClr(pif_info);
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+                                                                /* --------------- REVERT IF'S LEASE PARAMS ----------- */
+    DHCPc_ParamRevert(pif_info, DHCPc_PARAM_APPLY_ALL);
+#endif
+
+                                                                /* ---------------- FREE IF'S DATA OBJ ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #7.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+    ptmr = pif_info->Tmr;
+    if (ptmr != (DHCPc_TMR *)0) {                               /* If lease tmr not NULL, ...                           */
+        pcomm = (DHCPc_COMM *)ptmr->Obj;
+        if (pcomm != (DHCPc_COMM *)0) {
+            DHCPc_CommFree(pcomm);                              /* ...    free comm       ...                           */
+        }
+
+        DHCPc_TmrFree(ptmr);                                    /* ...  & free tmr.                                     */
+        pif_info->Tmr = (DHCPc_TMR *)0;                         /* Prevents a double-free of the timer.                 */
+    }
+
+    DHCPc_IF_InfoMsgSet(pif_info, (DHCPc_MSG *)0, perr);        /* Free msg.                                            */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    addr_shared = DHCPc_IF_InfoAddrSharedChk(pif_info);
+    addr_cfgd   = pif_info->AddrCfgd;
+
+    DHCPc_IF_InfoFree(pif_info);
+
+    DHCPc_OS_Unlock();
+
+    if (client_state == DHCP_STATE_INFORM) {                    /* If IF statically cfg'd, ...                          */
+       *perr = DHCPc_ERR_NONE;                                  /* ... do NOT rem addr (see Note #4).                   */
+        return;
+    }
+
+                                                                /* ----------------- REM IF'S IP ADDR ----------------- */
+    if (addr_shared == DEF_YES) {                               /* If addr(s) held by other client(s), ...              */
+        if (addr_cfgd == NET_IPv4_ADDR_NONE) {                  /* ... rem own addr only (see Note #6).                 */
+           *perr = DHCPc_ERR_NONE;
+            return;
+        }
+        NetIPv4_CfgAddrRemove(if_nbr, addr_cfgd, &err_net);
+
+    } else {
+        NetIPv4_CfgAddrRemoveAll(if_nbr, &err_net);
+    }
+    if (err_net != NET_IPv4_ERR_NONE) {
+       *perr = DHCPc_ERR_IF_CFG;
+
+    } else {
+       *perr = DHCPc_ERR_NONE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_InformStateHandler()
+*
+* Description : (1) Perform actions associated with the INFORM exchange :
+*
+*                   (a) Get      interface's hardware address
+*                   (b) Get      interface's configured host address
+*                   (c) Initialize socket
+*                   (d) Transmit INFORM & get reply
+*                   (e) Push     servers
+*
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_MsgRxHandler().
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Configuration parameters successfully
+*                                                                   obtained.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_IF_ADDR_NONE          NO address configured on interface.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_INIT_SOCK             Error initializing socket.
+*
+*                                                               ---------- RETURNED BY DHCPc_Req() : ------------
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_RX_NAK                NAK message received from server.
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*                               DHCPc_ERR_TX                    Transmit error.
+*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgRxHandler().
+*
+* Note(s)     : (2) See 'DHCPc_AddrHW_Get()  Note #1'.
+*
+*               (3) The interface's address configuration is NOT modified & NO address validation is
+*                   performed (see 'DHCPc_Inform()  Note #2').  The received ACK is kept in the interface
+*                   information structure so that its options can be retrieved with DHCPc_GetOptVal().
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_InformStateHandler (DHCPc_IF_INFO  *pif_info,
+                                        DHCPc_ERR      *perr)
+{
+    NET_IF_NBR      if_nbr;
+    CPU_BOOLEAN     if_en;
+    CPU_INT08U      addr_hw_len;
+    CPU_INT08U      addr_hw[DHCPc_HW_ADDR_LEN_MAX];
+    NET_IPv4_ADDR   addr_host;
+    NET_SOCK_ID     sock_id;
+    NET_ERR         err_net;
+
+
+    if_nbr = pif_info->IF_Nbr;
+
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {                                     /* If IF NOT enabled, ...                               */
+       *perr = DHCPc_ERR_IF_INVALID;                            /* ... rtn err.                                         */
+        return;
+    }
+
+                                                                /* ------------------- GET HW ADDR -------------------- */
+    addr_hw_len = DHCPc_AddrHW_Get(if_nbr, &addr_hw[0], perr);  /* See Note #2.                                         */
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ------------------ GET HOST ADDR ------------------- */
+    addr_host = DHCPc_AddrHostGet(if_nbr);
+    if (addr_host == NET_IPv4_ADDR_NONE) {
+       *perr = DHCPc_ERR_IF_ADDR_NONE;
+        return;
+    }
+
+                                                                /* -------------------- INIT SOCK --------------------- */
+    sock_id = DHCPc_InitSock(addr_host, if_nbr);
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
+       *perr = DHCPc_ERR_INIT_SOCK;
+        return;
+    }
+
+                                                                /* -------------- TX INFORM & GET REPLY --------------- */
+    pif_info->TransactionID++;                                  /* Inc last transaction ID.                             */
+    pif_info->AcqStartTime = DHCPc_TimeGet_sec();
+
+    DHCPc_Req(sock_id, pif_info, &addr_hw[0], addr_hw_len, perr);
+
+    NetApp_SockClose((NET_SOCK_ID ) sock_id,                    /* Close sock.                                          */
+                     (CPU_INT32U  ) 0,
+                     (NET_ERR    *)&err_net);
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+                                                                /* --------------------- PUSH SRVS -------------------- */
+    if (*perr == DHCPc_ERR_NONE) {
+        if (DHCPc_SrvGet(pif_info) == DEF_YES) {
+            DHCPc_SrvPush(pif_info);
+        }
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_Discover()
+*
+* Description : (1) Perform the DISCOVER phase of the lease negotiation :
+*
+*                   (a) Get message
+*                   (b) Generate new 'xid' (see Note #2)
+*                   (c) Prepare  DISCOVER message
+*                   (d) Transmit DISCOVER message
+*                   (e) Get reply from server(s)
+*                   (f) Copy lease OFFER
+*
+*
+* Argument(s) : sock_id         Socket ID of socket to transmit & receive DHCPc data.
+*
+*               pif_info        Pointer to DHCP interface information.
+*               --------        Argument checked in DHCPc_InitStateHandler().
+*
+*               paddr_hw        Pointer to hardware address buffer.
+*
+*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DISCOVER successfully transmitted & OFFER(S)
+*                                                                   received (see Note #2).
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
+*
+*                                                               --------- RETURNED BY DHCPc_MsgGet() : ----------
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*
+*                                                               ------ RETURNED BY DHCPc_TxMsgPrepare() : -------
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*
+*                                                               ----------- RETURNED BY DHCPc_Tx() : ------------
+*                               DHCPc_ERR_TX                    Transmit error.
+*
+*                                                               -------- RETURNED BY DHCPc_RxReply() : ----------
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+*                                                               ----- RETURNED BY DHCPc_IF_InfoMsgSet() : -------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler().
+*
+* Note(s)     : (1) RFC #2131, section 'Constructing and sending DHCP messages', states that "selecting
+*                   a new 'xid' for each retransmission is an implementation decision.  A client may
+*                   choose to reuse the same 'xid' or select a new 'xid' for each retransmitted message".
+*
+*                   This implementation increments the previously used 'xid' and used that new value as
+*                   the transaction ID.
+*
+*                   However, an OFFER replying to one of the previous DHCPc_TRANSACTION_ID_WIN_LEN DISCOVER
+*                   messages is still accepted, so that a late OFFER is used rather than forcing another
+*                   back-off delay.  The client then continues the transaction of the accepted OFFER, so
+*                   that the REQUEST message carries the 'xid' of the OFFER.  The 'xid' of the OFFER is
+*                   kept apart from the last 'xid' generated, so that the next DISCOVER message never
+*                   reuses an 'xid' already transmitted.
+*
+*               (2) When the function returns DHCPc_ERR_NONE, the OFFER message's parameters are copied
+*                   into the structure pointed to by 'pif_info' so that a REQUEST message can be crafted.
+*
+*               (3) If NO DHCP OFFER is received following a DHCP DISCOVER transmission, the caller is
+*                   responsible of the retransmission handling--i.e. this function will NOT attempt to
+*                   send another DISCOVER.
+*
+*               (4) In the event of a surge of DHCP OFFER datagrams coming from multiple hosts on the
+*                   network attempting to acquire an IP address from a DHCP server, the socket receive
+*                   queue should be closed during a backoff delay in order to prevent Rx buffers from
+*                   being consumed. This is due to the fact that DHCP OFFER datagrams are sent to the
+*                   broadcast address (255.255.255.255) on port 68 and thus the uC/TCPIP stack will accept
+*                   them. Since the DHCP client does not process any offers during a backoff delay, these
+*                   incoming datagrams will get queued until the client consumes them after the delay
+*                   which may last up to 64 seconds (See Note #1 in DHCPc_CalcBackOff()). Closing the
+*                   socket receive queue prompts the TCP IP stack to drop those datagrams before they're
+*                   ever queued.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_Discover (NET_SOCK_ID     sock_id,
+                              DHCPc_IF_INFO  *pif_info,
+                              CPU_INT08U     *paddr_hw,
+                              CPU_INT08U      addr_hw_len,
+                              DHCPc_ERR      *perr)
+{
+    DHCPc_MSG           *pmsg;
+    DHCP_MSG_HDR        *pmsg_hdr;
+    CPU_INT16U           discover_retry_cnt;
+    CPU_BOOLEAN          discover_done;
+    CPU_BOOLEAN          discover_dly;
+    CPU_INT32U           dly_ms;
+    CPU_INT16U           discover_msg_len;
+    NET_SOCK_ADDR_IPv4   addr_server;
+    NET_SOCK_ADDR_LEN    addr_server_size;
+    CPU_BOOLEAN          rx_done;
+    DHCPc_MSG_TYPE       dhcp_rx_msg_type;
+    CPU_INT08U          *popt;
+    CPU_INT08U           opt_val_len;
+    NET_ERR              net_err;
+
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
+    if (paddr_hw == (CPU_INT08U *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
+    }
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    if (addr_hw_len > DHCPc_HW_ADDR_LEN_MAX) {
+#else
+    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
+#endif
+       *perr = DHCPc_ERR_INVALID_HW_ADDR;
+        return;
+    }
+#endif
+
+                                                                /* --------------------- GET MSG ---------------------- */
+    pmsg = DHCPc_MsgGet(perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+
+    discover_retry_cnt = 0;
+    discover_done      = DEF_NO;
+    discover_dly       = DEF_NO;
+    dly_ms             = 0;
+
+    pif_info->TransactionID_WinLen = 0;
+
+                                                                /* While DISCOVER retry < max retry ...                 */
+                                                                /* ... & DISCOVER NOT done,         ...                 */
+    while ((discover_retry_cnt <  pif_info->Cfg.DiscoverRetryCnt) &&
+           (discover_done      != DEF_YES)) {
+
+        if (discover_dly == DEF_YES) {                          /* Dly DISCOVER, if req'd.                              */
+            dly_ms = DHCPc_CalcBackOff(pif_info, dly_ms);
+                                                                /* Close Rx Q before delay to prevent Rx buffers ...    */
+            (void)NetSock_CfgRxQ_Size( sock_id,                 /* ... from exhausting. (See Note #4).                  */
+                                       NET_SOCK_DATA_SIZE_MIN,
+                                      &net_err);
+            KAL_Dly(DHCPc_CalcBackOffRand(dly_ms));
+
+            (void)NetSock_CfgRxQ_Size( sock_id,                 /* Re-configure Rx Q size to its original value.        */
+                                       NET_SOCK_CFG_RX_Q_SIZE_OCTET,
+                                      &net_err);
+        }
+
+                                                                /* ------------------ GENERATE 'XID' ------------------ */
+        pif_info->TransactionID++;                              /* Inc last transaction ID (see Note #1).               */
+
+        if ((discover_dly                   == DEF_YES) &&      /* If DISCOVER re-tx'd, ...                             */
+            (pif_info->TransactionID_WinLen <  DHCPc_TRANSACTION_ID_WIN_LEN)) {
+            pif_info->TransactionID_WinLen++;                   /* ... still accept prev xid (see Note #1).             */
+        }
+
+
+                                                                /* --------------- PREPARE DISCOVER MSG --------------- */
+        discover_msg_len = DHCPc_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
+                                              (DHCPc_MSG_TYPE ) DHCP_MSG_DISCOVER,
+                                              (CPU_INT08U    *) paddr_hw,
+                                              (CPU_INT08U     ) addr_hw_len,
+                                              (CPU_INT08U    *)&pmsg->MsgBuf[0],
+                                              (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
+                                              (DHCPc_ERR     *) perr);
+        if (*perr != DHCPc_ERR_NONE) {
+            DHCPc_MsgFree(pmsg);
+            return;
+        }
+
+                                                                /* ---------------------- TX MSG ---------------------- */
+        addr_server_size = sizeof(addr_server);
+        Mem_Clr((void     *)&addr_server,
+                (CPU_SIZE_T) addr_server_size);
+        addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+        addr_server.Addr       = NET_UTIL_HOST_TO_NET_32(NET_IPv4_ADDR_BROADCAST);
+        addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_SERVER);
+
+        DHCPc_Tx((NET_SOCK_ID      ) sock_id,
+                 (void            *)&pmsg->MsgBuf[0],
+                 (CPU_INT16U       ) discover_msg_len,
+                 (NET_SOCK_ADDR   *)&addr_server,
+                 (NET_SOCK_ADDR_LEN) addr_server_size,
+                 (DHCPc_ERR       *) perr);
+        if (*perr != DHCPc_ERR_NONE) {
+            discover_done = DEF_YES;
+
+        } else {
+
+                                                                /* ------------- RX REPLY FROM SERVER(S) -------------- */
+            rx_done = DEF_FALSE;
+
+
+            while (rx_done != DEF_YES) {
+
+                pmsg->MsgLen = DHCP_MSG_BUF_SIZE;
+                dhcp_rx_msg_type = DHCPc_RxReply((NET_SOCK_ID    ) sock_id,
+                                                 (DHCPc_IF_INFO *) pif_info,
+                                                 (NET_IPv4_ADDR  ) NET_IPv4_ADDR_NONE,
+                                                 (CPU_INT08U    *) paddr_hw,
+                                                 (CPU_INT08U     ) addr_hw_len,
+                                                 (CPU_INT08U    *)&pmsg->MsgBuf[0],
+                                                 (CPU_INT16U    *)&pmsg->MsgLen,
+                                                 (DHCPc_ERR     *) perr);
+
+                switch (*perr) {
+                    case DHCPc_ERR_NONE:                        /* If NO err                    ...                     */
+
+                         switch (dhcp_rx_msg_type) {
+                             case DHCP_MSG_OFFER:               /* ... & rx'd msg is OFFER,     ...                     */
+                                  rx_done       = DEF_YES;      /* ... rx         done          ...                     */
+                                  discover_done = DEF_YES;      /* ... & DISCOVER done.                                 */
+                                  break;
+
+
+                             default:                           /* ... Else rx'd msg NOT OFFER, ...                     */
+                                  rx_done = DEF_NO;             /* ... rx NOT done.                                     */
+                                  break;
+                         }
+                         break;
+
+
+                    default:                                    /* If rx err,                   ...                     */
+                         rx_done      = DEF_YES;
+                         discover_dly = DEF_YES;
+                         discover_retry_cnt++;                  /* ... restart DISCOVER.                                */
+                         break;
+                }
+            }
+        }
+    }
+
+    pif_info->TransactionID_WinLen = 0;                         /* Accept cur xid only from now on.                     */
+
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_MsgFree(pmsg);
+        return;
+    }
+                                                                /* Continue OFFER's transaction (see Note #1).          */
+    pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+    NET_UTIL_VAL_COPY_GET_NET_32(&pif_info->TransactionID_Req, &pmsg_hdr->xid);
+
+                                                                /* ----------- COPY OFFER IN IF INFO STRUCT ----------- */
+    DHCPc_IF_InfoMsgSet(pif_info, pmsg, perr);                  /* Set msg ptr to rx'd OFFER.                           */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_MsgFree(pmsg);
+        return;
+    }
+
+                                                                /* Get server id.                                       */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SERVER_IDENTIFIER,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_32(&pif_info->ServerID, popt);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             DHCPc_Req()
+*
+* Description : (1) Perform the REQUEST phase of the lease negotiation :
+*
+*                   (a) Get              message
+*                   (b) Prepare  REQUEST message from last received OFFER
+*                   (c) Transmit REQUEST message
+*                   (d) Get reply from server(s)
+*                   (e) Copy ACK.
+*
+*
+* Argument(s) : sock_id         Socket ID of socket to transmit & receive DHCPc data.
+*
+*               pif_info        Pointer to DHCP interface information.
+*               --------        Argument checked in DHCPc_InitStateHandler().
+*
+*               paddr_hw        Pointer to hardware address buffer.
+*
+*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  REQUEST successfully transmitted & ACK received.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
+*                               DHCPc_ERR_RX_NAK                NAK message received from server.
+*
+*                                                               --------- RETURNED BY DHCPc_MsgGet() : ----------
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*
+*                                                               ------ RETURNED BY DHCPc_TxMsgPrepare() : -------
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*
+*                                                               ----------- RETURNED BY DHCPc_Tx() : ------------
+*                               DHCPc_ERR_TX                    Transmit error.
+*
+*                                                               -------- RETURNED BY DHCPc_RxReply() : ----------
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+*                                                               ----- RETURNED BY DHCPc_IF_InfoMsgSet() : -------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler(),
+*               DHCPc_InformStateHandler().
+*
+* Note(s)     : (2) If NO DHCP message is received following a DHCP REQUEST transmission, the caller is
+*                   responsible of the retransmission handling--i.e. this function will NOT attempt to
+*                   send another REQUEST.
+*
+*               (3) When the client is in the INFORM state, an INFORM message is transmitted instead of a
+*                   REQUEST message; the server replies with an ACK that does NOT hold any lease.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_Req (NET_SOCK_ID     sock_id,
+                         DHCPc_IF_INFO  *pif_info,
+                         CPU_INT08U     *paddr_hw,
+                         CPU_INT08U      addr_hw_len,
+                         DHCPc_ERR      *perr)
+{
+    DHCPc_MSG           *pmsg;
+    CPU_INT16U           request_retry_cnt;
+    CPU_BOOLEAN          request_done;
+    CPU_BOOLEAN          request_dly;
+    CPU_INT32U           dly_ms;
+    CPU_INT16U           request_msg_len;
+    DHCPc_MSG_TYPE       msg_type;
+    NET_IPv4_ADDR        addr_server_ip;
+    NET_SOCK_ADDR_IPv4   addr_server;
+    NET_SOCK_ADDR_LEN    addr_server_size;
+    CPU_BOOLEAN          rx_done;
+    DHCPc_MSG_TYPE       dhcp_rx_msg_type;
+    NET_ERR              net_err;
+
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
+    if (paddr_hw == (CPU_INT08U *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
+    }
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    if (addr_hw_len > DHCPc_HW_ADDR_LEN_MAX) {
+#else
+    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
+#endif
+       *perr = DHCPc_ERR_INVALID_HW_ADDR;
+        return;
+    }
+#endif
+
+                                                                /* --------------------- GET MSG ---------------------- */
+    pmsg = DHCPc_MsgGet(perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+
+    request_retry_cnt = 0;
+    request_done      = DEF_NO;
+    request_dly       = DEF_NO;
+    dly_ms            = 0;
+                                                                /* Tx INFORM if IF statically cfg'd (see Note #3).      */
+    msg_type          = (pif_info->ClientState == DHCP_STATE_INFORM) ? DHCP_MSG_INFORM
+                                                                     : DHCP_MSG_REQUEST;
+
+                                                                /* While REQUEST retry < max retry ...                  */
+                                                                /* ... & REQUEST NOT done,         ...                  */
+    while ((request_retry_cnt <  pif_info->Cfg.ReqRetryCnt) &&
+           (request_done      != DEF_YES)) {
+
+        if (request_dly == DEF_YES) {                           /* Dly REQUEST, if req'd.                               */
+            dly_ms = DHCPc_CalcBackOff(pif_info, dly_ms);
+                                                                /* Close Rx Q before delay to prevent Rx buffers ...    */
+                                                                /* from exhaustion.                                     */
+            (void)NetSock_CfgRxQ_Size( sock_id,
+                                       NET_SOCK_DATA_SIZE_MIN,
+                                      &net_err);
+            KAL_Dly(DHCPc_CalcBackOffRand(dly_ms));
+
+            (void)NetSock_CfgRxQ_Size( sock_id,                 /* Re-configure Rx Q size to its original value.        */
+                                       NET_SOCK_CFG_RX_Q_SIZE_OCTET,
+                                      &net_err);
+        }
+
+                                                                /* --------------- PREPARE REQUEST MSG ---------------- */
+        request_msg_len = DHCPc_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
+                                             (DHCPc_MSG_TYPE ) msg_type,
+                                             (CPU_INT08U    *) paddr_hw,
+                                             (CPU_INT08U     ) addr_hw_len,
+                                             (CPU_INT08U    *)&pmsg->MsgBuf[0],
+                                             (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
+                                             (DHCPc_ERR     *) perr);
+        if (*perr != DHCPc_ERR_NONE) {
+            DHCPc_MsgFree(pmsg);
+            return;
+        }
+
+
+                                                                /* ---------------------- TX MSG ---------------------- */
+        if (pif_info->ClientState == DHCP_STATE_RENEWING) {     /* If client in RENEWING state, ...                     */
+            addr_server_ip = pif_info->ServerID;                /* ... tx unicast   msg.                                */
+        } else {                                                /* Else,                        ...                     */
+            addr_server_ip = NET_IPv4_ADDR_BROADCAST;           /* ... tx broadcast msg.                                */
+        }
+
+        addr_server_size = sizeof(addr_server);
+        Mem_Clr((void     *)&addr_server,
+                (CPU_SIZE_T) addr_server_size);
+        addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+        addr_server.Addr       = addr_server_ip;
+        addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_SERVER);
+
+        DHCPc_Tx((NET_SOCK_ID      ) sock_id,
+                 (void            *)&pmsg->MsgBuf[0],
+                 (CPU_INT16U       ) request_msg_len,
+                 (NET_SOCK_ADDR   *)&addr_server,
+                 (NET_SOCK_ADDR_LEN) addr_server_size,
+                 (DHCPc_ERR       *) perr);
+        if (*perr != DHCPc_ERR_NONE) {
+            request_done = DEF_YES;
+
+        } else {
+
+                                                                /* ------------- RX REPLY FROM SERVER(S) -------------- */
+            rx_done = DEF_FALSE;
+
+
+            while (rx_done != DEF_YES) {
+
+                pmsg->MsgLen = DHCP_MSG_BUF_SIZE;
+                dhcp_rx_msg_type = DHCPc_RxReply((NET_SOCK_ID    ) sock_id,
+                                                 (DHCPc_IF_INFO *) pif_info,
+                                                 (NET_IPv4_ADDR  ) NET_IPv4_ADDR_NONE,
+                                                 (CPU_INT08U    *) paddr_hw,
+                                                 (CPU_INT08U     ) addr_hw_len,
+                                                 (CPU_INT08U    *)&pmsg->MsgBuf[0],
+                                                 (CPU_INT16U    *)&pmsg->MsgLen,
+                                                 (DHCPc_ERR     *) perr);
+
+                switch (*perr) {
+                    case DHCPc_ERR_NONE:                        /* If NO err                          ...               */
+
+                         switch (dhcp_rx_msg_type) {
+                             case DHCP_MSG_ACK:                 /* ... & rx'd msg is ACK,             ...               */
+                                  rx_done      = DEF_YES;       /* ... rx        done                 ...               */
+                                  request_done = DEF_YES;       /* ... & REQUEST done.                                  */
+                                  break;
+
+
+                             case DHCP_MSG_NAK:                 /* ... else if rx'd msg is NAK,       ...               */
+                                  rx_done      = DEF_YES;       /* ... rx        done,                ...               */
+                                  request_done = DEF_YES;       /* ... REQUEST done,                  ...               */
+                                 *perr = DHCPc_ERR_RX_NAK;      /* ... & rtn err.                                       */
+                                  break;
+
+
+                             default:                           /* ... Else rx'd msg NOT ACK nor NAK, ...               */
+                                  rx_done = DEF_NO;             /* ... rx NOT done.                                     */
+                                  break;
+                         }
+                         break;
+
+
+                    default:                                    /* If rx err,         ...                               */
+                         rx_done     = DEF_YES;
+                         request_dly = DEF_YES;
+                         request_retry_cnt++;                   /* ... restart REQUEST.                                 */
+                         break;
+                }
+            }
+        }
+    }
+
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_MsgFree(pmsg);
+        return;
+    }
+
+                                                                /* ------------ COPY ACK IN IF INFO STRUCT ------------ */
+    DHCPc_IF_InfoMsgSet(pif_info, pmsg, perr);                  /* Set msg ptr to rx'd ACK.                             */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_MsgFree(pmsg);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_DeclineRelease()
+*
+* Description : (1) Perform the DECLINE or RELEASE phase of the lease negotiation :
+*
+*                   (a) Get                      message
+*                   (b) Prepare  DECLINE/RELEASE message
+*                   (c) Transmit DECLINE/RELEASE message
+*
+*
+* Argument(s) : sock_id         Socket ID of socket to transmit & receive DHCPc data.
+*
+*               pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_InitStateHandler(),
+*                                                     DHCPc_StopStateHandler().
+*
+*               msg_type        DHCP message type to prepare :
+*
+*                                   DHCP_MSG_DECLINE        Decline message
+*                                   DHCP_MSG_RELEASE        Release message
+*
+*               paddr_hw        Pointer to hardware address buffer.
+*
+*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DECLINE/RELEASE successfully transmitted
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*
+*                                                               ------ RETURNED BY DHCPc_MsgGet() : ------
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*
+*                                                               --- RETURNED BY DHCPc_TxMsgPrepare() : ---
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*
+*                                                               -------- RETURNED BY DHCPc_Tx() : --------
+*                               DHCPc_ERR_TX                    Transmit error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_StopStateHandler().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_DeclineRelease (NET_SOCK_ID      sock_id,
+                                    DHCPc_IF_INFO   *pif_info,
+                                    DHCPc_MSG_TYPE   msg_type,
+                                    CPU_INT08U      *paddr_hw,
+                                    CPU_INT08U       addr_hw_len,
+                                    DHCPc_ERR       *perr)
+{
+    DHCPc_MSG           *pmsg;
+    CPU_INT16U           release_msg_len;
+    NET_IPv4_ADDR        addr_ip_server;
+    NET_SOCK_ADDR_IPv4   addr_server;
+    NET_SOCK_ADDR_LEN    addr_server_size;
+
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
+    if (paddr_hw == (CPU_INT08U *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
+    }
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    if (addr_hw_len > DHCPc_HW_ADDR_LEN_MAX) {
+#else
+    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
+#endif
+       *perr = DHCPc_ERR_INVALID_HW_ADDR;
+        return;
+    }
+#endif
+
+    switch (msg_type) {
+        case DHCP_MSG_DECLINE:
+             addr_ip_server = NET_IPv4_ADDR_BROADCAST;
+             break;
+
+
+        case DHCP_MSG_RELEASE:
+             addr_ip_server = pif_info->ServerID;
+             break;
+
+
+        default:
+            *perr = DHCPc_ERR_INVALID_MSG;
+             return;
+    }
+
+                                                                /* --------------------- GET MSG ---------------------- */
+    pmsg = DHCPc_MsgGet(perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+                                                                /* --------------- PREPARE RELEASE MSG ---------------- */
+    release_msg_len = DHCPc_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
+                                         (DHCPc_MSG_TYPE ) msg_type,
+                                         (CPU_INT08U    *) paddr_hw,
+                                         (CPU_INT08U     ) addr_hw_len,
+                                         (CPU_INT08U    *)&pmsg->MsgBuf[0],
+                                         (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
+                                         (DHCPc_ERR     *) perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_MsgFree(pmsg);
+        return;
+    }
+
+
+                                                                /* ---------------------- TX MSG ---------------------- */
+    addr_server_size = sizeof(addr_server);
+    Mem_Clr((void     *)&addr_server,
+            (CPU_SIZE_T) addr_server_size);
+    addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+    addr_server.Addr       = addr_ip_server;
+    addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_SERVER);
+
+    DHCPc_Tx((NET_SOCK_ID      ) sock_id,
+             (void            *)&pmsg->MsgBuf[0],
+             (CPU_INT16U       ) release_msg_len,
+             (NET_SOCK_ADDR   *)&addr_server,
+             (NET_SOCK_ADDR_LEN) addr_server_size,
+             (DHCPc_ERR       *) perr);
+
+
+    DHCPc_MsgFree(pmsg);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_ReleaseWait()
+*
+* Description : Wait until a RELEASE message transmitted to the server is sent out.
+*
+* Argument(s) : if_nbr          Interface number on which the RELEASE message was transmitted.
+*
+*               addr_host       Interface's host address, in network-order.
+*
+*               addr_server     Server address,           in network-order.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StopStateHandler().
+*
+* Note(s)     : (1) The RELEASE message is sent out by the stack as soon as the hardware address of the
+*                   next-hop is resolved : the server itself if it is on the interface's subnet, or the
+*                   interface's default gateway otherwise.
+*
+*               (2) The next-hop's ARP cache is polled every DHCP_RELEASE_POLL_DLY_MS milliseconds until it
+*                   is resolved or until DHCP_RELEASE_DLY_S seconds elapsed.  When the cache is already
+*                   resolved (e.g. server previously contacted by a unicast renewal), NO delay is added.
+*
+*               (3) If ARP is not present (NET_ARP_MODULE_EN not defined), NO address resolution is
+*                   needed & the function returns immediately.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ReleaseWait (NET_IF_NBR      if_nbr,
+                                 NET_IPv4_ADDR   addr_host,
+                                 NET_IPv4_ADDR   addr_server)
+{
+#ifdef  NET_ARP_MODULE_EN
+    CPU_INT08U        addr_hw[NET_CACHE_HW_ADDR_LEN_ETHER];
+    NET_IPv4_ADDR     addr_local;
+    NET_IPv4_ADDR     addr_subnet_mask;
+    NET_IPv4_ADDR     addr_gateway;
+    NET_IPv4_ADDR     addr_next_hop;
+    NET_ARP_ADDR_LEN  addr_len;
+    CPU_INT32U        poll_nbr;
+    CPU_INT32U        poll_ix;
+    NET_ERR           err_net;
+
+
+                                                                /* ------------------- GET NEXT-HOP ------------------- */
+    addr_next_hop  = addr_server;                               /* See Note #1.                                         */
+    addr_local     = NET_UTIL_NET_TO_HOST_32(addr_host);
+
+    addr_subnet_mask = NetIPv4_GetAddrSubnetMask(addr_local, &err_net);
+    if (err_net == NET_IPv4_ERR_NONE) {
+        if ((addr_local                           & addr_subnet_mask) !=
+            (NET_UTIL_NET_TO_HOST_32(addr_server) & addr_subnet_mask)) {
+            addr_gateway = NetIPv4_GetAddrDfltGateway(addr_local, &err_net);
+            if ((err_net      == NET_IPv4_ERR_NONE) &&
+                (addr_gateway != NET_IPv4_ADDR_NONE)) {
+                addr_next_hop = NET_UTIL_HOST_TO_NET_32(addr_gateway);
+            }
+        }
+    }
+
+                                                                /* ------------------ POLL ARP CACHE ------------------ */
+    addr_len = sizeof(addr_next_hop);
+    poll_nbr = (DHCP_RELEASE_DLY_S * DEF_TIME_NBR_mS_PER_SEC) / DHCP_RELEASE_POLL_DLY_MS;
+
+    for (poll_ix = 0; poll_ix < poll_nbr; poll_ix++) {          /* See Note #2.                                         */
+        NetARP_CacheGetAddrHW(                   if_nbr,
+                              (CPU_INT08U     *)&addr_hw[0],
+                              (NET_ARP_ADDR_LEN) NET_CACHE_HW_ADDR_LEN_ETHER,
+                              (CPU_INT08U     *)&addr_next_hop,
+                              (NET_ARP_ADDR_LEN) addr_len,
+                              (NET_ERR        *)&err_net);
+        if (err_net == NET_ARP_ERR_NONE) {                      /* If next-hop resolved, RELEASE sent out.              */
+            return;
+        }
+
+        KAL_Dly(DHCP_RELEASE_POLL_DLY_MS);
+    }
+
+#else
+   (void)&if_nbr;                                               /* Prevent 'variable unused' compiler warnings.         */
+   (void)&addr_host;                                            /* See Note #3.                                         */
+   (void)&addr_server;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_CalcBackOff()
+*
+* Description : Calculate next backed-off retransmit/retry timeout value.
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_InitStateHandler().
+*
+*               timeout_ms      Current timeout value (in milliseconds).
+*
+* Return(s)   : Backed-off re-transmit/retry timeout value (in milliseconds).
+*
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_Req(),
+*               DHCPc_IPv6_Exchange().
+*
+* Note(s)     : (1) RFC #2131, Section 4.1 'Constructing and sending DHCP messages' states that "the
+*                   client MUST adopt a retransmission strategy that incorporates a randomized
+*                   exponential backoff algorithm to determine the delay between retransmissions".
+*
+*                   It also stipulates that "the retransmission delay SHOULD be double with subsequent
+*                   retransmissions up to a maximum of 64 seconds".
+*
+*                   This implementation takes some distance from the RFC by setting the default initial
+*                   delay value to 2 seconds instead of the proposed 4 seconds.  Each delay is then
+*                   randomized before it is waited (see 'DHCPc_CalcBackOffRand()').
+*
+*               (2) The initial & maximum delay values are taken from the interface configuration (see
+*                   'DHCPc_StartExt()').
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DHCPc_CalcBackOff (DHCPc_IF_INFO  *pif_info,
+                                       CPU_INT32U      timeout_ms)
+{
+    CPU_INT32U  timeout_calcd;
+
+
+    if (timeout_ms == 0) {                                      /* See Note #2.                                         */
+        timeout_calcd = pif_info->Cfg.BackOffDlyInitial_ms;
+
+    } else {
+        timeout_calcd = (timeout_ms < pif_info->Cfg.BackOffDlyMax_ms)
+                      ? (timeout_ms * (CPU_INT32U)DHCPc_BACKOFF_DLY_SCALAR)
+                      : pif_info->Cfg.BackOffDlyMax_ms;
+
+        timeout_calcd = DEF_MIN((CPU_INT32U)timeout_calcd,
+                                (CPU_INT32U)pif_info->Cfg.BackOffDlyMax_ms);
+    }
+
+    return (timeout_calcd);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_CalcBackOffRand()
+*
+* Description : Randomize a backed-off retransmit/retry delay value.
+*
+* Argument(s) : dly_ms      Backed-off delay value (in milliseconds).
+*
+* Return(s)   : Randomized delay value (in milliseconds).
+*
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_Req(),
+*               DHCPc_IPv6_Exchange().
+*
+* Note(s)     : (1) RFC #2131, Section 4.1 'Constructing and sending DHCP messages' states that "the delay
+*                   [...] SHOULD be randomized by the value of a uniform random number chosen from the
+*                   range -1 to +1".
+*
+*                   The delay is therefore randomized by up to DHCPc_BACKOFF_DLY_RAND_MS milliseconds, so
+*                   that clients started at the same time do NOT retransmit in lockstep.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DHCPc_CalcBackOffRand (CPU_INT32U  dly_ms)
+{
+    CPU_INT32U  rand_ms;
+    CPU_INT32U  dly_rand_ms;
+
+
+                                                                /* Get rand offset in [0, 2 * RAND_MS] (see Note #1).   */
+    rand_ms = DHCPc_RandGet() % ((2u * DHCPc_BACKOFF_DLY_RAND_MS) + 1u);
+
+    if ((dly_ms + rand_ms) > DHCPc_BACKOFF_DLY_RAND_MS) {       /* Offset dly by [-RAND_MS, +RAND_MS], ...              */
+        dly_rand_ms = (dly_ms + rand_ms) - DHCPc_BACKOFF_DLY_RAND_MS;
+    } else {
+        dly_rand_ms =  0u;                                      /* ... but NOT below 0.                                 */
+    }
+
+    return (dly_rand_ms);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_RandSeed()
+*
+* Description : Mix data into the state of the pseudo-random number generator.
+*
+* Argument(s) : pdata       Pointer to data to mix into the generator state.
+*               -----       Argument validated in caller(s).
+*
+*               data_len    Length of the data (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IF_InfoGet(),
+*               DHCPc_AddrLocalLinkGet().
+*
+* Note(s)     : (1) The data (e.g. hardware address) & the current OS tick are mixed into the generator
+*                   state using the FNV-1a hash algorithm, so that devices that only differ by their
+*                   hardware address & devices booting at different times have distinct generator states.
+*
+*               (2) The generator state MUST NOT be zero (see 'DHCPc_RandGet()  Note #2').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_RandSeed (CPU_INT08U  *pdata,
+                              CPU_INT08U   data_len)
+{
+    CPU_INT32U  time_cur;
+    CPU_INT32U  state;
+    CPU_INT08U  i;
+    CPU_SR_ALLOC();
+
+
+    time_cur = DHCPc_OS_TimeGet_tick();
+
+    CPU_CRITICAL_ENTER();
+    state = DHCPc_RandState ^ time_cur;                         /* Mix cur tick into state (see Note #1).               */
+
+    for (i = 0u; i < data_len; i++) {                           /* Mix data into state.                                 */
+        state = (state ^ pdata[i]) * DHCPc_RAND_FNV_PRIME;
+    }
+
+    if (state == 0u) {                                          /* See Note #2.                                         */
+        state = DHCPc_RAND_SEED_INIT;
+    }
+    DHCPc_RandState = state;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_RandGet()
+*
+* Description : Get a 32-bit random number.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Random number.
+*
+* Caller(s)   : DHCPc_IF_InfoGet(),
+*               DHCPc_CalcBackOffRand(),
+*               DHCPc_AddrLocalLinkCfg(),
+*               DHCPc_AddrLocalLinkGet().
+*
+* Note(s)     : (1) The random number is obtained from the configured random number function, if any (see
+*                   'dhcp-c.h  DHCPc RANDOM NUMBER FUNCTION DATA TYPE').
+*
+*               (2) If NO random number function is configured, or if it fails, the random number is
+*                   obtained from the DHCP client's pseudo-random number generator (32-bit xorshift
+*                   generator, whose state MUST NOT be zero).
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DHCPc_RandGet (void)
+{
+    DHCPc_RAND_FNCT  rand_fnct;
+    CPU_INT32U       rand;
+    CPU_BOOLEAN      valid;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    rand_fnct = DHCPc_RandFnct;
+    CPU_CRITICAL_EXIT();
+
+    if (rand_fnct != (DHCPc_RAND_FNCT)0) {                      /* Get rand nbr from rand nbr fnct (see Note #1).       */
+        rand  = 0u;
+        valid = rand_fnct(&rand);
+        if (valid == DEF_OK) {
+            return (rand);
+        }
+    }
+
+                                                                /* Get rand nbr from pseudo-rand nbr generator ...      */
+    CPU_CRITICAL_ENTER();                                       /* ... (see Note #2).                                   */
+    rand  = DHCPc_RandState;
+    rand ^= rand << 13;
+    rand ^= rand >> 17;
+    rand ^= rand <<  5;
+    DHCPc_RandState = rand;
+    CPU_CRITICAL_EXIT();
+
+    return (rand);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_AddrValidate()
+*
+* Description : (1) Validate IP address not already used on the network.
+*
+*                   (a) Probe addr on network
+*                   (b) Wait for reply
+*                   (c) Get HW addr from ARP cache
+*
+*
+* Argument(s) : if_nbr          IF on which to perform address validation.
+*
+*               addr_target     IP address to validate, in network-order.
+*
+*               dly_ms          Delay to wait for a reply, in milliseconds.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  No error, address NOT used on the network.
+*                               DHCPc_ERR_ADDR_VALIDATE         Error validating address.
+*                               DHCPc_ERR_ADDR_USED             Address already used on the network.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler().
+*
+* Note(s)     : (2) If ARP is not present (NET_ARP_MODULE_EN not defined), or if any other error
+*                   happens when attempting to check the address, DHCPc_ERR_ADDR_VALIDATE is returned,
+*                   meaning that the check does not allow to conclude anything.
+*********************************************************************************************************
+*/
+
+#if ((DHCPc_CFG_ADDR_VALIDATE_EN       == DEF_ENABLED) || \
+     (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED))
+static  void  DHCPc_AddrValidate (NET_IF_NBR      if_nbr,
+                                  NET_IPv4_ADDR   addr_target,
+                                  CPU_INT32U      dly_ms,
+                                  DHCPc_ERR      *perr)
+{
+#ifdef  NET_ARP_MODULE_EN
+    CPU_INT08U        hw_addr_sender[NET_CACHE_HW_ADDR_LEN_ETHER];
+    NET_IPv4_ADDR     addr_this_host;
+    NET_ARP_ADDR_LEN  addr_len;
+#endif
+    NET_ERR           err_net;
+
+
+   (void)&err_net;                                              /* Prevent possible 'variable unused' warning.          */
+
+   *perr = DHCPc_ERR_ADDR_VALIDATE;                             /* Dflt rtn val.                                        */
+
+#ifdef  NET_ARP_MODULE_EN
+    addr_this_host = NET_IPv4_ADDR_NONE;
+    addr_len       = sizeof(addr_target);
+
+                                                                /* ---------------- PROBE ADDR ON NET ----------------- */
+    NetARP_CacheProbeAddrOnNet((NET_PROTOCOL_TYPE) NET_PROTOCOL_TYPE_IP_V4,
+                               (CPU_INT08U      *)&addr_this_host,
+                               (CPU_INT08U      *)&addr_target,
+                               (NET_ARP_ADDR_LEN ) addr_len,
+                               (NET_ERR         *)&err_net);
+
+    if (err_net != NET_ARP_ERR_NONE) {
+        return;                                                 /* See Note #2.                                         */
+    }
+                                                                /* ------------------ WAIT FOR REPLY ------------------ */
+    KAL_Dly(dly_ms);
+
+                                                                /* ------------ GET HW ADDR FROM ARP CACHE ------------ */
+    NetARP_CacheGetAddrHW(                   if_nbr,
+                          (CPU_INT08U     *)&hw_addr_sender[0],
+                          (NET_ARP_ADDR_LEN) NET_CACHE_HW_ADDR_LEN_ETHER,
+                          (CPU_INT08U     *)&addr_target,
+                          (NET_ARP_ADDR_LEN) addr_len,
+                          (NET_ERR        *)&err_net);
+
+    switch (err_net) {
+        case NET_ARP_ERR_CACHE_NOT_FOUND:                       /* If cache NOT found or cache pending, ...             */
+        case NET_ARP_ERR_CACHE_PEND:
+        case NET_CACHE_ERR_PEND:
+            *perr = DHCPc_ERR_NONE;                             /* ... addr NOT used.                                   */
+             break;
+
+
+        case NET_ARP_ERR_NONE:                                  /* If NO err, ...                                       */
+            *perr = DHCPc_ERR_ADDR_USED;                        /* ... hw addr in cache resolved (addr used).          */
+             break;
+
+
+        default:
+            *perr = DHCPc_ERR_ADDR_VALIDATE;
+             break;
+    }
+
+
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_AddrCfg()
+*
+* Description : Configure the interface's network parameters with the last accepted OFFER.
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_InitStateHandler().
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Interface's network successfully configured.
+*                               DHCPc_ERR_IF_CFG                Error configuring the interface's network.
+*
+*                                                               -------- RETURNED BY DHCPc_RouteGet() : --------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler().
+*
+* Note(s)     : (1) The address of a client sharing its interface with other logical client(s) is added
+*                   as an additional address of the interface (see 'DHCPc_InitStateHandler()  Note #6').
+*
+*               (2) When routes are enabled, the default gateway is the first default route of the lease
+*                   (see 'dhcp-c.h  DHCPc ROUTE DATA TYPE  Note #1').  The routes are installed once the
+*                   address is configured.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_AddrCfg (DHCPc_IF_INFO  *pif_info,
+                             DHCPc_ERR      *perr)
+{
+    DHCPc_MSG      *pmsg;
+    DHCP_MSG_HDR   *pmsg_hdr;
+    CPU_INT08U     *popt;
+    CPU_INT08U      opt_val_len;
+    CPU_BOOLEAN     cfgd;
+    NET_IF_NBR      if_nbr;
+    NET_IPv4_ADDR   addr_host;
+    NET_IPv4_ADDR   addr_subnet_mask;
+    NET_IPv4_ADDR   addr_dflt_gateway;
+    NET_ERR         err_net;
+
+
+    pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;
+    pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+
+                                                                /* -------------------- GET PARAM --------------------- */
+    addr_subnet_mask  = NET_IPv4_ADDR_NONE;
+    addr_dflt_gateway = NET_IPv4_ADDR_NONE;
+
+                                                                /* Get assign'd addr.                                   */
+    NET_UTIL_VAL_COPY_GET_NET_32(&addr_host, &pmsg_hdr->yiaddr);
+
+                                                                /* Get assign'd subnet mask.                            */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SUBNET_MASK,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_GET_NET_32(&addr_subnet_mask, popt);
+    }
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+    addr_dflt_gateway = DHCPc_RouteGet(pif_info, perr);         /* Get assign'd routes & dflt gateway (see Note #2).    */
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+#else
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_ROUTER,    /* Get assign'd dflt gateway.                           */
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_GET_NET_32(&addr_dflt_gateway, popt);
+    }
+#endif
+
+                                                                /* ------------------- CFG IF ADDR -------------------- */
+    if_nbr = pif_info->IF_Nbr;
+                                                                /* See Note #1.                                         */
+    if (DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_ADDR_SHARED) == DEF_YES) {
+        cfgd = NetIPv4_CfgAddrAdd(if_nbr, addr_host, addr_subnet_mask, addr_dflt_gateway, &err_net);
+    } else {
+        cfgd = NetIPv4_CfgAddrAddDynamic(if_nbr, addr_host, addr_subnet_mask, addr_dflt_gateway, &err_net);
+    }
+    if (cfgd != DEF_OK) {                                       /* If cfg invalid, ...                                  */
+       *perr = DHCPc_ERR_IF_CFG;                                /* ... rtn err.                                         */
+        return;
+    }
+
+    pif_info->AddrCfgd = addr_host;
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+    DHCPc_RouteInstall(pif_info);                               /* Install routes (see Note #2).                        */
+#endif
+
+   *perr = DHCPc_ERR_NONE;
+}
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_AddrHostGet()
+*
+* Description : Get the host address configured on an interface.
+*
+* Argument(s) : if_nbr      Interface number to get the host address of.
+*
+* Return(s)   : First host address configured on the interface (in network order), if available.
+*
+*               NET_IPv4_ADDR_NONE,                                                 otherwise.
+*
+* Caller(s)   : DHCPc_InformStateHandler(),
+*               DHCPc_TxMsgPrepare().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  NET_IPv4_ADDR  DHCPc_AddrHostGet (NET_IF_NBR  if_nbr)
+{
+    NET_IPv4_ADDR     addr_tbl[NET_IPv4_CFG_IF_MAX_NBR_ADDR];
+    NET_IP_ADDRS_QTY  addr_tbl_qty;
+    CPU_BOOLEAN       addr_avail;
+    NET_ERR           err_net;
+
+
+    addr_tbl_qty = NET_IPv4_CFG_IF_MAX_NBR_ADDR;
+    addr_avail   = NetIPv4_GetAddrHost((NET_IF_NBR        ) if_nbr,
+                                       (NET_IPv4_ADDR    *)&addr_tbl[0],
+                                       (NET_IP_ADDRS_QTY *)&addr_tbl_qty,
+                                       (NET_ERR          *)&err_net);
+    if ((addr_avail   != DEF_YES) ||
+        (addr_tbl_qty <  1u)      ||
+        (addr_tbl[0]  == NET_IPv4_ADDR_NONE)) {
+        return (NET_IPv4_ADDR_NONE);
+    }
+
+    return ((NET_IPv4_ADDR)NET_UTIL_HOST_TO_NET_32(addr_tbl[0]));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_AddrHW_Get()
+*
+* Description : Get the hardware address of an interface, as transmitted in the 'chaddr' field.
+*
+* Argument(s) : if_nbr      Interface number to get the hardware address of.
+*
+*               paddr_hw    Pointer to buffer that will receive the hardware address (see Note #1) :
+*               --------    Argument validated in caller(s).
+*
+*                               DHCPc_HW_ADDR_LEN_MAX octets long, at least.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Hardware address successfully retrieved.
+*                               DHCPc_ERR_IF_INVALID            Invalid interface.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*
+* Return(s)   : Length of the hardware address (in octets), if NO error(s).
+*
+*               0,                                        otherwise.
+*
+* Caller(s)   : DHCPc_IF_InfoGet(),
+*               DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler(),
+*               DHCPc_StopStateHandler(),
+*               DHCPc_InformStateHandler(),
+*               DHCPc_ForceRenewValidate(),
+*               DHCPc_HW_TypeSet(),
+*               DHCPc_IPv6_DUID_Set().
+*
+* Note(s)     : (1) (a) When DHCPc_CFG_HW_TYPE_GENERIC_EN is DEF_DISABLED, the hardware address MUST be an
+*                       Ethernet address.
+*
+*                   (b) When DHCPc_CFG_HW_TYPE_GENERIC_EN is DEF_ENABLED, an interface without a hardware
+*                       address, or with a hardware address NOT fitting the 'chaddr' field, returns a length
+*                       of 0 (see 'dhcp-c.h  DHCPc HARDWARE ADDRESS DEFINES  Note #2').  Any other error, &
+*                       in particular an invalid interface, is returned to the caller.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  DHCPc_AddrHW_Get (NET_IF_NBR   if_nbr,
+                                      CPU_INT08U  *paddr_hw,
+                                      DHCPc_ERR   *perr)
+{
+    CPU_INT08U  addr_hw_len;
+    NET_ERR     err_net;
+
+
+    addr_hw_len = DHCPc_HW_ADDR_LEN_MAX;
+    NetIF_AddrHW_Get( if_nbr,
+                      paddr_hw,
+                     &addr_hw_len,
+                     &err_net);
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    switch (err_net) {
+        case NET_IF_ERR_NONE:
+             break;
+
+
+        case NET_IF_ERR_INVALID_CFG:                            /* If NO hw addr fitting 'chaddr', ...                  */
+        case NET_IF_ERR_INVALID_ADDR_LEN:
+        case NET_ERR_FAULT_NULL_FNCT:
+             addr_hw_len = 0u;                                  /* ... rtn NO hw addr (see Note #1b).                   */
+             break;
+
+
+        case NET_IF_ERR_INVALID_IF:
+            *perr = DHCPc_ERR_IF_INVALID;
+             return (0u);
+
+
+        default:
+            *perr = DHCPc_ERR_INVALID_HW_ADDR;
+             return (0u);
+    }
+#else
+    if ((err_net     != NET_IF_ERR_NONE) ||                     /* See Note #1a.                                        */
+        (addr_hw_len != NET_IF_ETHER_ADDR_SIZE)) {
+       *perr = DHCPc_ERR_INVALID_HW_ADDR;
+        return (0u);
+    }
+#endif
+
+   *perr = DHCPc_ERR_NONE;
+
+    return (addr_hw_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_HW_TypeSet()
+*
+* Description : Set the hardware type of a client whose hardware type is NOT configured.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in caller(s).
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Hardware type successfully set.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Hardware type NOT configured & interface's
+*                                                                   hardware address NOT an Ethernet address.
+*
+*                                                               ------- RETURNED BY DHCPc_AddrHW_Get() : -------
+*                               DHCPc_ERR_IF_INVALID            Invalid interface.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StartAsync(),
+*               DHCPc_Inform(),
+*               DHCPc_IPv6_Start().
+*
+* Note(s)     : (1) A client whose hardware type is NOT configured MUST run on an interface with an Ethernet
+*                   hardware address, & then transmits the Ethernet hardware type.  This prevents e.g. a PPP
+*                   interface from transmitting the Ethernet hardware type with NO hardware address (see
+*                   'dhcp-c.h  DHCPc HARDWARE ADDRESS DEFINES  Note #1b').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+static  void  DHCPc_HW_TypeSet (DHCPc_IF_INFO  *pif_info,
+                                DHCPc_ERR      *perr)
+{
+    CPU_INT08U  addr_hw_len;
+    CPU_INT08U  addr_hw[DHCPc_HW_ADDR_LEN_MAX];
+
+
+    if (pif_info->Cfg.HW_Type != DHCPc_HW_TYPE_NONE) {          /* If hw type cfg'd, use it as is.                      */
+       *perr = DHCPc_ERR_NONE;
+        return;
+    }
+
+    addr_hw_len = DHCPc_AddrHW_Get(pif_info->IF_Nbr, &addr_hw[0], perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {                /* If NO Ethernet hw addr, ...                          */
+       *perr = DHCPc_ERR_INVALID_HW_ADDR;                       /* ... hw type MUST be cfg'd (see Note #1).             */
+        return;
+    }
+
+    pif_info->Cfg.HW_Type = DHCP_HTYPE_ETHER;
+
+   *perr = DHCPc_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_AddrLocalLinkCfg()
+*
+* Description : (1) Perform action associated with dynamic link-local address configuration
+*
+*                   (a) Get random address
+*                   (b) Test address
+*                   (c) Interpret test result
+*                   (d) Configure interface and announce IP address
+*
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument checked in DHCPc_InitStateHandler().
+*
+*               paddr_hw        Pointer to hardware address buffer.
+*
+*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Interface configured using a link-local address.
+*                               DHCPc_ERR_IF_CFG                Error configuring the interface's network.
+*
+*                                                               ------ RETURNED BY DHCPc_AddrValidate() : ------
+*                               DHCPc_ERR_ADDR_VALIDATE         Error validating address.
+*                               DHCPc_ERR_ADDR_USED             Address already used on the network.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : none.
+*
+* Note(s)     : (2) From RFC #3027, section 'Probe details' :
+*
+*                   (a) "If the number of conflicts [experienced in the process of trying to acquire an
+*                       address] exceeds MAX_CONFLICTS, then the host MUST limit the rate at which it
+*                       probes for new addresses to no more than one new address per RATE_LIMIT_INTERVAL".
+*
+*                   (b) "When ready to begin probing, the host should then wait for a random time interval
+*                       selected uniformly in the range zero to PROBE_WAIT seconds, and should then send
+*                       PROBE_NUM probe packets, each of these probe packets spaced randomly, PROBE_MIN to
+*                       PROBE_MAX seconds apart".
+*
+*                       This implementation waits a random time interval of up to PROBE_WAIT seconds
+*                       before sending the first probe packet.  As for the retransmission of ARP packets,
+*                       this if left to the ARP layer.
+*
+*               (3) From RFC #3027, section 'Announcing an Address', "[...] the host MUST announce its
+*                   claimed address by broadcasting ANNOUNCE_NUM ARP announcements, spaced
+*                   ANNOUNCE_INTERVAL seconds apart".
+*
+*                   This is being done to make sure hosts on the network do NOT have ARP cache entries
+*                   from other host that had been previously using the same address.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED)
+static  void  DHCPc_AddrLocalLinkCfg (DHCPc_IF_INFO  *pif_info,
+                                      CPU_INT08U     *paddr_hw,
+                                      CPU_INT08U      addr_hw_len,
+                                      DHCPc_ERR      *perr)
+{
+    NET_IPv4_ADDR  addr_host;
+    NET_IPv4_ADDR  addr_net;
+    CPU_INT08U     addr_len;
+    CPU_BOOLEAN    addr_srch_done;
+    CPU_INT08U     nbr_conflicts;
+    CPU_BOOLEAN    cfgd;
+    CPU_INT08U     announce_nbr;
+    CPU_BOOLEAN    announce_done;
+    CPU_INT32U     dly_ms;
+    NET_ERR        err_net;
+
+
+                                                                /* ------------------ GET RANDOM ADDR ----------------- */
+    nbr_conflicts  = 0;
+    addr_srch_done = DEF_NO;
+
+    while ((addr_srch_done != DEF_YES) &&
+           (nbr_conflicts  <=  DHCPc_CFG_LOCAL_LINK_MAX_RETRY)) {
+
+        if (nbr_conflicts > DHCP_LOCAL_LINK_MAX_CONFLICTS) {
+                                                                /* See Note #2a.                                        */
+            KAL_Dly((CPU_INT32U)(DHCP_LOCAL_LINK_RATE_LIMIT_INTERVAL_S * DEF_TIME_NBR_mS_PER_SEC));
+        }
+
+        addr_host =  DHCPc_AddrLocalLinkGet(paddr_hw, addr_hw_len);
+        addr_net  = (NET_IPv4_ADDR)NET_UTIL_HOST_TO_NET_32(addr_host);
+
+
+                                                                /* -------------- VALIDATE ADDR NOT USED -------------- */
+        dly_ms = DHCPc_RandGet() % ((CPU_INT32U)(DHCP_LOCAL_LINK_PROBE_WAIT_S * DEF_TIME_NBR_mS_PER_SEC) + 1u);
+        KAL_Dly(dly_ms);                                        /* Dly (see Note #2b).                                  */
+
+                                                                /* Probe addr.                                          */
+        DHCPc_AddrValidate(                pif_info->IF_Nbr,
+                           (NET_IPv4_ADDR) addr_net,
+                           (CPU_INT32U   )(DHCP_LOCAL_LINK_ANNOUNCE_WAIT_S * DEF_TIME_NBR_mS_PER_SEC),
+                           (DHCPc_ERR   *) perr);
+        switch(*perr) {
+            case DHCPc_ERR_NONE:                                /* If addr not used, ...                                */
+                 addr_srch_done = DEF_YES;                      /* ... addr validated.                                  */
+                 break;
+
+
+            case DHCPc_ERR_ADDR_USED:                           /* Else if addr used, ...                               */
+                 nbr_conflicts++;                               /* ... restart process.                                 */
+                 break;
+
+
+            case DHCPc_ERR_ADDR_VALIDATE:                       /* Else if any other error, ...                         */
+            default:
+                 addr_srch_done = DEF_YES;                      /* ... stop link-local cfg.                             */
+        }
+    }
+
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+                                                                /* -------------- CFG IF & ANNOUNCE ADDR -------------- */
+    cfgd = NetIPv4_CfgAddrAddDynamic((NET_IF_NBR   ) pif_info->IF_Nbr,
+                                     (NET_IPv4_ADDR) addr_host,
+                                     (NET_IPv4_ADDR) NET_IPv4_ADDR_LOCAL_LINK_MASK,
+                                     (NET_IPv4_ADDR) NET_IPv4_ADDR_NONE,
+                                     (NET_ERR     *)&err_net);
+    if (cfgd != DEF_OK) {
+       *perr = DHCPc_ERR_IF_CFG;
+        return;
+    }
+
+    pif_info->AddrCfgd = addr_host;
+
+    addr_len      = sizeof(NET_IPv4_ADDR);
+    announce_nbr  = 0;
+    announce_done = DEF_NO;
+
+
+    while ((announce_nbr  < DHCP_LOCAL_LINK_ANNOUNCE_NUM) &&    /* See Note #3.                                         */
+           (announce_done != DEF_YES)) {
+
+        NetARP_TxReqGratuitous((NET_PROTOCOL_TYPE) NET_PROTOCOL_TYPE_IP_V4,
+                               (CPU_INT08U      *)&addr_net,
+                               (CPU_INT08U       ) addr_len,
+                               (NET_ERR         *)&err_net);
+
+        if (err_net == NET_ARP_ERR_NONE) {
+            KAL_Dly((CPU_INT32U)(DHCP_LOCAL_LINK_ANNOUNCE_INTERVAL_S * DEF_TIME_NBR_mS_PER_SEC));
+
+        } else {
+            announce_done = DEF_YES;
+        }
+
+        announce_nbr++;
+    }
+
+
+   *perr = DHCPc_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_AddrLocalLinkGet()
+*
+* Description : (1) Generate a pseudo-random IPv4 address in the Link-Local reserved range :
+*
+*                   (a) Seed random number generator from the hardware address
+*                   (b) Get  random number
+*                   (c) Generate address
+*
+*
+* Argument(s) : paddr_hw        Pointer to hardware address buffer.
+*               --------        Argument validated in DHCPc_AddrLocalLinkCfg().
+*
+*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+* Return(s)   : IPv4 Link-Local address.
+*
+* Caller(s)   : DHCPc_AddrLocalLinkCfg().
+*
+* Note(s)     : (2) The hardware address & the current time are mixed into the random number generator
+*                   state (see 'DHCPc_RandSeed()  Note #1'), so that devices booting at the same time do
+*                   NOT select the same link-local address candidates.
+*
+*               (3) The random address returned from this function is obtained by adding an "offset"
+*                   generated from the random number to the link-local base address (defined by
+*                   NET_IP_ADDR_LOCAL_LINK_HOST_MIN).
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED)
+static  NET_IPv4_ADDR  DHCPc_AddrLocalLinkGet (CPU_INT08U  *paddr_hw,
+                                               CPU_INT08U   addr_hw_len)
+{
+    CPU_INT32U     random;
+    NET_IPv4_ADDR  addr;
+
+
+                                                                /* ------------------- GET RAND NBR ------------------- */
+    DHCPc_RandSeed(paddr_hw, addr_hw_len);                      /* See Note #2.                                         */
+    random = DHCPc_RandGet();
+
+                                                                /* ------------------- GENERATE ADDR ------------------ */
+                                                                /* See Note #3.                                         */
+    addr =            NET_IPv4_ADDR_LOCAL_LINK_HOST_MIN +
+           (random % (NET_IPv4_ADDR_LOCAL_LINK_HOST_MAX - NET_IPv4_ADDR_LOCAL_LINK_HOST_MIN + 1));
+
+    return (addr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          DHCPc_RouteGet()
+*
+* Description : (1) Get the routes of the last accepted lease :
+*
+*                   (a) Get classless static routes
+*                   (b) Get static routes & routers, if NO classless static route
+*                   (c) Set interface's routes
+*
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler().
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Routes successfully set.
+*
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : --------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : Default gateway (in host order), if any.
+*
+*               NET_IPv4_ADDR_NONE,             otherwise.
+*
+* Caller(s)   : DHCPc_AddrCfg().
+*
+* Note(s)     : (2) See 'dhcp-c.h  DHCPc ROUTE DATA TYPE  Note #1'.
+*
+*               (3) A 'Classless Static Route' option shorter than DHCP_ROUTE_CLASSLESS_LEN_MIN or holding
+*                   an invalid route is ignored as a whole; the 'Static Route' & 'Router' options are then
+*                   used instead (see 'dhcp-c.h  DHCP ROUTE DEFINES  Note #1').
+*
+*               (4) The routes are written while the interface's route table is empty; the interface lock
+*                   is hence ONLY acquired to set the number of routes (see 'DHCPc_RouteRemove()').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+static  NET_IPv4_ADDR  DHCPc_RouteGet (DHCPc_IF_INFO  *pif_info,
+                                       DHCPc_ERR      *perr)
+{
+    DHCPc_MSG      *pmsg;
+    CPU_INT08U     *popt;
+    CPU_INT08U      opt_val_len;
+    CPU_INT16U      opt_ix;
+    CPU_INT08U      prefix_len;
+    CPU_INT08U      addr_len;
+    CPU_INT08U      ix;
+    CPU_BOOLEAN     classless_valid;
+    CPU_INT08U      route_qty;
+    DHCPc_ROUTE     route;
+    NET_IPv4_ADDR   addr_dflt_gateway;
+
+
+    pmsg              = (DHCPc_MSG *)pif_info->MsgPtr;
+    route_qty         =  0u;
+    addr_dflt_gateway =  NET_IPv4_ADDR_NONE;
+    classless_valid   =  DEF_NO;
+
+                                                                /* ------------ GET CLASSLESS STATIC ROUTES ----------- */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_CLASSLESS_STATIC_ROUTE,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if ((popt        != (CPU_INT08U *)0) &&                     /* Validate opt len (see Note #3).                      */
+        (opt_val_len >= DHCP_ROUTE_CLASSLESS_LEN_MIN)) {
+        opt_ix          = 0u;
+        classless_valid = DEF_YES;
+
+        while ((opt_ix          <  opt_val_len) &&
+               (classless_valid == DEF_YES)) {
+            prefix_len = popt[opt_ix];
+            addr_len   = (prefix_len + DEF_OCTET_NBR_BITS - 1u) / DEF_OCTET_NBR_BITS;
+
+            if ((prefix_len > DHCP_ROUTE_PREFIX_LEN_MAX) ||     /* Validate route (see Note #3).                        */
+               ((opt_ix + 1u + addr_len + DHCP_ROUTE_ROUTER_LEN) > opt_val_len)) {
+                classless_valid = DEF_NO;
+
+            } else {
+                route.AddrDest = NET_IPv4_ADDR_NONE;            /* Get dest from significant octets.                    */
+                for (ix = 0u; ix < addr_len; ix++) {
+                    route.AddrDest |= (NET_IPv4_ADDR)popt[opt_ix + 1u + ix] << ((3u - ix) * DEF_OCTET_NBR_BITS);
+                }
+
+                if (prefix_len == 0u) {                         /* Get dest mask from prefix len.                       */
+                    route.AddrMask = NET_IPv4_ADDR_NONE;
+                } else {
+                    route.AddrMask = (NET_IPv4_ADDR)(DEF_INT_32U_MAX_VAL << (DHCP_ROUTE_PREFIX_LEN_MAX - prefix_len));
+                }
+                route.AddrDest &= route.AddrMask;
+
+                NET_UTIL_VAL_COPY_GET_NET_32(&route.AddrNextHop, &popt[opt_ix + 1u + addr_len]);
+
+                if ((prefix_len        == 0u) &&                /* First dflt route is dflt gateway.                    */
+                    (addr_dflt_gateway == NET_IPv4_ADDR_NONE)) {
+                    addr_dflt_gateway = route.AddrNextHop;
+                }
+
+                route_qty  = DHCPc_RouteInsert(pif_info, &route, route_qty);
+                opt_ix    += 1u + addr_len + DHCP_ROUTE_ROUTER_LEN;
+            }
+        }
+
+        if (classless_valid != DEF_YES) {                       /* If any route invalid, ignore opt (see Note #3).      */
+            route_qty         = 0u;
+            addr_dflt_gateway = NET_IPv4_ADDR_NONE;
+        }
+    }
+
+                                                                /* ------------ GET STATIC ROUTES & ROUTERS ----------- */
+    if (classless_valid != DEF_YES) {
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_STATIC_ROUTE,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if (popt != (CPU_INT08U *)0) {
+            for (opt_ix = 0u; (opt_ix + DHCP_ROUTE_STATIC_LEN) <= opt_val_len; opt_ix += DHCP_ROUTE_STATIC_LEN) {
+                NET_UTIL_VAL_COPY_GET_NET_32(&route.AddrDest,    &popt[opt_ix]);
+                NET_UTIL_VAL_COPY_GET_NET_32(&route.AddrNextHop, &popt[opt_ix + DHCP_ROUTE_ROUTER_LEN]);
+                                                                /* Get dest mask from dest class.                       */
+                if ((route.AddrDest & DHCP_ROUTE_CLASS_A_MASK) == DHCP_ROUTE_CLASS_A) {
+                    route.AddrMask = DHCP_ROUTE_CLASS_A_MASK_NET;
+                } else if ((route.AddrDest & DHCP_ROUTE_CLASS_B_MASK) == DHCP_ROUTE_CLASS_B) {
+                    route.AddrMask = DHCP_ROUTE_CLASS_B_MASK_NET;
+                } else if ((route.AddrDest & DHCP_ROUTE_CLASS_C_MASK) == DHCP_ROUTE_CLASS_C) {
+                    route.AddrMask = DHCP_ROUTE_CLASS_C_MASK_NET;
+                } else {
+                    route.AddrMask = NET_IPv4_ADDR_NONE;        /* Multicast/reserved dest NOT routed.                  */
+                }
+
+                if ((route.AddrMask != NET_IPv4_ADDR_NONE) &&   /* Dflt route NOT allowed in opt.                       */
+                    (route.AddrDest != NET_IPv4_ADDR_NONE)) {
+                    route.AddrDest &= route.AddrMask;
+                    route_qty       = DHCPc_RouteInsert(pif_info, &route, route_qty);
+                }
+            }
+        }
+
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_ROUTER,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if (popt != (CPU_INT08U *)0) {
+            for (opt_ix = 0u; (opt_ix + DHCP_ROUTE_ROUTER_LEN) <= opt_val_len; opt_ix += DHCP_ROUTE_ROUTER_LEN) {
+                route.AddrDest = NET_IPv4_ADDR_NONE;            /* Each router is a dflt route.                         */
+                route.AddrMask = NET_IPv4_ADDR_NONE;
+                NET_UTIL_VAL_COPY_GET_NET_32(&route.AddrNextHop, &popt[opt_ix]);
+
+                if (opt_ix == 0u) {                             /* First router is dflt gateway.                        */
+                    addr_dflt_gateway = route.AddrNextHop;
+                }
+
+                route_qty = DHCPc_RouteInsert(pif_info, &route, route_qty);
+            }
+        }
+    }
+
+                                                                /* ------------------ SET IF ROUTES ------------------- */
+    DHCPc_OS_IF_Lock(pif_info->ID, perr);                       /* See Note #4.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return (NET_IPv4_ADDR_NONE);
+    }
+
+    pif_info->RouteQty = route_qty;
+
+    DHCPc_OS_IF_Unlock(pif_info->ID);
+
+   *perr = DHCPc_ERR_NONE;
+
+    return (addr_dflt_gateway);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_RouteInsert()
+*
+* Description : Insert a route in the route table of an interface, sorted by decreasing prefix length.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler().
+*
+*               proute      Pointer to route to insert.
+*               ------      Argument validated in DHCPc_RouteGet().
+*
+*               route_qty   Number of routes already in the route table.
+*
+* Return(s)   : Number of routes in the route table.
+*
+* Caller(s)   : DHCPc_RouteGet().
+*
+* Note(s)     : (1) A route is inserted after the routes of the same prefix length, so that the routes of
+*                   the same prefix length (e.g. the routers) keep the server's order of preference.
+*
+*               (2) #### The routes in excess of DHCPc_CFG_ROUTE_MAX_NBR are discarded.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+static  CPU_INT08U  DHCPc_RouteInsert (DHCPc_IF_INFO  *pif_info,
+                                       DHCPc_ROUTE    *proute,
+                                       CPU_INT08U      route_qty)
+{
+    CPU_INT08U  ix;
+    CPU_INT08U  ix_insert;
+
+
+    if (route_qty >= DHCPc_CFG_ROUTE_MAX_NBR) {                 /* If route tbl full, discard route (see Note #2).      */
+        return (route_qty);
+    }
+
+    ix_insert = 0u;                                             /* Find insert ix (see Note #1).                        */
+    while ((ix_insert <  route_qty) &&
+           (pif_info->RouteTbl[ix_insert].AddrMask >= proute->AddrMask)) {
+        ix_insert++;
+    }
+
+    for (ix = route_qty; ix > ix_insert; ix--) {                /* Shift less specific routes.                          */
+        pif_info->RouteTbl[ix] = pif_info->RouteTbl[ix - 1u];
+    }
+
+    pif_info->RouteTbl[ix_insert] = *proute;
+
+    return (route_qty + 1u);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_RouteInstall()
+*
+* Description : Install the routes of an interface into the IP stack.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_AddrCfg().
+*
+* Note(s)     : (1) The routes are installed through the route function, if any (see 'dhcp-c.h  DHCPc ROUTE
+*                   DATA TYPE  Note #2').
+*
+*               (2) The route table is ONLY written by the DHCPc task & is hence
+*                   read without the interface lock.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+static  void  DHCPc_RouteInstall (DHCPc_IF_INFO  *pif_info)
+{
+    DHCPc_ROUTE_FNCT  route_fnct;
+    CPU_INT08U        ix;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    route_fnct = DHCPc_RouteFnct;
+    CPU_CRITICAL_EXIT();
+
+    if (route_fnct == (DHCPc_ROUTE_FNCT)0) {                    /* If NO route fnct, routes NOT installed.              */
+        return;
+    }
+
+    for (ix = 0u; ix < pif_info->RouteQty; ix++) {              /* Install routes (see Note #2).                        */
+        route_fnct(pif_info->IF_Nbr, &pif_info->RouteTbl[ix], DEF_YES);
+    }
+
+    DEF_BIT_SET(pif_info->Flags, DHCPc_FLAG_ROUTE_INSTALLED);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_RouteRemove()
+*
+* Description : Remove the routes of an interface from the IP stack & clear the interface's route table.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler(),
+*                                                 DHCPc_StopStateHandler().
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Routes successfully removed.
+*
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : --------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_StopStateHandler().
+*
+* Note(s)     : (1) Only the routes installed by 'DHCPc_RouteInstall()' are removed through the route
+*                   function.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+static  void  DHCPc_RouteRemove (DHCPc_IF_INFO  *pif_info,
+                                 DHCPc_ERR      *perr)
+{
+    DHCPc_ROUTE_FNCT  route_fnct;
+    CPU_INT08U        ix;
+    CPU_SR_ALLOC();
+
+
+                                                                /* ----------------- REM STACK ROUTES ----------------- */
+    if (DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_ROUTE_INSTALLED) == DEF_YES) {
+        CPU_CRITICAL_ENTER();
+        route_fnct = DHCPc_RouteFnct;
+        CPU_CRITICAL_EXIT();
+
+        if (route_fnct != (DHCPc_ROUTE_FNCT)0) {                /* See Note #1.                                         */
+            for (ix = 0u; ix < pif_info->RouteQty; ix++) {
+                route_fnct(pif_info->IF_Nbr, &pif_info->RouteTbl[ix], DEF_NO);
+            }
+        }
+
+        DEF_BIT_CLR(pif_info->Flags, DHCPc_FLAG_ROUTE_INSTALLED);
+    }
+
+                                                                /* ------------------ CLR IF ROUTES ------------------- */
+    if (pif_info->RouteQty == 0u) {
+       *perr = DHCPc_ERR_NONE;
+        return;
+    }
+
+    DHCPc_OS_IF_Lock(pif_info->ID, perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+    pif_info->RouteQty = 0u;
+
+    DHCPc_OS_IF_Unlock(pif_info->ID);
+
+   *perr = DHCPc_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_SrvGet()
+*
+* Description : Get the servers & the domain name of the last accepted message.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler(),
+*                                                 DHCPc_RenewRebindStateHandler(),
+*                                                 DHCPc_InformStateHandler().
+*
+* Return(s)   : DEF_YES, if the servers or the domain name changed.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler(),
+*               DHCPc_InformStateHandler().
+*
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc SERVER FUNCTION DATA TYPE  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+static  CPU_BOOLEAN  DHCPc_SrvGet (DHCPc_IF_INFO  *pif_info)
+{
+    DHCPc_MSG    *pmsg;
+    CPU_BOOLEAN   changed;
+
+
+    pmsg    = (DHCPc_MSG *)pif_info->MsgPtr;
+
+    changed =  DHCPc_SrvAddrGet((DHCPc_MSG    *) pmsg,
+                                (DHCPc_OPT_CODE) DHCP_OPT_DOMAIN_NAME_SERVER,
+                                (NET_IPv4_ADDR *)&pif_info->DNS_SrvTbl[0],
+                                (CPU_INT08U    *)&pif_info->DNS_SrvQty);
+
+    if (DHCPc_SrvAddrGet((DHCPc_MSG    *) pmsg,
+                         (DHCPc_OPT_CODE) DHCP_OPT_NETWORK_TIME_PROTOCOL_SERVER,
+                         (NET_IPv4_ADDR *)&pif_info->NTP_SrvTbl[0],
+                         (CPU_INT08U    *)&pif_info->NTP_SrvQty) == DEF_YES) {
+        changed = DEF_YES;
+    }
+
+#if (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0)
+    if (DHCPc_SrvDomainNameGet(pmsg, &pif_info->DomainName[0]) == DEF_YES) {
+        changed = DEF_YES;
+    }
+#endif
+
+    return (changed);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_SrvAddrGet()
+*
+* Description : Get the server addresses of a message option into a server table.
+*
+* Argument(s) : pmsg        Pointer to DHCP message.
+*               ----        Argument validated in DHCPc_SrvGet().
+*
+*               opt_code    Option code of the server addresses.
+*
+*               paddr_tbl   Pointer to server table (see Note #1).
+*               ---------   Argument validated in DHCPc_SrvGet().
+*
+*               paddr_qty   Pointer to number of servers in the table.
+*               ---------   Argument validated in DHCPc_SrvGet().
+*
+* Return(s)   : DEF_YES, if the server table changed.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_SrvGet().
+*
+* Note(s)     : (1) The server table holds DHCPc_CFG_SRV_MAX_NBR addresses, in host order.  The servers in
+*                   excess are discarded.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+static  CPU_BOOLEAN  DHCPc_SrvAddrGet (DHCPc_MSG       *pmsg,
+                                       DHCPc_OPT_CODE   opt_code,
+                                       NET_IPv4_ADDR   *paddr_tbl,
+                                       CPU_INT08U      *paddr_qty)
+{
+    CPU_INT08U     *popt;
+    CPU_INT08U      opt_val_len;
+    CPU_INT08U      addr_qty;
+    CPU_INT08U      ix;
+    NET_IPv4_ADDR   addr;
+    CPU_BOOLEAN     changed;
+
+
+    addr_qty = 0u;
+    changed  = DEF_NO;
+
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) opt_code,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        addr_qty = opt_val_len / sizeof(NET_IPv4_ADDR);
+        if (addr_qty > DHCPc_CFG_SRV_MAX_NBR) {                 /* Discard srvs in excess (see Note #1).                */
+            addr_qty = DHCPc_CFG_SRV_MAX_NBR;
+        }
+
+        for (ix = 0u; ix < addr_qty; ix++) {
+            NET_UTIL_VAL_COPY_GET_NET_32(&addr, &popt[ix * sizeof(NET_IPv4_ADDR)]);
+            if ((ix        >= *paddr_qty) ||                    /* If srv changed, ...                                  */
+                (paddr_tbl[ix] != addr)) {
+                paddr_tbl[ix]  = addr;                          /* ... update srv tbl.                                  */
+                changed        = DEF_YES;
+            }
+        }
+    }
+
+    if (addr_qty != *paddr_qty) {
+       *paddr_qty = addr_qty;
+        changed   = DEF_YES;
+    }
+
+    return (changed);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_SrvDomainNameGet()
+*
+* Description : Get the domain name of a message.
+*
+* Argument(s) : pmsg            Pointer to DHCP message.
+*               ----            Argument validated in DHCPc_SrvGet().
+*
+*               pdomain_name    Pointer to domain name buffer, of DHCPc_CFG_DOMAIN_NAME_MAX_LEN + 1 chars.
+*               ------------    Argument validated in DHCPc_SrvGet().
+*
+* Return(s)   : DEF_YES, if the domain name changed.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_SrvGet().
+*
+* Note(s)     : (1) The domain name is taken from the 'Domain Name' option or, if absent, from the first
+*                   domain of the 'Domain Search' option (see 'dhcp-c.h  DHCPc SERVER FUNCTION DATA TYPE
+*                   Note #1').
+*
+*               (2) A compression pointer MUST point backward in the option (see 'dhcp-c.h  DHCP DOMAIN NAME
+*                   DEFINES  Note #2').  Since every label decoded lengthens the domain name, the decoding is
+*                   bounded by DHCPc_CFG_DOMAIN_NAME_MAX_LEN even for a looping pointer.
+*
+*               (3) An invalid domain, or a domain name longer than DHCPc_CFG_DOMAIN_NAME_MAX_LEN, is
+*                   discarded.
+*********************************************************************************************************
+*/
+
+#if ((DHCPc_CFG_SRV_MAX_NBR         > 0) && \
+     (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0))
+static  CPU_BOOLEAN  DHCPc_SrvDomainNameGet (DHCPc_MSG  *pmsg,
+                                             CPU_CHAR   *pdomain_name)
+{
+    CPU_INT08U   *popt;
+    CPU_INT08U    opt_val_len;
+    CPU_INT16U    opt_ix;
+    CPU_INT16U    opt_ix_ptr;
+    CPU_INT08U    label_len;
+    CPU_INT16U    name_len;
+    CPU_INT16U    ix;
+    CPU_CHAR      name_char;
+    CPU_BOOLEAN   name_valid;
+    CPU_BOOLEAN   name_end;
+    CPU_BOOLEAN   changed;
+
+
+    name_len   = 0u;
+    name_valid = DEF_NO;
+    changed    = DEF_NO;
+
+                                                                /* ------------------ GET DOMAIN NAME ----------------- */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_DOMAIN_NAME,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        if (opt_val_len <= DHCPc_CFG_DOMAIN_NAME_MAX_LEN) {     /* See Note #3.                                         */
+            for (ix = 0u; ix < opt_val_len; ix++) {
+                name_char = (CPU_CHAR)popt[ix];
+                if (pdomain_name[ix] != name_char) {
+                    pdomain_name[ix]  = name_char;
+                    changed           = DEF_YES;
+                }
+            }
+            name_len   = opt_val_len;
+            name_valid = DEF_YES;
+        }
+
+    } else {                                                    /* ------------- GET FIRST SEARCH DOMAIN -------------- */
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_DOMAIN_SEARCH,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if (popt != (CPU_INT08U *)0) {
+            opt_ix     = 0u;
+            name_valid = DEF_YES;
+            name_end   = DEF_NO;
+
+            while ((name_valid == DEF_YES) &&
+                   (name_end   != DEF_YES)) {
+                if (opt_ix >= opt_val_len) {                    /* Validate label in opt.                               */
+                    name_valid = DEF_NO;
+                    continue;
+                }
+
+                label_len = popt[opt_ix];
+                if ((label_len & DHCP_DOMAIN_LABEL_PTR_MASK) == DHCP_DOMAIN_LABEL_PTR_MASK) {
+                    if ((opt_ix + 1u) >= opt_val_len) {         /* Follow compression ptr (see Note #2).                */
+                        name_valid = DEF_NO;
+                        continue;
+                    }
+                    opt_ix_ptr = ((CPU_INT16U)(label_len & ~DHCP_DOMAIN_LABEL_PTR_MASK) << DEF_OCTET_NBR_BITS) |
+                                  (CPU_INT16U) popt[opt_ix + 1u];
+                    if (opt_ix_ptr >= opt_ix) {
+                        name_valid = DEF_NO;
+                    } else {
+                        opt_ix     = opt_ix_ptr;
+                    }
+
+                } else if (label_len == 0u) {                   /* End of domain.                                       */
+                    name_end = DEF_YES;
+
+                } else if ((label_len > DHCP_DOMAIN_LABEL_LEN_MAX) ||
+                          ((opt_ix + 1u + label_len) > opt_val_len) ||
+                          ((name_len + label_len + ((name_len > 0u) ? 1u : 0u)) > DHCPc_CFG_DOMAIN_NAME_MAX_LEN)) {
+                    name_valid = DEF_NO;                        /* See Note #3.                                         */
+
+                } else {
+                    if (name_len > 0u) {                        /* Sep labels.                                          */
+                        if (pdomain_name[name_len] != DHCP_DOMAIN_LABEL_SEP) {
+                            pdomain_name[name_len]  = DHCP_DOMAIN_LABEL_SEP;
+                            changed                 = DEF_YES;
+                        }
+                        name_len++;
+                    }
+                    for (ix = 0u; ix < label_len; ix++) {       /* Copy label.                                          */
+                        name_char = (CPU_CHAR)popt[opt_ix + 1u + ix];
+                        if (pdomain_name[name_len] != name_char) {
+                            pdomain_name[name_len]  = name_char;
+                            changed                 = DEF_YES;
+                        }
+                        name_len++;
+                    }
+                    opt_ix += 1u + label_len;
+                }
+            }
+        }
+    }
+
+    if (name_valid != DEF_YES) {                                /* Discard invalid domain (see Note #3).                */
+        name_len = 0u;
+    }
+
+    if ((pdomain_name[name_len] != (CPU_CHAR)'\0') ||           /* Terminate domain name.                               */
+        (changed                == DEF_YES)) {
+        pdomain_name[name_len]   = (CPU_CHAR)'\0';
+        changed                  =  DEF_YES;
+    }
+
+    return (changed);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_SrvPush()
+*
+* Description : Push the servers & the domain name of an interface to the server functions.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler(),
+*                                                 DHCPc_RenewRebindStateHandler(),
+*                                                 DHCPc_InformStateHandler(),
+*                                                 DHCPc_StopStateHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler(),
+*               DHCPc_InformStateHandler(),
+*               DHCPc_SrvClr().
+*
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc SERVER FUNCTION DATA TYPE  Note #2'.
+*
+*               (2) A NULL pointer is passed for an empty server table or an empty domain name.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+static  void  DHCPc_SrvPush (DHCPc_IF_INFO  *pif_info)
+{
+    DHCPc_DNS_FNCT   dns_fnct;
+    DHCPc_NTP_FNCT   ntp_fnct;
+    NET_IPv4_ADDR   *paddr_tbl;
+    CPU_CHAR        *pdomain_name;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    dns_fnct = DHCPc_DNS_Fnct;
+    ntp_fnct = DHCPc_NTP_Fnct;
+    CPU_CRITICAL_EXIT();
+
+                                                                /* --------------------- PUSH DNS --------------------- */
+    if (dns_fnct != (DHCPc_DNS_FNCT)0) {
+        paddr_tbl    = (pif_info->DNS_SrvQty > 0u) ? &pif_info->DNS_SrvTbl[0] : (NET_IPv4_ADDR *)0;
+        pdomain_name = (CPU_CHAR *)0;
+#if (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0)
+        if (pif_info->DomainName[0] != (CPU_CHAR)'\0') {        /* See Note #2.                                         */
+            pdomain_name = &pif_info->DomainName[0];
+        }
+#endif
+        dns_fnct(pif_info->IF_Nbr, paddr_tbl, pif_info->DNS_SrvQty, pdomain_name);
+    }
+
+                                                                /* --------------------- PUSH NTP --------------------- */
+    if (ntp_fnct != (DHCPc_NTP_FNCT)0) {
+        paddr_tbl    = (pif_info->NTP_SrvQty > 0u) ? &pif_info->NTP_SrvTbl[0] : (NET_IPv4_ADDR *)0;
+        ntp_fnct(pif_info->IF_Nbr, paddr_tbl, pif_info->NTP_SrvQty);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_SrvClr()
+*
+* Description : Clear the servers & the domain name of an interface.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler(),
+*                                                 DHCPc_StopStateHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_StopStateHandler().
+*
+* Note(s)     : (1) The cleared servers are pushed ONLY if servers or a domain name were previously pushed
+*                   (see 'dhcp-c.h  DHCPc SERVER FUNCTION DATA TYPE  Note #2b').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+static  void  DHCPc_SrvClr (DHCPc_IF_INFO  *pif_info)
+{
+    CPU_BOOLEAN  changed;
+
+
+    changed = DEF_NO;
+
+    if ((pif_info->DNS_SrvQty > 0u) ||
+        (pif_info->NTP_SrvQty > 0u)) {
+        pif_info->DNS_SrvQty = 0u;
+        pif_info->NTP_SrvQty = 0u;
+        changed              = DEF_YES;
+    }
+
+#if (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0)
+    if (pif_info->DomainName[0] != (CPU_CHAR)'\0') {
+        pif_info->DomainName[0]  = (CPU_CHAR)'\0';
+        changed                  =  DEF_YES;
+    }
+#endif
+
+    if (changed == DEF_YES) {                                   /* See Note #1.                                         */
+        DHCPc_SrvPush(pif_info);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_ParamApply()
+*
+* Description : (1) Apply the lease parameters of the last accepted message to the IP stack :
+*
+*                   (a) Apply interface MTU
+*                   (b) Apply ARP cache timeout
+*                   (c) Apply default IP & TCP TTLs
+*
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler(),
+*                                                 DHCPc_RenewRebindStateHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler().
+*
+* Note(s)     : (2) See 'dhcp-c.h  DHCPc PARAMETER APPLY DEFINES  Note #1'.
+*
+*               (3) ONLY the parameters enabled in the interface configuration are applied; a parameter is
+*                   ONLY applied again when its value changes.  A parameter previously applied but missing
+*                   or invalid in the message is reverted.
+*
+*               (4) The interface MTU is saved by the first client of the interface applying a lease MTU,
+*                   & the clients with a lease MTU or a lease ARP cache timeout applied are counted, with
+*                   the global DHCPc lock acquired (see 'dhcp-c.h  DHCPc PARAMETER APPLY DEFINES  Note #2').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+static  void  DHCPc_ParamApply (DHCPc_IF_INFO  *pif_info)
+{
+    DHCPc_MSG    *pmsg;
+    CPU_INT08U   *popt;
+    CPU_INT08U    opt_val_len;
+    CPU_INT08U    param_apply;
+    CPU_INT08U    param_revert;
+    NET_IF_NBR    if_nbr;
+    NET_MTU       mtu;
+    CPU_INT32U    timeout_sec;
+    CPU_BOOLEAN   timeout_set;
+    CPU_INT08U    ttl_ip;
+    CPU_INT08U    ttl_tcp;
+    DHCPc_ERR     err;
+    NET_ERR       err_net;
+
+
+    pmsg         = (DHCPc_MSG *)pif_info->MsgPtr;
+    param_apply  =  pif_info->Cfg.ParamApply;
+    param_revert =  DHCPc_PARAM_APPLY_NONE;
+
+                                                                /* ------------------- APPLY IF MTU ------------------- */
+    if (DEF_BIT_IS_SET(param_apply, DHCPc_PARAM_APPLY_MTU) == DEF_YES) {
+        mtu  = 0u;
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_INTERFACE_MTU,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if ((popt        != (CPU_INT08U *)0) &&
+            (opt_val_len == sizeof(CPU_INT16U))) {
+            NET_UTIL_VAL_COPY_GET_NET_16(&mtu, popt);
+        }
+
+        if (mtu < DHCPc_PARAM_APPLY_MTU_MIN) {                  /* If MTU NOT rx'd or invalid, revert MTU.              */
+            DEF_BIT_SET(param_revert, DHCPc_PARAM_APPLY_MTU);
+
+        } else if ((DEF_BIT_IS_CLR(pif_info->ParamApplied, DHCPc_PARAM_APPLY_MTU) == DEF_YES) ||
+                   (mtu != pif_info->MTU)) {
+            DHCPc_OS_Lock(&err);                                /* See Note #4.                                         */
+            if (err == DHCPc_OS_ERR_NONE) {
+                if_nbr  = pif_info->IF_Nbr;
+                err_net = NET_IF_ERR_NONE;
+                if (DHCPc_MTU_CntTbl[if_nbr] == 0u) {           /* Save IF MTU to restore on revert.                    */
+                    DHCPc_MTU_PrevTbl[if_nbr] = NetIF_MTU_Get(if_nbr, &err_net);
+                }
+                if (err_net == NET_IF_ERR_NONE) {
+                    NetIF_MTU_Set(if_nbr, mtu, &err_net);
+                    if (err_net == NET_IF_ERR_NONE) {
+                        if (DEF_BIT_IS_CLR(pif_info->ParamApplied, DHCPc_PARAM_APPLY_MTU) == DEF_YES) {
+                            DHCPc_MTU_CntTbl[if_nbr]++;
+                        }
+                        pif_info->MTU = mtu;
+                        DEF_BIT_SET(pif_info->ParamApplied, DHCPc_PARAM_APPLY_MTU);
+                    }
+                }
+                DHCPc_OS_Unlock();
+            }
+        }
+    }
+
+#ifdef  NET_ARP_MODULE_EN
+                                                                /* -------------- APPLY ARP CACHE TIMEOUT ------------- */
+    if (DEF_BIT_IS_SET(param_apply, DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT) == DEF_YES) {
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_ARP_CACHE_TIMEOUT,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if ((popt        != (CPU_INT08U *)0) &&
+            (opt_val_len == sizeof(CPU_INT32U))) {
+            NET_UTIL_VAL_COPY_GET_NET_32(&timeout_sec, popt);
+                                                                /* Limit timeout to ARP range (see Note #2).            */
+            if (timeout_sec < NET_ARP_CACHE_TIMEOUT_MIN_SEC) {
+                timeout_sec = NET_ARP_CACHE_TIMEOUT_MIN_SEC;
+            } else if (timeout_sec > NET_ARP_CACHE_TIMEOUT_MAX_SEC) {
+                timeout_sec = NET_ARP_CACHE_TIMEOUT_MAX_SEC;
+            }
+
+            if ((DEF_BIT_IS_CLR(pif_info->ParamApplied, DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT) == DEF_YES) ||
+                (timeout_sec != pif_info->ARP_CacheTimeout_sec)) {
+                DHCPc_OS_Lock(&err);                            /* See Note #4.                                         */
+                if (err == DHCPc_OS_ERR_NONE) {
+                    timeout_set = NetARP_CfgCacheTimeout((CPU_INT16U)timeout_sec);
+                    if (timeout_set == DEF_OK) {
+                        if (DEF_BIT_IS_CLR(pif_info->ParamApplied, DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT) == DEF_YES) {
+                            DHCPc_ARP_CacheTimeoutCnt++;
+                        }
+                        pif_info->ARP_CacheTimeout_sec = (CPU_INT16U)timeout_sec;
+                        DEF_BIT_SET(pif_info->ParamApplied, DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT);
+                    }
+                    DHCPc_OS_Unlock();
+                }
+            }
+
+        } else {
+            DEF_BIT_SET(param_revert, DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT);
+        }
+    }
+#else
+   (void)&timeout_sec;                                          /* Prevent 'variable unused' compiler warnings.         */
+   (void)&timeout_set;
+   (void)&err;
+#endif
+
+                                                                /* ------------------ APPLY DFLT TTLs ----------------- */
+    ttl_ip  = 0u;
+    ttl_tcp = 0u;
+
+    if (DEF_BIT_IS_SET(param_apply, DHCPc_PARAM_APPLY_IP_TTL) == DEF_YES) {
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_DEFAULT_IP_TIME_TO_LIVE,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if ((popt        != (CPU_INT08U *)0) &&
+            (opt_val_len == sizeof(CPU_INT08U))) {
+            ttl_ip = *popt;
+        }
+    }
+
+    if (DEF_BIT_IS_SET(param_apply, DHCPc_PARAM_APPLY_TCP_TTL) == DEF_YES) {
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_TCP_DEFAULT_TTL,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if ((popt        != (CPU_INT08U *)0) &&
+            (opt_val_len == sizeof(CPU_INT08U))) {
+            ttl_tcp = *popt;
+        }
+    }
+
+    DHCPc_ParamTTL_Set(pif_info, ttl_ip, ttl_tcp);
+
+                                                                /* ------------- REVERT MISSING LEASE PARAMS ---------- */
+    DHCPc_ParamRevert(pif_info, param_revert);                  /* See Note #3.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_ParamRevert()
+*
+* Description : Revert lease parameters applied to the IP stack.
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_InitStateHandler(),
+*                                                     DHCPc_RenewRebindStateHandler(),
+*                                                     DHCPc_StopStateHandler().
+*
+*               param_flags     Lease parameters to revert (see 'dhcp-c.h  DHCPc PARAMETER APPLY DEFINES').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_StopStateHandler(),
+*               DHCPc_ParamApply().
+*
+* Note(s)     : (1) ONLY the lease parameters currently applied are reverted.
+*
+*               (2) The interface MTU saved before the first lease applying it is restored ONLY once NO
+*                   other client of the interface has a lease MTU applied, & the ARP cache timeout
+*                   configured by the application ONLY once NO other client has a lease timeout applied
+*                   (see 'dhcp-c.h  DHCPc PARAMETER APPLY DEFINES  Note #2').  Should the global DHCPc lock
+*                   NOT be acquired, the parameter is kept applied & reverted with the next lease parameters
+*                   reverted.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+static  void  DHCPc_ParamRevert (DHCPc_IF_INFO  *pif_info,
+                                 CPU_INT08U      param_flags)
+{
+    CPU_INT08U  param_revert;
+    NET_IF_NBR  if_nbr;
+    DHCPc_ERR   err;
+    NET_ERR     err_net;
+
+
+    param_revert = param_flags & pif_info->ParamApplied;        /* See Note #1.                                         */
+    if (param_revert == DHCPc_PARAM_APPLY_NONE) {
+        return;
+    }
+
+                                                                /* ------------------- REVERT IF MTU ------------------ */
+    if (DEF_BIT_IS_SET(param_revert, DHCPc_PARAM_APPLY_MTU) == DEF_YES) {
+        DHCPc_OS_Lock(&err);                                    /* See Note #2.                                         */
+        if (err == DHCPc_OS_ERR_NONE) {
+            if_nbr = pif_info->IF_Nbr;
+            DHCPc_MTU_CntTbl[if_nbr]--;
+            if (DHCPc_MTU_CntTbl[if_nbr] == 0u) {               /* If NO other lease MTU applied on IF, restore MTU.    */
+                NetIF_MTU_Set(if_nbr, DHCPc_MTU_PrevTbl[if_nbr], &err_net);
+            }
+            DHCPc_OS_Unlock();
+            pif_info->MTU = 0u;
+
+        } else {
+            DEF_BIT_CLR(param_revert, DHCPc_PARAM_APPLY_MTU);
+        }
+    }
+
+#ifdef  NET_ARP_MODULE_EN
+                                                                /* ------------- REVERT ARP CACHE TIMEOUT ------------- */
+    if (DEF_BIT_IS_SET(param_revert, DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT) == DEF_YES) {
+        DHCPc_OS_Lock(&err);                                    /* See Note #2.                                         */
+        if (err == DHCPc_OS_ERR_NONE) {
+            DHCPc_ARP_CacheTimeoutCnt--;
+            if (DHCPc_ARP_CacheTimeoutCnt == 0u) {              /* If NO other lease timeout applied, restore timeout.  */
+               (void)NetARP_CfgCacheTimeout(DHCPc_ARP_CacheTimeoutPrev_sec);
+            }
+            DHCPc_OS_Unlock();
+            pif_info->ARP_CacheTimeout_sec = 0u;
+
+        } else {
+            DEF_BIT_CLR(param_revert, DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT);
+        }
+    }
+#else
+   (void)&err;
+#endif
+
+    DEF_BIT_CLR(pif_info->ParamApplied, (CPU_INT08U)(param_revert & (DHCPc_PARAM_APPLY_MTU |
+                                                                     DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT)));
+
+                                                                /* ----------------- REVERT DFLT TTLs ----------------- */
+    if (DEF_BIT_IS_SET_ANY(param_revert, (DHCPc_PARAM_APPLY_IP_TTL | DHCPc_PARAM_APPLY_TCP_TTL)) == DEF_YES) {
+        DHCPc_ParamTTL_Set(pif_info,
+                           (DEF_BIT_IS_SET(param_revert, DHCPc_PARAM_APPLY_IP_TTL)  == DEF_YES) ? 0u : pif_info->TTL_IP,
+                           (DEF_BIT_IS_SET(param_revert, DHCPc_PARAM_APPLY_TCP_TTL) == DEF_YES) ? 0u : pif_info->TTL_TCP);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_ParamTTL_Set()
+*
+* Description : Apply the default IP & TCP TTLs of an interface through the TTL function.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_ParamApply(),
+*                                                 DHCPc_ParamRevert().
+*
+*               ttl_ip      Default IP  TTL, or 0 for the IP stack default.
+*
+*               ttl_tcp     Default TCP TTL, or 0 for the IP stack default.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_ParamApply(),
+*               DHCPc_ParamRevert().
+*
+* Note(s)     : (1) The TTL function is ONLY called when either TTL changes (see 'dhcp-c.h  DHCPc TTL
+*                   FUNCTION DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+static  void  DHCPc_ParamTTL_Set (DHCPc_IF_INFO  *pif_info,
+                                  CPU_INT08U      ttl_ip,
+                                  CPU_INT08U      ttl_tcp)
+{
+    DHCPc_TTL_FNCT  ttl_fnct;
+    CPU_SR_ALLOC();
+
+
+    if ((ttl_ip  == pif_info->TTL_IP) &&                        /* See Note #1.                                         */
+        (ttl_tcp == pif_info->TTL_TCP)) {
+        return;
+    }
+
+    pif_info->TTL_IP  = ttl_ip;
+    pif_info->TTL_TCP = ttl_tcp;
+
+    DEF_BIT_CLR(pif_info->ParamApplied, (CPU_INT08U)(DHCPc_PARAM_APPLY_IP_TTL | DHCPc_PARAM_APPLY_TCP_TTL));
+    if (ttl_ip != 0u) {
+        DEF_BIT_SET(pif_info->ParamApplied, DHCPc_PARAM_APPLY_IP_TTL);
+    }
+    if (ttl_tcp != 0u) {
+        DEF_BIT_SET(pif_info->ParamApplied, DHCPc_PARAM_APPLY_TCP_TTL);
+    }
+
+    CPU_CRITICAL_ENTER();
+    ttl_fnct = DHCPc_TTL_Fnct;
+    CPU_CRITICAL_EXIT();
+
+    if (ttl_fnct != (DHCPc_TTL_FNCT)0) {
+        ttl_fnct(pif_info->IF_Nbr, ttl_ip, ttl_tcp);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_RelayInfoSet()
+*
+* Description : Record the relay agent path of a received reply into the client's relay information.
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument checked in DHCPc_RxReply().
+*
+*               pmsg_buf        Pointer to received DHCP message buffer.
+*               --------        Argument checked in DHCPc_RxReply().
+*
+*               msg_len         Length of the received DHCP message (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_RxReply().
+*
+* Note(s)     : (1) The relay information is read by DHCPc_ClientRelayInfoGet() from the application's
+*                   context & is hence written with the interface lock acquired, so that a consistent
+*                   record is returned.  The reply is parsed before the lock is acquired.
+*
+*                   The relay information is NOT updated if the interface lock can NOT be acquired.
+*
+*               (2) See 'dhcp-c.h  DHCPc RELAY INFORMATION DATA TYPE  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+static  void  DHCPc_RelayInfoSet (DHCPc_IF_INFO  *pif_info,
+                                  CPU_INT08U     *pmsg_buf,
+                                  CPU_INT16U      msg_len)
+{
+    DHCP_MSG_HDR      *pmsg_hdr;
+    DHCPc_RELAY_INFO  *prelay_info;
+    NET_IPv4_ADDR      addr_relay;
+#if (DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN > 0)
+    CPU_INT08U        *popt;
+    CPU_INT08U         opt_val_len;
+#endif
+    DHCPc_ERR          err;
+
+
+    prelay_info = &pif_info->Relay;
+    pmsg_hdr    = (DHCP_MSG_HDR *)pmsg_buf;
+                                                                /* ---------------- GET RELAY AGENT ADDR -------------- */
+    NET_UTIL_VAL_COPY_GET_NET_32(&addr_relay, &pmsg_hdr->giaddr);
+
+#if (DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN > 0)
+                                                                /* ---------------- GET RELAY AGENT INFO -------------- */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_RELAY_AGENT_INFORMATION,
+                           (CPU_INT08U   *) pmsg_buf,
+                           (CPU_INT16U    ) msg_len,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt == (CPU_INT08U *)0) {                              /* If opt NOT echoed, ...                               */
+        opt_val_len = 0u;                                       /* ... clr relay agent info.                            */
+
+    } else if (opt_val_len > DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN) {
+        opt_val_len = DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN;       /* Truncate relay agent info (see Note #2).             */
+    }
+#else
+   (void)&msg_len;                                              /* Prevent 'variable unused' compiler warning.          */
+#endif
+
+                                                                /* ------------------ ACQUIRE IF LOCK ----------------- */
+    DHCPc_OS_IF_Lock(pif_info->ID, &err);                       /* See Note #1.                                         */
+    if (err != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ----------------- SET RELAY INFO ------------------- */
+    prelay_info->AddrRelay = addr_relay;                        /* See Note #2.                                         */
+
+    if (addr_relay != NET_IPv4_ADDR_NONE) {
+        prelay_info->RxRelayedCtr++;
+    } else {
+        prelay_info->RxDirectCtr++;
+    }
+
+#if (DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN > 0)
+    if (opt_val_len > 0u) {
+        Mem_Copy((void     *)&prelay_info->AgentInfo[0],
+                 (void     *) popt,
+                 (CPU_SIZE_T) opt_val_len);
+    }
+    prelay_info->AgentInfoLen = opt_val_len;
+#endif
+
+                                                                /* ------------------ RELEASE IF LOCK ----------------- */
+    DHCPc_OS_IF_Unlock(pif_info->ID);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_LeaseTimeCalc()
+*
+* Description : (1) Calculate the lease time & renewing/rebinding times for last accepted lease :
+*
+*                   (a) Get           lease time from ACK message
+*                   (b) Get/calculate times T1 & T2
+*                   (c) Calculate     lease, T1 & T2 deadlines
+*                   (d) Configure     timer
+*
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_InitStateHandler(),
+*                                                     DHCPc_RenewRebindStateHandler().
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Lease time successfully calculated.
+*                               DHCPc_ERR_TMR_CFG               Configuration timer error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler().
+*
+* Note(s)     : (2) From RFC #2131, section 4.4.1, "the client records the lease expiration time as the
+*                   sum of the time at which the original request was sent and the duration of the
+*                   lease from the DHCPACK message".
+*
+*                   The lease, T1 & T2 deadlines are hence ALL anchored on the transmit time of the last
+*                   REQUEST message (see 'DHCPc_TxMsgPrepare()'), & are NOT affected by the time spent
+*                   until the timer is configured or handled.
+*
+*               (3) A lease time larger than DHCP_LEASE_TIME_MAX_SEC is handled as an infinite lease.
+*                   T1 & T2 times are limited to the lease time.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_LeaseTimeCalc (DHCPc_IF_INFO  *pif_info,
+                                   DHCPc_ERR      *perr)
+{
+    DHCPc_MSG   *pmsg;
+    CPU_INT08U  *popt;
+    CPU_INT08U   opt_val_len;
+    CPU_INT32U   time_lease;
+    CPU_INT32U   time_t1;
+    CPU_INT32U   time_t2;
+    CPU_INT32U   time_start_sec;
+
+
+    time_lease = DHCP_LEASE_INFINITE;
+
+                                                                /* ------------- GET LEASE TIME FROM ACK -------------- */
+    pmsg = pif_info->MsgPtr;
+                                                                /* Get lease time.                                      */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_IP_ADDRESS_LEASE_TIME,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_GET_NET_32(&time_lease, popt);
+    }
+
+                                                                /* If lease time infinite (see Note #3), ...            */
+    if ((time_lease == DHCP_LEASE_INFINITE    ) ||
+        (time_lease >  DHCP_LEASE_TIME_MAX_SEC)) {
+        pif_info->LeaseDeadline_sec = DHCP_LEASE_INFINITE;
+        pif_info->T1_Deadline_sec   = DHCP_LEASE_INFINITE;
+        pif_info->T2_Deadline_sec   = DHCP_LEASE_INFINITE;
+
+       *perr = DHCPc_ERR_NONE;                                  /* ... NO tmr to set.                                   */
+        return;
+    }
+
+                                                                /* Get renewal time.                                    */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_RENEWAL_TIME_VALUE,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_GET_NET_32(&time_t1, popt);
+
+    } else {
+        time_t1 = (CPU_INT32U)(time_lease * DHCP_T1_LEASE_FRACTION);
+    }
+
+                                                                /* Get rebinding time.                                  */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_REBINDING_TIME_VALUE,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_GET_NET_32(&time_t2, popt);
+
+    } else {
+        time_t2 = (CPU_INT32U)(time_lease * DHCP_T2_LEASE_FRACTION);
+    }
+
+
+    if (time_t2 > time_lease) {                                 /* Limit T1 & T2 to lease time (see Note #3).           */
+        time_t2 = time_lease;
+    }
+    if (time_t1 > time_t2) {
+        time_t1 = time_t2;
+    }
+
+
+                                                                /* --------------- CALC LEASE DEADLINES --------------- */
+    time_start_sec = pif_info->NegoStartTime;                   /* See Note #2.                                         */
+
+    pif_info->T1_Deadline_sec   = time_start_sec + time_t1;
+    pif_info->T2_Deadline_sec   = time_start_sec + time_t2;
+    pif_info->LeaseDeadline_sec = time_start_sec + time_lease;
+
+
+                                                                /* --------------------- CFG TMR ---------------------- */
+    DHCPc_TmrCfg((DHCPc_IF_INFO *)pif_info,
+                 (DHCPc_COMM_MSG )DHCPc_COMM_MSG_T1_EXPIRED,
+                 (CPU_INT32U     )pif_info->T1_Deadline_sec,
+                 (DHCPc_ERR     *)perr);
+
+    if (*perr != DHCPc_ERR_NONE) {
+        *perr  = DHCPc_ERR_TMR_CFG;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_LeaseTimeUpdate()
+*
+* Description : (1) Configure the next renewing/rebinding timer following lease extension failure :
+*
+*                   (a) Get       current time
+*                   (b) Determine timer deadline & message
+*                   (c) Configure timer
+*
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_RenewRebindStateHandler().
+*
+*               exp_tmr_msg     Message for expired timer.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Lease time successfully updated & timer set.
+*                               DHCPc_ERR_TMR_INVALID_MSG       Invalid expiration timer message.
+*                               DHCPc_ERR_TMR_CFG               Configuration timer error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_RenewRebindStateHandler(),
+*               DHCPc_IPv6_RenewStateHandler().
+*
+* Note(s)     : (2) From RFC #2131, section 'Reacquisition and expiration', "In both RENEWING and
+*                   REBINDING states, if the client receives no response to its DHCPREQUEST message, the
+*                   client SHOULD wait one-half of the remaining time until T2 (in RENEWING state) and
+*                   one-half of the remaining lease time (in REBINDING state), down to a minimum of 60
+*                   seconds, before retransmitting the DHCPREQUEST message".
+*
+*                   However, in order to prevent a miss on one of the followed times (T1, T2, or the
+*                   lease itself), this implementation waits down to a remaining time of 5 minutes until
+*                   T2 (RENEWING) or the lease time (REBINDING).
+*
+*               (3) Remaining times are calculated from the lease deadlines set by DHCPc_LeaseTimeCalc();
+*                   the deadlines themselves are NEVER updated, so retransmissions do NOT make the T2 or
+*                   lease expiration drift.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_LeaseTimeUpdate (DHCPc_IF_INFO   *pif_info,
+                                     DHCPc_COMM_MSG   exp_tmr_msg,
+                                     DHCPc_ERR       *perr)
+{
+    CPU_INT32U      time_cur_sec;
+    CPU_INT32U      time_remain_sec;
+    CPU_INT32U      tmr_deadline_sec;
+    DHCPc_COMM_MSG  tmr_msg;
+
+
+    time_cur_sec = DHCPc_TimeGet_sec();
+
+                                                                /* ----------- DETERMINE TMR DEADLINE & MSG ----------- */
+    switch (exp_tmr_msg) {                                      /* See Notes #2 & #3.                                   */
+        case DHCPc_COMM_MSG_T1_EXPIRED:
+             time_remain_sec = DHCPc_TimeRemainGet_sec(time_cur_sec, pif_info->T2_Deadline_sec);
+             if (time_remain_sec > (2 * DHCP_MIN_RETX_TIME_S)) {
+                 tmr_deadline_sec = time_cur_sec + (time_remain_sec / 2);
+                 tmr_msg          = DHCPc_COMM_MSG_T1_EXPIRED;
+
+             } else {
+                 tmr_deadline_sec = pif_info->T2_Deadline_sec;
+                 tmr_msg          = DHCPc_COMM_MSG_T2_EXPIRED;
+             }
+             break;
+
+
+        case DHCPc_COMM_MSG_T2_EXPIRED:
+             time_remain_sec = DHCPc_TimeRemainGet_sec(time_cur_sec, pif_info->LeaseDeadline_sec);
+             if (time_remain_sec > (2 * DHCP_MIN_RETX_TIME_S)) {
+                 tmr_deadline_sec = time_cur_sec + (time_remain_sec / 2);
+                 tmr_msg          = DHCPc_COMM_MSG_T2_EXPIRED;
+
+             } else {
+                 tmr_deadline_sec = pif_info->LeaseDeadline_sec;
+                 tmr_msg          = DHCPc_COMM_MSG_LEASE_EXPIRED;
+             }
+             break;
+
+
+        default:
+            *perr = DHCPc_ERR_TMR_INVALID_MSG;
+             return;
+    }
+
+                                                                /* --------------------- CFG TMR ---------------------- */
+    DHCPc_TmrCfg(pif_info, tmr_msg, tmr_deadline_sec, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        *perr  = DHCPc_ERR_TMR_CFG;
+    }
+}
+
+
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                     DHCPc_ForceRenewNonceGet()
+*
+* Description : Get the FORCERENEW nonce from the last DHCPACK message received from the server.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_InitStateHandler(),
+*                                                 DHCPc_RenewRebindStateHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_RenewRebindStateHandler().
+*
+* Note(s)     : (1) A client that did NOT receive a nonce from its server can NOT authenticate, & hence
+*                   MUST discard, any FORCERENEW message (see RFC #6704).
+*
+*               (2) When the lease is renewed/rebound, the server might NOT send the nonce again; the
+*                   nonce received in a previous DHCPACK is then kept.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ForceRenewNonceGet (DHCPc_IF_INFO  *pif_info)
+{
+    DHCPc_MSG   *pmsg;
+    CPU_INT08U  *popt;
+    CPU_INT08U   opt_val_len;
+
+
+    pmsg = pif_info->MsgPtr;
+                                                                /* Get auth opt.                                        */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_AUTHENTICATION,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+
+    if ((popt                             != (CPU_INT08U *)0)                      &&
+        (opt_val_len                      ==  DHCP_AUTH_OPT_LEN)                   &&
+        (popt[DHCP_AUTH_OFFSET_PROTOCOL]  ==  DHCP_AUTH_PROTOCOL_FORCERENEW_NONCE) &&
+        (popt[DHCP_AUTH_OFFSET_ALGORITHM] ==  DHCP_AUTH_ALGORITHM_HMAC_MD5)        &&
+        (popt[DHCP_AUTH_OFFSET_RDM]       ==  DHCP_AUTH_RDM_MONOTONIC)             &&
+        (popt[DHCP_AUTH_OFFSET_INFO_TYPE] ==  DHCP_AUTH_INFO_TYPE_NONCE)) {
+
+        Mem_Copy((void     *)&pif_info->ForceRenewNonce[0],     /* Save nonce ...                                       */
+                 (void     *)&popt[DHCP_AUTH_OFFSET_INFO],
+                 (CPU_SIZE_T) DHCP_AUTH_NONCE_LEN);
+
+        Mem_Copy((void     *)&pif_info->ForceRenewReplay[0],    /* ... & replay detection val.                          */
+                 (void     *)&popt[DHCP_AUTH_OFFSET_REPLAY],
+                 (CPU_SIZE_T) DHCP_AUTH_REPLAY_LEN);
+
+        pif_info->ForceRenewNonceValid = DEF_YES;
+
+    } else if ((pif_info->ClientState != DHCP_STATE_RENEWING) &&
+               (pif_info->ClientState != DHCP_STATE_REBINDING)) {
+        pif_info->ForceRenewNonceValid = DEF_NO;                /* Keep nonce ONLY on renew/rebind (see Note #2).       */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    DHCPc_ForceRenewListenStart()
+*
+* Description : Open a FORCERENEW listen socket for every interface in the BOUND state.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgRxHandler().
+*
+* Note(s)     : (1) The listen socket is opened ONLY if a nonce was received from the server (see
+*                   'DHCPc_ForceRenewNonceGet()  Note #1').
+*
+*               (2) The listen socket is bound to the address currently configured on the interface, since
+*                   the server unicasts the FORCERENEW message to the client.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ForceRenewListenStart (void)
+{
+    DHCPc_IF_INFO  *pif_info;
+    NET_IPv4_ADDR   addr_host;
+
+
+    pif_info = DHCPc_InfoListHead;
+    while (pif_info != (DHCPc_IF_INFO *)0) {
+                                                                /* If IF bound with nonce (see Note #1) ...             */
+        if ((pif_info->ClientState          == DHCP_STATE_BOUND) &&
+            (pif_info->ForceRenewNonceValid == DEF_YES)          &&
+            (pif_info->ForceRenewSockID     == NET_SOCK_BSD_ERR_OPEN)) {
+
+                                                                /* ... open listen sock (see Note #2).                  */
+            addr_host = (NET_IPv4_ADDR)NET_UTIL_HOST_TO_NET_32(pif_info->AddrCfgd);
+            if (addr_host != NET_IPv4_ADDR_NONE) {
+                pif_info->ForceRenewSockID = DHCPc_InitSock(addr_host, pif_info->IF_Nbr);
+            }
+        }
+
+        pif_info = pif_info->NextPtr;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    DHCPc_ForceRenewListenStop()
+*
+* Description : Close the FORCERENEW listen socket of every interface.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_MsgRxHandler().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ForceRenewListenStop (void)
+{
+    DHCPc_IF_INFO  *pif_info;
+    NET_ERR         err_net;
+
+
+    pif_info = DHCPc_InfoListHead;
+    while (pif_info != (DHCPc_IF_INFO *)0) {
+        if (pif_info->ForceRenewSockID != NET_SOCK_BSD_ERR_OPEN) {
+            NetApp_SockClose((NET_SOCK_ID ) pif_info->ForceRenewSockID,
+                             (CPU_INT32U  ) 0,
+                             (NET_ERR    *)&err_net);
+
+            pif_info->ForceRenewSockID = NET_SOCK_BSD_ERR_OPEN;
+        }
+
+        pif_info = pif_info->NextPtr;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_ForceRenewChk()
+*
+* Description : (1) Check the FORCERENEW listen sockets for a valid FORCERENEW message :
+*
+*                   (a) Get message buffer
+*                   (b) For every listening interface :
+*                       (1) Receive pending message(s), without blocking
+*                       (2) Validate received message(s)
+*                       (3) Post FORCERENEW message to DHCPc Task
+*                   (c) Free message buffer
+*
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_TmrTaskHandler().
+*
+* Note(s)     : (2) The listen socket of an interface is checked ONLY while its lease timer is pending.
+*                   Once the lease timer has expired, the client is about to renew/rebind its lease
+*                   anyway.
+*
+*               (3) Once a valid FORCERENEW message has been received, the listen socket is closed so
+*                   that NO other FORCERENEW message gets posted before the first one is handled.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_ForceRenewChk (void)
+{
+    DHCPc_IF_INFO      *pif_info;
+    DHCPc_MSG          *pmsg;
+    DHCPc_COMM         *pcomm;
+    NET_SOCK_ADDR       addr_remote;
+    NET_SOCK_ADDR_LEN   addr_remote_size;
+    CPU_INT16U          rx_len;
+    CPU_BOOLEAN         valid;
+    DHCPc_ERR           err;
+    NET_ERR             err_net;
+
+
+                                                                /* ------------------- GET MSG BUF -------------------- */
+    pmsg = DHCPc_MsgGet(&err);
+    if (err != DHCPc_ERR_NONE) {
+        return;
+    }
+
+                                                                /* -------------- CHK IF'S LISTEN SOCK ---------------- */
+    pif_info = DHCPc_InfoListHead;
+    while (pif_info != (DHCPc_IF_INFO *)0) {
+        if ((pif_info->ForceRenewSockID != NET_SOCK_BSD_ERR_OPEN) &&
+            (pif_info->Tmr              != (DHCPc_TMR *)0)) {   /* See Note #2.                                         */
+
+            valid = DEF_NO;
+            do {                                                /* Rx pending msg(s) until valid FORCERENEW rx'd.       */
+                addr_remote_size = sizeof(addr_remote);
+
+                rx_len = NetApp_SockRx((NET_SOCK_ID        ) pif_info->ForceRenewSockID,
+                                       (void              *)&pmsg->MsgBuf[0],
+                                       (CPU_INT16U         ) DHCP_MSG_BUF_SIZE,
+                                       (CPU_INT16U         ) 0,
+#if (NET_VERSION >= 21200u)
+                                       (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_RX_NO_BLOCK,
+#else
+                                       (CPU_INT16S         ) NET_SOCK_FLAG_RX_NO_BLOCK,
+#endif
+                                       (NET_SOCK_ADDR     *)&addr_remote,
+                                       (NET_SOCK_ADDR_LEN *)&addr_remote_size,
+                                       (CPU_INT16U         ) 0,
+                                       (CPU_INT32U         ) 0,
+                                       (CPU_INT32U         ) 0,
+                                       (NET_ERR           *)&err_net);
+
+                if (err_net == NET_APP_ERR_NONE) {
+                    valid = DHCPc_ForceRenewValidate(pif_info, &pmsg->MsgBuf[0], rx_len);
+                }
+            } while ((err_net == NET_APP_ERR_NONE) &&
+                     (valid   != DEF_YES));
+
+            if (valid == DEF_YES) {                             /* If valid FORCERENEW rx'd, ...                        */
+                pcomm = DHCPc_CommGet((DHCPc_IF_INFO *) pif_info,
+                                      (DHCPc_COMM_MSG ) DHCPc_COMM_MSG_FORCERENEW,
+                                      (DHCPc_ERR     *)&err);
+                if (err == DHCPc_ERR_NONE) {
+                                                                /* ... close listen sock (see Note #3) ...              */
+                    NetApp_SockClose((NET_SOCK_ID ) pif_info->ForceRenewSockID,
+                                     (CPU_INT32U  ) 0,
+                                     (NET_ERR    *)&err_net);
+                    pif_info->ForceRenewSockID = NET_SOCK_BSD_ERR_OPEN;
+
+                                                                /* ... & post FORCERENEW to DHCP client task.           */
+                    DHCPc_OS_MsgPost((void      *) pcomm,
+                                     (DHCPc_ERR *)&err);
+                    if (err != DHCPc_OS_ERR_NONE) {
+                        DHCPc_CommFree(pcomm);
+                    }
+                }
+            }
+        }
+
+        pif_info = pif_info->NextPtr;
+    }
+
+                                                                /* ------------------- FREE MSG BUF ------------------- */
+    DHCPc_MsgFree(pmsg);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     DHCPc_ForceRenewValidate()
+*
+* Description : (1) Validate a received FORCERENEW message :
+*
+*                   (a) Validate message header
+*                   (b) Validate message type & server identifier
+*                   (c) Validate authentication option
+*                   (d) Validate replay detection value
+*                   (e) Validate HMAC-MD5 digest
+*
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_ForceRenewChk().
+*
+*               pmsg_buf    Pointer to received message buffer.
+*               --------    Argument validated in DHCPc_ForceRenewChk().
+*
+*               msg_len     Length of the received message (in octets).
+*
+* Return(s)   : DEF_YES, if the message is a valid & authenticated FORCERENEW message.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_ForceRenewChk().
+*
+* Note(s)     : (2) See 'DHCPc_AddrHW_Get()  Note #1'.
+*
+*               (3) The replay detection value of the message MUST be strictly greater than the last value
+*                   received from the server (monotonically increasing counter).
+*
+*               (4) The HMAC-MD5 digest is computed over the whole message, with the digest field of the
+*                   'Authentication' option set to zero, & keyed with the nonce received in the DHCPACK.
+*                   The received message buffer is hence modified.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DHCPc_ForceRenewValidate (DHCPc_IF_INFO  *pif_info,
+                                               CPU_INT08U     *pmsg_buf,
+                                               CPU_INT16U      msg_len)
+{
+    DHCP_MSG_HDR   *pmsg_hdr;
+    CPU_INT08U     *popt;
+    CPU_INT08U      opt_val_len;
+    CPU_INT08U      addr_hw_len;
+    CPU_INT08U      addr_hw[DHCPc_HW_ADDR_LEN_MAX];
+    CPU_INT08U      digest_rx[DHCP_AUTH_HMAC_MD5_LEN];
+    CPU_INT08U      digest_calc[DHCP_AUTH_HMAC_MD5_LEN];
+    NET_IPv4_ADDR   addr_server;
+    CPU_BOOLEAN     match;
+    CPU_INT08U      i;
+    DHCPc_ERR       err;
+
+
+    if (pif_info->ForceRenewNonceValid != DEF_YES) {            /* If NO nonce rx'd, ...                                */
+        return (DEF_NO);                                        /* ... rtn (see 'DHCPc_ForceRenewNonceGet()  Note #1'). */
+    }
+
+    if (msg_len < DHCP_MSG_RX_MIN_LEN) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------------------- VALIDATE HDR ------------------- */
+    pmsg_hdr = (DHCP_MSG_HDR *)pmsg_buf;
+    if (pmsg_hdr->op != DHCP_OP_REPLY) {                        /* Validate opcode.                                     */
+        return (DEF_NO);
+    }
+
+                                                                /* Validate HW addr (see Note #2).                      */
+    addr_hw_len = DHCPc_AddrHW_Get(pif_info->IF_Nbr, &addr_hw[0], &err);
+    if (err != DHCPc_ERR_NONE) {
+        return (DEF_NO);
+    }
+
+    match = Mem_Cmp((void     *)&pmsg_hdr->chaddr[0],
+                    (void     *)&addr_hw[0],
+                    (CPU_SIZE_T) addr_hw_len);
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------------ VALIDATE MSG TYPE & SERVER ------------ */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_DHCP_MESSAGE_TYPE,
+                           (CPU_INT08U   *) pmsg_buf,
+                           (CPU_INT16U    ) msg_len,
+                           (CPU_INT08U   *)&opt_val_len);
+    if ((popt  == (CPU_INT08U *)0) ||
+        (*popt !=  DHCP_MSG_FORCERENEW)) {
+        return (DEF_NO);
+    }
+
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SERVER_IDENTIFIER,
+                           (CPU_INT08U   *) pmsg_buf,
+                           (CPU_INT16U    ) msg_len,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt == (CPU_INT08U *)0) {
+        return (DEF_NO);
+    }
+
+    NET_UTIL_VAL_COPY_32(&addr_server, popt);
+    if (addr_server != pif_info->ServerID) {
+        return (DEF_NO);
+    }
+
+                                                                /* ----------------- VALIDATE AUTH OPT ---------------- */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_AUTHENTICATION,
+                           (CPU_INT08U   *) pmsg_buf,
+                           (CPU_INT16U    ) msg_len,
+                           (CPU_INT08U   *)&opt_val_len);
+
+    if ((popt                             == (CPU_INT08U *)0)                      ||
+        (opt_val_len                      !=  DHCP_AUTH_OPT_LEN)                   ||
+        (popt[DHCP_AUTH_OFFSET_PROTOCOL]  !=  DHCP_AUTH_PROTOCOL_FORCERENEW_NONCE) ||
+        (popt[DHCP_AUTH_OFFSET_ALGORITHM] !=  DHCP_AUTH_ALGORITHM_HMAC_MD5)        ||
+        (popt[DHCP_AUTH_OFFSET_RDM]       !=  DHCP_AUTH_RDM_MONOTONIC)             ||
+        (popt[DHCP_AUTH_OFFSET_INFO_TYPE] !=  DHCP_AUTH_INFO_TYPE_HMAC_MD5)) {
+        return (DEF_NO);
+    }
+
+                                                                /* --------------- VALIDATE REPLAY VAL ---------------- */
+    i = 0u;                                                     /* Cmp replay val as big-endian nbr (see Note #3).      */
+    while ((i                                   <  DHCP_AUTH_REPLAY_LEN) &&
+           (popt[DHCP_AUTH_OFFSET_REPLAY + i] == pif_info->ForceRenewReplay[i])) {
+        i++;
+    }
+
+    if ((i                                  >= DHCP_AUTH_REPLAY_LEN) ||
+        (popt[DHCP_AUTH_OFFSET_REPLAY + i] <  pif_info->ForceRenewReplay[i])) {
+        return (DEF_NO);
+    }
+
+                                                                /* ----------------- VALIDATE DIGEST ------------------ */
+    Mem_Copy((void     *)&digest_rx[0],                         /* Get rx'd digest ...                                  */
+             (void     *)&popt[DHCP_AUTH_OFFSET_INFO],
+             (CPU_SIZE_T) DHCP_AUTH_HMAC_MD5_LEN);
+
+    Mem_Clr((void     *)&popt[DHCP_AUTH_OFFSET_INFO],           /* ... & clr it in msg (see Note #4).                   */
+            (CPU_SIZE_T) DHCP_AUTH_HMAC_MD5_LEN);
+
+    DHCPc_HMAC_MD5((CPU_INT08U *)&pif_info->ForceRenewNonce[0],
+                   (CPU_INT08U  ) DHCP_AUTH_NONCE_LEN,
+                   (CPU_INT08U *) pmsg_buf,
+                   (CPU_INT16U  ) msg_len,
+                   (CPU_INT08U *)&digest_calc[0]);
+
+    match = Mem_Cmp((void     *)&digest_rx[0],
+                    (void     *)&digest_calc[0],
+                    (CPU_SIZE_T) DHCP_AUTH_HMAC_MD5_LEN);
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+
+                                                                /* Save replay val.                                     */
+    Mem_Copy((void     *)&pif_info->ForceRenewReplay[0],
+             (void     *)&popt[DHCP_AUTH_OFFSET_REPLAY],
+             (CPU_SIZE_T) DHCP_AUTH_REPLAY_LEN);
+
+    return (DEF_YES);
+}
+#endif
+
+
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)
+/*
+*********************************************************************************************************
+*                                       DHCPc_EmulClientStart()
+*
+* Description : Start a virtual client & transmit its first DISCOVER message.
+*
+* Argument(s) : sock_id         Socket ID of the emulation socket.
+*
+*               ix              Index of a free virtual client in the emulation table.
+*
+*               addr_hw_tag     Octet identifying the emulating host in the synthetic hardware addresses.
+*
+*               pstats          Pointer to emulation statistics.
+*               ------          Argument validated in DHCPc_EmulRun().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_EmulRun().
+*
+* Note(s)     : (1) The synthetic hardware address is a locally administered unicast address holding the
+*                   emulating host's tag & the sequence number of the virtual client.  The transaction ID
+*                   holds the index of the client (see 'dhcp-c.h  DHCPc EMULATION DEFINES  Note #2').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_EmulClientStart (NET_SOCK_ID        sock_id,
+                                     CPU_INT16U         ix,
+                                     CPU_INT08U         addr_hw_tag,
+                                     DHCPc_EMUL_STATS  *pstats)
+{
+    DHCPc_EMUL_CLIENT  *pclient;
+    CPU_INT32U          seq;
+    DHCPc_ERR           err;
+
+
+    pclient = &DHCPc_EmulClientTbl[ix];
+    seq     =  pstats->ClientStartCtr;
+                                                                /* Build synthetic hw addr (see Note #1).               */
+    pclient->AddrHW[0] =  DHCPc_EMUL_ADDR_HW_LOCAL;
+    pclient->AddrHW[1] =  addr_hw_tag;
+    pclient->AddrHW[2] = (CPU_INT08U)(seq >> (3u * DEF_OCTET_NBR_BITS));
+    pclient->AddrHW[3] = (CPU_INT08U)(seq >> (2u * DEF_OCTET_NBR_BITS));
+    pclient->AddrHW[4] = (CPU_INT08U)(seq >> (1u * DEF_OCTET_NBR_BITS));
+    pclient->AddrHW[5] = (CPU_INT08U)(seq);
+
+    pclient->TransactionID  = (seq << DHCPc_EMUL_XID_SEQ_SHIFT) | ix;
+    pclient->ServerID       =  NET_IPv4_ADDR_NONE;
+    pclient->AddrOffered    =  NET_IPv4_ADDR_NONE;
+    pclient->StartTime_tick =  DHCPc_OS_TimeGet_tick();
+    pclient->AcqStartTime   =  DHCPc_TimeGet_sec();
+    pclient->RetryCnt       =  0u;
+    pclient->ClientState    =  DHCP_STATE_INIT;
+
+    DHCPc_EmulClientCnt++;
+    pstats->ClientStartCtr++;
+
+    DHCPc_EmulTx(sock_id, pclient, DHCP_MSG_DISCOVER, pstats, &err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_EmulIF_InfoSet()
+*
+* Description : Load the shared interface information with the state of a virtual client.
+*
+* Argument(s) : pclient     Pointer to virtual client.
+*               -------     Argument validated in DHCPc_EmulTx(),
+*                                                 DHCPc_EmulRx().
+*
+* Return(s)   : Pointer to shared interface information.
+*
+* Caller(s)   : DHCPc_EmulTx(),
+*               DHCPc_EmulRx().
+*
+* Note(s)     : (1) See 'DHCPc_EmulRun()  Note #3'.
+*
+*               (2) The client identifier is also replaced in the transmit option template, at the offset of
+*                   its value recorded when the template was built (see 'DHCPc_TxOptTmplBuild()  Note #2').
+*                   The hardware address follows the hardware type octet of the client identifier.
+*
+*               (3) The 'secs' field of a virtual client's messages is counted from its own first DISCOVER
+*                   (see 'DHCPc_TxMsgPrepare()  Note #13').
+*********************************************************************************************************
+*/
+
+static  DHCPc_IF_INFO  *DHCPc_EmulIF_InfoSet (DHCPc_EMUL_CLIENT  *pclient)
+{
+    DHCPc_IF_INFO  *pif_info;
+    DHCP_MSG_HDR   *pmsg_hdr;
+
+
+    pif_info                    = &DHCPc_EmulIF_Info;
+    pif_info->ClientState       =  pclient->ClientState;
+    pif_info->TransactionID     =  pclient->TransactionID;
+    pif_info->TransactionID_Req =  pclient->TransactionID;
+    pif_info->ServerID          =  pclient->ServerID;
+    pif_info->AcqStartTime      =  pclient->AcqStartTime;       /* See Note #3.                                         */
+
+    Mem_Copy((void     *)&pif_info->Cfg.ClientID[1],            /* Client id : hw type + hw addr.                       */
+             (void     *)&pclient->AddrHW[0],
+             (CPU_SIZE_T) NET_IF_ETHER_ADDR_SIZE);
+
+                                                                /* Client id in tx opt tmpl (see Note #2).              */
+    Mem_Copy((void     *)&pif_info->TxOptTmpl[pif_info->TxOptTmplClientID_Ix + 1u],
+             (void     *)&pclient->AddrHW[0],
+             (CPU_SIZE_T) NET_IF_ETHER_ADDR_SIZE);
+
+                                                                /* Set offered addr, for REQUEST & RELEASE msgs.        */
+    pmsg_hdr = (DHCP_MSG_HDR *)&DHCPc_EmulMsgLast.MsgBuf[0];    /* See 'DHCPc_EmulRun()  Note #3'.                      */
+    NET_UTIL_VAL_COPY_32(&pmsg_hdr->yiaddr, &pclient->AddrOffered);
+
+    return (pif_info);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_EmulTx()
+*
+* Description : Prepare & transmit a message for a virtual client.
+*
+* Argument(s) : sock_id     Socket ID of the emulation socket.
+*
+*               pclient     Pointer to virtual client.
+*               -------     Argument validated in DHCPc_EmulClientStart(),
+*                                                 DHCPc_EmulRx(),
+*                                                 DHCPc_EmulTmrChk().
+*
+*               msg_type    Type of message to transmit :
+*
+*                               DHCP_MSG_DISCOVER
+*                               DHCP_MSG_REQUEST
+*                               DHCP_MSG_RELEASE
+*
+*               pstats      Pointer to emulation statistics.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Message successfully transmitted.
+*
+*                                                               --- RETURNED BY DHCPc_TxMsgPrepare() : ---
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*
+*                                                               -------- RETURNED BY DHCPc_Tx() : --------
+*                               DHCPc_ERR_TX                    Transmit error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_EmulClientStart(),
+*               DHCPc_EmulRx(),
+*               DHCPc_EmulTmrChk().
+*
+* Note(s)     : (1) The transmit time is updated even if the message could NOT be transmitted, so that the
+*                   message is retransmitted on timeout.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_EmulTx (NET_SOCK_ID         sock_id,
+                            DHCPc_EMUL_CLIENT  *pclient,
+                            DHCPc_MSG_TYPE      msg_type,
+                            DHCPc_EMUL_STATS   *pstats,
+                            DHCPc_ERR          *perr)
+{
+    DHCPc_IF_INFO       *pif_info;
+    CPU_INT16U           msg_len;
+    NET_SOCK_ADDR_IPv4   addr_server;
+    NET_SOCK_ADDR_LEN    addr_server_size;
+
+
+    pclient->TxTime_tick = DHCPc_OS_TimeGet_tick();             /* See Note #1.                                         */
+
+    pif_info = DHCPc_EmulIF_InfoSet(pclient);
+
+                                                                /* ------------------- PREPARE MSG -------------------- */
+    msg_len = DHCPc_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
+                                 (DHCPc_MSG_TYPE ) msg_type,
+                                 (CPU_INT08U    *)&pclient->AddrHW[0],
+                                 (CPU_INT08U     ) NET_IF_ETHER_ADDR_SIZE,
+                                 (CPU_INT08U    *)&DHCPc_EmulMsgTx.MsgBuf[0],
+                                 (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
+                                 (DHCPc_ERR     *) perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ---------------------- TX MSG ---------------------- */
+    addr_server_size = sizeof(addr_server);
+    Mem_Clr((void     *)&addr_server,
+            (CPU_SIZE_T) addr_server_size);
+    addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+    addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_SERVER);
+
+    if (msg_type == DHCP_MSG_RELEASE) {                         /* Unicast RELEASE to server, ...                       */
+        addr_server.Addr   = pclient->ServerID;
+    } else {                                                    /* ... broadcast other msgs.                            */
+        addr_server.Addr   = NET_UTIL_HOST_TO_NET_32(NET_IPv4_ADDR_BROADCAST);
+    }
+
+    DHCPc_Tx((NET_SOCK_ID      ) sock_id,
+             (void            *)&DHCPc_EmulMsgTx.MsgBuf[0],
+             (CPU_INT16U       ) msg_len,
+             (NET_SOCK_ADDR   *)&addr_server,
+             (NET_SOCK_ADDR_LEN) addr_server_size,
+             (DHCPc_ERR       *) perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+    pstats->TxCtr++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_EmulRx()
+*
+* Description : (1) Receive & dispatch a server reply to its virtual client :
+*
+*                   (a) Receive  message, if any
+*                   (b) Get      virtual client from transaction ID
+*                   (c) Validate message for the virtual client
+*                   (d) Advance  virtual client's transaction
+*
+*
+* Argument(s) : sock_id     Socket ID of the emulation socket.
+*
+*               pcfg        Pointer to emulation configuration.
+*               ----        Argument validated in DHCPc_EmulRun().
+*
+*               pstats      Pointer to emulation statistics.
+*               ------      Argument validated in DHCPc_EmulRun().
+*
+*               tick_rate   OS clock tick rate (in ticks per second).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_EmulRun().
+*
+* Note(s)     : (2) The socket is read without retry so that the event loop is NOT delayed when NO reply is
+*                   pending.
+*
+*               (3) See 'dhcp-c.h  DHCPc EMULATION DEFINES  Note #2'.
+*
+*               (4) A REQUEST is transmitted for the first OFFER received; other OFFERs & unexpected replies
+*                   are discarded.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_EmulRx (NET_SOCK_ID         sock_id,
+                            DHCPc_EMUL_CFG     *pcfg,
+                            DHCPc_EMUL_STATS   *pstats,
+                            CPU_INT32U          tick_rate)
+{
+    DHCPc_EMUL_CLIENT  *pclient;
+    DHCPc_IF_INFO      *pif_info;
+    DHCP_MSG_HDR       *pmsg_hdr;
+    NET_SOCK_ADDR       addr_remote;
+    NET_SOCK_ADDR_LEN   addr_remote_size;
+    CPU_INT16U          rx_msg_len;
+    CPU_INT32U          rx_xid;
+    CPU_INT32U          ix;
+    NET_IPv4_ADDR       server_id;
+    NET_IPv4_ADDR       addr_offered;
+    CPU_BOOLEAN         valid;
+    CPU_INT08U         *popt;
+    CPU_INT08U          opt_val_len;
+    DHCPc_MSG_TYPE      msg_type;
+    DHCPc_ERR           err;
+
+
+                                                                /* --------------------- RX MSG ----------------------- */
+    addr_remote_size = sizeof(addr_remote);
+
+    rx_msg_len = DHCPc_Rx((NET_SOCK_ID        ) sock_id,        /* See Note #2.                                         */
+                          (void              *)&DHCPc_EmulMsgRx.MsgBuf[0],
+                          (CPU_INT16U         ) DHCP_MSG_BUF_SIZE,
+                          (CPU_INT32U         ) DHCPc_EMUL_RX_TIMEOUT_MS,
+                          (CPU_INT16U         ) 0u,
+                          (NET_SOCK_ADDR     *)&addr_remote,
+                          (NET_SOCK_ADDR_LEN *)&addr_remote_size,
+                          (DHCPc_ERR         *)&err);
+    if (err != DHCPc_ERR_NONE) {
+        return;
+    }
+
+    if (rx_msg_len < DHCP_MSG_RX_MIN_LEN) {
+        pstats->RxDiscardCtr++;
+        return;
+    }
+
+                                                                /* ------------------ GET CLIENT ---------------------- */
+    pmsg_hdr = (DHCP_MSG_HDR *)&DHCPc_EmulMsgRx.MsgBuf[0];
+    NET_UTIL_VAL_COPY_GET_NET_32(&rx_xid, &pmsg_hdr->xid);
+
+    ix = rx_xid & DHCPc_EMUL_XID_IX_MASK;                       /* See Note #3.                                         */
+    if (ix >= DHCPc_CFG_EMUL_MAX_NBR_CLIENT) {
+        pstats->RxDiscardCtr++;
+        return;
+    }
+
+    pclient = &DHCPc_EmulClientTbl[ix];
+    if (pclient->ClientState == DHCP_STATE_NONE) {
+        pstats->RxDiscardCtr++;
+        return;
+    }
+
+                                                                /* ------------------ VALIDATE MSG -------------------- */
+    server_id = (pclient->ClientState == DHCP_STATE_SELECTING) ? pclient->ServerID : NET_IPv4_ADDR_NONE;
+
+    NET_UTIL_VAL_COPY_32(&addr_offered, &pmsg_hdr->yiaddr);
+    pif_info = DHCPc_EmulIF_InfoSet(pclient);
+    valid    = DHCPc_RxReplyValidate((DHCPc_IF_INFO *) pif_info,
+                                     (NET_IPv4_ADDR  ) server_id,
+                                     (CPU_INT08U    *)&pclient->AddrHW[0],
+                                     (CPU_INT08U     ) NET_IF_ETHER_ADDR_SIZE,
+                                     (CPU_INT08U    *)&DHCPc_EmulMsgRx.MsgBuf[0],
+                                     (CPU_INT16U     ) rx_msg_len);
+    if (valid != DEF_YES) {
+        pstats->RxDiscardCtr++;
+        return;
+    }
+
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_DHCP_MESSAGE_TYPE,
+                           (CPU_INT08U   *)&DHCPc_EmulMsgRx.MsgBuf[0],
+                           (CPU_INT16U    ) rx_msg_len,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt == (CPU_INT08U *)0) {
+        pstats->RxDiscardCtr++;
+        return;
+    }
+    msg_type = (DHCPc_MSG_TYPE)(*popt);
+
+                                                                /* ---------------- ADVANCE CLIENT -------------------- */
+    switch (pclient->ClientState) {
+        case DHCP_STATE_INIT:
+             if (msg_type != DHCP_MSG_OFFER) {                  /* See Note #4.                                         */
+                 pstats->RxDiscardCtr++;
+                 break;
+             }
+                                                                /* Get server id.                                       */
+             popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SERVER_IDENTIFIER,
+                                    (CPU_INT08U   *)&DHCPc_EmulMsgRx.MsgBuf[0],
+                                    (CPU_INT16U    ) rx_msg_len,
+                                    (CPU_INT08U   *)&opt_val_len);
+             if (popt == (CPU_INT08U *)0) {
+                 pstats->RxDiscardCtr++;
+                 break;
+             }
+             NET_UTIL_VAL_COPY_32(&pclient->ServerID, popt);
+             pclient->AddrOffered = addr_offered;
+
+             pstats->RxCtr++;
+             pclient->ClientState = DHCP_STATE_SELECTING;       /* Tx REQUEST for offered addr.                         */
+             pclient->RetryCnt    = 0u;
+             DHCPc_EmulTx(sock_id, pclient, DHCP_MSG_REQUEST, pstats, &err);
+             break;
+
+
+        case DHCP_STATE_SELECTING:
+             switch (msg_type) {
+                 case DHCP_MSG_ACK:
+                      pstats->RxCtr++;
+                      if (pcfg->ReleaseEn == DEF_YES) {         /* Release lease, if req'd.                             */
+                          DHCPc_EmulTx(sock_id, pclient, DHCP_MSG_RELEASE, pstats, &err);
+                      }
+                      DHCPc_EmulClientDone(pclient, DHCP_MSG_ACK, pstats, tick_rate);
+                      break;
+
+
+                 case DHCP_MSG_NAK:
+                      pstats->RxCtr++;
+                      DHCPc_EmulClientDone(pclient, DHCP_MSG_NAK, pstats, tick_rate);
+                      break;
+
+
+                 default:                                       /* See Note #4.                                         */
+                      pstats->RxDiscardCtr++;
+                      break;
+             }
+             break;
+
+
+        default:
+             pstats->RxDiscardCtr++;
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DHCPc_EmulTmrChk()
+*
+* Description : Retransmit the unanswered messages of the virtual clients, or fail the clients once the
+*               maximum number of retransmissions is reached.
+*
+* Argument(s) : sock_id         Socket ID of the emulation socket.
+*
+*               pcfg            Pointer to emulation configuration.
+*               ----            Argument validated in DHCPc_EmulRun().
+*
+*               pstats          Pointer to emulation statistics.
+*               ------          Argument validated in DHCPc_EmulRun().
+*
+*               timeout_tick    Retransmission timeout (in OS ticks).
+*
+*               tick_rate       OS clock tick rate (in ticks per second).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_EmulRun().
+*
+* Note(s)     : (1) The transaction ID is kept across retransmissions, so that late replies to a previous
+*                   transmission are still accepted.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_EmulTmrChk (NET_SOCK_ID         sock_id,
+                                DHCPc_EMUL_CFG     *pcfg,
+                                DHCPc_EMUL_STATS   *pstats,
+                                CPU_INT32U          timeout_tick,
+                                CPU_INT32U          tick_rate)
+{
+    DHCPc_EMUL_CLIENT  *pclient;
+    CPU_INT32U          time_cur_tick;
+    CPU_INT16U          ix;
+    DHCPc_MSG_TYPE      msg_type;
+    DHCPc_ERR           err;
+
+
+    time_cur_tick = DHCPc_OS_TimeGet_tick();
+
+    for (ix = 0u; ix < DHCPc_CFG_EMUL_MAX_NBR_CLIENT; ix++) {
+        pclient = &DHCPc_EmulClientTbl[ix];
+
+        if ((pclient->ClientState == DHCP_STATE_NONE) ||        /* If client free or timeout NOT elapsed, ...           */
+            ((time_cur_tick - pclient->TxTime_tick) < timeout_tick)) {
+            continue;                                           /* ... chk next client.                                 */
+        }
+
+        if (pclient->RetryCnt >= pcfg->RetryCnt) {              /* If max retries reached, ...                          */
+            DHCPc_EmulClientDone(pclient, DHCP_MSG_NONE, pstats, tick_rate);
+            continue;                                           /* ... client failed.                                   */
+        }
+
+        pclient->RetryCnt++;
+        pstats->TxRetryCtr++;
+                                                                /* Re-tx last msg (see Note #1).                        */
+        msg_type = (pclient->ClientState == DHCP_STATE_INIT) ? DHCP_MSG_DISCOVER : DHCP_MSG_REQUEST;
+        DHCPc_EmulTx(sock_id, pclient, msg_type, pstats, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_EmulClientDone()
+*
+* Description : End a virtual client's transaction, update the statistics & free the virtual client.
+*
+* Argument(s) : pclient     Pointer to virtual client.
+*               -------     Argument validated in DHCPc_EmulRx(),
+*                                                 DHCPc_EmulTmrChk().
+*
+*               msg_type    Type of message ending the transaction :
+*
+*                               DHCP_MSG_ACK        Transaction completed.
+*                               DHCP_MSG_NAK        Transaction refused by server.
+*                               DHCP_MSG_NONE       Transaction failed.
+*
+*               pstats      Pointer to emulation statistics.
+*
+*               tick_rate   OS clock tick rate (in ticks per second).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_EmulRx(),
+*               DHCPc_EmulTmrChk().
+*
+* Note(s)     : (1) The sum of the latencies is kept in seconds & milliseconds so that it does NOT overflow
+*                   over long emulation runs.
+*
+*               (2) See 'dhcp-c.h  DHCPc EMULATION DEFINES  Note #3'.
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_EmulClientDone (DHCPc_EMUL_CLIENT  *pclient,
+                                    DHCPc_MSG_TYPE      msg_type,
+                                    DHCPc_EMUL_STATS   *pstats,
+                                    CPU_INT32U          tick_rate)
+{
+    CPU_INT32U  latency_tick;
+    CPU_INT32U  latency_ms;
+    CPU_INT08U  hist_ix;
+
+
+    switch (msg_type) {
+        case DHCP_MSG_ACK:
+             latency_tick = DHCPc_OS_TimeGet_tick() - pclient->StartTime_tick;
+             latency_ms   = DHCPc_EmulTimeGet_ms(latency_tick, tick_rate);
+
+             pstats->ClientBoundCtr++;
+             if (latency_ms < pstats->LatencyMin_ms) {
+                 pstats->LatencyMin_ms = latency_ms;
+             }
+             if (latency_ms > pstats->LatencyMax_ms) {
+                 pstats->LatencyMax_ms = latency_ms;
+             }
+                                                                /* Add latency to sum (see Note #1).                    */
+             DHCPc_EmulLatencySum_ms  += latency_ms % DEF_TIME_NBR_mS_PER_SEC;
+             DHCPc_EmulLatencySum_sec += latency_ms / DEF_TIME_NBR_mS_PER_SEC;
+             if (DHCPc_EmulLatencySum_ms >= DEF_TIME_NBR_mS_PER_SEC) {
+                 DHCPc_EmulLatencySum_ms  -= DEF_TIME_NBR_mS_PER_SEC;
+                 DHCPc_EmulLatencySum_sec++;
+             }
+
+             hist_ix = 0u;                                      /* Get histogram bucket (see Note #2).                  */
+             while ((hist_ix    <  (DHCPc_EMUL_LATENCY_HIST_NBR - 1u)) &&
+                    (latency_ms >= DEF_BIT(hist_ix))) {
+                 hist_ix++;
+             }
+             pstats->LatencyHist[hist_ix]++;
+             break;
+
+
+        case DHCP_MSG_NAK:
+             pstats->ClientNakCtr++;
+             break;
+
+
+        default:
+             pstats->ClientFailCtr++;
+             break;
+    }
+
+    pclient->ClientState = DHCP_STATE_NONE;
+    DHCPc_EmulClientCnt--;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DHCPc_EmulTimeGet_tick()
+*
+* Description : Convert a time in milliseconds to OS clock ticks, rounded up.
+*
+* Argument(s) : time_ms     Time to convert (in milliseconds).
+*
+*               tick_rate   OS clock tick rate (in ticks per second).
+*
+* Return(s)   : Time in OS clock ticks, at least 1.
+*
+* Caller(s)   : DHCPc_EmulRun().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DHCPc_EmulTimeGet_tick (CPU_INT32U  time_ms,
+                                            CPU_INT32U  tick_rate)
+{
+    CPU_INT32U  time_tick;
+
+
+    time_tick  = (time_ms / DEF_TIME_NBR_mS_PER_SEC) * tick_rate;
+    time_tick += (((time_ms % DEF_TIME_NBR_mS_PER_SEC) * tick_rate) + (DEF_TIME_NBR_mS_PER_SEC - 1u)) /
+                    DEF_TIME_NBR_mS_PER_SEC;
+    if (time_tick == 0u) {
+        time_tick = 1u;
+    }
+
+    return (time_tick);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_EmulTimeGet_ms()
+*
+* Description : Convert a time in OS clock ticks to milliseconds.
+*
+* Argument(s) : time_tick   Time to convert (in OS clock ticks).
+*
+*               tick_rate   OS clock tick rate (in ticks per second).
+*
+* Return(s)   : Time in milliseconds.
+*
+* Caller(s)   : DHCPc_EmulRun(),
+*               DHCPc_EmulClientDone().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DHCPc_EmulTimeGet_ms (CPU_INT32U  time_tick,
+                                          CPU_INT32U  tick_rate)
+{
+    CPU_INT32U  time_ms;
+
+
+    time_ms  = (time_tick / tick_rate) * DEF_TIME_NBR_mS_PER_SEC;
+    time_ms += ((time_tick % tick_rate) * DEF_TIME_NBR_mS_PER_SEC) / tick_rate;
+
+    return (time_ms);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_RxReply()
+*
+* Description : (1) Receive DHCP reply message :
+*
+*                   (a) Receive           message data from server
+*                   (b) Validate received message (see Note #3)
+*                   (c) Retrieve received message type
+*
+*
+* Argument(s) : sock_id             Socket ID of socket to receive DHCP reply message.
+*
+*               pif_info            Pointer to DHCP interface information.
+*               --------            Argument checked in DHCPc_Discover(),
+*                                                       DHCPc_Req().
+*
+*               server_id           Server identifier.
+*
+*               paddr_hw            Pointer to hardware address buffer.
+*
+*               addr_hw_len         Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               pmsg_buf            Pointer to DHCP message buffer to receive reply.
+*
+*               pmsg_buf_len        Pointer to a variable to ... :
+*
+*                                       (a) Pass the size of the message buffer pointed to by 'pmsg_buf'.
+*                                       (b) (1) Return the actual size of the received message buffer, if NO errors;
+*                                           (2) Return 0,                                              otherwise.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPc reply successfully received.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
+*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*
+*                                                               ----------- RETURNED BY DHCPc_Rx() : ------------
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+* Return(s)   : Type of received message, if NO error.
+*
+*               DHCP_MSG_NONE,            otherwise.
+*
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_Req().
+*
+* Note(s)     : (2) See 'DHCPc_AddrHW_Get()  Note #1'.
+*
+*               (3) Received messages that are NOT valid replies for the client are silently discarded
+*                   (see 'DHCPc_RxReplyValidate()').
+*
+*               (4) The relay agent path of every valid reply is recorded in the client's relay information
+*                   (see 'dhcp-c.h  DHCPc RELAY INFORMATION DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+static  DHCPc_MSG_TYPE  DHCPc_RxReply (NET_SOCK_ID     sock_id,
+                                       DHCPc_IF_INFO  *pif_info,
+                                       NET_IPv4_ADDR   server_id,
+                                       CPU_INT08U     *paddr_hw,
+                                       CPU_INT08U      addr_hw_len,
+                                       CPU_INT08U     *pmsg_buf,
+                                       CPU_INT16U     *pmsg_buf_len,
+                                       DHCPc_ERR      *perr)
+{
+    CPU_BOOLEAN         rx_valid;
+    CPU_BOOLEAN         rx_err;
+    NET_SOCK_ADDR       addr_remote;
+    NET_SOCK_ADDR_LEN   addr_remote_size;
+    CPU_INT16U          rx_msg_len;
+    CPU_INT08U         *popt;
+    CPU_INT08U         *opt_val_len;
+    DHCPc_MSG_TYPE      msg_type;
+
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
+    if ((paddr_hw     == (CPU_INT08U *)0) ||
+        (pmsg_buf     == (CPU_INT08U *)0) ||
+        (pmsg_buf_len == (CPU_INT16U *)0)) {
+       *pmsg_buf_len = 0;
+       *perr         = DHCPc_ERR_NULL_PTR;
+        return (DHCP_MSG_NONE);
+    }
+
+    if (*pmsg_buf_len < DHCP_MSG_RX_MIN_LEN) {
+        *pmsg_buf_len = 0;
+        *perr         = DHCPc_ERR_INVALID_MSG_SIZE;
+        return (DHCP_MSG_NONE);
+    }
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    if (addr_hw_len > DHCPc_HW_ADDR_LEN_MAX) {
+#else
+    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
+#endif
+       *pmsg_buf_len = 0;
+       *perr         = DHCPc_ERR_INVALID_HW_ADDR;
+        return (DHCP_MSG_NONE);
+    }
+
+#else
+   (void)&addr_hw_len;                                          /* Prevent 'variable unused' compiler warning.          */
+#endif
+
+
+                                                                /* ------------ RX MESSAGE FROM SERVER(S) ------------- */
+    rx_valid = DEF_NO;
+    rx_err   = DEF_NO;
+
+    while ((rx_valid != DEF_YES) &&
+           (rx_err   != DEF_YES)) {
+
+        addr_remote_size = sizeof(addr_remote);
+
+        rx_msg_len = DHCPc_Rx((NET_SOCK_ID        ) sock_id,
+                              (void              *) pmsg_buf,
+                              (CPU_INT16U         )*pmsg_buf_len,
+                              (CPU_INT32U         ) pif_info->Cfg.RxTimeout_ms,
+                              (CPU_INT16U         ) DHCPc_RX_MAX_RETRY,
+                              (NET_SOCK_ADDR     *)&addr_remote,
+                              (NET_SOCK_ADDR_LEN *)&addr_remote_size,
+                              (DHCPc_ERR         *) perr);
+
+        if (*perr == DHCPc_ERR_NONE) {
+                                                                /* ------------------- VALIDATE MSG ------------------- */
+            rx_valid = DHCPc_RxReplyValidate((DHCPc_IF_INFO *) pif_info,
+                                             (NET_IPv4_ADDR  ) server_id,
+                                             (CPU_INT08U    *) paddr_hw,
+                                             (CPU_INT08U     ) addr_hw_len,
+                                             (CPU_INT08U    *) pmsg_buf,
+                                             (CPU_INT16U     ) rx_msg_len);
+
+        } else {
+            rx_err = DEF_YES;
+        }
+    }
+
+    if (*perr != DHCPc_ERR_NONE) {
+       *pmsg_buf_len = 0;
+        return (DHCP_MSG_NONE);
+    }
+
+                                                                /* ------------------- GET MSG TYPE ------------------- */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_DHCP_MESSAGE_TYPE,
+                           (CPU_INT08U   *) pmsg_buf,
+                           (CPU_INT16U    ) rx_msg_len,
+                           (CPU_INT08U   *)&opt_val_len);
+
+    if (popt == (CPU_INT08U *)0) {
+       *pmsg_buf_len = 0;
+       *perr         = DHCPc_ERR_RX_MSG_TYPE;
+        return (DHCP_MSG_NONE);
+    }
+
+                                                                /* Retrieve msg type opt val.                           */
+    msg_type     = (DHCPc_MSG_TYPE)(*popt);
+   *pmsg_buf_len =  rx_msg_len;
+
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+    DHCPc_RelayInfoSet(pif_info, pmsg_buf, rx_msg_len);         /* Record relay path (see Note #4).                     */
+#endif
+
+    return (msg_type);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_RxReplyValidate()
+*
+* Description : (1) Validate a received DHCP reply message :
+*
+*                   (a) length
+*                   (b) opcode
+*                   (c) hardware address
+*                   (d) transaction ID
+*                   (e) server      ID
+*                   (f) client      ID (see Note #3)
+*
+*
+* Argument(s) : pif_info            Pointer to DHCP interface information.
+*               --------            Argument checked in DHCPc_RxReply(),
+*                                                       DHCPc_EmulRx().
+*
+*               server_id           Server identifier, NET_IPv4_ADDR_NONE if NOT known.
+*
+*               paddr_hw            Pointer to hardware address buffer.
+*               --------            Argument checked in DHCPc_RxReply(),
+*                                                       DHCPc_EmulRx().
+*
+*               addr_hw_len         Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               pmsg_buf            Pointer to received DHCP message buffer.
+*               --------            Argument checked in DHCPc_RxReply(),
+*                                                       DHCPc_EmulRx().
+*
+*               msg_len             Length of the received DHCP message (in octets).
+*
+* Return(s)   : DEF_YES, if message is a valid reply for the client.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_RxReply(),
+*               DHCPc_EmulRx().
+*
+* Note(s)     : (2) Received messages smaller than the minimum size allowed are NOT valid.
+*
+*                   See also 'dhcp-c.h  DHCP MESSAGE DEFINES  Note #2'.
+*
+*               (3) Since the logical clients of an interface share the same hardware address, a reply
+*                   carrying a client identifier is accepted only if it matches the client identifier of
+*                   the client (see 'dhcp-c.h  DHCP CLIENT IDENTIFIER DEFINES  Note #1').
+*
+*               (4) A reply to a DISCOVER or INFORM message carrying the last transaction ID or one of the
+*                   'TransactionID_WinLen' previous transaction IDs is accepted (see 'DHCPc_Discover()
+*                   Note #1').  The unsigned difference between both transaction IDs handles the transaction
+*                   ID wrap-around.  A reply to a REQUEST message MUST carry the transaction ID of the
+*                   accepted OFFER.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DHCPc_RxReplyValidate (DHCPc_IF_INFO  *pif_info,
+                                            NET_IPv4_ADDR   server_id,
+                                            CPU_INT08U     *paddr_hw,
+                                            CPU_INT08U      addr_hw_len,
+                                            CPU_INT08U     *pmsg_buf,
+                                            CPU_INT16U      msg_len)
+{
+    DHCP_MSG_HDR   *pmsg_hdr;
+    CPU_INT32U      rx_xid;
+    CPU_INT32U      xid_age;
+    CPU_INT08U     *popt;
+    CPU_INT08U      opt_val_len;
+    NET_IPv4_ADDR   addr_server;
+    CPU_BOOLEAN     match;
+
+
+    if (msg_len < DHCP_MSG_RX_MIN_LEN) {                        /* Validate len (see Note #2).                          */
+        return (DEF_NO);
+    }
+
+    pmsg_hdr = (DHCP_MSG_HDR *)pmsg_buf;
+
+    if (pmsg_hdr->op != DHCP_OP_REPLY) {                        /* Validate opcode.                                     */
+        return (DEF_NO);
+    }
+
+                                                                /* Validate HW addr.                                    */
+    match = Mem_Cmp((void     *)pmsg_hdr->chaddr,
+                    (void     *)paddr_hw,
+                    (CPU_SIZE_T)addr_hw_len);
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+
+                                                                /* Validate transaction ID (see Note #4).               */
+    NET_UTIL_VAL_COPY_GET_NET_32(&rx_xid, &pmsg_hdr->xid);
+    if ((pif_info->ClientState == DHCP_STATE_INIT  ) ||         /* If DISCOVER or INFORM tx'd, ...                      */
+        (pif_info->ClientState == DHCP_STATE_INFORM)) {
+        xid_age = pif_info->TransactionID - rx_xid;             /* ... accept last or prev xids ...                     */
+        if (xid_age > pif_info->TransactionID_WinLen) {
+            return (DEF_NO);
+        }
+
+    } else if (rx_xid != pif_info->TransactionID_Req) {         /* ... else accept OFFER's xid only.                    */
+        return (DEF_NO);
+    }
+
+                                                                /* Validate server id.                                  */
+    if (server_id != NET_IPv4_ADDR_NONE) {                      /* If server id known,    ...                           */
+                                                                /* ... get server id opt, ...                           */
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SERVER_IDENTIFIER,
+                               (CPU_INT08U   *) pmsg_buf,
+                               (CPU_INT16U    ) msg_len,
+                               (CPU_INT08U   *)&opt_val_len);
+        if (popt == (CPU_INT08U *)0) {
+            return (DEF_NO);
+        }
+                                                                /* ... & compare with lease server id.                  */
+        NET_UTIL_VAL_COPY_32(&addr_server, popt);
+        if (addr_server != server_id) {
+            return (DEF_NO);
+        }
+    }
+
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)                           /* Validate client id (see Note #3).                    */
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_CLIENT_IDENTIFIER,
+                           (CPU_INT08U   *) pmsg_buf,
+                           (CPU_INT16U    ) msg_len,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {                              /* If NO client id in reply, rely on xid.               */
+        if (opt_val_len != pif_info->Cfg.ClientID_Len) {
+            return (DEF_NO);
+        }
+
+        match = Mem_Cmp((void     *) popt,
+                        (void     *)&pif_info->Cfg.ClientID[0],
+                        (CPU_SIZE_T) opt_val_len);
+        if (match != DEF_YES) {
+            return (DEF_NO);
+        }
+    }
+#endif
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             DHCPc_Rx()
+*
+* Description : Receive DHCPc data via socket.
+*
+* Argument(s) : sock_id             Socket ID of socket to receive DHCPc data.
+*
+*               pdata_buf           Pointer to DHCPc data buffer to receive data.
+*               ---------           Argument checked in DHCPc_RxReply().
+*
+*               data_buf_len        Length  of DHCPc data buffer to receive data.
+*
+*               timeout_ms          Maximum inactivity time on receive (in milliseconds).
+*
+*               retry_max           Maximum number of receive retries on transitory errors.
+*
+*               paddr_remote        Pointer to an address buffer that will receive the socket address
+*                                       structure with the received data's remote address.
+*
+*               paddr_remote_len    Pointer to a variable to ... :
+*
+*                                       (a) Pass the size of the address buffer pointed to by 'paddr_remote'.
+*                                       (b) Return the actual size of socket address structure with the
+*                                               received data's remote address.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPc data successfully received.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+* Return(s)   : Length of DHCPc data received (in octets), if no error.
+*
+*               0,                                         otherwise.
+*
+* Caller(s)   : DHCPc_RxReply(),
+*               DHCPc_EmulRx(),
+*               DHCPc_IPv6_RxReply().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DHCPc_Rx (NET_SOCK_ID         sock_id,
+                              void               *pdata_buf,
+                              CPU_INT16U          data_buf_len,
+                              CPU_INT32U          timeout_ms,
+                              CPU_INT16U          retry_max,
+                              NET_SOCK_ADDR      *paddr_remote,
+                              NET_SOCK_ADDR_LEN  *paddr_remote_len,
+                              DHCPc_ERR          *perr)
+{
+    CPU_INT16U  rx_len;
+    NET_ERR     err_net;
+
+
+                                                                /* ------------------- RX APP DATA -------------------- */
+    rx_len = NetApp_SockRx((NET_SOCK_ID        ) sock_id,
+                           (void              *) pdata_buf,
+                           (CPU_INT16U         ) data_buf_len,
+                           (CPU_INT16U         ) 0,
+#if (NET_VERSION >= 21200u)
+                           (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
+#else
+                           (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
+#endif
+                           (NET_SOCK_ADDR     *) paddr_remote,
+                           (NET_SOCK_ADDR_LEN *) paddr_remote_len,
+                           (CPU_INT16U         ) retry_max,
+                           (CPU_INT32U         ) timeout_ms,
+                           (CPU_INT32U         ) DHCPc_RX_TIME_DLY_MS,
+                           (NET_ERR           *)&err_net);
+
+    switch (err_net) {
+        case NET_APP_ERR_NONE:
+            *perr = DHCPc_ERR_NONE;
+             break;
+
+
+        case NET_APP_ERR_DATA_BUF_OVF:
+            *perr = DHCPc_ERR_RX_OVF;
+             break;
+
+
+        case NET_APP_ERR_CONN_CLOSED:
+        case NET_APP_ERR_FAULT:
+        case NET_APP_ERR_INVALID_ARG:
+        case NET_APP_ERR_INVALID_OP:
+        case NET_ERR_RX:
+        default:
+             rx_len = 0;
+            *perr   = DHCPc_ERR_RX;
+             break;
+    }
+
+    return (rx_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_TxOptTmplBuild()
+*
+* Description : Build the transmit option template of an interface.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_StartExt(),
+*                                                 DHCPc_Inform(),
+*                                                 DHCPc_EmulRun().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_StartExt(),
+*               DHCPc_Inform(),
+*               DHCPc_EmulRun().
+*
+* Note(s)     : (1) The template holds the options that do NOT depend on the client state, so that
+*                   DHCPc_TxMsgPrepare() only writes the state dependent options & copies the template
+*                   on each (re-)transmission (see 'dhcp-c.h  DHCPc TRANSMIT OPTION TEMPLATE DEFINES
+*                   Note #1').  The template MUST be built after the parameter request list.
+*
+*               (2) The offset of the client identifier value in the template is recorded, so that the
+*                   value MAY be replaced without re-building the template (see 'DHCPc_EmulIF_InfoSet()').
+*
+*               (3) #### The host name is read when the interface is started.  A host name changed with
+*                   CPU_NameSet() is hence NOT sent before the interface is restarted.
+*
+*               (4) The vendor class identifier & the vendor-specific information are copied once from the
+*                   interface configuration into the template, which is pre-sized for their maximum length
+*                   (see 'dhcp-c.h  DHCPc TRANSMIT OPTION TEMPLATE DEFINES').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_TxOptTmplBuild (DHCPc_IF_INFO  *pif_info)
+{
+    CPU_INT08U  *popt;
+#if (DHCP_MSG_BUF_SIZE > DHCP_MSG_BUF_SIZE_MIN)
+    CPU_INT16U   max_msg_size;
+#endif
+#if (CPU_CFG_NAME_EN == DEF_ENABLED)
+    CPU_CHAR     host_name[CPU_CFG_NAME_SIZE];
+    CPU_SIZE_T   host_name_len;
+    CPU_ERR      err_cpu;
+#endif
+
+
+    popt = &pif_info->TxOptTmpl[0];
+
+                                                                /* ------------- BUILD OPT OF EVERY MSG --------------- */
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    if (pif_info->Cfg.ClientID_Len > 0u) {                      /* Client identifier (see Note #2).                     */
+       *popt++ = DHCP_OPT_CLIENT_IDENTIFIER;
+       *popt++ = pif_info->Cfg.ClientID_Len;
+
+        pif_info->TxOptTmplClientID_Ix = (CPU_INT16U)(popt - &pif_info->TxOptTmpl[0]);
+        Mem_Copy((void     *) popt,
+                 (void     *)&pif_info->Cfg.ClientID[0],
+                 (CPU_SIZE_T) pif_info->Cfg.ClientID_Len);
+        popt += pif_info->Cfg.ClientID_Len;
+    }
+#endif
+
+#if (CPU_CFG_NAME_EN == DEF_ENABLED)                            /* Host name (see Note #3).                             */
+    CPU_NameGet(host_name, &err_cpu);
+    if (err_cpu == CPU_ERR_NONE) {
+        host_name_len = Str_Len(host_name);
+        if (host_name_len > 0) {
+           *popt++  = DHCP_OPT_HOST_NAME;
+           *popt++  = host_name_len;
+            Mem_Copy(popt, host_name, host_name_len);
+            popt   += host_name_len;
+        }
+    }
+#endif
+
+    pif_info->TxOptTmplLen[DHCPc_TX_OPT_TMPL_PART_ALL]   = (CPU_INT16U)(popt - &pif_info->TxOptTmpl[0]);
+
+
+                                                                /* ---------- BUILD OPT OF PARAM REQ MSGS ------------- */
+#if (DHCP_MSG_BUF_SIZE > DHCP_MSG_BUF_SIZE_MIN)                 /* Max DHCP msg size.                                   */
+    max_msg_size = DHCP_MSG_BUF_SIZE + DHCP_MSG_IP_UDP_HDR_SIZE;
+   *popt++ = DHCP_OPT_MAXIMUM_DHCP_MESSAGE_SIZE;
+   *popt++ = 2;
+    NET_UTIL_VAL_COPY_SET_NET_16(popt, &max_msg_size);
+    popt  += 2;
+#endif
+
+#if (DHCPc_CFG_VENDOR_CLASS_MAX_LEN > 0)
+    if (pif_info->Cfg.VendorClass_Len > 0u) {                   /* Vendor class id (see Note #4).                       */
+       *popt++ = DHCP_OPT_VENDOR_CLASS_IDENTIFIER;
+       *popt++ = pif_info->Cfg.VendorClass_Len;
+
+        Mem_Copy((void     *) popt,
+                 (void     *)&pif_info->Cfg.VendorClass[0],
+                 (CPU_SIZE_T) pif_info->Cfg.VendorClass_Len);
+        popt += pif_info->Cfg.VendorClass_Len;
+    }
+#endif
+
+#if (DHCPc_CFG_VENDOR_INFO_MAX_LEN > 0)
+    if (pif_info->Cfg.VendorInfo_Len > 0u) {                    /* Vendor-specific info (see Note #4).                  */
+       *popt++ = DHCP_OPT_VENDOR_SPECIFIC_INFORMATION;
+       *popt++ = pif_info->Cfg.VendorInfo_Len;
+
+        Mem_Copy((void     *) popt,
+                 (void     *)&pif_info->Cfg.VendorInfo[0],
+                 (CPU_SIZE_T) pif_info->Cfg.VendorInfo_Len);
+        popt += pif_info->Cfg.VendorInfo_Len;
+    }
+#endif
+
+    if (pif_info->ParamReqQty > 0) {                            /* Req'd param.                                         */
+       *popt++ = DHCP_OPT_PARAMETER_REQUEST_LIST;
+       *popt++ = pif_info->ParamReqQty;
+
+        Mem_Copy((void     *) popt,
+                 (void     *)&pif_info->ParamReqTbl[0],
+                 (CPU_SIZE_T) pif_info->ParamReqQty);
+        popt += pif_info->ParamReqQty;
+    }
+
+    pif_info->TxOptTmplLen[DHCPc_TX_OPT_TMPL_PART_PARAM] = (CPU_INT16U)(popt - &pif_info->TxOptTmpl[0]);
+
+
+                                                                /* ------------- BUILD OPT OF NEGO MSGS --------------- */
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+   *popt++ = DHCP_OPT_FORCERENEW_NONCE_CAPABLE;                 /* FORCERENEW nonce capable.                            */
+   *popt++ = 1;
+   *popt++ = DHCP_AUTH_ALGORITHM_HMAC_MD5;
+#endif
+
+    pif_info->TxOptTmplLen[DHCPc_TX_OPT_TMPL_PART_NEGO]  = (CPU_INT16U)(popt - &pif_info->TxOptTmpl[0]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_TxMsgPrepare()
+*
+* Description : Prepare DHCP message.
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument checked   in DHCPc_Discover(),
+*                                                     DHCPc_Req(),
+*                                        validated in DHCPc_DeclineRelease().
+*
+*               msg_type        Type of message to be prepared :
+*
+*                                   DHCP_MSG_DISCOVER
+*                                   DHCP_MSG_REQUEST
+*                                   DHCP_MSG_DECLINE
+*                                   DHCP_MSG_RELEASE
+*                                   DHCP_MSG_INFORM
+*
+*               paddr_hw        Pointer to hardware address buffer.
+*
+*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               pmsg_buf        Pointer to DHCP transmit message buffer.
+*
+*               msg_buf_size    Size of message buffer (in octets).
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPc message successfully prepared.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) 'paddr_hw/pmsg_buf' passed a
+*                                                                   NULL pointer.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*
+* Return(s)   : Size of the message (in octets).
+*
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_Req(),
+*               DHCPc_DeclineRelease(),
+*               DHCPc_EmulTx().
+*
+* Note(s)     : (2) The 'htype', 'hlen' & 'chaddr' fields are set from the interface's hardware type &
+*                   hardware address.  A client without a hardware address fitting the 'chaddr' field
+*                   always sets the BROADCAST bit in DISCOVER & REQUEST messages (see 'dhcp-c.h  DHCPc
+*                   HARDWARE ADDRESS DEFINES  Note #2b').
+*
+*               (3) From RFC #2131, section 'Protocol Summary', "To work around some clients that cannot
+*                   accept IP unicast datagrams before the TCP/IP software is configured [...], DHCP uses
+*                   the 'flags' field".  Section 'Constructing and sending DHCP messages' continues by
+*                   adding that "a client that cannot receive unicast IP datagrams until its protocol
+*                   software has been configured with an IP address SHOULD set the BROADCAST bit in the
+*                   'flags' field to 1".
+*
+*                  "A server [...] sending [...] a DHCP message directly to a DHCP client SHOULD examine
+*                   [that bit] in the 'flags' field.  If this bit is set to 1, the DHCP message SHOULD be
+*                   sent as an IP broadcast using an IP broadcast address as the IP destination address
+*                   and the link-layer broadcast address as the link-layer destination address".
+*
+*                   #### Since the Micrium uC/TCP-IP stack is NOT able to receive a packet on an
+*                   unconfigured interface, the BROADCAST bit is always set in the 'flags' field of a DHCP
+*                   message, when permitted by the RFC.
+*
+*               (4) The parameter request list is built when the interface is started & holds both the
+*                   system & the application requested parameters, without duplicates.  The option is
+*                   NOT sent if the list is empty.
+*
+*                   See also 'DHCPc_ParamReqBuild()'.
+*
+*               (5) The vendor-specific options MUST be large enough so the DHCP message is at least
+*                   DHCP_MSG_TX_MIN_LEN octets.
+*
+*                   See also 'dhcp-c.h  DHCP MESSAGE DEFINES  Note #2'.
+*
+*               (6) Only the message header is cleared since the options are written contiguously & then
+*                   padded up to DHCP_MSG_TX_MIN_LEN; the rest of a large message buffer is NEVER
+*                   transmitted.
+*
+*               (7) The maximum DHCP message size is advertised only if the message buffer is larger than
+*                   the minimum size (see 'dhcp-c.h  DHCP MESSAGE DEFINES  Note #1b').
+*
+*               (8) RFC #2131, section 'Client parameters in DHCP' states that the client "MUST include its
+*                   network address in the 'ciaddr' field" of a DHCPINFORM message.  Since the interface
+*                   is already configured, the BROADCAST bit is NOT set.
+*
+*               (9) The client advertises its support of the Forcerenew Nonce Authentication protocol in
+*                   the DISCOVER & REQUEST messages (see RFC #6704), so that the server sends a nonce in
+*                   its DHCPACK.
+*
+*                   See also 'dhcp-c.h  DHCP AUTHENTICATION DEFINES  Note #1'.
+*
+*               (10) A client sharing its interface with other logical client(s) always requests broadcast
+*                    replies, since its offered address is NOT configured on the interface (see
+*                    'DHCPc_InitStateHandler()  Note #6').
+*
+*               (11) The client identifier of a logical client is included in every message, so that the
+*                    server identifies the client by this value rather than by its hardware address (see
+*                    'dhcp-c.h  DHCP CLIENT IDENTIFIER DEFINES  Note #1').
+*
+*               (12) The options that do NOT depend on the client state are copied from the transmit option
+*                    template of the interface, built when the interface is started (see
+*                    'DHCPc_TxOptTmplBuild()').  Only the header & the state dependent options are written
+*                    on each (re-)transmission.
+*
+*               (13) RFC #2131, section 'Format of a DHCP message', defines the 'secs' field as the seconds
+*                    elapsed since the client began the address acquisition or renewal process.  It is
+*                    computed from the start time saved in the interface information & saturates at the
+*                    field's maximum value.  RFC #2131, section 'Constructing and sending DHCP messages',
+*                    sets the field to 0 in DECLINE & RELEASE messages.
+*
+*               (14) The message buffer is large enough for the fixed header, the state dependent options,
+*                    the whole transmit option template & the END option, since DHCPc_CFG_MSG_BUF_SIZE is
+*                    checked at compile time (see 'dhcp-c.h  DHCPc TRANSMIT OPTION TEMPLATE DEFINES
+*                    Note #3').
+*
+*               (15) DISCOVER & INFORM messages carry the last transaction ID generated, whereas the other
+*                    messages carry the transaction ID of the accepted OFFER (see 'DHCPc_Discover()
+*                    Note #1').
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DHCPc_TxMsgPrepare (DHCPc_IF_INFO   *pif_info,
+                                        DHCPc_MSG_TYPE   msg_type,
+                                        CPU_INT08U      *paddr_hw,
+                                        CPU_INT08U       addr_hw_len,
+                                        CPU_INT08U      *pmsg_buf,
+                                        CPU_INT16U       msg_buf_size,
+                                        DHCPc_ERR       *perr)
+{
+    DHCP_MSG_HDR  *pmsg_hdr;
+    CPU_INT08U    *pmsg_opt;
+    DHCPc_MSG     *pmsg_last_rx;
+    DHCP_MSG_HDR  *pmsg_last_rx_hdr;
+    CPU_INT16U     msg_size;
+    CPU_INT16U     flag;
+    CPU_INT32U     xid;
+    CPU_INT32U     ciaddr;
+    CPU_BOOLEAN    get_local_addr;
+    CPU_BOOLEAN    wr_req_ip_addr;
+    CPU_BOOLEAN    wr_server_id;
+    CPU_INT08U     tmpl_part;
+    CPU_INT16U     tmpl_len;
+    CPU_INT32U     time_cur_sec;
+    CPU_INT32U     secs_elapsed;
+    CPU_INT16U     secs;
+    CPU_INT08U    *popt;
+    CPU_INT16U     opt_len;
+    CPU_INT16U     opt_pad_len;
+
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
+    if ((paddr_hw == (CPU_INT08U    *)0) ||
+        (pmsg_buf == (CPU_INT08U    *)0)) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return (0);
+    }
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    if (addr_hw_len > DHCPc_HW_ADDR_LEN_MAX) {                  /* See Note #2.                                         */
+#else
+    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {                /* See Note #2.                                         */
+#endif
+       *perr = DHCPc_ERR_INVALID_HW_ADDR;
+        return (0);
+    }
+
+    if (msg_buf_size < DHCP_MSG_BUF_SIZE) {
+       *perr = DHCPc_ERR_INVALID_MSG_SIZE;
+        return (0);
+    }
+
+#else
+   (void)&addr_hw_len;                                          /* Prevent 'variable unused' compiler warning.          */
+   (void)&msg_buf_size;
+#endif
+
+
+                                                                /* ---------- GET SPECIFIC FIELDS & OPT VAL ----------- */
+    flag = 0;
+    switch (msg_type) {
+        case DHCP_MSG_DISCOVER:
+#if (DHCPc_CFG_BROADCAST_BIT_EN == DEF_ENABLED)                 /* See Note #3.                                         */
+             flag           = DHCP_FLAG_BROADCAST;
+#endif
+             get_local_addr = DEF_NO;
+             wr_req_ip_addr = DEF_NO;
+             wr_server_id   = DEF_NO;
+             tmpl_part      = DHCPc_TX_OPT_TMPL_PART_NEGO;
+             break;
+
+
+        case DHCP_MSG_REQUEST:
+#if (DHCPc_CFG_BROADCAST_BIT_EN == DEF_ENABLED)                 /* See Note #3.                                         */
+             flag      = DHCP_FLAG_BROADCAST;
+#endif
+             tmpl_part = DHCPc_TX_OPT_TMPL_PART_NEGO;
+
+             switch (pif_info->ClientState) {
+                 case DHCP_STATE_SELECTING:
+                      get_local_addr = DEF_NO;
+                      wr_req_ip_addr = DEF_YES;
+                      wr_server_id   = DEF_YES;
+                      break;
+
+
+                 case DHCP_STATE_INIT_REBOOT:
+                      get_local_addr = DEF_NO;
+                      wr_req_ip_addr = DEF_YES;
+                      wr_server_id   = DEF_NO;
+                      break;
+
+
+                 case DHCP_STATE_BOUND:
+                 case DHCP_STATE_RENEWING:
+                 case DHCP_STATE_REBINDING:
+                      get_local_addr = DEF_YES;
+                      wr_req_ip_addr = DEF_NO;
+                      wr_server_id   = DEF_NO;
+                      break;
+
+
+                 default:
+                      get_local_addr = DEF_NO;
+                      wr_req_ip_addr = DEF_NO;
+                      wr_server_id   = DEF_NO;
+                      break;
+             }
+             break;
+
+
+        case DHCP_MSG_DECLINE:
+             get_local_addr = DEF_NO;
+             wr_req_ip_addr = DEF_YES;
+             wr_server_id   = DEF_YES;
+             tmpl_part      = DHCPc_TX_OPT_TMPL_PART_ALL;
+             break;
+
+
+        case DHCP_MSG_RELEASE:
+             get_local_addr = DEF_YES;
+             wr_req_ip_addr = DEF_NO;
+             wr_server_id   = DEF_YES;
+             tmpl_part      = DHCPc_TX_OPT_TMPL_PART_ALL;
+             break;
+
+
+        case DHCP_MSG_INFORM:                                   /* See Note #8.                                         */
+             get_local_addr = DEF_NO;
+             wr_req_ip_addr = DEF_NO;
+             wr_server_id   = DEF_NO;
+             tmpl_part      = DHCPc_TX_OPT_TMPL_PART_PARAM;
+             break;
+
+
+        default:                                                /* Unsupported msg, ...                                 */
+            *perr = DHCPc_ERR_INVALID_MSG;
+             return (0);                                        /* ... rtn.                                             */
+    }
+
+    if ((DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_ADDR_SHARED) == DEF_YES) &&
+       ((msg_type == DHCP_MSG_DISCOVER) ||
+        (msg_type == DHCP_MSG_REQUEST))) {
+        flag = DHCP_FLAG_BROADCAST;                             /* See Note #10.                                        */
+    }
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    if ((addr_hw_len == 0u) &&
+       ((msg_type == DHCP_MSG_DISCOVER) ||
+        (msg_type == DHCP_MSG_REQUEST))) {
+        flag = DHCP_FLAG_BROADCAST;                             /* See Note #2.                                         */
+    }
+#endif
+
+    pmsg_last_rx     = (DHCPc_MSG    *) pif_info->MsgPtr;
+    pmsg_last_rx_hdr = (DHCP_MSG_HDR *)&pmsg_last_rx->MsgBuf[0];
+
+    if (get_local_addr == DEF_YES) {
+        NET_UTIL_VAL_COPY_32(&ciaddr, &pmsg_last_rx_hdr->yiaddr);
+
+    } else if (msg_type == DHCP_MSG_INFORM) {                   /* Get IF's static addr (see Note #8).                  */
+        ciaddr = (CPU_INT32U)DHCPc_AddrHostGet(pif_info->IF_Nbr);
+
+    } else {
+        ciaddr = 0;
+    }
+
+                                                                /* ------------------- GET CUR TIME ------------------- */
+    time_cur_sec = DHCPc_TimeGet_sec();
+
+    if ((msg_type == DHCP_MSG_DECLINE) ||                       /* Get elapsed time (see Note #13).                     */
+        (msg_type == DHCP_MSG_RELEASE)) {
+        secs = 0;
+
+    } else {
+        secs_elapsed = time_cur_sec - pif_info->AcqStartTime;
+        if (secs_elapsed > DEF_INT_16U_MAX_VAL) {
+            secs_elapsed = DEF_INT_16U_MAX_VAL;
+        }
+        secs = (CPU_INT16U)secs_elapsed;
+    }
+
+
+    Mem_Clr((void     *)pmsg_buf,                               /* Clr msg hdr (see Note #6).                           */
+            (CPU_SIZE_T)DHCP_MSG_HDR_SIZE);
+
+                                                                /* --------------- SETTING DHCP MSG HDR --------------- */
+    pmsg_hdr        = (DHCP_MSG_HDR *)&pmsg_buf[0];
+
+    pmsg_hdr->op    = DHCP_OP_REQUEST;
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    pmsg_hdr->htype = pif_info->Cfg.HW_Type;                    /* See Note #2.                                         */
+#else
+    pmsg_hdr->htype = DHCP_HTYPE_ETHER;
+#endif
+    pmsg_hdr->hlen  = addr_hw_len;
+    pmsg_hdr->hops  = 0;
+
+    if ((msg_type == DHCP_MSG_DISCOVER) ||                      /* Get xid (see Note #15).                              */
+        (msg_type == DHCP_MSG_INFORM  )) {
+        xid = pif_info->TransactionID;
+
+    } else {
+        xid = pif_info->TransactionID_Req;
+    }
+
+    NET_UTIL_VAL_COPY_SET_NET_32(&pmsg_hdr->xid, &xid);
+    NET_UTIL_VAL_COPY_SET_NET_16(&pmsg_hdr->secs, &secs);
+
+    NET_UTIL_VAL_COPY_SET_NET_16(&pmsg_hdr->flags, &flag);
+
+    NET_UTIL_VAL_COPY_32(&pmsg_hdr->ciaddr, &ciaddr);           /* Already in net order.                                */
+    NET_UTIL_VAL_SET_NET_32(&pmsg_hdr->yiaddr, 0);
+    NET_UTIL_VAL_SET_NET_32(&pmsg_hdr->siaddr, 0);
+    NET_UTIL_VAL_SET_NET_32(&pmsg_hdr->giaddr, 0);
+
+    Mem_Copy((void     *) pmsg_hdr->chaddr,                     /* Copy hw addr (see Note #2).                          */
+             (void     *) paddr_hw,
+             (CPU_SIZE_T) addr_hw_len);
+
+
+                                                                /* --------------- SETTING DHCP MSG OPT --------------- */
+    pmsg_opt = &pmsg_buf[DHCP_MSG_HDR_SIZE];
+    popt     =  pmsg_opt;
+
+    NET_UTIL_VAL_SET_NET_32(popt, DHCP_MAGIC_COOKIE);           /* DHCP Magic cookie.                                   */
+    popt    += DHCP_MAGIC_COOKIE_SIZE;
+
+   *popt++   = DHCP_OPT_DHCP_MESSAGE_TYPE;                      /* DHCP Message Type.                                   */
+   *popt++   = 1;                                               /* Msg type opt len.                                    */
+   *popt++   = msg_type;
+
+    if (wr_req_ip_addr == DEF_YES) {                            /* Requested IP address.                                */
+       *popt++  = DHCP_OPT_REQUESTED_IP_ADDRESS;
+       *popt++  = 4;
+        NET_UTIL_VAL_COPY_32(popt, &pmsg_last_rx_hdr->yiaddr);
+        popt   += 4;
+    }
+
+    if (wr_server_id == DEF_YES) {                              /* Server ID.                                           */
+       *popt++  = DHCP_OPT_SERVER_IDENTIFIER;
+       *popt++  = 4;
+        NET_UTIL_VAL_COPY_32(popt, &pif_info->ServerID);
+        popt   += 4;
+    }
+
+                                                                /* Opt tmpl (see Notes #4, #7, #9, #11, #12 & #14).     */
+    tmpl_len = pif_info->TxOptTmplLen[tmpl_part];
+    Mem_Copy((void     *) popt,
+             (void     *)&pif_info->TxOptTmpl[0],
+             (CPU_SIZE_T) tmpl_len);
+    popt    += tmpl_len;
+
+   *popt++   = DHCP_OPT_END;                                    /* End of options.                                      */
+
+
+                                                                /* -------------------- GET MSG LEN ------------------- */
+    opt_len = popt - pmsg_opt;
+    if (opt_len < (DHCP_MSG_TX_MIN_LEN - DHCP_MSG_HDR_SIZE)) {  /* See Note #5.                                         */
+        opt_pad_len = ((DHCP_MSG_TX_MIN_LEN - DHCP_MSG_HDR_SIZE) - opt_len);
+
+        Mem_Set((void     *)popt,
+                (CPU_INT08U)DHCP_OPT_PAD,
+                (CPU_SIZE_T)opt_pad_len);
+
+        opt_len = (DHCP_MSG_TX_MIN_LEN - DHCP_MSG_HDR_SIZE);
     }
+
+    pif_info->NegoStartTime = time_cur_sec;                     /* Save nego start time.                                */
+
+
+    msg_size = DHCP_MSG_HDR_SIZE + opt_len;
+   *perr     = DHCPc_ERR_NONE;
+
+    return (msg_size);
 }
 
 
 /*
 *********************************************************************************************************
-*                                             DHCPc_Req()
-*
-* Description : (1) Perform the REQUEST phase of the lease negotiation :
+*                                             DHCPc_Tx()
 *
-*                   (a) Get              message
-*                   (b) Prepare  REQUEST message from last received OFFER
-*                   (c) Transmit REQUEST message
-*                   (d) Get reply from server(s)
-*                   (e) Copy ACK.
+* Description : Transmit DHCPc data via socket.
 *
+* Argument(s) : sock_id             Socket ID of socket to transmit DHCPc data.
 *
-* Argument(s) : sock_id         Socket ID of socket to transmit & receive DHCPc data.
+*               pdata_buf           Pointer to DHCPc data buffer to transmit.
 *
-*               pif_info        Pointer to DHCP interface information.
-*               --------        Argument checked in DHCPc_InitStateHandler().
+*               data_buf_len        Length  of DHCPc data buffer to transmit.
 *
-*               paddr_hw        Pointer to hardware address buffer.
+*               paddr_remote        Pointer to the socket address structure of the remote address
 *
-*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*               addr_remote_len     Length  of the socket address structure pointed to by 'paddr_remote'.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  REQUEST successfully transmitted & ACK received.
-*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
-*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
-*                               DHCPc_ERR_RX_NAK                NAK message received from server.
-*
-*                                                               --------- RETURNED BY DHCPc_MsgGet() : ----------
-*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
-*
-*                                                               ------ RETURNED BY DHCPc_TxMsgPrepare() : -------
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
-*
-*                                                               ----------- RETURNED BY DHCPc_Tx() : ------------
+*                               DHCPc_ERR_NONE                  DHCPc data successfully transmitted.
+*                               DHCPc_ERR_NULL_PTR              Argument(s) 'pdata_buf/paddr_remote' passed
+*                                                                   a NULL pointer.
 *                               DHCPc_ERR_TX                    Transmit error.
 *
-*                                                               -------- RETURNED BY DHCPc_RxReply() : ----------
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
-*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
-*                               DHCPc_ERR_RX                    Receive error.
-*
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_InitStateHandler(),
-*               DHCPc_RenewRebindStateHandler()
+* Caller(s)   : DHCPc_Discover(),
+*               DHCPc_Req(),
+*               DHCPc_DeclineRelease(),
+*               DHCPc_EmulTx(),
+*               DHCPc_IPv6_Exchange().
 *
-* Note(s)     : (2) If NO DHCP message is received following a DHCP REQUEST transmission, the caller is
-*                   responsible of the retransmission handling--i.e. this function will NOT attempt to
-*                   send another REQUEST.
+* Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_Req (NET_SOCK_ID     sock_id,
-                         DHCPc_IF_INFO  *pif_info,
-                         CPU_INT08U     *paddr_hw,
-                         CPU_INT08U      addr_hw_len,
-                         DHCPc_ERR      *perr)
+static  void  DHCPc_Tx (NET_SOCK_ID         sock_id,
+                        void               *pdata_buf,
+                        CPU_INT16U          data_buf_len,
+                        NET_SOCK_ADDR      *paddr_remote,
+                        NET_SOCK_ADDR_LEN   addr_remote_len,
+                        DHCPc_ERR          *perr)
 {
-    DHCPc_MSG           *pmsg;
-    CPU_INT16U           request_retry_cnt;
-    CPU_BOOLEAN          request_done;
-    CPU_BOOLEAN          request_dly;
-    CPU_INT16U           dly_ms;
-    CPU_INT16U           request_msg_len;
-    NET_IPv4_ADDR        addr_server_ip;
-    NET_SOCK_ADDR_IPv4   addr_server;
-    NET_SOCK_ADDR_LEN    addr_server_size;
-    CPU_BOOLEAN          rx_done;
-    DHCPc_MSG_TYPE       dhcp_rx_msg_type;
-    NET_ERR              net_err;
+    NET_ERR  err_net;
 
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
-    if (paddr_hw == (CPU_INT08U *)0) {
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* ------------------ VALIDATE PTRS ------------------- */
+    if ((pdata_buf    == (void          *)0) ||
+        (paddr_remote == (NET_SOCK_ADDR *)0)) {
        *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
-
-    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
-       *perr = DHCPc_ERR_INVALID_HW_ADDR;
-        return;
-    }
 #endif
 
-                                                                /* --------------------- GET MSG ---------------------- */
-    pmsg = DHCPc_MsgGet(perr);
-    if (*perr != DHCPc_ERR_NONE) {
-        return;
-    }
-
 
-    request_retry_cnt = 0;
-    request_done      = DEF_NO;
-    request_dly       = DEF_NO;
-    dly_ms            = 0;
-
-                                                                /* While REQUEST retry < max retry ...                  */
-                                                                /* ... & REQUEST NOT done,         ...                  */
-    while ((request_retry_cnt <  DHCPc_CFG_REQUEST_RETRY_CNT) &&
-           (request_done      != DEF_YES)) {
-
-        if (request_dly == DEF_YES) {                           /* Dly REQUEST, if req'd.                               */
-            dly_ms = DHCPc_CalcBackOff(dly_ms);
-                                                                /* Close Rx Q before delay to prevent Rx buffers ...    */
-                                                                /* from exhaustion.                                     */
-            (void)NetSock_CfgRxQ_Size( sock_id,
-                                       NET_SOCK_DATA_SIZE_MIN,
-                                      &net_err);
-            KAL_Dly(dly_ms);
-
-            (void)NetSock_CfgRxQ_Size( sock_id,                 /* Re-configure Rx Q size to its original value.        */
-                                       NET_SOCK_CFG_RX_Q_SIZE_OCTET,
-                                      &net_err);
-        }
+                                                                /* ------------------- TX APP DATA -------------------- */
+   (void)NetApp_SockTx((NET_SOCK_ID       ) sock_id,
+                       (void             *) pdata_buf,
+                       (CPU_INT16U        ) data_buf_len,
+#if (NET_VERSION >= 21200u)
+                       (NET_SOCK_API_FLAGS) NET_SOCK_FLAG_NONE,
+#else
+                       (CPU_INT16S        ) NET_SOCK_FLAG_NONE,
+#endif
+                       (NET_SOCK_ADDR    *) paddr_remote,
+                       (NET_SOCK_ADDR_LEN ) addr_remote_len,
+                       (CPU_INT16U        ) DHCPc_TX_MAX_RETRY,
+                       (CPU_INT32U        ) 0,
+                       (CPU_INT32U        ) DHCPc_TX_TIME_DLY_MS,
+                       (NET_ERR          *)&err_net);
 
-                                                                /* --------------- PREPARE REQUEST MSG ---------------- */
-        request_msg_len = DHCPc_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
-                                             (DHCPc_MSG_TYPE ) DHCP_MSG_REQUEST,
-                                             (CPU_INT08U    *) paddr_hw,
-                                             (CPU_INT08U     ) addr_hw_len,
-                                             (CPU_INT08U    *)&pmsg->MsgBuf[0],
-                                             (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
-                                             (DHCPc_ERR     *) perr);
-        if (*perr != DHCPc_ERR_NONE) {
-            DHCPc_MsgFree(pmsg);
-            return;
-        }
+    if (err_net == NET_APP_ERR_NONE) {
+       *perr = DHCPc_ERR_NONE;
 
+    } else {
+       *perr = DHCPc_ERR_TX;
+    }
+}
 
-                                                                /* ---------------------- TX MSG ---------------------- */
-        if (pif_info->ClientState == DHCP_STATE_RENEWING) {     /* If client in RENEWING state, ...                     */
-            addr_server_ip = pif_info->ServerID;                /* ... tx unicast   msg.                                */
-        } else {                                                /* Else,                        ...                     */
-            addr_server_ip = NET_IPv4_ADDR_BROADCAST;           /* ... tx broadcast msg.                                */
-        }
 
-        addr_server_size = sizeof(addr_server);
-        Mem_Clr((void     *)&addr_server,
-                (CPU_SIZE_T) addr_server_size);
-        addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
-        addr_server.Addr       = addr_server_ip;
-        addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_SERVER);
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                          DHCPc_HMAC_MD5()
+*
+* Description : Compute the HMAC-MD5 digest of a data buffer (see RFC #2104).
+*
+* Argument(s) : pkey        Pointer to key.
+*
+*               key_len     Length of the key (in octets) [see Note #1].
+*
+*               pdata       Pointer to data buffer.
+*
+*               data_len    Length of the data buffer (in octets).
+*
+*               pdigest     Pointer to buffer that will receive the HMAC-MD5 digest (DHCPc_MD5_DIGEST_LEN
+*                               octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_ForceRenewValidate().
+*
+* Note(s)     : (1) The key MUST NOT be longer than DHCPc_MD5_BLK_SIZE octets; the FORCERENEW nonce is
+*                   always DHCP_AUTH_NONCE_LEN octets long.
+*********************************************************************************************************
+*/
 
-        DHCPc_Tx((NET_SOCK_ID      ) sock_id,
-                 (void            *)&pmsg->MsgBuf[0],
-                 (CPU_INT16U       ) request_msg_len,
-                 (NET_SOCK_ADDR   *)&addr_server,
-                 (NET_SOCK_ADDR_LEN) addr_server_size,
-                 (DHCPc_ERR       *) perr);
-        if (*perr != DHCPc_ERR_NONE) {
-            request_done = DEF_YES;
+static  void  DHCPc_HMAC_MD5 (CPU_INT08U  *pkey,
+                              CPU_INT08U   key_len,
+                              CPU_INT08U  *pdata,
+                              CPU_INT16U   data_len,
+                              CPU_INT08U  *pdigest)
+{
+    DHCPc_MD5_CTX  ctx;
+    CPU_INT08U     pad[DHCPc_MD5_BLK_SIZE];
+    CPU_INT08U     digest_inner[DHCPc_MD5_DIGEST_LEN];
+    CPU_INT08U     i;
 
-        } else {
 
-                                                                /* ------------- RX REPLY FROM SERVER(S) -------------- */
-            rx_done = DEF_FALSE;
+    Mem_Clr((void     *)&pad[0],                                /* Inner hash: MD5((K ^ ipad) | data).                  */
+            (CPU_SIZE_T) sizeof(pad));
+    Mem_Copy((void     *)&pad[0],
+             (void     *) pkey,
+             (CPU_SIZE_T) key_len);
+    for (i = 0u; i < DHCPc_MD5_BLK_SIZE; i++) {
+        pad[i] ^= DHCPc_HMAC_IPAD;
+    }
 
+    DHCPc_MD5_Init(&ctx);
+    DHCPc_MD5_Update(&ctx, &pad[0], sizeof(pad));
+    DHCPc_MD5_Update(&ctx,  pdata,  data_len);
+    DHCPc_MD5_Final(&ctx, &digest_inner[0]);
 
-            while (rx_done != DEF_YES) {
+    for (i = 0u; i < DHCPc_MD5_BLK_SIZE; i++) {                 /* Outer hash: MD5((K ^ opad) | inner hash).            */
+        pad[i] ^= (DHCPc_HMAC_IPAD ^ DHCPc_HMAC_OPAD);
+    }
 
-                pmsg->MsgLen = DHCP_MSG_BUF_SIZE;
-                dhcp_rx_msg_type = DHCPc_RxReply((NET_SOCK_ID    ) sock_id,
-                                                 (DHCPc_IF_INFO *) pif_info,
-                                                 (NET_IPv4_ADDR  ) NET_IPv4_ADDR_NONE,
-                                                 (CPU_INT08U    *) paddr_hw,
-                                                 (CPU_INT08U     ) addr_hw_len,
-                                                 (CPU_INT08U    *)&pmsg->MsgBuf[0],
-                                                 (CPU_INT16U    *)&pmsg->MsgLen,
-                                                 (DHCPc_ERR     *) perr);
+    DHCPc_MD5_Init(&ctx);
+    DHCPc_MD5_Update(&ctx, &pad[0],          sizeof(pad));
+    DHCPc_MD5_Update(&ctx, &digest_inner[0], sizeof(digest_inner));
+    DHCPc_MD5_Final(&ctx, pdigest);
+}
 
-                switch (*perr) {
-                    case DHCPc_ERR_NONE:                        /* If NO err                          ...               */
 
-                         switch (dhcp_rx_msg_type) {
-                             case DHCP_MSG_ACK:                 /* ... & rx'd msg is ACK,             ...               */
-                                  rx_done      = DEF_YES;       /* ... rx        done                 ...               */
-                                  request_done = DEF_YES;       /* ... & REQUEST done.                                  */
-                                  break;
+/*
+*********************************************************************************************************
+*                                          DHCPc_MD5_Init()
+*
+* Description : Initialize an MD5 context (see RFC #1321).
+*
+* Argument(s) : pctx        Pointer to MD5 context.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_HMAC_MD5().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
 
+static  void  DHCPc_MD5_Init (DHCPc_MD5_CTX  *pctx)
+{
+    pctx->State[0] = 0x67452301u;
+    pctx->State[1] = 0xEFCDAB89u;
+    pctx->State[2] = 0x98BADCFEu;
+    pctx->State[3] = 0x10325476u;
+    pctx->Len      = 0u;
+}
 
-                             case DHCP_MSG_NAK:                 /* ... else if rx'd msg is NAK,       ...               */
-                                  rx_done      = DEF_YES;       /* ... rx        done,                ...               */
-                                  request_done = DEF_YES;       /* ... REQUEST done,                  ...               */
-                                 *perr = DHCPc_ERR_RX_NAK;      /* ... & rtn err.                                       */
-                                  break;
 
+/*
+*********************************************************************************************************
+*                                         DHCPc_MD5_Update()
+*
+* Description : Add data to an MD5 digest computation.
+*
+* Argument(s) : pctx        Pointer to MD5 context.
+*
+*               pdata       Pointer to data buffer.
+*
+*               data_len    Length of the data buffer (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_HMAC_MD5(),
+*               DHCPc_MD5_Final().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
 
-                             default:                           /* ... Else rx'd msg NOT ACK nor NAK, ...               */
-                                  rx_done = DEF_NO;             /* ... rx NOT done.                                     */
-                                  break;
-                         }
-                         break;
+static  void  DHCPc_MD5_Update (DHCPc_MD5_CTX  *pctx,
+                                CPU_INT08U     *pdata,
+                                CPU_INT32U      data_len)
+{
+    CPU_INT32U  buf_ix;
+    CPU_INT32U  cpy_len;
 
 
-                    default:                                    /* If rx err,         ...                               */
-                         rx_done     = DEF_YES;
-                         request_dly = DEF_YES;
-                         request_retry_cnt++;                   /* ... restart REQUEST.                                 */
-                         break;
-                }
-            }
+    while (data_len > 0u) {
+        buf_ix  =  pctx->Len % DHCPc_MD5_BLK_SIZE;
+        cpy_len = (DHCPc_MD5_BLK_SIZE - buf_ix);
+        if (cpy_len > data_len) {
+            cpy_len = data_len;
         }
-    }
 
-    if (*perr != DHCPc_ERR_NONE) {
-        DHCPc_MsgFree(pmsg);
-        return;
-    }
+        Mem_Copy((void     *)&pctx->Buf[buf_ix],
+                 (void     *) pdata,
+                 (CPU_SIZE_T) cpy_len);
+
+        pctx->Len += cpy_len;
+        pdata     += cpy_len;
+        data_len  -= cpy_len;
 
-                                                                /* ------------ COPY ACK IN IF INFO STRUCT ------------ */
-    if (pif_info->MsgPtr != (DHCPc_MSG *)0) {                   /* If msg ptr NOT NULL, ...                             */
-        DHCPc_MsgFree(pif_info->MsgPtr);                        /* ... free msg         ...                             */
+        if ((pctx->Len % DHCPc_MD5_BLK_SIZE) == 0u) {           /* If blk full, ...                                     */
+            DHCPc_MD5_Blk(&pctx->State[0], &pctx->Buf[0]);      /* ... process blk.                                     */
+        }
     }
-
-    pif_info->MsgPtr = pmsg;                                    /* ... & set msg ptr to rx'd ACK.                       */
 }
 
 
 /*
 *********************************************************************************************************
-*                                       DHCPc_DeclineRelease()
-*
-* Description : (1) Perform the DECLINE or RELEASE phase of the lease negotiation :
-*
-*                   (a) Get                      message
-*                   (b) Prepare  DECLINE/RELEASE message
-*                   (c) Transmit DECLINE/RELEASE message
-*
-*
-* Argument(s) : sock_id         Socket ID of socket to transmit & receive DHCPc data.
-*
-*               pif_info        Pointer to DHCP interface information.
-*               --------        Argument validated in DHCPc_InitStateHandler(),
-*                                                     DHCPc_StopStateHandler().
+*                                          DHCPc_MD5_Final()
 *
-*               msg_type        DHCP message type to prepare :
+* Description : Pad the data & get the MD5 digest.
 *
-*                                   DHCP_MSG_DECLINE        Decline message
-*                                   DHCP_MSG_RELEASE        Release message
+* Argument(s) : pctx        Pointer to MD5 context.
 *
-*               paddr_hw        Pointer to hardware address buffer.
+*               pdigest     Pointer to buffer that will receive the MD5 digest (DHCPc_MD5_DIGEST_LEN octets).
 *
-*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+* Return(s)   : none.
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
+* Caller(s)   : DHCPc_HMAC_MD5().
 *
-*                               DHCPc_ERR_NONE                  DECLINE/RELEASE successfully transmitted
-*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
-*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
-*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+* Note(s)     : (1) The data is padded with a single '1' bit & with '0' bits up to 56 octets modulo 64,
+*                   followed by the data length in bits as a 64-bit little-endian value (see RFC #1321,
+*                   sections 3.1 & 3.2).
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_MD5_Final (DHCPc_MD5_CTX  *pctx,
+                               CPU_INT08U     *pdigest)
+{
+    CPU_INT08U  pad[DHCPc_MD5_BLK_SIZE];
+    CPU_INT08U  len_bit[8];
+    CPU_INT32U  len;
+    CPU_INT32U  pad_len;
+    CPU_INT08U  i;
+
+
+    len = pctx->Len;
+    Mem_Clr((void     *)&len_bit[0],                            /* Msg len in bits, little-endian.                      */
+            (CPU_SIZE_T) sizeof(len_bit));
+    for (i = 0u; i < 4u; i++) {
+        len_bit[i] = (CPU_INT08U)((len << 3) >> (i * 8u));
+    }
+    len_bit[4] = (CPU_INT08U)(len >> 29);
+
+    Mem_Clr((void     *)&pad[0],                                /* Pad data (see Note #1).                              */
+            (CPU_SIZE_T) sizeof(pad));
+    pad[0]  = 0x80u;
+    pad_len = ((len % DHCPc_MD5_BLK_SIZE) < 56u) ? (56u  - (len % DHCPc_MD5_BLK_SIZE))
+                                                 : (120u - (len % DHCPc_MD5_BLK_SIZE));
+
+    DHCPc_MD5_Update(pctx, &pad[0],     pad_len);
+    DHCPc_MD5_Update(pctx, &len_bit[0], sizeof(len_bit));
+
+    for (i = 0u; i < DHCPc_MD5_DIGEST_LEN; i++) {               /* Get digest, little-endian.                           */
+        pdigest[i] = (CPU_INT08U)(pctx->State[i / 4u] >> ((i % 4u) * 8u));
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPc_MD5_Blk()
 *
-*                                                               ------ RETURNED BY DHCPc_MsgGet() : ------
-*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+* Description : Process a 64-octet data block (see RFC #1321, section 3.4).
 *
-*                                                               --- RETURNED BY DHCPc_TxMsgPrepare() : ---
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+* Argument(s) : pstate      Pointer to MD5 state (A, B, C, D).
 *
-*                                                               -------- RETURNED BY DHCPc_Tx() : --------
-*                               DHCPc_ERR_TX                    Transmit error.
+*               pblk        Pointer to data block.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_InitStateHandler(),
-*               DHCPc_StopStateHandler().
+* Caller(s)   : DHCPc_MD5_Update().
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_DeclineRelease (NET_SOCK_ID      sock_id,
-                                    DHCPc_IF_INFO   *pif_info,
-                                    DHCPc_MSG_TYPE   msg_type,
-                                    CPU_INT08U      *paddr_hw,
-                                    CPU_INT08U       addr_hw_len,
-                                    DHCPc_ERR       *perr)
+static  void  DHCPc_MD5_Blk (CPU_INT32U  *pstate,
+                             CPU_INT08U  *pblk)
 {
-    DHCPc_MSG           *pmsg;
-    CPU_INT16U           release_msg_len;
-    NET_IPv4_ADDR        addr_ip_server;
-    NET_SOCK_ADDR_IPv4   addr_server;
-    NET_SOCK_ADDR_LEN    addr_server_size;
+    CPU_INT32U  m[16];
+    CPU_INT32U  a;
+    CPU_INT32U  b;
+    CPU_INT32U  c;
+    CPU_INT32U  d;
+    CPU_INT32U  f;
+    CPU_INT32U  tmp;
+    CPU_INT08U  g;
+    CPU_INT08U  s;
+    CPU_INT08U  i;
 
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
-    if (paddr_hw == (CPU_INT08U *)0) {
-       *perr = DHCPc_ERR_NULL_PTR;
-        return;
+    for (i = 0u; i < 16u; i++) {                                /* Get blk words, little-endian.                        */
+        m[i] = ((CPU_INT32U)pblk[(i * 4u)     ]      ) |
+               ((CPU_INT32U)pblk[(i * 4u) + 1u] <<  8) |
+               ((CPU_INT32U)pblk[(i * 4u) + 2u] << 16) |
+               ((CPU_INT32U)pblk[(i * 4u) + 3u] << 24);
     }
 
-    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
-       *perr = DHCPc_ERR_INVALID_HW_ADDR;
-        return;
-    }
-#endif
+    a = pstate[0];
+    b = pstate[1];
+    c = pstate[2];
+    d = pstate[3];
 
-    switch (msg_type) {
-        case DHCP_MSG_DECLINE:
-             addr_ip_server = NET_IPv4_ADDR_BROADCAST;
-             break;
+    for (i = 0u; i < 64u; i++) {
+        switch (i / 16u) {
+            case 0u:
+                 f = (b & c) | (~b & d);
+                 g =  i;
+                 break;
 
 
-        case DHCP_MSG_RELEASE:
-             addr_ip_server = pif_info->ServerID;
-             break;
+            case 1u:
+                 f = (d & b) | (~d & c);
+                 g = ((5u * i) + 1u) % 16u;
+                 break;
 
 
-        default:
-            *perr = DHCPc_ERR_INVALID_MSG;
-             return;
-    }
+            case 2u:
+                 f =  b ^ c ^ d;
+                 g = ((3u * i) + 5u) % 16u;
+                 break;
 
-                                                                /* --------------------- GET MSG ---------------------- */
-    pmsg = DHCPc_MsgGet(perr);
-    if (*perr != DHCPc_ERR_NONE) {
-        return;
+
+            default:
+                 f =  c ^ (b | ~d);
+                 g =  (7u * i)       % 16u;
+                 break;
+        }
+
+        s   =  DHCPc_MD5_Shift[((i / 16u) * 4u) + (i % 4u)];
+        tmp =  a + f + DHCPc_MD5_Const[i] + m[g];
+        a   =  d;
+        d   =  c;
+        c   =  b;
+        b  += (tmp << s) | (tmp >> (32u - s));
     }
 
-                                                                /* --------------- PREPARE RELEASE MSG ---------------- */
-    release_msg_len = DHCPc_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
-                                         (DHCPc_MSG_TYPE ) msg_type,
-                                         (CPU_INT08U    *) paddr_hw,
-                                         (CPU_INT08U     ) addr_hw_len,
-                                         (CPU_INT08U    *)&pmsg->MsgBuf[0],
-                                         (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
-                                         (DHCPc_ERR     *) perr);
-    if (*perr != DHCPc_ERR_NONE) {
-        DHCPc_MsgFree(pmsg);
-        return;
+    pstate[0] += a;
+    pstate[1] += b;
+    pstate[2] += c;
+    pstate[3] += d;
+}
+#endif
+
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                      DHCPc_IPv6_InfoGetCfgd()
+*
+* Description : Get interface information structure of the DHCPv6 client of an interface.
+*
+* Argument(s) : if_nbr          Interface number to get the interface information structure.
+*
+* Return(s)   : Pointer to interface information structure, if a DHCPv6 client is started on the interface.
+*
+*               Pointer to NULL,                            otherwise.
+*
+* Caller(s)   : DHCPc_IPv6_Stop(),
+*               DHCPc_IPv6_ChkStatus(),
+*               DHCPc_IPv6_LeaseGet(),
+*               DHCPc_IF_InfoGet().
+*
+* Note(s)     : (1) The DHCPv6 client is looked up in the interface's information list (see 'DHCPc_IF_InfoGetCfgd()
+*                   Note #2') & identified by the DHCPc_FLAG_IPv6 flag, regardless of its client identifier.
+*********************************************************************************************************
+*/
+
+static  DHCPc_IF_INFO  *DHCPc_IPv6_InfoGetCfgd (NET_IF_NBR  if_nbr)
+{
+    DHCPc_IF_INFO  *pif_info;
+    CPU_BOOLEAN     if_cfgd;
+
+
+    if (if_nbr >= NET_IF_NBR_IF_TOT) {                          /* If IF nbr invalid, ...                               */
+        return ((DHCPc_IF_INFO *)0);                            /* ... rtn NULL ptr.                                    */
     }
 
+    pif_info = DHCPc_InfoIF_Tbl[if_nbr];                        /* See Note #1.                                         */
+    if_cfgd  = DEF_NO;
 
-                                                                /* ---------------------- TX MSG ---------------------- */
-    addr_server_size = sizeof(addr_server);
-    Mem_Clr((void     *)&addr_server,
-            (CPU_SIZE_T) addr_server_size);
-    addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
-    addr_server.Addr       = addr_ip_server;
-    addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_CFG_IP_PORT_SERVER);
+    while ((pif_info != (DHCPc_IF_INFO *)0) &&
+           (if_cfgd  !=  DEF_YES)) {
+        if_cfgd = DEF_BIT_IS_SET(pif_info->Flags, DHCPc_FLAG_IPv6);
 
-    DHCPc_Tx((NET_SOCK_ID      ) sock_id,
-             (void            *)&pmsg->MsgBuf[0],
-             (CPU_INT16U       ) release_msg_len,
-             (NET_SOCK_ADDR   *)&addr_server,
-             (NET_SOCK_ADDR_LEN) addr_server_size,
-             (DHCPc_ERR       *) perr);
+        if (if_cfgd != DEF_YES) {
+            pif_info = pif_info->IF_NextPtr;
+        }
+    }
 
+    if (if_cfgd != DEF_YES) {                                   /* If NO DHCPv6 client on IF, ...                       */
+        return ((DHCPc_IF_INFO *)0);                            /* ... rtn NULL ptr.                                    */
+    }
 
-    DHCPc_MsgFree(pmsg);
+    return (pif_info);
 }
 
 
 /*
 *********************************************************************************************************
-*                                         DHCPc_CalcBackOff()
+*                                        DHCPc_IPv6_DUID_Set()
 *
-* Description : Calculate next backed-off retransmit/retry timeout value.
+* Description : Set the DUID & the IAID of a DHCPv6 client.
 *
-* Argument(s) : timeout_ms      Current timeout value (in milliseconds).
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_IPv6_Start().
 *
-* Return(s)   : Backed-off re-transmit/retry timeout value (in milliseconds).
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-* Caller(s)   : DHCPc_Discover(),
-*               DHCPc_Req().
+*                               DHCPc_ERR_NONE                  DUID & IAID successfully set.
+*                               DHCPc_ERR_CLIENT_ID_NONE        NO hardware address & NO client identifier.
 *
-* Note(s)     : (1) RFC #2131, Section 4.1 'Constructing and sending DHCP messages' states that "the
-*                   client MUST adopt a retransmission strategy that incorporates a randomized
-*                   exponential backoff algorithm to determine the delay between retransmissions".
+*                                                               ------- RETURNED BY DHCPc_AddrHW_Get() : -------
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
 *
-*                   It also stipulates that "the retransmission delay SHOULD be double with subsequent
-*                   retransmissions up to a maximum of 64 seconds".
+* Return(s)   : none.
 *
-*                   This implementation takes some distance from the RFC by setting the initial delay
-*                   value to 2 seconds instead of the proposed 4 seconds.  It also does NOT randomize
-*                   the delay value.
+* Caller(s)   : DHCPc_IPv6_Start().
+*
+* Note(s)     : (1) A client identifier of type DHCP_CLIENT_ID_TYPE_DUID holds the IAID followed by the DUID
+*                   (see RFC #4361, section 'Encoding of the DHCPv4 Client Identifier').  Both are used as
+*                   is by the DHCPv6 client, so that the DHCP & the DHCPv6 clients of an interface share
+*                   the same identity.
+*
+*               (2) Otherwise, the DUID is a DUID-LL built from the interface's hardware type & address
+*                   (see 'dhcp-c.h  DHCPv6 DEFINES  Note #2') & the interface number is used as IAID.
 *********************************************************************************************************
 */
 
-static  CPU_INT16U  DHCPc_CalcBackOff (CPU_INT16U  timeout_ms)
+static  void  DHCPc_IPv6_DUID_Set (DHCPc_IF_INFO  *pif_info,
+                                   DHCPc_ERR      *perr)
 {
-    CPU_INT32U  timeout_calcd;
+    DHCPc_IPv6_INFO  *pinfo;
+    CPU_INT08U        addr_hw_len;
+    CPU_INT16U        duid_type;
+    CPU_INT16U        hw_type;
 
 
-    if (timeout_ms == 0) {
-        timeout_calcd = (CPU_INT32U)DHCPc_BACKOFF_DLY_INITIAL_MS;
+    pinfo = &pif_info->IPv6;
 
-    } else {
-        timeout_calcd = (timeout_ms < (CPU_INT32U)DHCPc_BACKOFF_DLY_MAX_MS)
-                      ? (timeout_ms * (CPU_INT32U)DHCPc_BACKOFF_DLY_SCALAR)
-                      : (CPU_INT32U)DHCPc_BACKOFF_DLY_MAX_MS;
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    if (pif_info->Cfg.ClientID_Len > 0u) {                      /* If DUID client id cfg'd (see Note #1), ...           */
+                                                                /* ... get IAID ...                                     */
+        NET_UTIL_VAL_COPY_GET_NET_32(&pinfo->IAID, &pif_info->Cfg.ClientID[1]);
 
-        timeout_calcd = DEF_MIN((CPU_INT32U)timeout_calcd,
-                                (CPU_INT32U)DHCPc_BACKOFF_DLY_MAX_MS);
+        pinfo->DUID_Len = pif_info->Cfg.ClientID_Len - DHCP_CLIENT_ID_DUID_OFFSET;
+        Mem_Copy((void     *)&pinfo->DUID[0],                   /* ... & DUID.                                          */
+                 (void     *)&pif_info->Cfg.ClientID[DHCP_CLIENT_ID_DUID_OFFSET],
+                 (CPU_SIZE_T) pinfo->DUID_Len);
+
+       *perr = DHCPc_ERR_NONE;
+        return;
+    }
+#endif
+
+                                                                /* ------------------- BUILD DUID-LL ------------------ */
+    addr_hw_len = DHCPc_AddrHW_Get(pif_info->IF_Nbr, &pinfo->DUID[DHCPc_IPv6_DUID_LL_HDR_LEN], perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
+
+    if (addr_hw_len == 0u) {                                    /* If NO hw addr, ...                                   */
+       *perr = DHCPc_ERR_CLIENT_ID_NONE;                        /* ... client can NOT be identified.                    */
+        return;
     }
 
-    return ((CPU_INT16U)timeout_calcd);
+    duid_type = DHCPc_IPv6_DUID_TYPE_LL;
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    hw_type   = pif_info->Cfg.HW_Type;
+#else
+    hw_type   = DHCP_HTYPE_ETHER;
+#endif
+    NET_UTIL_VAL_COPY_SET_NET_16(&pinfo->DUID[0], &duid_type);
+    NET_UTIL_VAL_COPY_SET_NET_16(&pinfo->DUID[2], &hw_type);
+
+    pinfo->DUID_Len = DHCPc_IPv6_DUID_LL_HDR_LEN + addr_hw_len;
+    pinfo->IAID     = (CPU_INT32U)pif_info->IF_Nbr;             /* See Note #2.                                         */
+
+
+   *perr = DHCPc_ERR_NONE;
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DHCPc_AddrValidate()
-*
-* Description : (1) Validate IP address not already used on the network.
-*
-*                   (a) Probe addr on network
-*                   (b) Wait for reply
-*                   (c) Get HW addr from ARP cache
-*
+*                                        DHCPc_IPv6_InitSock()
 *
-* Argument(s) : if_nbr          IF on which to perform address validation.
-*
-*               addr_target     IP address to validate, in network-order.
-*
-*               dly_ms          Delay to wait for a reply, in milliseconds.
+* Description : Initialize a DHCPv6 client socket.
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
+* Argument(s) : if_nbr      Interface number to bind the socket to.
 *
-*                               DHCPc_ERR_NONE                  No error, address NOT used on the network.
-*                               DHCPc_ERR_ADDR_VALIDATE         Error validating address.
-*                               DHCPc_ERR_ADDR_USED             Address already used on the network.
+* Return(s)   : Socket descriptor/handle identifier, if NO errors.
 *
-* Return(s)   : none.
+*               NET_SOCK_BSD_ERR_OPEN,               otherwise.
 *
-* Caller(s)   : DHCPc_InitStateHandler().
+* Caller(s)   : DHCPc_IPv6_InitStateHandler(),
+*               DHCPc_IPv6_RenewStateHandler(),
+*               DHCPc_IPv6_StopStateHandler().
 *
-* Note(s)     : (2) If ARP is not present (NET_ARP_MODULE_EN not defined), or if any other error
-*                   happens when attempting to check the address, DHCPc_ERR_ADDR_VALIDATE is returned,
-*                   meaning that the check does not allow to conclude anything.
+* Note(s)     : (1) The socket is bound to the unspecified address, so that the network stack selects the
+*                   interface's link-local address as source address of the messages (see RFC #8415,
+*                   section 'Client/Server Exchanges Involving Two Messages').
 *********************************************************************************************************
 */
 
-#if ((DHCPc_CFG_ADDR_VALIDATE_EN       == DEF_ENABLED) || \
-     (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED))
-static  void  DHCPc_AddrValidate (NET_IF_NBR      if_nbr,
-                                  NET_IPv4_ADDR   addr_target,
-                                  CPU_INT32U      dly_ms,
-                                  DHCPc_ERR      *perr)
+static  NET_SOCK_ID  DHCPc_IPv6_InitSock (NET_IF_NBR  if_nbr)
 {
-#ifdef  NET_ARP_MODULE_EN
-    CPU_INT08U        hw_addr_sender[NET_CACHE_HW_ADDR_LEN_ETHER];
-    NET_IPv4_ADDR     addr_this_host;
-    NET_ARP_ADDR_LEN  addr_len;
-#endif
-    NET_ERR           err_net;
-
+    NET_SOCK_ID         sock_id;
+    NET_SOCK_ADDR_IPv6  local_addr;
+    NET_SOCK_ADDR_LEN   local_addr_size;
+    CPU_BOOLEAN         rtn_status;
+    CPU_BOOLEAN         success;
+    NET_ERR             err_net;
 
-   (void)&err_net;                                              /* Prevent possible 'variable unused' warning.          */
 
-   *perr = DHCPc_ERR_ADDR_VALIDATE;                             /* Dflt rtn val.                                        */
+                                                                /* --------------------- OPEN SOCK -------------------- */
+    sock_id = NetApp_SockOpen((NET_SOCK_PROTOCOL_FAMILY) NET_SOCK_ADDR_FAMILY_IP_V6,
+                              (NET_SOCK_TYPE           ) NET_SOCK_TYPE_DATAGRAM,
+                              (NET_SOCK_PROTOCOL       ) NET_SOCK_PROTOCOL_UDP,
+                              (CPU_INT16U              ) 0,
+                              (CPU_INT32U              ) 0,
+                              (NET_ERR                *)&err_net);
 
-#ifdef  NET_ARP_MODULE_EN
-    addr_this_host = NET_IPv4_ADDR_NONE;
-    addr_len       = sizeof(addr_target);
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
+        return (NET_SOCK_BSD_ERR_OPEN);
+    }
 
-                                                                /* ---------------- PROBE ADDR ON NET ----------------- */
-    NetARP_CacheProbeAddrOnNet((NET_PROTOCOL_TYPE) NET_PROTOCOL_TYPE_IP_V4,
-                               (CPU_INT08U      *)&addr_this_host,
-                               (CPU_INT08U      *)&addr_target,
-                               (NET_ARP_ADDR_LEN ) addr_len,
-                               (NET_ERR         *)&err_net);
+                                                                /* ------------- SET IF NBR FOR THE SOCKET ------------ */
+    success = NetSock_CfgIF(sock_id,
+                            if_nbr,
+                           &err_net);
+    if (success != DEF_OK) {
+        NetApp_SockClose((NET_SOCK_ID ) sock_id,
+                         (CPU_INT32U  ) 0,
+                         (NET_ERR    *)&err_net);
 
-    if (err_net != NET_ARP_ERR_NONE) {
-        return;                                                 /* See Note #2.                                         */
+        return (NET_SOCK_BSD_ERR_OPEN);
     }
-                                                                /* ------------------ WAIT FOR REPLY ------------------ */
-    KAL_Dly(dly_ms);
-
-                                                                /* ------------ GET HW ADDR FROM ARP CACHE ------------ */
-    NetARP_CacheGetAddrHW(                   if_nbr,
-                          (CPU_INT08U     *)&hw_addr_sender[0],
-                          (NET_ARP_ADDR_LEN) NET_CACHE_HW_ADDR_LEN_ETHER,
-                          (CPU_INT08U     *)&addr_target,
-                          (NET_ARP_ADDR_LEN) addr_len,
-                          (NET_ERR        *)&err_net);
 
-    switch (err_net) {
-        case NET_ARP_ERR_CACHE_NOT_FOUND:                       /* If cache NOT found or cache pending, ...             */
-        case NET_ARP_ERR_CACHE_PEND:
-        case NET_CACHE_ERR_PEND:
-            *perr = DHCPc_ERR_NONE;                             /* ... addr NOT used.                                   */
-             break;
+                                                                /* ------------------ SET LOCAL ADDR ------------------ */
+    local_addr_size = sizeof(local_addr);
+    Mem_Clr((void     *)&local_addr,                            /* Unspecified addr (see Note #1).                      */
+            (CPU_SIZE_T) local_addr_size);
+    local_addr.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V6;
+    local_addr.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_IPv6_PORT_CLIENT);
 
 
-        case NET_ARP_ERR_NONE:                                  /* If NO err, ...                                       */
-            *perr = DHCPc_ERR_ADDR_USED;                        /* ... hw addr in cache resolved (addr used).          */
-             break;
+                                                                /* --------------------- BIND SOCK -------------------- */
+    rtn_status = NetApp_SockBind((NET_SOCK_ID      ) sock_id,
+                                 (NET_SOCK_ADDR   *)&local_addr,
+                                 (NET_SOCK_ADDR_LEN) local_addr_size,
+                                 (CPU_INT16U       ) 0,
+                                 (CPU_INT32U       ) 0,
+                                 (NET_ERR         *)&err_net);
 
+    if (rtn_status != DEF_OK) {
+        NetApp_SockClose((NET_SOCK_ID ) sock_id,
+                         (CPU_INT32U  ) 0,
+                         (NET_ERR    *)&err_net);
 
-        default:
-            *perr = DHCPc_ERR_ADDR_VALIDATE;
-             break;
+        return (NET_SOCK_BSD_ERR_OPEN);
     }
 
 
-#endif
+    return (sock_id);
 }
-#endif
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_AddrCfg()
+*                                    DHCPc_IPv6_InitStateHandler()
 *
-* Description : Configure the interface's network parameters with the last accepted OFFER.
+* Description : (1) Perform actions associated with the INIT state of a DHCPv6 client :
+*
+*                   (a) Revert   previous lease
+*                   (b) Initialize socket
+*                   (c) Transmit SOLICIT & get ADVERTISE
+*                   (d) Transmit REQUEST & get REPLY
+*                   (e) Configure interface address, delegated prefix & lease timer
 *
-* Argument(s) : pif_info        Pointer to DHCP interface information.
-*               --------        Argument validated in DHCPc_InitStateHandler().
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_MsgRxHandler().
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  Interface's network successfully configured.
-*                               DHCPc_ERR_IF_CFG                Error configuring the interface's network.
+*                               DHCPc_ERR_NONE                  DHCPv6 lease successfully negotiated &
+*                                                                   applied (timer     set).
+*                               DHCPc_ERR_NONE_NO_TMR           DHCPv6 lease successfully negotiated &
+*                                                                   applied (timer NOT set).
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_INIT_SOCK             Error initializing socket.
+*
+*                                                               ----- RETURNED BY DHCPc_IPv6_Exchange() : ------
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCPv6 message.
+*                               DHCPc_ERR_TX                    Transmit error.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+*                                                               ---- RETURNED BY DHCPc_IPv6_LeaseParse() : -----
+*                               DHCPc_ERR_IPv6_STATUS           NO identity association granted.
+*
+*                                                               ---- RETURNED BY DHCPc_IPv6_LeaseApply() : -----
+*                               DHCPc_ERR_ADDR_USED             Leased address already used on the link.
+*                               DHCPc_ERR_IF_CFG                Error configuring the interface's address.
 *
 * Return(s)   : none.
 *
 * Caller(s)   : DHCPc_InitStateHandler().
 *
-* Note(s)     : none.
+* Note(s)     : (2) The lease offered in the ADVERTISE message is kept as the client's pending lease, so
+*                   that the REQUEST message carries its address & prefix as hints (see
+*                   'DHCPc_IPv6_TxMsgPrepare()  Note #2a').  The client's lease is ONLY set once the lease
+*                   granted is applied (see 'dhcp-c.h  DHCPc DHCPv6 INFORMATION DATA TYPE  Note #3').
+*
+*               (3) RFC #8415, section 'Receipt of Reply Messages', states that a client detecting a
+*                   duplicate address "MUST send a Decline message to the server".  The lease declined is
+*                   kept as the pending lease for the DECLINE message, & the negotiation is then restarted
+*                   as for an address found in use by a DHCP client (see 'DHCPc_InitStateHandler()  Note #4').
+*
+*               (4) #### The first valid ADVERTISE message received is selected; the server preference &
+*                   the identity associations offered by other servers are NOT compared.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_AddrCfg (DHCPc_IF_INFO  *pif_info,
-                             DHCPc_ERR      *perr)
+static  void  DHCPc_IPv6_InitStateHandler (DHCPc_IF_INFO  *pif_info,
+                                           DHCPc_ERR      *perr)
 {
-    DHCPc_MSG      *pmsg;
-    DHCP_MSG_HDR   *pmsg_hdr;
-    CPU_INT08U     *popt;
-    CPU_INT08U      opt_val_len;
-    CPU_BOOLEAN     cfgd;
-    NET_IF_NBR      if_nbr;
-    NET_IPv4_ADDR   addr_host;
-    NET_IPv4_ADDR   addr_subnet_mask;
-    NET_IPv4_ADDR   addr_dflt_gateway;
-    NET_ERR         err_net;
+    DHCPc_IPv6_LEASE   lease;
+    NET_IF_NBR         if_nbr;
+    CPU_BOOLEAN        if_en;
+    NET_SOCK_ID        sock_id;
+    CPU_INT16U         nego_retry_cnt;
+    CPU_BOOLEAN        nego_done;
+    CPU_BOOLEAN        nego_dly;
+    CPU_INT32U         time_t1;
+    CPU_INT32U         time_t2;
+    DHCPc_ERR          err;
+    NET_ERR            err_net;
 
 
-    pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;
-    pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+    if_nbr = pif_info->IF_Nbr;
 
-                                                                /* -------------------- GET PARAM --------------------- */
-    addr_subnet_mask  = NET_IPv4_ADDR_NONE;
-    addr_dflt_gateway = NET_IPv4_ADDR_NONE;
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {                                     /* If IF NOT enabled, ...                               */
+       *perr = DHCPc_ERR_IF_INVALID;                            /* ... rtn err.                                         */
+        return;
+    }
 
-                                                                /* Get assign'd addr.                                   */
-    NET_UTIL_VAL_COPY_GET_NET_32(&addr_host, &pmsg_hdr->yiaddr);
+                                                                /* ----------------- REVERT PREV LEASE ---------------- */
+    DHCPc_IPv6_LeaseRevert(pif_info, DEF_YES);
 
-                                                                /* Get assign'd subnet mask.                            */
-    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SUBNET_MASK,
-                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
-                           (CPU_INT16U    ) pmsg->MsgLen,
-                           (CPU_INT08U   *)&opt_val_len);
-    if (popt != (CPU_INT08U *)0) {
-        NET_UTIL_VAL_COPY_GET_NET_32(&addr_subnet_mask, popt);
+                                                                /* --------------------- INIT SOCK -------------------- */
+    sock_id = DHCPc_IPv6_InitSock(if_nbr);
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {
+       *perr = DHCPc_ERR_INIT_SOCK;
+        return;
     }
 
-    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_ROUTER,    /* Get assign'd dflt gateway.                           */
-                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
-                           (CPU_INT16U    ) pmsg->MsgLen,
-                           (CPU_INT08U   *)&opt_val_len);
-    if (popt != (CPU_INT08U *)0) {
-        NET_UTIL_VAL_COPY_GET_NET_32(&addr_dflt_gateway, popt);
+
+                                                                /* --------------- TX SOLICIT & REQUEST --------------- */
+    nego_retry_cnt = 0;
+    nego_done      = DEF_NO;
+    nego_dly       = DEF_NO;
+    time_t1        = 0;
+    time_t2        = 0;
+
+    while ((nego_retry_cnt <  pif_info->Cfg.NegoRetryCnt) &&
+           (nego_done      != DEF_YES)) {
+
+        pif_info->ClientState = DHCP_STATE_INIT;
+
+        if (nego_dly == DEF_YES) {                              /* Dly nego, if req'd.                                  */
+            KAL_Dly(DHCP_INIT_DLY_MS);
+        }
+                                                                /* Tx SOLICIT & get ADVERTISE (see Note #4).            */
+        DHCPc_IPv6_Exchange((NET_SOCK_ID    ) sock_id,
+                            (DHCPc_IF_INFO *) pif_info,
+                            (CPU_INT08U     ) DHCPc_IPv6_MSG_SOLICIT,
+                            (CPU_INT16U     ) pif_info->Cfg.DiscoverRetryCnt,
+                            (DHCPc_ERR     *) perr);
+        if (*perr == DHCPc_ERR_NONE) {
+            DHCPc_IPv6_LeaseParse(pif_info, &lease, &time_t1, &time_t2, perr);
+        }
+        if (*perr == DHCPc_ERR_NONE) {                          /* Keep offered lease (see Note #2).                    */
+            Mem_Copy((void     *)&pif_info->IPv6.LeasePend,
+                     (void     *)&lease,
+                     (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
+        }
+
+        if (*perr != DHCPc_ERR_NONE) {
+            nego_retry_cnt++;
+            nego_dly = DEF_YES;
+
+        } else {                                                /* ADVERTISE rx'd, ...                                  */
+                                                                /* ... tx REQUEST & get REPLY.                          */
+            pif_info->ClientState = DHCP_STATE_REQUESTING;
+
+            DHCPc_IPv6_Exchange((NET_SOCK_ID    ) sock_id,
+                                (DHCPc_IF_INFO *) pif_info,
+                                (CPU_INT08U     ) DHCPc_IPv6_MSG_REQUEST,
+                                (CPU_INT16U     ) pif_info->Cfg.ReqRetryCnt,
+                                (DHCPc_ERR     *) perr);
+            if (*perr == DHCPc_ERR_NONE) {
+                DHCPc_IPv6_LeaseParse(pif_info, &lease, &time_t1, &time_t2, perr);
+            }
+            if (*perr == DHCPc_ERR_NONE) {
+                DHCPc_IPv6_LeaseApply(pif_info, &lease, perr);  /* Cfg addr & push prefix.                              */
+            }
+
+            switch (*perr) {
+                case DHCPc_ERR_NONE:
+                     nego_done = DEF_YES;
+                     break;
+
+
+                case DHCPc_ERR_ADDR_USED:                       /* If addr used, ...                                    */
+                     Mem_Copy((void     *)&pif_info->IPv6.LeasePend,
+                              (void     *)&lease,
+                              (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
+                                                                /* ... tx DECLINE (see Note #3) ...                     */
+                     DHCPc_IPv6_Exchange((NET_SOCK_ID    ) sock_id,
+                                         (DHCPc_IF_INFO *) pif_info,
+                                         (CPU_INT08U     ) DHCPc_IPv6_MSG_DECLINE,
+                                         (CPU_INT16U     ) pif_info->Cfg.ReqRetryCnt,
+                                         (DHCPc_ERR     *)&err);
+                     nego_retry_cnt++;                          /* ... & restart nego.                                  */
+                     nego_dly = DEF_YES;
+                     break;
+
+
+                case DHCPc_ERR_IPv6_STATUS:
+                     nego_retry_cnt++;
+                     nego_dly = DEF_YES;
+                     break;
+
+
+                default:
+                     nego_done = DEF_YES;
+                     break;
+            }
+        }
     }
 
-                                                                /* ------------------- CFG IF ADDR -------------------- */
-    if_nbr = pif_info->IF_Nbr;
-    cfgd   = NetIPv4_CfgAddrAddDynamic(if_nbr, addr_host, addr_subnet_mask, addr_dflt_gateway, &err_net);
-    if (cfgd != DEF_OK) {                                       /* If cfg invalid, ...                                  */
-       *perr = DHCPc_ERR_IF_CFG;                                /* ... rtn err.                                         */
+    NetApp_SockClose((NET_SOCK_ID ) sock_id,                    /* Close sock.                                          */
+                     (CPU_INT32U  ) 0,
+                     (NET_ERR    *)&err_net);
+
+
+    if (*perr != DHCPc_ERR_NONE) {                              /* If nego failed, ...                                  */
+        DHCPc_IPv6_LeaseRevert(pif_info, DEF_YES);              /* ... revert lease & set client state to NONE.         */
+        pif_info->ClientState = DHCP_STATE_NONE;
         return;
     }
 
-   *perr = DHCPc_ERR_NONE;
+                                                                /* ------------------- CFG LEASE TMR ------------------ */
+    DHCPc_IPv6_LeaseTimeCalc(pif_info, time_t1, time_t2, perr);
+    if (*perr != DHCPc_ERR_NONE) {                              /* If err setting tmr, ...                              */
+       *perr = DHCPc_ERR_NONE_NO_TMR;                           /* ... rtn err.                                         */
+    }
+
+    pif_info->ClientState = DHCP_STATE_BOUND;
 }
 
 
 /*
 *********************************************************************************************************
-*                                      DHCPc_AddrLocalLinkCfg()
+*                                   DHCPc_IPv6_RenewStateHandler()
 *
-* Description : (1) Perform action associated with dynamic link-local address configuration
+* Description : (1) Perform actions associated with the RENEWING/REBINDING states of a DHCPv6 client :
 *
-*                   (a) Get random address
-*                   (b) Test address
-*                   (c) Interpret test result
-*                   (d) Configure interface and announce IP address
+*                   (a) Initialize socket
+*                   (b) Transmit RENEW/REBIND & get REPLY
+*                   (c) Configure interface address & delegated prefix
+*                   (d) Transmit DECLINE, if leased address already used on the link
+*                   (e) Configure lease timer
 *
 *
 * Argument(s) : pif_info        Pointer to DHCP interface information.
-*               --------        Argument checked in DHCPc_InitStateHandler().
-*
-*               paddr_hw        Pointer to hardware address buffer.
+*               --------        Argument validated in DHCPc_MsgRxHandler().
 *
-*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*               exp_tmr_msg     Expired timer message.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  Interface configured using a link-local address.
-*                               DHCPc_ERR_IF_CFG                Error configuring the interface's network.
-*
-*                                                               ------ RETURNED BY DHCPc_AddrValidate() : ------
-*                               DHCPc_ERR_ADDR_VALIDATE         Error validating address.
-*                               DHCPc_ERR_ADDR_USED             Address already used on the network.
+*                               DHCPc_ERR_NONE                  DHCPv6 lease successfully renewed/rebound.
+*                               DHCPc_ERR_NONE_NO_TMR           Error setting timer, lease might NOT have
+*                                                                   been renewed/rebound.
+*                               DHCPc_ERR_INVALID_MSG           Invalid timer expiration message.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_INIT_SOCK             Error initializing socket.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : none.
-*
-* Note(s)     : (2) From RFC #3027, section 'Probe details' :
-*
-*                   (a) "If the number of conflicts [experienced in the process of trying to acquire an
-*                       address] exceeds MAX_CONFLICTS, then the host MUST limit the rate at which it
-*                       probes for new addresses to no more than one new address per RATE_LIMIT_INTERVAL".
-*
-*                   (b) "When ready to begin probing, the host should then wait for a random time interval
-*                       selected uniformly in the range zero to PROBE_WAIT seconds, and should then send
-*                       PROBE_NUM probe packets, each of these probe packets spaced randomly, PROBE_MIN to
-*                       PROBE_MAX seconds apart".
-*
-*                       This implementation takes some distance from the RFC by waiting PROBE_WAIT
-*                       seconds before sending the first probe packet.  As for the retransmission of ARP
-*                       packets, this if left to the ARP layer.
+* Caller(s)   : DHCPc_RenewRebindStateHandler().
 *
-*               (3) From RFC #3027, section 'Announcing an Address', "[...] the host MUST announce its
-*                   claimed address by broadcasting ANNOUNCE_NUM ARP announcements, spaced
-*                   ANNOUNCE_INTERVAL seconds apart".
+* Note(s)     : (2) A lease NOT renewed/rebound is handled as a DHCP lease (see 'DHCPc_LeaseTimeUpdate()');
+*                   once the lease expires, the client goes back to the INIT state & the lease is reverted.
 *
-*                   This is being done to make sure hosts on the network do NOT have ARP cache entries
-*                   from other host that had been previously using the same address.
+*               (3) A renewed lease whose new address is found in use on the link is declined (see
+*                   'DHCPc_IPv6_InitStateHandler()  Note #3') & handled as a lease NOT renewed.  The
+*                   client's lease & address are left unchanged (see 'DHCPc_IPv6_LeaseApply()  Note #3'),
+*                   so that the client remains bound until the current lease expires.
 *********************************************************************************************************
 */
 
-#if (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED)
-static  void  DHCPc_AddrLocalLinkCfg (DHCPc_IF_INFO  *pif_info,
-                                      CPU_INT08U     *paddr_hw,
-                                      CPU_INT08U      addr_hw_len,
-                                      DHCPc_ERR      *perr)
+static  void  DHCPc_IPv6_RenewStateHandler (DHCPc_IF_INFO   *pif_info,
+                                            DHCPc_COMM_MSG   exp_tmr_msg,
+                                            DHCPc_ERR       *perr)
 {
-    NET_IPv4_ADDR  addr_host;
-    NET_IPv4_ADDR  addr_net;
-    CPU_INT08U     addr_len;
-    CPU_BOOLEAN    addr_srch_done;
-    CPU_INT08U     nbr_conflicts;
-    CPU_BOOLEAN    cfgd;
-    CPU_INT08U     announce_nbr;
-    CPU_BOOLEAN    announce_done;
-    NET_ERR        err_net;
-
-
-                                                                /* ------------------ GET RANDOM ADDR ----------------- */
-    nbr_conflicts  = 0;
-    addr_srch_done = DEF_NO;
-
-    while ((addr_srch_done != DEF_YES) &&
-           (nbr_conflicts  <=  DHCPc_CFG_LOCAL_LINK_MAX_RETRY)) {
-
-        if (nbr_conflicts > DHCP_LOCAL_LINK_MAX_CONFLICTS) {
-                                                                /* See Note #2a.                                        */
-            KAL_Dly((CPU_INT32U)(DHCP_LOCAL_LINK_RATE_LIMIT_INTERVAL_S * DEF_TIME_NBR_mS_PER_SEC));
-        }
-
-        addr_host =  DHCPc_AddrLocalLinkGet(paddr_hw, addr_hw_len);
-        addr_net  = (NET_IPv4_ADDR)NET_UTIL_HOST_TO_NET_32(addr_host);
-
+    DHCPc_IPv6_LEASE   lease;
+    NET_IF_NBR         if_nbr;
+    CPU_BOOLEAN        if_en;
+    NET_SOCK_ID        sock_id;
+    CPU_INT08U         msg_type;
+    CPU_INT32U         time_t1;
+    CPU_INT32U         time_t2;
+    DHCPc_ERR          err;
+    NET_ERR            err_net;
 
-                                                                /* -------------- VALIDATE ADDR NOT USED -------------- */
-                                                                /* Dly (see Note #2b).                                  */
-        KAL_Dly((CPU_INT32U)(DHCP_LOCAL_LINK_PROBE_WAIT_S * DEF_TIME_NBR_mS_PER_SEC));
 
-                                                                /* Probe addr.                                          */
-        DHCPc_AddrValidate(                pif_info->IF_Nbr,
-                           (NET_IPv4_ADDR) addr_net,
-                           (CPU_INT32U   )(DHCP_LOCAL_LINK_ANNOUNCE_WAIT_S * DEF_TIME_NBR_mS_PER_SEC),
-                           (DHCPc_ERR   *) perr);
-        switch(*perr) {
-            case DHCPc_ERR_NONE:                                /* If addr not used, ...                                */
-                 addr_srch_done = DEF_YES;                      /* ... addr validated.                                  */
-                 break;
+    switch (exp_tmr_msg) {                                      /* Set cur client state.                                */
+        case DHCPc_COMM_MSG_T1_EXPIRED:
+             pif_info->ClientState = DHCP_STATE_RENEWING;
+             msg_type              = DHCPc_IPv6_MSG_RENEW;
+             break;
 
 
-            case DHCPc_ERR_ADDR_USED:                           /* Else if addr used, ...                               */
-                 nbr_conflicts++;                               /* ... restart process.                                 */
-                 break;
+        case DHCPc_COMM_MSG_T2_EXPIRED:
+             pif_info->ClientState = DHCP_STATE_REBINDING;
+             msg_type              = DHCPc_IPv6_MSG_REBIND;
+             break;
 
 
-            case DHCPc_ERR_ADDR_VALIDATE:                       /* Else if any other error, ...                         */
-            default:
-                 addr_srch_done = DEF_YES;                      /* ... stop link-local cfg.                             */
-        }
+        default:
+            *perr = DHCPc_ERR_INVALID_MSG;
+             return;
     }
 
-    if (*perr != DHCPc_ERR_NONE) {
+
+    if_nbr = pif_info->IF_Nbr;
+
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {                                     /* If IF NOT enabled, ...                               */
+       *perr = DHCPc_ERR_IF_INVALID;                            /* ... rtn err.                                         */
         return;
     }
 
-                                                                /* -------------- CFG IF & ANNOUNCE ADDR -------------- */
-    cfgd = NetIPv4_CfgAddrAddDynamic((NET_IF_NBR   ) pif_info->IF_Nbr,
-                                     (NET_IPv4_ADDR) addr_host,
-                                     (NET_IPv4_ADDR) NET_IPv4_ADDR_LOCAL_LINK_MASK,
-                                     (NET_IPv4_ADDR) NET_IPv4_ADDR_NONE,
-                                     (NET_ERR     *)&err_net);
-    if (cfgd != DEF_OK) {
-       *perr = DHCPc_ERR_IF_CFG;
+                                                                /* --------------------- INIT SOCK -------------------- */
+    sock_id = DHCPc_IPv6_InitSock(if_nbr);
+    if (sock_id == NET_SOCK_BSD_ERR_OPEN) {                     /* If sock NOT opened, ...                              */
+        DHCPc_LeaseTimeUpdate(pif_info, exp_tmr_msg, perr);     /* ... update cur lease & cfg tmr ...                   */
+        if (*perr == DHCPc_ERR_NONE) {
+           *perr = DHCPc_ERR_INIT_SOCK;                         /* ... & set err.                                       */
+
+        } else {
+           *perr = DHCPc_ERR_NONE_NO_TMR;
+        }
+
         return;
     }
 
-    addr_len      = sizeof(NET_IPv4_ADDR);
-    announce_nbr  = 0;
-    announce_done = DEF_NO;
+                                                                /* ------------ TX RENEW/REBIND & GET REPLY ----------- */
+    time_t1 = 0;
+    time_t2 = 0;
 
+    DHCPc_IPv6_Exchange((NET_SOCK_ID    ) sock_id,
+                        (DHCPc_IF_INFO *) pif_info,
+                        (CPU_INT08U     ) msg_type,
+                        (CPU_INT16U     ) pif_info->Cfg.ReqRetryCnt,
+                        (DHCPc_ERR     *) perr);
+    if (*perr == DHCPc_ERR_NONE) {
+        DHCPc_IPv6_LeaseParse(pif_info, &lease, &time_t1, &time_t2, perr);
+    }
 
-    while ((announce_nbr  < DHCP_LOCAL_LINK_ANNOUNCE_NUM) &&    /* See Note #3.                                         */
-           (announce_done != DEF_YES)) {
+                                                                /* ------------------- APPLY LEASE -------------------- */
+    if (*perr == DHCPc_ERR_NONE) {
+        DHCPc_IPv6_LeaseApply(pif_info, &lease, perr);          /* Cfg addr & push prefix.                              */
+    }
 
-        NetARP_TxReqGratuitous((NET_PROTOCOL_TYPE) NET_PROTOCOL_TYPE_IP_V4,
-                               (CPU_INT08U      *)&addr_net,
-                               (CPU_INT08U       ) addr_len,
-                               (NET_ERR         *)&err_net);
+    if (*perr == DHCPc_ERR_ADDR_USED) {                         /* If addr used, tx DECLINE (see Note #3).              */
+        Mem_Copy((void     *)&pif_info->IPv6.LeasePend,
+                 (void     *)&lease,
+                 (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
+        DHCPc_IPv6_Exchange((NET_SOCK_ID    ) sock_id,
+                            (DHCPc_IF_INFO *) pif_info,
+                            (CPU_INT08U     ) DHCPc_IPv6_MSG_DECLINE,
+                            (CPU_INT16U     ) pif_info->Cfg.ReqRetryCnt,
+                            (DHCPc_ERR     *)&err);
+    }
 
-        if (err_net == NET_ARP_ERR_NONE) {
-            KAL_Dly((CPU_INT32U)(DHCP_LOCAL_LINK_ANNOUNCE_INTERVAL_S * DEF_TIME_NBR_mS_PER_SEC));
+    NetApp_SockClose((NET_SOCK_ID ) sock_id,
+                     (CPU_INT32U  ) 0,
+                     (NET_ERR    *)&err_net);
 
-        } else {
-            announce_done = DEF_YES;
-        }
+    if (*perr == DHCPc_ERR_NONE) {                              /* If lease renewed/rebound, ...                        */
+                                                                /* ... calc lease time & cfg tmr.                       */
+        DHCPc_IPv6_LeaseTimeCalc(pif_info, time_t1, time_t2, perr);
 
-        announce_nbr++;
+    } else {                                                    /* Else lease NOT renewed/rebound, ...                  */
+        DHCPc_LeaseTimeUpdate(pif_info, exp_tmr_msg, perr);     /* ... update cur lease & cfg tmr (see Note #2).        */
     }
 
 
-   *perr = DHCPc_ERR_NONE;
+    if (*perr != DHCPc_ERR_NONE) {                              /* If err setting tmr, ...                              */
+       *perr = DHCPc_ERR_NONE_NO_TMR;                           /* ... rtn err.                                         */
+    }
+
+    pif_info->ClientState = DHCP_STATE_BOUND;
 }
-#endif
 
 
 /*
 *********************************************************************************************************
-*                                      DHCPc_AddrLocalLinkGet()
+*                                    DHCPc_IPv6_StopStateHandler()
 *
-* Description : (1) Generate a pseudo-random IPv4 address in the Link-Local reserved range :
+* Description : (1) Perform actions associated with the STOPPING state of a DHCPv6 client :
 *
-*                   (a) Generate a seed from the hardware address
-*                   (b) Generate a seed from the current time
-*                   (c) Get pseudo-random number from seeds
-*                   (d) Generate address
+*                   (a) Revert   interface address & delegated prefix
+*                   (b) Transmit RELEASE message, if necessary
+*                   (c) Free     interface's objects
 *
 *
-* Argument(s) : paddr_hw        Pointer to hardware address buffer.
-*               --------        Argument validated in DHCPc_AddrLocalLinkCfg().
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument checked in DHCPc_MsgRxHandler().
 *
-*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-* Return(s)   : IPv4 Link-Local address.
+*                               DHCPc_ERR_NONE                  DHCPv6 client successfully stopped.
 *
-* Caller(s)   : DHCPc_AddrLocalLinkCfg().
+*                                                               ----- RETURNED BY DHCPc_OS_Lock() : -----
+*                               DHCPc_OS_ERR_LOCK               Error acquiring DHCPc lock.
 *
-* Note(s)     : (2) The seeds are generated by creating 32-bit values from :
+* Return(s)   : none.
 *
-*                   (a) The two least significant bytes of the hardware address, shifted by 16 bits &
-*                   (b) The     least significant byte  of the current time.
+* Caller(s)   : DHCPc_StopStateHandler().
 *
-*               (3) The random address returned from this function is obtained by adding an "offset"
-*                   generated from the random number to the link-local base address (defined by
-*                   NET_IP_ADDR_LOCAL_LINK_HOST_MIN).
+* Note(s)     : (2) RFC #8415, section 'Creation and Transmission of Release Messages', states that "the
+*                   client MUST stop using all of the leases being released before the client begins the
+*                   Release message exchange process".  The address & the prefix are hence reverted first.
+*
+*               (3) As for a DHCPRELEASE message (see 'DHCPc_StopStateHandler()  Note #3'), NO error
+*                   handling is performed on the RELEASE message.
+*
+*                   #### The RELEASE message is transmitted once & NOT retransmitted.
+*
+*               (4) See 'DHCPc_StopStateHandler()  Note #7'.
 *********************************************************************************************************
 */
 
-#if (DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN == DEF_ENABLED)
-static  NET_IPv4_ADDR  DHCPc_AddrLocalLinkGet (CPU_INT08U  *paddr_hw,
-                                               CPU_INT08U   addr_hw_len)
+static  void  DHCPc_IPv6_StopStateHandler (DHCPc_IF_INFO  *pif_info,
+                                           DHCPc_ERR      *perr)
 {
-    CPU_INT32U     time_cur;
-    CPU_INT32U     seed_hw_addr;
-    CPU_INT32U     seed_time;
-    CPU_INT32U     random;
-    NET_IPv4_ADDR  addr;
+    DHCPc_STATE   client_state;
+    CPU_BOOLEAN   tx_release;
+    NET_SOCK_ID   sock_id;
+    DHCPc_TMR    *ptmr;
+    DHCPc_COMM   *pcomm;
+    DHCPc_ERR     err;
+    NET_ERR       err_net;
 
 
-                                                                /* ------------------ GENERATE SEEDS ------------------ */
-    seed_hw_addr = 0;                                           /* See Note #2a.                                        */
-    seed_hw_addr = (((CPU_INT32U)*(paddr_hw + addr_hw_len - 2) << 24) |
-                    ((CPU_INT32U)*(paddr_hw + addr_hw_len - 1) << 16));
+    client_state          = pif_info->ClientState;              /* Get client state ...                                 */
+    pif_info->ClientState = DHCP_STATE_STOPPING;                /* ... and set it to STOPPING.                          */
 
+    switch (client_state) {
+        case DHCP_STATE_BOUND:
+        case DHCP_STATE_RENEWING:
+        case DHCP_STATE_REBINDING:
+             tx_release = DEF_YES;
+             break;
 
-    time_cur  =  DHCPc_OS_TimeGet_tick();                       /* See Note #2b.                                        */
-    seed_time = (time_cur & 0x0000FFFF);
 
-                                                                /* ---------------- GET PSEUDO-RAND NBR --------------- */
-    random = (seed_time | seed_hw_addr);                        /* OR the two seeds.                                    */
+        default:
+             tx_release = DEF_NO;
+             break;
+    }
 
-                                                                /* ------------------- GENERATE ADDR ------------------ */
-                                                                /* See Note #3.                                         */
-    addr =            NET_IPv4_ADDR_LOCAL_LINK_HOST_MIN +
-           (random % (NET_IPv4_ADDR_LOCAL_LINK_HOST_MAX - NET_IPv4_ADDR_LOCAL_LINK_HOST_MIN + 1));
+                                                                /* ------------------- REVERT LEASE ------------------- */
+    DHCPc_IPv6_LeaseRevert(pif_info, DEF_NO);                   /* See Note #2.                                         */
 
-    return (addr);
+                                                                /* -------------------- TX RELEASE -------------------- */
+    if (tx_release == DEF_YES) {
+        sock_id = DHCPc_IPv6_InitSock(pif_info->IF_Nbr);
+        if (sock_id != NET_SOCK_BSD_ERR_OPEN) {                 /* See Note #3.                                         */
+            DHCPc_IPv6_Exchange((NET_SOCK_ID    ) sock_id,
+                                (DHCPc_IF_INFO *) pif_info,
+                                (CPU_INT08U     ) DHCPc_IPv6_MSG_RELEASE,
+                                (CPU_INT16U     ) 1u,
+                                (DHCPc_ERR     *)&err);
+
+            NetApp_SockClose((NET_SOCK_ID ) sock_id,            /* Close sock.                                          */
+                             (CPU_INT32U  ) 0,
+                             (NET_ERR    *)&err_net);
+        }
+    }
+
+                                                                /* ---------------- FREE IF'S DATA OBJ ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #4.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+    ptmr = pif_info->Tmr;
+    if (ptmr != (DHCPc_TMR *)0) {                               /* If lease tmr not NULL, ...                           */
+        pcomm = (DHCPc_COMM *)ptmr->Obj;
+        if (pcomm != (DHCPc_COMM *)0) {
+            DHCPc_CommFree(pcomm);                              /* ...    free comm       ...                           */
+        }
+
+        DHCPc_TmrFree(ptmr);                                    /* ...  & free tmr.                                     */
+        pif_info->Tmr = (DHCPc_TMR *)0;                         /* Prevents a double-free of the timer.                 */
+    }
+
+    DHCPc_IF_InfoMsgSet(pif_info, (DHCPc_MSG *)0, perr);        /* Free msg.                                            */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    DHCPc_IF_InfoFree(pif_info);
+
+    DHCPc_OS_Unlock();
+
+
+   *perr = DHCPc_ERR_NONE;
 }
-#endif
 
 
 /*
 *********************************************************************************************************
-*                                        DHCPc_LeaseTimeCalc()
+*                                        DHCPc_IPv6_Exchange()
 *
-* Description : (1) Calculate the lease time & renewing/rebinding times for last accepted lease :
+* Description : (1) Perform a DHCPv6 message exchange :
 *
-*                   (a) Get           lease time from ACK message
-*                   (b) Get/calculate times T1 & T2
-*                   (c) Update        times with negotiation duration & set minimum
-*                   (d) Configure     timer
+*                   (a) Get      message
+*                   (b) Generate transaction ID
+*                   (c) Transmit message to all DHCPv6 servers & relay agents
+*                   (d) Get reply from server(s)
+*                   (e) Copy reply & server DUID
 *
 *
-* Argument(s) : pif_info        Pointer to DHCP interface information.
-*               --------        Argument validated in DHCPc_InitStateHandler(),
-*                                                     DHCPc_RenewRebindStateHandler().
+* Argument(s) : sock_id         Socket ID of socket to transmit & receive DHCPv6 data.
+*
+*               pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_IPv6_InitStateHandler(),
+*                                                     DHCPc_IPv6_RenewStateHandler(),
+*                                                     DHCPc_IPv6_StopStateHandler().
+*
+*               msg_type        DHCPv6 message type to transmit.
+*
+*               retry_max       Maximum number of transmissions.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  Lease time successfully calculated.
-*                               DHCPc_ERR_TMR_CFG               Configuration timer error.
+*                               DHCPc_ERR_NONE                  Message successfully transmitted & reply
+*                                                                   received.
+*
+*                                                               --------- RETURNED BY DHCPc_MsgGet() : ---------
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*
+*                                                               --- RETURNED BY DHCPc_IPv6_TxMsgPrepare() : ----
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCPv6 message.
+*
+*                                                               ----------- RETURNED BY DHCPc_Tx() : -----------
+*                               DHCPc_ERR_TX                    Transmit error.
+*
+*                                                               ------ RETURNED BY DHCPc_IPv6_RxReply() : ------
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+*                                                               ----- RETURNED BY DHCPc_IF_InfoMsgSet() : ------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_InitStateHandler(),
-*               DHCPc_RenewRebindStateHandler().
+* Caller(s)   : DHCPc_IPv6_InitStateHandler(),
+*               DHCPc_IPv6_RenewStateHandler(),
+*               DHCPc_IPv6_StopStateHandler().
 *
-* Note(s)     : none.
+* Note(s)     : (2) RFC #8415, section 'Transmission of Messages by a Client', states that "the client
+*                   MUST use the same transaction ID" for the retransmissions of a message.  A new
+*                   transaction ID is hence generated for each exchange only, & the elapsed time is
+*                   counted from the first transmission of the exchange.
+*
+*               (3) #### The retransmissions are delayed with the interface's back-off delays & receive
+*                   timeout (see 'DHCPc_CalcBackOff()') rather than with the IRT & MRT parameters of RFC
+*                   #8415; the socket receive queue is closed during the delays (see 'DHCPc_Discover()
+*                   Note #4').
 *********************************************************************************************************
 */
 
-static  void  DHCPc_LeaseTimeCalc (DHCPc_IF_INFO  *pif_info,
+static  void  DHCPc_IPv6_Exchange (NET_SOCK_ID     sock_id,
+                                   DHCPc_IF_INFO  *pif_info,
+                                   CPU_INT08U      msg_type,
+                                   CPU_INT16U      retry_max,
                                    DHCPc_ERR      *perr)
 {
-    DHCPc_MSG   *pmsg;
-    CPU_INT08U  *popt;
-    CPU_INT08U   opt_val_len;
-    CPU_INT32U   time_lease;
-    CPU_INT32U   time_t1;
-    CPU_INT32U   time_t2;
-    CPU_INT32U   time_nego_stop;
-    CPU_INT32U   time_nego_sec;
+    DHCPc_MSG           *pmsg;
+    CPU_INT16U           retry_cnt;
+    CPU_BOOLEAN          done;
+    CPU_BOOLEAN          dly;
+    CPU_INT32U           dly_ms;
+    CPU_INT16U           msg_len;
+    NET_SOCK_ADDR_IPv6   addr_server;
+    NET_SOCK_ADDR_LEN    addr_server_size;
+    CPU_INT08U          *popt;
+    CPU_INT16U           opt_val_len;
+    NET_ERR              net_err;
 
 
-    time_lease = DHCP_LEASE_INFINITE;
+                                                                /* ---------------------- GET MSG --------------------- */
+    pmsg = DHCPc_MsgGet(perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        return;
+    }
 
-                                                                /* ------------- GET LEASE TIME FROM ACK -------------- */
-    pmsg = pif_info->MsgPtr;
-                                                                /* Get lease time.                                      */
-    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_IP_ADDRESS_LEASE_TIME,
-                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
-                           (CPU_INT16U    ) pmsg->MsgLen,
-                           (CPU_INT08U   *)&opt_val_len);
-    if (popt != (CPU_INT08U *)0) {
-        NET_UTIL_VAL_COPY_GET_NET_32(&time_lease, popt);
+                                                                /* ------------------- GENERATE XID ------------------- */
+    pif_info->TransactionID = (pif_info->TransactionID + 1u) & DHCPc_IPv6_MSG_XID_MASK;
+    pif_info->AcqStartTime  =  DHCPc_TimeGet_sec();             /* See Note #2.                                         */
+
+    addr_server_size = sizeof(addr_server);                     /* All_DHCP_Relay_Agents_and_Servers addr.              */
+    Mem_Clr((void     *)&addr_server,
+            (CPU_SIZE_T) addr_server_size);
+    addr_server.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V6;
+    addr_server.Port       = NET_UTIL_HOST_TO_NET_16(DHCPc_IPv6_PORT_SERVER);
+    Mem_Copy((void     *)&addr_server.Addr,
+             (void     *)&DHCPc_IPv6_AddrSrvAll[0],
+             (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+
+
+    retry_cnt = 0;
+    done      = DEF_NO;
+    dly       = DEF_NO;
+    dly_ms    = 0;
+
+    while ((retry_cnt <  retry_max) &&
+           (done      != DEF_YES)) {
+
+        if (dly == DEF_YES) {                                   /* Dly re-tx (see Note #3).                             */
+            dly_ms = DHCPc_CalcBackOff(pif_info, dly_ms);
+
+            (void)NetSock_CfgRxQ_Size( sock_id,
+                                       NET_SOCK_DATA_SIZE_MIN,
+                                      &net_err);
+            KAL_Dly(DHCPc_CalcBackOffRand(dly_ms));
+
+            (void)NetSock_CfgRxQ_Size( sock_id,
+                                       NET_SOCK_CFG_RX_Q_SIZE_OCTET,
+                                      &net_err);
+        }
+
+                                                                /* ----------------- PREPARE & TX MSG ----------------- */
+        msg_len = DHCPc_IPv6_TxMsgPrepare((DHCPc_IF_INFO *) pif_info,
+                                          (CPU_INT08U     ) msg_type,
+                                          (CPU_INT08U    *)&pmsg->MsgBuf[0],
+                                          (CPU_INT16U     ) DHCP_MSG_BUF_SIZE,
+                                          (DHCPc_ERR     *) perr);
+        if (*perr != DHCPc_ERR_NONE) {
+            DHCPc_MsgFree(pmsg);
+            return;
+        }
+
+        DHCPc_Tx((NET_SOCK_ID      ) sock_id,
+                 (void            *)&pmsg->MsgBuf[0],
+                 (CPU_INT16U       ) msg_len,
+                 (NET_SOCK_ADDR   *)&addr_server,
+                 (NET_SOCK_ADDR_LEN) addr_server_size,
+                 (DHCPc_ERR       *) perr);
+
+                                                                /* -------------- RX REPLY FROM SERVER(S) ------------- */
+        if (*perr == DHCPc_ERR_NONE) {
+            pmsg->MsgLen = DHCP_MSG_BUF_SIZE;
+            DHCPc_IPv6_RxReply((NET_SOCK_ID    ) sock_id,
+                               (DHCPc_IF_INFO *) pif_info,
+                               (CPU_INT08U     ) msg_type,
+                               (CPU_INT08U    *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    *)&pmsg->MsgLen,
+                               (DHCPc_ERR     *) perr);
+        }
+
+        if (*perr == DHCPc_ERR_NONE) {
+            done = DEF_YES;
+
+        } else {                                                /* If tx or rx err, ...                                 */
+            dly  = DEF_YES;                                     /* ... re-tx msg.                                       */
+            retry_cnt++;
+        }
+    }
+
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_MsgFree(pmsg);
+        return;
     }
 
-    if (time_lease == DHCP_LEASE_INFINITE) {                    /* If lease time infinite, ...                          */
-        pif_info->LeaseTime_sec = DHCP_LEASE_INFINITE;
-        pif_info->T1_Time_sec   = DHCP_LEASE_INFINITE;
-        pif_info->T2_Time_sec   = DHCP_LEASE_INFINITE;
+                                                                /* ----------- COPY REPLY IN IF INFO STRUCT ----------- */
+                                                                /* Get srv DUID (validated in RxReplyValidate()).       */
+    popt = DHCPc_IPv6_MsgGetOpt((CPU_INT16U  ) DHCPc_IPv6_OPT_SERVERID,
+                                (CPU_INT08U *)&pmsg->MsgBuf[DHCPc_IPv6_MSG_HDR_LEN],
+                                (CPU_INT16U  )(pmsg->MsgLen - DHCPc_IPv6_MSG_HDR_LEN),
+                                (CPU_INT16U *)&opt_val_len);
+    Mem_Copy((void     *)&pif_info->IPv6.ServerID[0],
+             (void     *) popt,
+             (CPU_SIZE_T) opt_val_len);
+    pif_info->IPv6.ServerID_Len = (CPU_INT08U)opt_val_len;
 
-       *perr = DHCPc_ERR_NONE;                                  /* ... NO tmr to set.                                   */
+    DHCPc_IF_InfoMsgSet(pif_info, pmsg, perr);                  /* Set msg ptr to rx'd reply.                           */
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_MsgFree(pmsg);
         return;
     }
+}
 
-                                                                /* Get renewal time.                                    */
-    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_RENEWAL_TIME_VALUE,
-                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
-                           (CPU_INT16U    ) pmsg->MsgLen,
-                           (CPU_INT08U   *)&opt_val_len);
-    if (popt != (CPU_INT08U *)0) {
-        NET_UTIL_VAL_COPY_GET_NET_32(&time_t1, popt);
 
-    } else {
-        time_t1 = (CPU_INT32U)(time_lease * DHCP_T1_LEASE_FRACTION);
-    }
+/*
+*********************************************************************************************************
+*                                        DHCPc_IPv6_RxReply()
+*
+* Description : Receive a DHCPv6 reply message.
+*
+* Argument(s) : sock_id             Socket ID of socket to receive DHCPv6 reply message.
+*
+*               pif_info            Pointer to DHCP interface information.
+*               --------            Argument checked in DHCPc_IPv6_Exchange().
+*
+*               msg_type            Type of the transmitted DHCPv6 message.
+*
+*               pmsg_buf            Pointer to DHCPv6 message buffer to receive reply.
+*               --------            Argument checked in DHCPc_IPv6_Exchange().
+*
+*               pmsg_buf_len        Pointer to a variable to ... :
+*
+*                                       (a) Pass the size of the message buffer pointed to by 'pmsg_buf'.
+*                                       (b) (1) Return the actual size of the received message buffer, if NO errors;
+*                                           (2) Return 0,                                              otherwise.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  DHCPv6 reply successfully received.
+*
+*                                                               ----------- RETURNED BY DHCPc_Rx() : -----------
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IPv6_Exchange().
+*
+* Note(s)     : (1) Received messages that are NOT valid replies for the client are silently discarded
+*                   (see 'DHCPc_IPv6_RxReplyValidate()').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_IPv6_RxReply (NET_SOCK_ID     sock_id,
+                                  DHCPc_IF_INFO  *pif_info,
+                                  CPU_INT08U      msg_type,
+                                  CPU_INT08U     *pmsg_buf,
+                                  CPU_INT16U     *pmsg_buf_len,
+                                  DHCPc_ERR      *perr)
+{
+    CPU_BOOLEAN         rx_valid;
+    CPU_BOOLEAN         rx_err;
+    NET_SOCK_ADDR       addr_remote;
+    NET_SOCK_ADDR_LEN   addr_remote_size;
+    CPU_INT16U          rx_msg_len;
 
-                                                                /* Get rebinding time.                                  */
-    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_REBINDING_TIME_VALUE,
-                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
-                           (CPU_INT16U    ) pmsg->MsgLen,
-                           (CPU_INT08U   *)&opt_val_len);
-    if (popt != (CPU_INT08U *)0) {
-        NET_UTIL_VAL_COPY_GET_NET_32(&time_t2, popt);
 
-    } else {
-        time_t2 = (CPU_INT32U)(time_lease * DHCP_T2_LEASE_FRACTION);
-    }
+    rx_valid   = DEF_NO;
+    rx_err     = DEF_NO;
+    rx_msg_len = 0;
 
+    while ((rx_valid != DEF_YES) &&
+           (rx_err   != DEF_YES)) {
 
-                                                                /* ----------------- CALC LEASE TIME ------------------ */
-    time_nego_stop = DHCPc_OS_TimeGet_tick();
-    time_nego_sec  = DHCPc_OS_TimeCalcElapsed_sec(pif_info->NegoStartTime,
-                                                  time_nego_stop);
+        addr_remote_size = sizeof(addr_remote);
 
-    if (time_t1 >  time_nego_sec) {                             /* Subst nego time.                                     */
-        time_t1 -= time_nego_sec;
-    }
+        rx_msg_len = DHCPc_Rx((NET_SOCK_ID        ) sock_id,
+                              (void              *) pmsg_buf,
+                              (CPU_INT16U         )*pmsg_buf_len,
+                              (CPU_INT32U         ) pif_info->Cfg.RxTimeout_ms,
+                              (CPU_INT16U         ) DHCPc_RX_MAX_RETRY,
+                              (NET_SOCK_ADDR     *)&addr_remote,
+                              (NET_SOCK_ADDR_LEN *)&addr_remote_size,
+                              (DHCPc_ERR         *) perr);
 
-    if (time_t2 >  time_nego_sec) {
-        time_t2 -= time_nego_sec;
-    }
+        if (*perr == DHCPc_ERR_NONE) {                          /* Validate msg (see Note #1).                          */
+            rx_valid = DHCPc_IPv6_RxReplyValidate((DHCPc_IF_INFO *) pif_info,
+                                                  (CPU_INT08U     ) msg_type,
+                                                  (CPU_INT08U    *) pmsg_buf,
+                                                  (CPU_INT16U     ) rx_msg_len);
 
-    if (time_lease >  time_nego_sec) {
-        time_lease -= time_nego_sec;
+        } else {
+            rx_err = DEF_YES;
+        }
     }
 
-    pif_info->T1_Time_sec   = time_t1;
-    pif_info->T2_Time_sec   = time_t2;
-    pif_info->LeaseTime_sec = time_lease;
-
-
-                                                                /* --------------------- CFG TMR ---------------------- */
-    DHCPc_TmrCfg((DHCPc_IF_INFO *)pif_info,
-                 (DHCPc_COMM_MSG )DHCPc_COMM_MSG_T1_EXPIRED,
-                 (CPU_INT32U     )pif_info->T1_Time_sec,
-                 (DHCPc_ERR     *)perr);
-
     if (*perr != DHCPc_ERR_NONE) {
-        *perr  = DHCPc_ERR_TMR_CFG;
+       *pmsg_buf_len = 0;
+        return;
     }
+
+   *pmsg_buf_len = rx_msg_len;
 }
 
 
 /*
 *********************************************************************************************************
-*                                       DHCPc_LeaseTimeUpdate()
+*                                    DHCPc_IPv6_RxReplyValidate()
 *
-* Description : (1) Update the lease time & renewing/rebinding times following lease extension failure :
+* Description : (1) Validate a received DHCPv6 reply message :
 *
-*                   (a) Update lease times
-*                   (b) Determine timer value & message
-*                   (c) Configure timer
+*                   (a) length
+*                   (b) message type
+*                   (c) transaction ID
+*                   (d) client  DUID
+*                   (e) server  DUID
 *
 *
-* Argument(s) : pif_info        Pointer to DHCP interface information.
-*               --------        Argument validated in DHCPc_RenewRebindStateHandler().
+* Argument(s) : pif_info            Pointer to DHCP interface information.
+*               --------            Argument checked in DHCPc_IPv6_RxReply().
 *
-*               exp_tmr_msg     Message for expired timer.
+*               msg_type            Type of the transmitted DHCPv6 message.
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
+*               pmsg_buf            Pointer to received DHCPv6 message buffer.
+*               --------            Argument checked in DHCPc_IPv6_RxReply().
 *
-*                               DHCPc_ERR_NONE                  Lease time successfully updated & timer set.
-*                               DHCPc_ERR_TMR_INVALID_MSG       Invalid expiration timer message.
-*                               DHCPc_ERR_TMR_CFG               Configuration timer error.
+*               msg_len             Length of the received DHCPv6 message (in octets).
 *
-* Return(s)   : none.
+* Return(s)   : DEF_YES, if the message is a valid reply for the client.
 *
-* Caller(s)   : DHCPc_RenewRebindStateHandler().
+*               DEF_NO,  otherwise.
 *
-* Note(s)     : (2) From RFC #2131, section 'Reacquisition and expiration', "In both RENEWING and
-*                   REBINDING states, if the client receives no response to its DHCPREQUEST message, the
-*                   client SHOULD wait one-half of the remaining time until T2 (in RENEWING state) and
-*                   one-half of the remaining lease time (in REBINDING state), down to a minimum of 60
-*                   seconds, before retransmitting the DHCPREQUEST message".
+* Caller(s)   : DHCPc_IPv6_RxReply().
 *
-*                   However, in order to prevent a miss on one of the followed times (T1, T2, or the
-*                   lease itself), this implementation waits down to a remaining time of 5 minutes until
-*                   T2 (RENEWING) or the lease time (REBINDING).
+* Note(s)     : (2) A SOLICIT message is answered by ADVERTISE messages; every other message is answered by
+*                   a REPLY message (see RFC #8415, section 'Message Types').
+*
+*               (3) RFC #8415, section 'Receipt of Reply Messages', states that the client MUST discard any
+*                   reply that does NOT include a Server Identifier option.  The replies to messages sent to
+*                   a specific server MUST also come from that server; the reply to a REBIND message MAY
+*                   come from any server.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_LeaseTimeUpdate (DHCPc_IF_INFO   *pif_info,
-                                     DHCPc_COMM_MSG   exp_tmr_msg,
-                                     DHCPc_ERR       *perr)
+static  CPU_BOOLEAN  DHCPc_IPv6_RxReplyValidate (DHCPc_IF_INFO  *pif_info,
+                                                 CPU_INT08U      msg_type,
+                                                 CPU_INT08U     *pmsg_buf,
+                                                 CPU_INT16U      msg_len)
 {
-    CPU_INT32U      time_nego_stop;
-    CPU_INT32U      time_nego_sec;
-    CPU_INT32U      tmr_val_sec;
-    DHCPc_COMM_MSG  tmr_msg;
-
-
-    time_nego_stop = DHCPc_OS_TimeGet_tick();
-    time_nego_sec  = DHCPc_OS_TimeCalcElapsed_sec(pif_info->NegoStartTime, time_nego_stop);
+    DHCPc_IPv6_INFO  *pinfo;
+    CPU_INT08U        msg_type_reply;
+    CPU_INT32U        transaction_id;
+    CPU_INT08U       *popts;
+    CPU_INT16U        opts_len;
+    CPU_INT08U       *popt;
+    CPU_INT16U        opt_val_len;
+    CPU_BOOLEAN       match;
 
-                                                                /* ---------------- UPDATE LEASE TIMES ---------------- */
-                                                                /* Dec expired tmr time from other times.               */
-    switch (exp_tmr_msg) {
-        case DHCPc_COMM_MSG_T1_EXPIRED:
-             if (pif_info->LeaseTime_sec >  pif_info->T1_Time_sec) {
-                 pif_info->LeaseTime_sec -= pif_info->T1_Time_sec;
-             } else {
-                 pif_info->LeaseTime_sec  = 0;
-             }
 
-             if (pif_info->T2_Time_sec >  pif_info->T1_Time_sec) {
-                 pif_info->T2_Time_sec -= pif_info->T1_Time_sec;
-             } else {
-                 pif_info->T2_Time_sec  = 0;
-             }
+    pinfo = &pif_info->IPv6;
 
-             pif_info->T1_Time_sec = 0;
-             break;
+                                                                /* ------------------- VALIDATE LEN ------------------- */
+    if (msg_len < DHCPc_IPv6_MSG_HDR_LEN) {
+        return (DEF_NO);
+    }
 
+                                                                /* ----------------- VALIDATE MSG TYPE ---------------- */
+    if (msg_type == DHCPc_IPv6_MSG_SOLICIT) {                   /* See Note #2.                                         */
+        msg_type_reply = DHCPc_IPv6_MSG_ADVERTISE;
+    } else {
+        msg_type_reply = DHCPc_IPv6_MSG_REPLY;
+    }
 
-        case DHCPc_COMM_MSG_T2_EXPIRED:
-             if (pif_info->LeaseTime_sec >  pif_info->T2_Time_sec) {
-                 pif_info->LeaseTime_sec -= pif_info->T2_Time_sec;
-             } else {
-                 pif_info->LeaseTime_sec  = 0;
-             }
+    if (pmsg_buf[0] != msg_type_reply) {
+        return (DEF_NO);
+    }
 
-             pif_info->T2_Time_sec = 0;
-             pif_info->T1_Time_sec = 0;
-             break;
+                                                                /* -------------- VALIDATE TRANSACTION ID ------------- */
+    transaction_id = ((CPU_INT32U)pmsg_buf[1] << 16u) |
+                     ((CPU_INT32U)pmsg_buf[2] <<  8u) |
+                      (CPU_INT32U)pmsg_buf[3];
+    if (transaction_id != pif_info->TransactionID) {
+        return (DEF_NO);
+    }
 
+    popts    = &pmsg_buf[DHCPc_IPv6_MSG_HDR_LEN];
+    opts_len =  msg_len - DHCPc_IPv6_MSG_HDR_LEN;
 
-        default:
-            *perr = DHCPc_ERR_TMR_INVALID_MSG;
-             return;
+                                                                /* --------------- VALIDATE CLIENT DUID --------------- */
+    popt = DHCPc_IPv6_MsgGetOpt(DHCPc_IPv6_OPT_CLIENTID, popts, opts_len, &opt_val_len);
+    if ((popt        == (CPU_INT08U *)0) ||
+        (opt_val_len !=  pinfo->DUID_Len)) {
+        return (DEF_NO);
     }
 
-                                                                /* Dec time elapsed since tmr expired.                  */
-    if (pif_info->LeaseTime_sec >  time_nego_sec) {
-        pif_info->LeaseTime_sec -= time_nego_sec;
+    match = Mem_Cmp((void     *) popt,
+                    (void     *)&pinfo->DUID[0],
+                    (CPU_SIZE_T) opt_val_len);
+    if (match != DEF_YES) {
+        return (DEF_NO);
     }
 
-    if (pif_info->T2_Time_sec >  time_nego_sec) {
-        pif_info->T2_Time_sec -= time_nego_sec;
+                                                                /* --------------- VALIDATE SERVER DUID --------------- */
+    popt = DHCPc_IPv6_MsgGetOpt(DHCPc_IPv6_OPT_SERVERID, popts, opts_len, &opt_val_len);
+    if ((popt        == (CPU_INT08U *)0) ||                     /* See Note #3.                                         */
+        (opt_val_len ==  0u)               ||
+        (opt_val_len >   DHCPc_IPv6_SRV_ID_LEN_MAX)) {
+        return (DEF_NO);
     }
 
-
-                                                                /* ------------- DETERMINE TMR VAL & MSG -------------- */
-    switch (exp_tmr_msg) {                                      /* See Note #2.                                         */
-        case DHCPc_COMM_MSG_T1_EXPIRED:
-             if (pif_info->T2_Time_sec > (2 * DHCP_MIN_RETX_TIME_S)) {
-                 tmr_val_sec           = (pif_info->T2_Time_sec / 2);
-                 pif_info->T1_Time_sec =  tmr_val_sec;
-
-                 tmr_msg     = DHCPc_COMM_MSG_T1_EXPIRED;
-
-             } else {
-                 tmr_val_sec = pif_info->T2_Time_sec;
-                 tmr_msg     = DHCPc_COMM_MSG_T2_EXPIRED;
+    switch (msg_type) {
+        case DHCPc_IPv6_MSG_REQUEST:
+        case DHCPc_IPv6_MSG_RENEW:
+        case DHCPc_IPv6_MSG_RELEASE:
+        case DHCPc_IPv6_MSG_DECLINE:
+             if (opt_val_len != pinfo->ServerID_Len) {
+                 return (DEF_NO);
              }
-             break;
-
-
-        case DHCPc_COMM_MSG_T2_EXPIRED:
-             if (pif_info->LeaseTime_sec > (2 * DHCP_MIN_RETX_TIME_S)) {
-                 tmr_val_sec           = (pif_info->LeaseTime_sec / 2);
-                 pif_info->T2_Time_sec =  tmr_val_sec;
 
-                 tmr_msg     = DHCPc_COMM_MSG_T2_EXPIRED;
-
-             } else {
-                 tmr_val_sec = pif_info->LeaseTime_sec;
-                 tmr_msg     = DHCPc_COMM_MSG_LEASE_EXPIRED;
+             match = Mem_Cmp((void     *) popt,
+                             (void     *)&pinfo->ServerID[0],
+                             (CPU_SIZE_T) opt_val_len);
+             if (match != DEF_YES) {
+                 return (DEF_NO);
              }
              break;
 
 
         default:
-            *perr = DHCPc_ERR_TMR_INVALID_MSG;
-             return;
+             break;
     }
 
-                                                                /* --------------------- CFG TMR ---------------------- */
-    DHCPc_TmrCfg(pif_info, tmr_msg, tmr_val_sec, perr);
-    if (*perr != DHCPc_ERR_NONE) {
-        *perr  = DHCPc_ERR_TMR_CFG;
-    }
+    return (DEF_YES);
 }
 
 
 /*
 *********************************************************************************************************
-*                                           DHCPc_RxReply()
-*
-* Description : (1) Receive DHCP reply message :
+*                                      DHCPc_IPv6_TxMsgPrepare()
 *
-*                   (a) Receive           message data from server
-*
-*                   (b) Validate received message
-*
-*                       (1) opcode
-*                       (2) hardware address
-*                       (3) transaction ID
-*                       (4) server      ID
-*
-*                   (c) Retrieve received message type
-*
-*
-* Argument(s) : sock_id             Socket ID of socket to receive DHCP reply message.
-*
-*               pif_info            Pointer to DHCP interface information.
-*               --------            Argument checked in DHCPc_Discover(),
-*                                                       DHCPc_Req().
-*
-*               server_id           Server identifier.
-*
-*               paddr_hw            Pointer to hardware address buffer.
+* Description : Prepare a DHCPv6 message.
 *
-*               addr_hw_len         Length of the hardware address buffer pointed to by 'paddr_hw'.
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument checked in DHCPc_IPv6_Exchange().
 *
-*               pmsg_buf            Pointer to DHCP message buffer to receive reply.
+*               msg_type        DHCPv6 message type.
 *
-*               pmsg_buf_len        Pointer to a variable to ... :
+*               pmsg_buf        Pointer to DHCPv6 message buffer.
 *
-*                                       (a) Pass the size of the message buffer pointed to by 'pmsg_buf'.
-*                                       (b) (1) Return the actual size of the received message buffer, if NO errors;
-*                                           (2) Return 0,                                              otherwise.
+*               msg_buf_size    Size of DHCPv6 message buffer (in octets).
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  DHCPc reply successfully received.
-*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_NONE                  Message successfully prepared.
+*                               DHCPc_ERR_NULL_PTR              Argument 'pmsg_buf' passed a NULL pointer.
 *                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
-*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCPv6 message type.
 *
-*                                                               ----------- RETURNED BY DHCPc_Rx() : ------------
-*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
-*                               DHCPc_ERR_RX                    Receive error.
+* Return(s)   : Size of the prepared message (in octets), if NO errors.
 *
-* Return(s)   : Type of received message, if NO error.
+*               0,                                       otherwise.
 *
-*               DHCP_MSG_NONE,            otherwise.
+* Caller(s)   : DHCPc_IPv6_Exchange().
 *
-* Caller(s)   : DHCPc_Discover(),
-*               DHCPc_Req().
+* Note(s)     : (1) A DHCPv6 message is at most a few hundred octets long & hence fits in a DHCP message
+*                   buffer (see 'dhcp-c.h  DHCP MESSAGE DEFINES').
 *
-* Note(s)     : (2) #### This implementation of the DHCP client presumes an Ethernet hardware type.
+*               (2) The identity associations of the client carry the address & the prefix of a lease,
+*                   if any, with lifetimes of 0 :
 *
-*               (3) Received messages smaller than the minimum size allowed are silently discarded.
+*                   (a) As hints, in REQUEST messages, from the pending lease offered by the server (see
+*                           'DHCPc_IPv6_InitStateHandler()  Note #2').
+*                   (b) As leases to extend,  in RENEW & REBIND messages, from the client's lease.
+*                   (c) As leases to release, in RELEASE messages, from the client's lease; these ONLY
+*                           carry the identity associations obtained by the client.
+*                   (d) As address declined,  in DECLINE messages, from the pending lease declined (see
+*                           'DHCPc_IPv6_InitStateHandler()  Note #3'); these ONLY carry the IA_NA option.
 *
-*                   See also 'dhcp-c.h  DHCP MESSAGE DEFINES  Note #2'.
+*               (3) The elapsed time is expressed in hundredths of a second, counted from the first
+*                   transmission of the exchange (see 'DHCPc_IPv6_Exchange()  Note #2').
+*
+*               (4) RFC #8415, section 'SOL_MAX_RT Option', states that a client "MUST include the SOL_MAX_RT
+*                   option code in any Option Request option it sends".
+*
+*                   #### The SOL_MAX_RT option received is NOT used (see 'DHCPc_IPv6_Exchange()  Note #3').
 *********************************************************************************************************
 */
 
-static  DHCPc_MSG_TYPE  DHCPc_RxReply (NET_SOCK_ID     sock_id,
-                                       DHCPc_IF_INFO  *pif_info,
-                                       NET_IPv4_ADDR   server_id,
-                                       CPU_INT08U     *paddr_hw,
-                                       CPU_INT08U      addr_hw_len,
-                                       CPU_INT08U     *pmsg_buf,
-                                       CPU_INT16U     *pmsg_buf_len,
-                                       DHCPc_ERR      *perr)
+static  CPU_INT16U  DHCPc_IPv6_TxMsgPrepare (DHCPc_IF_INFO  *pif_info,
+                                             CPU_INT08U      msg_type,
+                                             CPU_INT08U     *pmsg_buf,
+                                             CPU_INT16U      msg_buf_size,
+                                             DHCPc_ERR      *perr)
 {
-    CPU_BOOLEAN         remote_match;
-    CPU_BOOLEAN         opcode_reply;
-    CPU_BOOLEAN         addr_hw_match;
-    CPU_BOOLEAN         transaction_id_match;
-    CPU_BOOLEAN         rx_err;
-    NET_SOCK_ADDR       addr_remote;
-    NET_SOCK_ADDR_LEN   addr_remote_size;
-    CPU_INT16U          rx_msg_len;
-    DHCP_MSG_HDR       *pmsg_hdr;
-    CPU_INT32U          rx_xid;
-    CPU_INT08U         *popt;
-    CPU_INT08U         *opt_val_len;
-    NET_IPv4_ADDR       addr_server;
-    DHCPc_MSG_TYPE      msg_type;
-
-
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
-    if ((paddr_hw     == (CPU_INT08U *)0) ||
-        (pmsg_buf     == (CPU_INT08U *)0) ||
-        (pmsg_buf_len == (CPU_INT16U *)0)) {
-       *pmsg_buf_len = 0;
-       *perr         = DHCPc_ERR_NULL_PTR;
-        return (DHCP_MSG_NONE);
-    }
-
-    if (*pmsg_buf_len < DHCP_MSG_RX_MIN_LEN) {
-        *pmsg_buf_len = 0;
-        *perr         = DHCPc_ERR_INVALID_MSG_SIZE;
-        return (DHCP_MSG_NONE);
+    DHCPc_IPv6_INFO   *pinfo;
+    DHCPc_IPv6_LEASE  *please;
+    CPU_INT08U        *popt;
+    CPU_INT08U         ia_tx;
+    CPU_BOOLEAN        wr_server_id;
+    CPU_BOOLEAN        wr_lease;
+    CPU_BOOLEAN        wr_oro;
+    CPU_BOOLEAN        wr_addr;
+    CPU_INT16U         opt_len;
+    CPU_INT16U         opt_code;
+    CPU_INT16U         elapsed;
+    CPU_INT32U         time_cur_sec;
+    CPU_INT32U         secs_elapsed;
+
+
+#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* ---------------- VALIDATE PTR & SIZE ----------------*/
+    if (pmsg_buf == (CPU_INT08U *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return (0);
     }
 
-    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {
-       *pmsg_buf_len = 0;
-       *perr         = DHCPc_ERR_INVALID_HW_ADDR;
-        return (DHCP_MSG_NONE);
+    if (msg_buf_size < DHCP_MSG_BUF_SIZE) {                     /* See Note #1.                                         */
+       *perr = DHCPc_ERR_INVALID_MSG_SIZE;
+        return (0);
     }
-
 #else
-   (void)&addr_hw_len;                                          /* Prevent 'variable unused' compiler warning.          */
+   (void)&msg_buf_size;                                         /* Prevent 'variable unused' compiler warning.          */
 #endif
 
+    pinfo  = &pif_info->IPv6;
+    please = &pinfo->Lease;
 
-                                                                /* ------------ RX MESSAGE FROM SERVER(S) ------------- */
-    remote_match         = DEF_NO;
-    opcode_reply         = DEF_NO;
-    addr_hw_match        = DEF_NO;
-    transaction_id_match = DEF_NO;
-    rx_err               = DEF_NO;
-
-    while (((remote_match         != DEF_YES)  ||
-            (opcode_reply         != DEF_YES)  ||
-            (addr_hw_match        != DEF_YES)  ||
-            (transaction_id_match != DEF_YES)) &&
-            (rx_err               != DEF_YES)) {
+                                                                /* -------------------- GET MSG OPT ------------------- */
+    switch (msg_type) {
+        case DHCPc_IPv6_MSG_SOLICIT:
+             ia_tx        = pinfo->IA_Req;
+             wr_server_id = DEF_NO;
+             wr_lease     = DEF_NO;
+             wr_oro       = DEF_YES;
+             break;
 
-        addr_remote_size = sizeof(addr_remote);
 
-        rx_msg_len = DHCPc_Rx((NET_SOCK_ID        ) sock_id,
-                              (void              *) pmsg_buf,
-                              (CPU_INT16U         )*pmsg_buf_len,
-                              (NET_SOCK_ADDR     *)&addr_remote,
-                              (NET_SOCK_ADDR_LEN *)&addr_remote_size,
-                              (DHCPc_ERR         *) perr);
+        case DHCPc_IPv6_MSG_REQUEST:                            /* See Note #2a.                                        */
+             please       = &pinfo->LeasePend;
+             ia_tx        = pinfo->IA_Req;
+             wr_server_id = DEF_YES;
+             wr_lease     = DEF_YES;
+             wr_oro       = DEF_YES;
+             break;
 
-        if (*perr == DHCPc_ERR_NONE) {
-                                                                /* ------------------- VALIDATE MSG ------------------- */
-            if (rx_msg_len >= DHCP_MSG_RX_MIN_LEN) {            /* See Note #3.                                         */
-                pmsg_hdr = (DHCP_MSG_HDR *)pmsg_buf;
 
-                                                                /* Validate opcode.                                     */
-                opcode_reply = (pmsg_hdr->op == DHCP_OP_REPLY) ? DEF_YES : DEF_NO;
+        case DHCPc_IPv6_MSG_RENEW:
+             ia_tx        = pinfo->IA_Req;
+             wr_server_id = DEF_YES;
+             wr_lease     = DEF_YES;
+             wr_oro       = DEF_YES;
+             break;
 
 
-                                                                /* Validate HW addr.                                    */
-                addr_hw_match = Mem_Cmp((void     *)pmsg_hdr->chaddr,
-                                        (void     *)paddr_hw,
-                                        (CPU_SIZE_T)NET_IF_ETHER_ADDR_SIZE);
+        case DHCPc_IPv6_MSG_REBIND:
+             ia_tx        = pinfo->IA_Req;
+             wr_server_id = DEF_NO;
+             wr_lease     = DEF_YES;
+             wr_oro       = DEF_YES;
+             break;
 
 
-                                                                /* Validate transaction ID.                             */
-                NET_UTIL_VAL_COPY_GET_NET_32(&rx_xid, &pmsg_hdr->xid);
-                transaction_id_match = (rx_xid == pif_info->TransactionID) ? DEF_YES : DEF_NO;
+        case DHCPc_IPv6_MSG_RELEASE:                            /* See Note #2c.                                        */
+             ia_tx        = please->IA;
+             wr_server_id = DEF_YES;
+             wr_lease     = DEF_YES;
+             wr_oro       = DEF_NO;
+             break;
 
 
-                                                                /* Validate server id.                                  */
-                if (server_id != NET_IPv4_ADDR_NONE) {          /* If server id known,    ...                           */
-                                                                /* ... get server id opt, ...                           */
-                    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SERVER_IDENTIFIER,
-                                           (CPU_INT08U   *) pmsg_buf,
-                                           (CPU_INT16U    ) rx_msg_len,
-                                           (CPU_INT08U   *)&opt_val_len);
+        case DHCPc_IPv6_MSG_DECLINE:                            /* See Note #2d.                                        */
+             please       = &pinfo->LeasePend;
+             ia_tx        = please->IA & DHCPc_IPv6_IA_NA;
+             wr_server_id = DEF_YES;
+             wr_lease     = DEF_YES;
+             wr_oro       = DEF_NO;
+             break;
 
-                    if (popt == (CPU_INT08U *)0) {
-                        remote_match = DEF_NO;
 
-                    } else {                                    /* ... & compare with lease server id.                  */
-                        NET_UTIL_VAL_COPY_32(&addr_server, popt);
-                        remote_match = (addr_server == server_id ? DEF_YES : DEF_NO);
-                    }
+        default:                                                /* Unsupported msg, ...                                 */
+            *perr = DHCPc_ERR_INVALID_MSG;
+             return (0);                                        /* ... rtn.                                             */
+    }
 
-                } else {
-                    remote_match = DEF_YES;
-                }
-            }
+                                                                /* ------------------- GET CUR TIME ------------------- */
+    time_cur_sec = DHCPc_TimeGet_sec();
+    secs_elapsed = time_cur_sec - pif_info->AcqStartTime;       /* Get elapsed time (see Note #3).                      */
+    if (secs_elapsed > (DHCPc_IPv6_ELAPSED_TIME_MAX / 100u)) {
+        elapsed = DHCPc_IPv6_ELAPSED_TIME_MAX;
+    } else {
+        elapsed = (CPU_INT16U)(secs_elapsed * 100u);
+    }
+
+                                                                /* ---------------- SET DHCPv6 MSG HDR ---------------- */
+    popt    = pmsg_buf;
+   *popt++  = msg_type;
+   *popt++  = (CPU_INT08U)(pif_info->TransactionID >> 16u);
+   *popt++  = (CPU_INT08U)(pif_info->TransactionID >>  8u);
+   *popt++  = (CPU_INT08U)(pif_info->TransactionID);
+
+                                                                /* ---------------- SET DHCPv6 MSG OPT ---------------- */
+                                                                /* Client DUID.                                         */
+    popt    = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_CLIENTID, pinfo->DUID_Len);
+    Mem_Copy((void     *) popt,
+             (void     *)&pinfo->DUID[0],
+             (CPU_SIZE_T) pinfo->DUID_Len);
+    popt   += pinfo->DUID_Len;
+
+    if (wr_server_id == DEF_YES) {                              /* Srv DUID.                                            */
+        popt  = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_SERVERID, pinfo->ServerID_Len);
+        Mem_Copy((void     *) popt,
+                 (void     *)&pinfo->ServerID[0],
+                 (CPU_SIZE_T) pinfo->ServerID_Len);
+        popt += pinfo->ServerID_Len;
+    }
+                                                                /* Elapsed time.                                        */
+    popt    = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_ELAPSED_TIME, DHCPc_IPv6_OPT_ELAPSED_TIME_LEN);
+    NET_UTIL_VAL_COPY_SET_NET_16(popt, &elapsed);
+    popt   += DHCPc_IPv6_OPT_ELAPSED_TIME_LEN;
+
+    if (wr_oro == DEF_YES) {                                    /* Opt req (see Note #4).                               */
+        opt_code = DHCPc_IPv6_OPT_SOL_MAX_RT;
+        popt     = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_ORO, 2u);
+        NET_UTIL_VAL_COPY_SET_NET_16(popt, &opt_code);
+        popt    += 2;
+    }
+
+    if (DEF_BIT_IS_SET(ia_tx, DHCPc_IPv6_IA_NA) == DEF_YES) {   /* IA_NA (see Note #2).                                 */
+        wr_addr = DEF_NO;
+        opt_len = DHCPc_IPv6_OPT_IA_LEN;
+        if ((wr_lease == DEF_YES) &&
+            (DEF_BIT_IS_SET(please->IA, DHCPc_IPv6_IA_NA) == DEF_YES)) {
+            wr_addr  = DEF_YES;
+            opt_len += DHCPc_IPv6_OPT_HDR_LEN + DHCPc_IPv6_OPT_IAADDR_LEN;
+        }
 
-        } else {
-            rx_err = DEF_YES;
+        popt  = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_IA_NA, opt_len);
+        NET_UTIL_VAL_COPY_SET_NET_32(popt, &pinfo->IAID);
+        popt += 4;
+        NET_UTIL_VAL_SET_NET_32(popt, 0);                       /* T1.                                                  */
+        popt += 4;
+        NET_UTIL_VAL_SET_NET_32(popt, 0);                       /* T2.                                                  */
+        popt += 4;
+
+        if (wr_addr == DEF_YES) {
+            popt  = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_IAADDR, DHCPc_IPv6_OPT_IAADDR_LEN);
+            Mem_Copy((void     *) popt,
+                     (void     *)&please->Addr,
+                     (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+            popt += NET_IPv6_ADDR_SIZE;
+            NET_UTIL_VAL_SET_NET_32(popt, 0);                   /* Preferred lifetime.                                  */
+            popt += 4;
+            NET_UTIL_VAL_SET_NET_32(popt, 0);                   /* Valid     lifetime.                                  */
+            popt += 4;
         }
     }
 
-    if (*perr != DHCPc_ERR_NONE) {
-       *pmsg_buf_len = 0;
-        return (DHCP_MSG_NONE);
+    if (DEF_BIT_IS_SET(ia_tx, DHCPc_IPv6_IA_PD) == DEF_YES) {   /* IA_PD (see Note #2).                                 */
+        wr_addr = DEF_NO;
+        opt_len = DHCPc_IPv6_OPT_IA_LEN;
+        if ((wr_lease == DEF_YES) &&
+            (DEF_BIT_IS_SET(please->IA, DHCPc_IPv6_IA_PD) == DEF_YES)) {
+            wr_addr  = DEF_YES;
+            opt_len += DHCPc_IPv6_OPT_HDR_LEN + DHCPc_IPv6_OPT_IAPREFIX_LEN;
+        }
+
+        popt  = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_IA_PD, opt_len);
+        NET_UTIL_VAL_COPY_SET_NET_32(popt, &pinfo->IAID);
+        popt += 4;
+        NET_UTIL_VAL_SET_NET_32(popt, 0);                       /* T1.                                                  */
+        popt += 4;
+        NET_UTIL_VAL_SET_NET_32(popt, 0);                       /* T2.                                                  */
+        popt += 4;
+
+        if (wr_addr == DEF_YES) {
+            popt    = DHCPc_IPv6_OptHdrWr(popt, DHCPc_IPv6_OPT_IAPREFIX, DHCPc_IPv6_OPT_IAPREFIX_LEN);
+            NET_UTIL_VAL_SET_NET_32(popt, 0);                   /* Preferred lifetime.                                  */
+            popt   += 4;
+            NET_UTIL_VAL_SET_NET_32(popt, 0);                   /* Valid     lifetime.                                  */
+            popt   += 4;
+           *popt++  = please->PrefixLen;
+            Mem_Copy((void     *) popt,
+                     (void     *)&please->Prefix,
+                     (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+            popt   += NET_IPv6_ADDR_SIZE;
+        }
     }
 
-                                                                /* ------------------- GET MSG TYPE ------------------- */
-    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_DHCP_MESSAGE_TYPE,
-                           (CPU_INT08U   *) pmsg_buf,
-                           (CPU_INT16U    ) rx_msg_len,
-                           (CPU_INT08U   *)&opt_val_len);
 
-    if (popt == (CPU_INT08U *)0) {
-       *pmsg_buf_len = 0;
-       *perr         = DHCPc_ERR_RX_MSG_TYPE;
-        return (DHCP_MSG_NONE);
-    }
+    pif_info->NegoStartTime = time_cur_sec;                     /* Save nego start time.                                */
+   *perr                    = DHCPc_ERR_NONE;
+
+    return ((CPU_INT16U)(popt - pmsg_buf));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DHCPc_IPv6_OptHdrWr()
+*
+* Description : Write the header of a DHCPv6 option.
+*
+* Argument(s) : popt        Pointer to option buffer.
+*               ----        Argument checked in DHCPc_IPv6_TxMsgPrepare().
+*
+*               opt_code    Option code.
+*
+*               opt_len     Option length (in octets), without the option header.
+*
+* Return(s)   : Pointer to the option value.
+*
+* Caller(s)   : DHCPc_IPv6_TxMsgPrepare().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
 
-                                                                /* Retrieve msg type opt val.                           */
-    msg_type     = (DHCPc_MSG_TYPE)(*popt);
-   *pmsg_buf_len =  rx_msg_len;
+static  CPU_INT08U  *DHCPc_IPv6_OptHdrWr (CPU_INT08U  *popt,
+                                          CPU_INT16U   opt_code,
+                                          CPU_INT16U   opt_len)
+{
+    NET_UTIL_VAL_COPY_SET_NET_16(&popt[0], &opt_code);
+    NET_UTIL_VAL_COPY_SET_NET_16(&popt[2], &opt_len);
 
-    return (msg_type);
+    return (popt + DHCPc_IPv6_OPT_HDR_LEN);
 }
 
 
 /*
 *********************************************************************************************************
-*                                             DHCPc_Rx()
-*
-* Description : Receive DHCPc data via socket.
-*
-* Argument(s) : sock_id             Socket ID of socket to receive DHCPc data.
-*
-*               pdata_buf           Pointer to DHCPc data buffer to receive data.
-*               ---------           Argument checked in DHCPc_RxReply().
-*
-*               data_buf_len        Length  of DHCPc data buffer to receive data.
+*                                       DHCPc_IPv6_MsgGetOpt()
 *
-*               paddr_remote        Pointer to an address buffer that will receive the socket address
-*                                       structure with the received data's remote address.
+* Description : Search a DHCPv6 option in an option buffer.
 *
-*               paddr_remote_len    Pointer to a variable to ... :
+* Argument(s) : opt_code        Option code to return the value of.
 *
-*                                       (a) Pass the size of the address buffer pointed to by 'paddr_remote'.
-*                                       (b) Return the actual size of socket address structure with the
-*                                               received data's remote address.
+*               popts           Pointer to option buffer, i.e. the options of a message or of an option.
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
+*               opts_len        Length of the option buffer (in octets).
 *
-*                               DHCPc_ERR_NONE                  DHCPc data successfully received.
-*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
-*                               DHCPc_ERR_RX                    Receive error.
+*               popt_val_len    Pointer to variable that will receive the length of the option's value.
 *
-* Return(s)   : Length of DHCPc data received (in octets), if no error.
+* Return(s)   : Pointer to the first occurrence of the option's value, if option found.
 *
-*               0,                                         otherwise.
+*               Pointer to NULL,                                       otherwise.
 *
-* Caller(s)   : DHCPc_RxReply().
+* Caller(s)   : DHCPc_IPv6_Exchange(),
+*               DHCPc_IPv6_RxReplyValidate(),
+*               DHCPc_IPv6_StatusGet(),
+*               DHCPc_IPv6_LeaseParse(),
+*               DHCPc_IPv6_IA_Parse().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The search stops at the first truncated option; its value is NEVER returned.
 *********************************************************************************************************
 */
 
-static  CPU_INT16U  DHCPc_Rx (NET_SOCK_ID         sock_id,
-                              void               *pdata_buf,
-                              CPU_INT16U          data_buf_len,
-                              NET_SOCK_ADDR      *paddr_remote,
-                              NET_SOCK_ADDR_LEN  *paddr_remote_len,
-                              DHCPc_ERR          *perr)
+static  CPU_INT08U  *DHCPc_IPv6_MsgGetOpt (CPU_INT16U   opt_code,
+                                           CPU_INT08U  *popts,
+                                           CPU_INT16U   opts_len,
+                                           CPU_INT16U  *popt_val_len)
 {
-    CPU_INT16U  rx_len;
-    NET_ERR     err_net;
-
+    CPU_INT08U  *popt;
+    CPU_INT16U   len_rem;
+    CPU_INT16U   code;
+    CPU_INT16U   len;
 
-                                                                /* ------------------- RX APP DATA -------------------- */
-    rx_len = NetApp_SockRx((NET_SOCK_ID        ) sock_id,
-                           (void              *) pdata_buf,
-                           (CPU_INT16U         ) data_buf_len,
-                           (CPU_INT16U         ) 0,
-#if (NET_VERSION >= 21200u)
-                           (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
-#else
-                           (CPU_INT16S         ) NET_SOCK_FLAG_NONE,
-#endif
-                           (NET_SOCK_ADDR     *) paddr_remote,
-                           (NET_SOCK_ADDR_LEN *) paddr_remote_len,
-                           (CPU_INT16U         ) DHCPc_RX_MAX_RETRY,
-                           (CPU_INT32U         ) DHCPc_CFG_MAX_RX_TIMEOUT_MS,
-                           (CPU_INT32U         ) DHCPc_RX_TIME_DLY_MS,
-                           (NET_ERR           *)&err_net);
 
-    switch (err_net) {
-        case NET_APP_ERR_NONE:
-            *perr = DHCPc_ERR_NONE;
-             break;
+    popt          = popts;
+    len_rem       = opts_len;
+   *popt_val_len  = 0;
 
+    while (len_rem >= DHCPc_IPv6_OPT_HDR_LEN) {
+        NET_UTIL_VAL_COPY_GET_NET_16(&code, &popt[0]);
+        NET_UTIL_VAL_COPY_GET_NET_16(&len,  &popt[2]);
+        popt    += DHCPc_IPv6_OPT_HDR_LEN;
+        len_rem -= DHCPc_IPv6_OPT_HDR_LEN;
 
-        case NET_APP_ERR_DATA_BUF_OVF:
-            *perr = DHCPc_ERR_RX_OVF;
-             break;
+        if (len > len_rem) {                                    /* If opt truncated, ...                                */
+            return ((CPU_INT08U *)0);                           /* ... stop srch (see Note #1).                         */
+        }
 
+        if (code == opt_code) {                                 /* If opt found, ...                                    */
+           *popt_val_len = len;
+            return (popt);                                      /* ... rtn ptr to opt val.                              */
+        }
 
-        case NET_APP_ERR_CONN_CLOSED:
-        case NET_APP_ERR_FAULT:
-        case NET_APP_ERR_INVALID_ARG:
-        case NET_APP_ERR_INVALID_OP:
-        case NET_ERR_RX:
-        default:
-             rx_len = 0;
-            *perr   = DHCPc_ERR_RX;
-             break;
+        popt    += len;
+        len_rem -= len;
     }
 
-    return (rx_len);
+    return ((CPU_INT08U *)0);
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DHCPc_TxMsgPrepare()
-*
-* Description : Prepare DHCP message.
+*                                       DHCPc_IPv6_StatusGet()
 *
-* Argument(s) : pif_info        Pointer to DHCP interface information.
-*               --------        Argument checked   in DHCPc_Discover(),
-*                                                     DHCPc_Req(),
-*                                        validated in DHCPc_DeclineRelease().
+* Description : Get the status code of a DHCPv6 message or option.
 *
-*               msg_type        Type of message to be prepared :
+* Argument(s) : popts       Pointer to option buffer.
 *
-*                                   DHCP_MSG_DISCOVER
-*                                   DHCP_MSG_REQUEST
-*                                   DHCP_MSG_DECLINE
-*                                   DHCP_MSG_RELEASE
+*               opts_len    Length of the option buffer (in octets).
 *
-*               paddr_hw        Pointer to hardware address buffer.
+* Return(s)   : Status code of the Status Code option, if any.
 *
-*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*               DHCPc_IPv6_STATUS_SUCCESS,                otherwise.
 *
-*               pmsg_buf        Pointer to DHCP transmit message buffer.
+* Caller(s)   : DHCPc_IPv6_LeaseParse(),
+*               DHCPc_IPv6_IA_Parse().
 *
-*               msg_buf_size    Size of message buffer (in octets).
+* Note(s)     : (1) RFC #8415, section 'Status Code Option', states that the absence of a Status Code option
+*                   "implies success".
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DHCPc_IPv6_StatusGet (CPU_INT08U  *popts,
+                                          CPU_INT16U   opts_len)
+{
+    CPU_INT08U  *popt;
+    CPU_INT16U   opt_val_len;
+    CPU_INT16U   status;
+
+
+    popt = DHCPc_IPv6_MsgGetOpt(DHCPc_IPv6_OPT_STATUS_CODE, popts, opts_len, &opt_val_len);
+    if ((popt        == (CPU_INT08U *)0) ||                     /* If NO status code, ...                               */
+        (opt_val_len <   DHCPc_IPv6_OPT_STATUS_CODE_LEN)) {
+        return (DHCPc_IPv6_STATUS_SUCCESS);                     /* ... rtn success (see Note #1).                       */
+    }
+
+    NET_UTIL_VAL_COPY_GET_NET_16(&status, popt);
+
+    return (status);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_IPv6_LeaseParse()
 *
-*               perr        Pointer to variable that will receive the return error code from this function :
+* Description : Parse the lease of the last reply received by a DHCPv6 client.
 *
-*                               DHCPc_ERR_NONE                  DHCPc message successfully prepared.
-*                               DHCPc_ERR_NULL_PTR              Argument(s) 'paddr_hw/pmsg_buf' passed a
-*                                                                   NULL pointer.
-*                               DHCPc_ERR_INVALID_HW_ADDR       Argument 'paddr_hw' has an invalid length.
-*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
-*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_IPv6_InitStateHandler(),
+*                                                 DHCPc_IPv6_RenewStateHandler().
 *
-* Return(s)   : Size of the message (in octets).
+*               please      Pointer to variable that will receive the lease.
 *
-* Caller(s)   : DHCPc_Discover(),
-*               DHCPc_Req(),
-*               DHCPc_DeclineRelease().
+*               pt1         Pointer to variable that will receive the T1 time (in seconds), 0 if NOT set.
 *
-* Note(s)     : (2) #### This implementation of the DHCP client presumes an Ethernet hardware type.
+*               pt2         Pointer to variable that will receive the T2 time (in seconds), 0 if NOT set.
 *
-*               (3) From RFC #2131, section 'Protocol Summary', "To work around some clients that cannot
-*                   accept IP unicast datagrams before the TCP/IP software is configured [...], DHCP uses
-*                   the 'flags' field".  Section 'Constructing and sending DHCP messages' continues by
-*                   adding that "a client that cannot receive unicast IP datagrams until its protocol
-*                   software has been configured with an IP address SHOULD set the BROADCAST bit in the
-*                   'flags' field to 1".
+*               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                  "A server [...] sending [...] a DHCP message directly to a DHCP client SHOULD examine
-*                   [that bit] in the 'flags' field.  If this bit is set to 1, the DHCP message SHOULD be
-*                   sent as an IP broadcast using an IP broadcast address as the IP destination address
-*                   and the link-layer broadcast address as the link-layer destination address".
+*                               DHCPc_ERR_NONE                  Lease successfully parsed.
+*                               DHCPc_ERR_IPv6_STATUS           Error status received or NO identity
+*                                                                   association granted.
 *
-*                   #### Since the Micrium uC/TCP-IP stack is NOT able to receive a packet on an
-*                   unconfigured interface, the BROADCAST bit is always set in the 'flags' field of a DHCP
-*                   message, when permitted by the RFC.
+* Return(s)   : none.
 *
-*               (4) #### The application requested parameters are NOT checked agains the system requested
-*                   ones, so it is possible that the same parameter be requested twice.  However, this
-*                   CANNOT lead to potential problem.
+* Caller(s)   : DHCPc_IPv6_InitStateHandler(),
+*               DHCPc_IPv6_RenewStateHandler().
 *
-*               (5) The vendor-specific options MUST be large enough so the DHCP message is at least
-*                   DHCP_MSG_TX_MIN_LEN octets.
+* Note(s)     : (1) A lease granting only some of the requested identity associations is accepted; the
+*                   other identity associations are requested again on the next renewal.
 *
-*                   See also 'dhcp-c.h  DHCP MESSAGE DEFINES  Note #2'.
+*               (2) #### Only the first IA_NA & IA_PD options of the reply are parsed.
 *********************************************************************************************************
 */
 
-static  CPU_INT16U  DHCPc_TxMsgPrepare (DHCPc_IF_INFO   *pif_info,
-                                        DHCPc_MSG_TYPE   msg_type,
-                                        CPU_INT08U      *paddr_hw,
-                                        CPU_INT08U       addr_hw_len,
-                                        CPU_INT08U      *pmsg_buf,
-                                        CPU_INT16U       msg_buf_size,
-                                        DHCPc_ERR       *perr)
+static  void  DHCPc_IPv6_LeaseParse (DHCPc_IF_INFO     *pif_info,
+                                     DHCPc_IPv6_LEASE  *please,
+                                     CPU_INT32U        *pt1,
+                                     CPU_INT32U        *pt2,
+                                     DHCPc_ERR         *perr)
 {
-    DHCP_MSG_HDR  *pmsg_hdr;
-    CPU_INT08U    *pmsg_opt;
-    DHCPc_MSG     *pmsg_last_rx;
-    DHCP_MSG_HDR  *pmsg_last_rx_hdr;
-    CPU_INT16U     msg_size;
-    CPU_INT16U     flag;
-    CPU_INT32U     ciaddr;
-    CPU_BOOLEAN    get_local_addr;
-    CPU_BOOLEAN    wr_req_ip_addr;
-    CPU_BOOLEAN    wr_server_id;
-    CPU_BOOLEAN    req_param;
-    CPU_INT08U     req_param_qty;
-    CPU_INT08U    *popt;
-    CPU_INT16U     opt_len;
-    CPU_INT16U     opt_pad_len;
-#if (CPU_CFG_NAME_EN == DEF_ENABLED)
-    CPU_CHAR       host_name[CPU_CFG_NAME_SIZE];
-    CPU_SIZE_T     host_name_len;
-    CPU_ERR        err_cpu;
-#endif
+    DHCPc_MSG   *pmsg;
+    CPU_INT08U  *popts;
+    CPU_INT16U   opts_len;
+    CPU_INT08U  *popt;
+    CPU_INT16U   opt_val_len;
+    CPU_INT16U   status;
 
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* --------------- VALIDATE PTR & ARGS ---------------- */
-    if ((paddr_hw == (CPU_INT08U    *)0) ||
-        (pmsg_buf == (CPU_INT08U    *)0)) {
-       *perr = DHCPc_ERR_NULL_PTR;
-        return (0);
+    Mem_Clr((void     *)please,
+            (CPU_SIZE_T)sizeof(DHCPc_IPv6_LEASE));
+   *pt1 = 0u;
+   *pt2 = 0u;
+
+    pmsg     = pif_info->MsgPtr;
+    popts    = &pmsg->MsgBuf[DHCPc_IPv6_MSG_HDR_LEN];
+    opts_len =  pmsg->MsgLen - DHCPc_IPv6_MSG_HDR_LEN;
+
+                                                                /* ---------------- VALIDATE MSG STATUS --------------- */
+    status = DHCPc_IPv6_StatusGet(popts, opts_len);
+    if (status != DHCPc_IPv6_STATUS_SUCCESS) {
+       *perr = DHCPc_ERR_IPv6_STATUS;
+        return;
     }
 
-    if (addr_hw_len != NET_IF_ETHER_ADDR_SIZE) {                /* See Note #2.                                         */
-       *perr = DHCPc_ERR_INVALID_HW_ADDR;
-        return (0);
+                                                                /* --------------------- PARSE IAs -------------------- */
+    if (DEF_BIT_IS_SET(pif_info->IPv6.IA_Req, DHCPc_IPv6_IA_NA) == DEF_YES) {
+        popt = DHCPc_IPv6_MsgGetOpt(DHCPc_IPv6_OPT_IA_NA, popts, opts_len, &opt_val_len);
+        if (popt != (CPU_INT08U *)0) {                          /* See Note #2.                                         */
+            DHCPc_IPv6_IA_Parse(pif_info, DHCPc_IPv6_IA_NA, popt, opt_val_len, please, pt1, pt2);
+        }
     }
 
-    if (msg_buf_size < DHCP_MSG_BUF_SIZE) {
-       *perr = DHCPc_ERR_INVALID_MSG_SIZE;
-        return (0);
+    if (DEF_BIT_IS_SET(pif_info->IPv6.IA_Req, DHCPc_IPv6_IA_PD) == DEF_YES) {
+        popt = DHCPc_IPv6_MsgGetOpt(DHCPc_IPv6_OPT_IA_PD, popts, opts_len, &opt_val_len);
+        if (popt != (CPU_INT08U *)0) {
+            DHCPc_IPv6_IA_Parse(pif_info, DHCPc_IPv6_IA_PD, popt, opt_val_len, please, pt1, pt2);
+        }
     }
 
-#else
-   (void)&addr_hw_len;                                          /* Prevent 'variable unused' compiler warning.          */
-#endif
+    if (please->IA == DHCPc_IPv6_IA_NONE) {                     /* If NO IA granted, ...                                */
+       *perr = DHCPc_ERR_IPv6_STATUS;                           /* ... rtn err (see Note #1).                           */
+        return;
+    }
 
 
-                                                                /* ---------- GET SPECIFIC FIELDS & OPT VAL ----------- */
-    flag = 0;
-    switch (msg_type) {
-        case DHCP_MSG_DISCOVER:
-#if (DHCPc_CFG_BROADCAST_BIT_EN == DEF_ENABLED)                 /* See Note #3.                                         */
-             flag           = DHCP_FLAG_BROADCAST;
-#endif
-             get_local_addr = DEF_NO;
-             wr_req_ip_addr = DEF_NO;
-             wr_server_id   = DEF_NO;
-             req_param      = DEF_YES;
-             break;
+   *perr = DHCPc_ERR_NONE;
+}
 
 
-        case DHCP_MSG_REQUEST:
-#if (DHCPc_CFG_BROADCAST_BIT_EN == DEF_ENABLED)                 /* See Note #3.                                         */
-             flag      = DHCP_FLAG_BROADCAST;
-#endif
-             req_param = DEF_YES;
+/*
+*********************************************************************************************************
+*                                        DHCPc_IPv6_IA_Parse()
+*
+* Description : Parse an IA_NA or IA_PD option of a DHCPv6 reply.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_IPv6_LeaseParse().
+*
+*               ia          Identity association type (see 'dhcp-c.h  DHCPv6 DEFINES  Note #3') :
+*
+*                               DHCPc_IPv6_IA_NA                IA_NA option.
+*                               DHCPc_IPv6_IA_PD                IA_PD option.
+*
+*               pia         Pointer to the option's value.
+*
+*               ia_len      Length of the option's value (in octets).
+*
+*               please      Pointer to lease to update.
+*
+*               pt1         Pointer to variable that holds the lowest T1 time (in seconds), 0 if NOT set.
+*
+*               pt2         Pointer to variable that holds the lowest T2 time (in seconds), 0 if NOT set.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IPv6_LeaseParse().
+*
+* Note(s)     : (1) RFC #8415, sections 'Identity Association for Non-temporary Addresses Option' & 'Identity
+*                   Association for Prefix Delegation Option', state that an IA with T1 greater than T2 &
+*                   an address or prefix with a preferred lifetime greater than its valid lifetime MUST be
+*                   discarded.  An address or prefix with a valid lifetime of 0 is NO longer leased.
+*
+*               (2) #### Only the first IA Address or IA Prefix option of the identity association is used.
+*********************************************************************************************************
+*/
 
-             switch (pif_info->ClientState) {
-                 case DHCP_STATE_SELECTING:
-                      get_local_addr = DEF_NO;
-                      wr_req_ip_addr = DEF_YES;
-                      wr_server_id   = DEF_YES;
-                      break;
+static  void  DHCPc_IPv6_IA_Parse (DHCPc_IF_INFO     *pif_info,
+                                   CPU_INT08U         ia,
+                                   CPU_INT08U        *pia,
+                                   CPU_INT16U         ia_len,
+                                   DHCPc_IPv6_LEASE  *please,
+                                   CPU_INT32U        *pt1,
+                                   CPU_INT32U        *pt2)
+{
+    CPU_INT32U   iaid;
+    CPU_INT32U   time_t1;
+    CPU_INT32U   time_t2;
+    CPU_INT08U  *popts;
+    CPU_INT16U   opts_len;
+    CPU_INT08U  *popt;
+    CPU_INT16U   opt_val_len;
+    CPU_INT16U   status;
+    CPU_INT32U   lifetime_pref;
+    CPU_INT32U   lifetime_valid;
+    CPU_INT08U   prefix_len;
 
 
-                 case DHCP_STATE_INIT_REBOOT:
-                      get_local_addr = DEF_NO;
-                      wr_req_ip_addr = DEF_YES;
-                      wr_server_id   = DEF_NO;
-                      break;
+                                                                /* -------------------- VALIDATE IA ------------------- */
+    if (ia_len < DHCPc_IPv6_OPT_IA_LEN) {
+        return;
+    }
 
+    NET_UTIL_VAL_COPY_GET_NET_32(&iaid,    &pia[0]);
+    NET_UTIL_VAL_COPY_GET_NET_32(&time_t1, &pia[4]);
+    NET_UTIL_VAL_COPY_GET_NET_32(&time_t2, &pia[8]);
 
-                 case DHCP_STATE_BOUND:
-                 case DHCP_STATE_RENEWING:
-                 case DHCP_STATE_REBINDING:
-                      get_local_addr = DEF_YES;
-                      wr_req_ip_addr = DEF_NO;
-                      wr_server_id   = DEF_NO;
-                      break;
+    if (iaid != pif_info->IPv6.IAID) {
+        return;
+    }
 
+    if ((time_t1 != 0u) &&                                      /* See Note #1.                                         */
+        (time_t2 != 0u) &&
+        (time_t1 >  time_t2)) {
+        return;
+    }
 
-                 default:
-                      get_local_addr = DEF_NO;
-                      wr_req_ip_addr = DEF_NO;
-                      wr_server_id   = DEF_NO;
-                      break;
-             }
-             break;
+    popts    = &pia[DHCPc_IPv6_OPT_IA_LEN];
+    opts_len =  ia_len - DHCPc_IPv6_OPT_IA_LEN;
+
+    status = DHCPc_IPv6_StatusGet(popts, opts_len);
+    if (status != DHCPc_IPv6_STATUS_SUCCESS) {
+        return;
+    }
+
+                                                                /* ------------------ GET ADDR/PREFIX ----------------- */
+    if (ia == DHCPc_IPv6_IA_NA) {
+        popt = DHCPc_IPv6_MsgGetOpt(DHCPc_IPv6_OPT_IAADDR, popts, opts_len, &opt_val_len);
+        if ((popt        == (CPU_INT08U *)0) ||                 /* See Note #2.                                         */
+            (opt_val_len <   DHCPc_IPv6_OPT_IAADDR_LEN)) {
+            return;
+        }
 
+        NET_UTIL_VAL_COPY_GET_NET_32(&lifetime_pref,  &popt[16]);
+        NET_UTIL_VAL_COPY_GET_NET_32(&lifetime_valid, &popt[20]);
+        if ((lifetime_valid == 0u) ||                           /* See Note #1.                                         */
+            (lifetime_pref  >  lifetime_valid)) {
+            return;
+        }
 
-        case DHCP_MSG_DECLINE:
-             get_local_addr = DEF_NO;
-             wr_req_ip_addr = DEF_YES;
-             wr_server_id   = DEF_YES;
-             req_param      = DEF_NO;
-             break;
+        Mem_Copy((void     *)&please->Addr,
+                 (void     *)&popt[0],
+                 (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+        please->AddrLifetimePref_sec  = lifetime_pref;
+        please->AddrLifetimeValid_sec = lifetime_valid;
 
+    } else {
+        popt = DHCPc_IPv6_MsgGetOpt(DHCPc_IPv6_OPT_IAPREFIX, popts, opts_len, &opt_val_len);
+        if ((popt        == (CPU_INT08U *)0) ||                 /* See Note #2.                                         */
+            (opt_val_len <   DHCPc_IPv6_OPT_IAPREFIX_LEN)) {
+            return;
+        }
 
-        case DHCP_MSG_RELEASE:
-             get_local_addr = DEF_YES;
-             wr_req_ip_addr = DEF_NO;
-             wr_server_id   = DEF_YES;
-             req_param      = DEF_NO;
-             break;
+        NET_UTIL_VAL_COPY_GET_NET_32(&lifetime_pref,  &popt[0]);
+        NET_UTIL_VAL_COPY_GET_NET_32(&lifetime_valid, &popt[4]);
+        prefix_len = popt[8];
+        if ((lifetime_valid == 0u) ||                           /* See Note #1.                                         */
+            (lifetime_pref  >  lifetime_valid) ||
+            (prefix_len     >  DHCPc_IPv6_ADDR_PREFIX_LEN)) {
+            return;
+        }
 
+        Mem_Copy((void     *)&please->Prefix,
+                 (void     *)&popt[9],
+                 (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+        please->PrefixLen               = prefix_len;
+        please->PrefixLifetimePref_sec  = lifetime_pref;
+        please->PrefixLifetimeValid_sec = lifetime_valid;
+    }
 
-        default:                                                /* Unsupported msg, ...                                 */
-            *perr = DHCPc_ERR_INVALID_MSG;
-             return (0);                                        /* ... rtn.                                             */
+    DEF_BIT_SET(please->IA, ia);
+
+                                                                /* ---------------- GET LOWEST T1 & T2 ---------------- */
+    if ((time_t1 != 0u) &&
+       ((*pt1 == 0u) || (time_t1 < *pt1))) {
+       *pt1 = time_t1;
     }
+    if ((time_t2 != 0u) &&
+       ((*pt2 == 0u) || (time_t2 < *pt2))) {
+       *pt2 = time_t2;
+    }
+}
 
-    pmsg_last_rx     = (DHCPc_MSG    *) pif_info->MsgPtr;
-    pmsg_last_rx_hdr = (DHCP_MSG_HDR *)&pmsg_last_rx->MsgBuf[0];
 
-    if (get_local_addr == DEF_YES) {
-        NET_UTIL_VAL_COPY_32(&ciaddr, &pmsg_last_rx_hdr->yiaddr);
+/*
+*********************************************************************************************************
+*                                        DHCPc_IPv6_LeaseSet()
+*
+* Description : Set the lease of a DHCPv6 client.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_IPv6_InitStateHandler(),
+*                                                 DHCPc_IPv6_LeaseApply(),
+*                                                 DHCPc_IPv6_LeaseRevert().
+*
+*               please      Pointer to lease to set.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Lease successfully set.
+*
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : -------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IPv6_InitStateHandler(),
+*               DHCPc_IPv6_LeaseApply(),
+*               DHCPc_IPv6_LeaseRevert().
+*
+* Note(s)     : (1) The lease is read by DHCPc_IPv6_LeaseGet() & is hence written with the interface lock
+*                   acquired (see 'dhcp-c.h  DHCPc INTERFACE INFORMATION DATA TYPE  Note #13').  It is ONLY
+*                   written by the DHCPc task, which reads it without the lock.
+*********************************************************************************************************
+*/
 
-    } else {
-        ciaddr = 0;
+static  void  DHCPc_IPv6_LeaseSet (DHCPc_IF_INFO     *pif_info,
+                                   DHCPc_IPv6_LEASE  *please,
+                                   DHCPc_ERR         *perr)
+{
+    DHCPc_OS_IF_Lock(pif_info->ID, perr);                       /* See Note #1.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
     }
 
+    Mem_Copy((void     *)&pif_info->IPv6.Lease,
+             (void     *) please,
+             (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
 
-    Mem_Clr((void     *)pmsg_buf,                               /* Clr msg buf.                                         */
-            (CPU_SIZE_T)msg_buf_size);
+    DHCPc_OS_IF_Unlock(pif_info->ID);
 
-                                                                /* --------------- SETTING DHCP MSG HDR --------------- */
-    pmsg_hdr        = (DHCP_MSG_HDR *)&pmsg_buf[0];
 
-    pmsg_hdr->op    = DHCP_OP_REQUEST;
-    pmsg_hdr->htype = DHCP_HTYPE_ETHER;                         /* See Note #2.                                         */
-    pmsg_hdr->hlen  = NET_IF_ETHER_ADDR_SIZE;
-    pmsg_hdr->hops  = 0;
+   *perr = DHCPc_ERR_NONE;
+}
 
-    NET_UTIL_VAL_COPY_SET_NET_32(&pmsg_hdr->xid, &pif_info->TransactionID);
-    NET_UTIL_VAL_SET_NET_32(&pmsg_hdr->secs, 0);
 
-    NET_UTIL_VAL_COPY_SET_NET_16(&pmsg_hdr->flags, &flag);
+/*
+*********************************************************************************************************
+*                                       DHCPc_IPv6_LeaseApply()
+*
+* Description : (1) Apply a DHCPv6 lease :
+*
+*                   (a) Configure leased address, if changed
+*                   (b) Set      client's lease
+*                   (c) Remove   previous address, if changed
+*                   (d) Withdraw previous prefix, if changed
+*                   (e) Push     delegated prefix
+*
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_IPv6_InitStateHandler(),
+*                                                 DHCPc_IPv6_RenewStateHandler().
+*
+*               please      Pointer to lease to apply.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Lease successfully applied.
+*                               DHCPc_ERR_ADDR_USED             Leased address already used on the link.
+*                               DHCPc_ERR_IF_CFG                Error configuring the interface's address.
+*
+*                                                               ------- RETURNED BY DHCPc_OS_IF_Lock() : -------
+*                               DHCPc_OS_ERR_LOCK               Interface access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IPv6_InitStateHandler(),
+*               DHCPc_IPv6_RenewStateHandler().
+*
+* Note(s)     : (2) The leased address is configured with a 128-bit prefix length (see 'dhcp-c.h  DHCPv6
+*                   DEFINES  Note #4') & Duplicate Address Detection, which blocks until completion.
+*
+*               (3) A new leased address is configured & validated BEFORE the lease is set & the previous
+*                   address removed.  Should the new address be found in use or NOT be configured, the
+*                   client's lease, address & prefix are left unchanged.
+*
+*               (4) The delegated prefix is pushed on every lease applied, so that the prefix function gets
+*                   the renewed lifetimes (see 'dhcp-c.h  DHCPc DHCPv6 PREFIX FUNCTION DATA TYPE  Note #1').
+*
+*               (5) #### The address is configured without lifetimes; it is removed by the client once the
+*                   lease expires.
+*********************************************************************************************************
+*/
 
-    NET_UTIL_VAL_COPY_32(&pmsg_hdr->ciaddr, &ciaddr);           /* Already in net order.                                */
-    NET_UTIL_VAL_SET_NET_32(&pmsg_hdr->yiaddr, 0);
-    NET_UTIL_VAL_SET_NET_32(&pmsg_hdr->siaddr, 0);
-    NET_UTIL_VAL_SET_NET_32(&pmsg_hdr->giaddr, 0);
+static  void  DHCPc_IPv6_LeaseApply (DHCPc_IF_INFO     *pif_info,
+                                     DHCPc_IPv6_LEASE  *please,
+                                     DHCPc_ERR         *perr)
+{
+    DHCPc_IPv6_INFO   *pinfo;
+    DHCPc_IPv6_LEASE   lease_prev;
+    NET_IF_NBR         if_nbr;
+    CPU_BOOLEAN        addr_lease;
+    CPU_BOOLEAN        addr_same;
+    CPU_BOOLEAN        addr_added;
+    CPU_BOOLEAN        same;
+    NET_ERR            err_net;
+
+
+    pinfo  = &pif_info->IPv6;
+    if_nbr =  pif_info->IF_Nbr;
+
+    Mem_Copy((void     *)&lease_prev,
+             (void     *)&pinfo->Lease,
+             (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
+
+    addr_lease = DEF_BIT_IS_SET(please->IA, DHCPc_IPv6_IA_NA);
+    addr_same  = DEF_NO;
+    if ((addr_lease      == DEF_YES) &&
+        (pinfo->AddrCfgd == DEF_YES)) {
+        addr_same = Mem_Cmp((void     *)&lease_prev.Addr,
+                            (void     *)&please->Addr,
+                            (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+    }
+
+                                                                /* ------------------- CFG NEW ADDR ------------------- */
+    addr_added = DEF_NO;
+    if ((addr_lease == DEF_YES) &&                              /* If new addr leased, ...                              */
+        (addr_same  != DEF_YES)) {                              /* ... cfg it (see Notes #2 & #3).                      */
+       (void)NetIPv6_CfgAddrAdd((NET_IF_NBR         ) if_nbr,
+                                (NET_IPv6_ADDR     *)&please->Addr,
+                                (NET_IPv6_PREFIX_LEN) DHCPc_IPv6_ADDR_PREFIX_LEN,
+                                (NET_FLAGS          )(NET_IPv6_FLAG_BLOCK_EN | NET_IPv6_FLAG_DAD_EN),
+                                (NET_ERR           *)&err_net);
+        switch (err_net) {
+            case NET_IPv6_ERR_NONE:
+                 addr_added = DEF_YES;
+                 break;
 
-    Mem_Copy((void     *) pmsg_hdr->chaddr,                     /* Copy hw addr (see Note #2).                          */
-             (void     *) paddr_hw,
-             (CPU_SIZE_T) NET_IF_ETHER_ADDR_SIZE);
 
+            case NET_IPv6_ERR_ADDR_CFG_DUPLICATED:
+                *perr = DHCPc_ERR_ADDR_USED;
+                 return;
 
-                                                                /* --------------- SETTING DHCP MSG OPT --------------- */
-    pmsg_opt = &pmsg_buf[DHCP_MSG_HDR_SIZE];
-    popt     =  pmsg_opt;
 
-    NET_UTIL_VAL_SET_NET_32(popt, DHCP_MAGIC_COOKIE);           /* DHCP Magic cookie.                                   */
-    popt    += DHCP_MAGIC_COOKIE_SIZE;
+            default:
+                *perr = DHCPc_ERR_IF_CFG;
+                 return;
+        }
+    }
 
-   *popt++   = DHCP_OPT_DHCP_MESSAGE_TYPE;                      /* DHCP Message Type.                                   */
-   *popt++   = 1;                                               /* Msg type opt len.                                    */
-   *popt++   = msg_type;
+                                                                /* --------------------- SET LEASE -------------------- */
+    DHCPc_IPv6_LeaseSet(pif_info, please, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        if (addr_added == DEF_YES) {                            /* Rem new addr (see Note #3).                          */
+           (void)NetIPv6_CfgAddrRemove(if_nbr, &please->Addr, &err_net);
+        }
+        return;
+    }
 
-    if (wr_req_ip_addr == DEF_YES) {                            /* Requested IP address.                                */
-       *popt++  = DHCP_OPT_REQUESTED_IP_ADDRESS;
-       *popt++  = 4;
-        NET_UTIL_VAL_COPY_32(popt, &pmsg_last_rx_hdr->yiaddr);
-        popt   += 4;
+                                                                /* ------------------- REM PREV ADDR ------------------ */
+    if ((pinfo->AddrCfgd == DEF_YES) &&                         /* If prev addr cfg'd ...                               */
+        (addr_same       != DEF_YES)) {                         /* ... & changed, rem it.                               */
+       (void)NetIPv6_CfgAddrRemove(if_nbr, &lease_prev.Addr, &err_net);
+        pinfo->AddrCfgd = DEF_NO;
     }
 
-    if (wr_server_id == DEF_YES) {                              /* Server ID.                                           */
-       *popt++  = DHCP_OPT_SERVER_IDENTIFIER;
-       *popt++  = 4;
-        NET_UTIL_VAL_COPY_32(popt, &pif_info->ServerID);
-        popt   += 4;
+    if (addr_added == DEF_YES) {
+        pinfo->AddrCfgd = DEF_YES;
     }
 
-#if (CPU_CFG_NAME_EN == DEF_ENABLED)                            /* Host name.                                           */
-    CPU_NameGet(host_name, &err_cpu);
-    if (err_cpu == CPU_ERR_NONE) {
-        host_name_len = Str_Len(host_name);
-        if (host_name_len > 0) {
-           *popt++  = DHCP_OPT_HOST_NAME;
-           *popt++  = host_name_len;
-            Mem_Copy(popt, host_name, host_name_len);
-            popt   += host_name_len;
+                                                                /* -------------------- PUSH PREFIX ------------------- */
+    if (pinfo->PrefixPushed == DEF_YES) {                       /* If prefix pushed ...                                 */
+        same = DEF_NO;
+        if ((DEF_BIT_IS_SET(please->IA, DHCPc_IPv6_IA_PD) == DEF_YES) &&
+            (lease_prev.PrefixLen == please->PrefixLen)) {
+            same = Mem_Cmp((void     *)&lease_prev.Prefix,
+                           (void     *)&please->Prefix,
+                           (CPU_SIZE_T) NET_IPv6_ADDR_SIZE);
+        }
+        if (same != DEF_YES) {                                  /* ... & changed, withdraw prev prefix.                 */
+            DHCPc_IPv6_PrefixPush(if_nbr, &lease_prev, DEF_NO);
+            pinfo->PrefixPushed = DEF_NO;
         }
     }
-#endif
 
-    if (req_param == DEF_YES) {                                 /* Req'd param.                                         */
-        req_param_qty = sizeof(DHCPc_ReqParam);
+    if (DEF_BIT_IS_SET(please->IA, DHCPc_IPv6_IA_PD) == DEF_YES) {
+        DHCPc_IPv6_PrefixPush(if_nbr, please, DEF_YES);         /* See Note #4.                                         */
+        pinfo->PrefixPushed = DEF_YES;
+    }
 
-       *popt++ = DHCP_OPT_PARAMETER_REQUEST_LIST;
-       *popt++ = pif_info->ParamReqQty + req_param_qty;
 
-        Mem_Copy((void     *) popt,                             /* Copy system req'd param.                             */
-                 (void     *)&DHCPc_ReqParam[0],
-                 (CPU_SIZE_T) req_param_qty);
-        popt += req_param_qty;
+   *perr = DHCPc_ERR_NONE;
+}
 
-        if (pif_info->ParamReqQty > 0) {
-            Mem_Copy((void     *) popt,                         /* Copy app    req'd param (see Note #4).               */
-                     (void     *)&pif_info->ParamReqTbl[0],
-                     (CPU_SIZE_T) pif_info->ParamReqQty);
-            popt += pif_info->ParamReqQty;
-        }
-    }
 
-   *popt++   = DHCP_OPT_END;                                    /* End of options.                                      */
+/*
+*********************************************************************************************************
+*                                      DHCPc_IPv6_LeaseRevert()
+*
+* Description : Revert the lease of a DHCPv6 client.
+*
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_IPv6_InitStateHandler(),
+*                                                 DHCPc_IPv6_StopStateHandler().
+*
+*               lease_clr   Indicate whether to clear the client's lease :
+*
+*                               DEF_YES                         Clear the lease.
+*                               DEF_NO                          Keep  the lease (see Note #1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IPv6_InitStateHandler(),
+*               DHCPc_IPv6_StopStateHandler().
+*
+* Note(s)     : (1) The lease is kept while stopping, so that the RELEASE message carries the leases
+*                   released (see 'DHCPc_IPv6_StopStateHandler()  Note #2').  The pending lease is cleared
+*                   along with the lease.
+*********************************************************************************************************
+*/
 
+static  void  DHCPc_IPv6_LeaseRevert (DHCPc_IF_INFO  *pif_info,
+                                      CPU_BOOLEAN     lease_clr)
+{
+    DHCPc_IPv6_INFO   *pinfo;
+    DHCPc_IPv6_LEASE   lease_none;
+    DHCPc_ERR          err;
+    NET_ERR            err_net;
 
-                                                                /* -------------------- GET MSG LEN ------------------- */
-    opt_len = popt - pmsg_opt;
-    if (opt_len < (DHCP_MSG_TX_MIN_LEN - DHCP_MSG_HDR_SIZE)) {  /* See Note #4.                                         */
-        opt_pad_len = ((DHCP_MSG_TX_MIN_LEN - DHCP_MSG_HDR_SIZE) - opt_len);
 
-        Mem_Set((void     *)popt,
-                (CPU_INT08U)DHCP_OPT_PAD,
-                (CPU_SIZE_T)opt_pad_len);
+    pinfo = &pif_info->IPv6;
 
-        opt_len = (DHCP_MSG_TX_MIN_LEN - DHCP_MSG_HDR_SIZE);
+    if (pinfo->AddrCfgd == DEF_YES) {                           /* Rem leased addr.                                     */
+       (void)NetIPv6_CfgAddrRemove(pif_info->IF_Nbr, &pinfo->Lease.Addr, &err_net);
+        pinfo->AddrCfgd = DEF_NO;
     }
 
-                                                                /* ------------------- GET CUR TIME ------------------- */
-    pif_info->NegoStartTime = DHCPc_OS_TimeGet_tick();
-
-
-    msg_size = DHCP_MSG_HDR_SIZE + opt_len;
-   *perr     = DHCPc_ERR_NONE;
+    if (pinfo->PrefixPushed == DEF_YES) {                       /* Withdraw delegated prefix.                           */
+        DHCPc_IPv6_PrefixPush(pif_info->IF_Nbr, &pinfo->Lease, DEF_NO);
+        pinfo->PrefixPushed = DEF_NO;
+    }
 
-    return (msg_size);
+    if (lease_clr == DEF_YES) {                                 /* Clr lease, if req'd (see Note #1).                   */
+        Mem_Clr((void     *)&lease_none,
+                (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
+        DHCPc_IPv6_LeaseSet(pif_info, &lease_none, &err);
+        Mem_Clr((void     *)&pinfo->LeasePend,
+                (CPU_SIZE_T) sizeof(DHCPc_IPv6_LEASE));
+    }
 }
 
 
 /*
 *********************************************************************************************************
-*                                             DHCPc_Tx()
-*
-* Description : Transmit DHCPc data via socket.
+*                                     DHCPc_IPv6_LeaseTimeCalc()
 *
-* Argument(s) : sock_id             Socket ID of socket to transmit DHCPc data.
-*
-*               pdata_buf           Pointer to DHCPc data buffer to transmit.
+* Description : Calculate the lease time & renewing/rebinding times of the last applied DHCPv6 lease &
+*               configure the lease timer.
 *
-*               data_buf_len        Length  of DHCPc data buffer to transmit.
+* Argument(s) : pif_info    Pointer to DHCP interface information.
+*               --------    Argument validated in DHCPc_IPv6_InitStateHandler(),
+*                                                 DHCPc_IPv6_RenewStateHandler().
 *
-*               paddr_remote        Pointer to the socket address structure of the remote address
+*               time_t1     T1 time of the lease (in seconds), 0 if NOT set.
 *
-*               addr_remote_len     Length  of the socket address structure pointed to by 'paddr_remote'.
+*               time_t2     T2 time of the lease (in seconds), 0 if NOT set.
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
-*                               DHCPc_ERR_NONE                  DHCPc data successfully transmitted.
-*                               DHCPc_ERR_NULL_PTR              Argument(s) 'pdata_buf/paddr_remote' passed
-*                                                                   a NULL pointer.
-*                               DHCPc_ERR_TX                    Transmit error.
+*                               DHCPc_ERR_NONE                  Lease time successfully calculated.
+*                               DHCPc_ERR_TMR_CFG               Configuration timer error.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : DHCPc_Discover(),
-*               DHCPc_Req(),
-*               DHCPc_DeclineRelease().
+* Caller(s)   : DHCPc_IPv6_InitStateHandler(),
+*               DHCPc_IPv6_RenewStateHandler().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The lease time is the lowest valid lifetime of the address & the prefix leased.  The
+*                   lease, T1 & T2 deadlines are anchored on the transmit time of the last message, as for
+*                   a DHCP lease (see 'DHCPc_LeaseTimeCalc()  Notes #2 & #3').
+*
+*               (2) RFC #8415, section 'Identity Association for Non-temporary Addresses Option', states
+*                   that T1 & T2 of 0 leave the renewal times "at the client's discretion".  The DHCP lease
+*                   fractions are then used.
+*
+*               (3) #### A lease with infinite lifetimes is NEVER renewed.
 *********************************************************************************************************
 */
 
-static  void  DHCPc_Tx (NET_SOCK_ID         sock_id,
-                        void               *pdata_buf,
-                        CPU_INT16U          data_buf_len,
-                        NET_SOCK_ADDR      *paddr_remote,
-                        NET_SOCK_ADDR_LEN   addr_remote_len,
-                        DHCPc_ERR          *perr)
+static  void  DHCPc_IPv6_LeaseTimeCalc (DHCPc_IF_INFO  *pif_info,
+                                        CPU_INT32U      time_t1,
+                                        CPU_INT32U      time_t2,
+                                        DHCPc_ERR      *perr)
 {
-    NET_ERR  err_net;
+    DHCPc_IPv6_LEASE  *please;
+    CPU_INT32U         time_lease;
+    CPU_INT32U         time_start_sec;
 
 
-#if (DHCPc_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                   /* ------------------ VALIDATE PTRS ------------------- */
-    if ((pdata_buf    == (void          *)0) ||
-        (paddr_remote == (NET_SOCK_ADDR *)0)) {
-       *perr = DHCPc_ERR_NULL_PTR;
+    please     = &pif_info->IPv6.Lease;
+    time_lease =  DHCPc_IPv6_LIFETIME_INFINITE;
+
+                                                                /* ------------------ GET LEASE TIME ------------------ */
+                                                                /* See Note #1.                                         */
+    if (DEF_BIT_IS_SET(please->IA, DHCPc_IPv6_IA_NA) == DEF_YES) {
+        time_lease = DEF_MIN(time_lease, please->AddrLifetimeValid_sec);
+    }
+    if (DEF_BIT_IS_SET(please->IA, DHCPc_IPv6_IA_PD) == DEF_YES) {
+        time_lease = DEF_MIN(time_lease, please->PrefixLifetimeValid_sec);
+    }
+                                                                /* If lease time infinite (see Note #3), ...            */
+    if ((time_lease == DHCPc_IPv6_LIFETIME_INFINITE) ||
+        (time_lease >  DHCP_LEASE_TIME_MAX_SEC     )) {
+        pif_info->LeaseDeadline_sec = DHCP_LEASE_INFINITE;
+        pif_info->T1_Deadline_sec   = DHCP_LEASE_INFINITE;
+        pif_info->T2_Deadline_sec   = DHCP_LEASE_INFINITE;
+
+       *perr = DHCPc_ERR_NONE;                                  /* ... NO tmr to set.                                   */
         return;
     }
-#endif
 
+    if (time_t1 == 0u) {                                        /* See Note #2.                                         */
+        time_t1 = (CPU_INT32U)(time_lease * DHCP_T1_LEASE_FRACTION);
+    }
+    if (time_t2 == 0u) {
+        time_t2 = (CPU_INT32U)(time_lease * DHCP_T2_LEASE_FRACTION);
+    }
 
-                                                                /* ------------------- TX APP DATA -------------------- */
-   (void)NetApp_SockTx((NET_SOCK_ID       ) sock_id,
-                       (void             *) pdata_buf,
-                       (CPU_INT16U        ) data_buf_len,
-#if (NET_VERSION >= 21200u)
-                       (NET_SOCK_API_FLAGS) NET_SOCK_FLAG_NONE,
-#else
-                       (CPU_INT16S        ) NET_SOCK_FLAG_NONE,
-#endif
-                       (NET_SOCK_ADDR    *) paddr_remote,
-                       (NET_SOCK_ADDR_LEN ) addr_remote_len,
-                       (CPU_INT16U        ) DHCPc_TX_MAX_RETRY,
-                       (CPU_INT32U        ) 0,
-                       (CPU_INT32U        ) DHCPc_TX_TIME_DLY_MS,
-                       (NET_ERR          *)&err_net);
+    if (time_t2 > time_lease) {                                 /* Limit T1 & T2 to lease time.                         */
+        time_t2 = time_lease;
+    }
+    if (time_t1 > time_t2) {
+        time_t1 = time_t2;
+    }
 
-    if (err_net == NET_APP_ERR_NONE) {
-       *perr = DHCPc_ERR_NONE;
+                                                                /* --------------- CALC LEASE DEADLINES --------------- */
+    time_start_sec = pif_info->NegoStartTime;                   /* See Note #1.                                         */
+
+    pif_info->T1_Deadline_sec   = time_start_sec + time_t1;
+    pif_info->T2_Deadline_sec   = time_start_sec + time_t2;
+    pif_info->LeaseDeadline_sec = time_start_sec + time_lease;
+
+                                                                /* ---------------------- CFG TMR --------------------- */
+    DHCPc_TmrCfg((DHCPc_IF_INFO *)pif_info,
+                 (DHCPc_COMM_MSG )DHCPc_COMM_MSG_T1_EXPIRED,
+                 (CPU_INT32U     )pif_info->T1_Deadline_sec,
+                 (DHCPc_ERR     *)perr);
+
+    if (*perr != DHCPc_ERR_NONE) {
+        *perr  = DHCPc_ERR_TMR_CFG;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc_IPv6_PrefixPush()
+*
+* Description : Push a delegated prefix to the application's prefix function.
+*
+* Argument(s) : if_nbr      Interface number of the DHCPv6 client.
+*
+*               please      Pointer to lease holding the delegated prefix.
+*               ------      Argument validated in DHCPc_IPv6_LeaseApply(),
+*                                                 DHCPc_IPv6_LeaseRevert().
+*
+*               valid       Indicate whether the prefix is still delegated :
+*
+*                               DEF_YES                         Push the prefix & its lifetimes.
+*                               DEF_NO                          Withdraw the prefix (see Note #1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_IPv6_LeaseApply(),
+*               DHCPc_IPv6_LeaseRevert().
+*
+* Note(s)     : (1) A withdrawn prefix is pushed with lifetimes of 0 (see 'dhcp-c.h  DHCPc DHCPv6 PREFIX
+*                   FUNCTION DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_IPv6_PrefixPush (NET_IF_NBR         if_nbr,
+                                     DHCPc_IPv6_LEASE  *please,
+                                     CPU_BOOLEAN        valid)
+{
+    DHCPc_IPv6_PREFIX_FNCT  prefix_fnct;
+    CPU_INT32U              lifetime_pref_sec;
+    CPU_INT32U              lifetime_valid_sec;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    prefix_fnct = DHCPc_IPv6_PrefixFnct;
+    CPU_CRITICAL_EXIT();
+
+    if (prefix_fnct == (DHCPc_IPv6_PREFIX_FNCT)0) {
+        return;
+    }
 
+    if (valid == DEF_YES) {
+        lifetime_pref_sec  = please->PrefixLifetimePref_sec;
+        lifetime_valid_sec = please->PrefixLifetimeValid_sec;
     } else {
-       *perr = DHCPc_ERR_TX;
+        lifetime_pref_sec  = 0u;                                /* See Note #1.                                         */
+        lifetime_valid_sec = 0u;
     }
+
+    prefix_fnct(if_nbr, &please->Prefix, please->PrefixLen, lifetime_pref_sec, lifetime_valid_sec);
 }
+#endif
 
 #endif
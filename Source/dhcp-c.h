@@ -28,10 +28,12 @@
 *                (a) Dynamic Configuration of IPv4 Link-Local Addresses       RFC #3927
 *                (b) Supports both infinite & temporary address leases,
 *                        with automatic renewal of lease if necessary
+*                (c) Stateful DHCPv6 address & prefix delegation client,      RFC #8415
+*                        when DHCPc_CFG_IPv6_EN is DEF_ENABLED
 *
 *            (2) To protect the validity & prevent the corruption of shared DHCP client resources,
-*                the primary tasks of the DHCP client are prevented from running concurrently
-*                through the use of a global DHCPc lock implementing protection by mutual exclusion.
+*                the tasks of the DHCP client access the shared resources through the use of a global
+*                DHCPc lock implementing protection by mutual exclusion.
 *
 *                (a) The mechanism of protected mutual exclusion is irrelevant but MUST be implemented
 *                    in the following two functions :
@@ -47,9 +49,26 @@
 *                                <DHCPc>                       directory path for DHCPc module
 *                                <os>                          directory name for specific OS
 *
-*                (b) Since this global lock implements mutual exclusion at the DHCP client task
-*                    level, critical sections are NOT required to prevent task-level concurrency in
-*                    the DHCP client.
+*                (b) The global lock protects the interface information list, the timer list & the
+*                    FORCERENEW listen sockets.  It is NOT held while a message is handled by the DHCPc
+*                    task, but ONLY while these shared resources are accessed, so that the API functions
+*                    are NOT blocked during a negotiation.
+*
+*                    The interface information of a client is handled ONLY by the DHCPc task.
+*
+*                (c) The message, communication object & timer pools, as well as the DHCPc time, are
+*                    accessed without the global lock & are hence protected by short critical sections.
+*
+*                (d) The current DHCP message & the route table of an interface are protected by a
+*                    per-interface lock, implemented in the following two functions :
+*
+*                        DHCPc_OS_IF_Lock()                    acquire access to interface information
+*                        DHCPc_OS_IF_Unlock()                  release access to interface information
+*
+*                    The interface lock is held ONLY while the message or the routes are replaced, freed or
+*                    read.  When both locks are required, the global lock MUST be acquired first.
+*
+*                (e) NO lock is held while the DHCP client delays or receives on a socket.
 *
 *            (3) Assumes the following versions (or more recent) of software modules are included in
 *                the project build :
@@ -200,6 +219,87 @@
 *               receive unicast packets when not fully configured.  This is the case of the uC/TCPIP
 *               stack, so this define MUST be set to DEF_ENABLED when this DHCP client is used with the
 *               Micrium's uC/TCP-IP stack.
+*
+*           (2) Configure DHCPc_CFG_MSG_BUF_SIZE to the size of the DHCP message buffers, i.e. the size of
+*               the largest DHCP message the client is able to receive.
+*
+*               See also 'DHCP MESSAGE DEFINES  Note #1'.
+*
+*           (3) Configure DHCPc_CFG_FORCERENEW_EN to DEF_ENABLED to keep listening on the client port
+*               while the lease is bound & to accept authenticated FORCERENEW messages.
+*
+*               See also 'DHCP AUTHENTICATION DEFINES  Note #1'.
+*
+*           (4) Configure DHCPc_CFG_RENEW_COALESCE_WIN_SEC to the number of seconds a lease MAY be renewed
+*               before its T1 time, so that renewals due within this window are performed along with any
+*               other DHCPc timer expiring earlier.  A value of 0 disables early renewal.
+*
+*               See also 'DHCPc_TmrTaskHandler()  Note #7'.
+*
+*           (5) Configure DHCPc_CFG_CLIENT_ID_MAX_LEN to the maximum length of the client identifier an
+*               interface configuration MAY hold, in order to run several logical DHCP clients on the same
+*               interface.  A value of 0 disables client identifiers & allows a single client per
+*               interface.
+*
+*               See also 'DHCP CLIENT IDENTIFIER DEFINES  Note #1'.
+*
+*           (6) Configure DHCPc_CFG_EMUL_MAX_NBR_CLIENT to the maximum number of virtual clients the
+*               client emulation MAY run concurrently to load test a DHCP server.  A value of 0 disables
+*               the client emulation.
+*
+*               See also 'DHCPc EMULATION DEFINES  Note #1'.
+*
+*           (7) DHCPc_CFG_WORKER_NBR configures the number of DHCPc tasks handling the DHCP negotiations
+*               & MUST be 1.  Every negotiation binds its socket to the DHCP client port, which the network
+*               stack does NOT allow to be bound by several sockets at a time : negotiations run by parallel
+*               tasks would fail with DHCPc_ERR_INIT_SOCK.  A single DHCPc task hence handles the messages
+*               of ALL the interfaces, in order.
+*
+*               See also 'dhcp-c.h  Note #2b'.
+*
+*           (8) Configure DHCPc_CFG_VENDOR_CLASS_MAX_LEN & DHCPc_CFG_VENDOR_INFO_MAX_LEN to the maximum
+*               length of the vendor class identifier & of the vendor-specific information an interface
+*               configuration MAY hold.  A value of 0 disables the corresponding option.
+*
+*               See also 'DHCP VENDOR OPTION DEFINES'.
+*
+*           (9) Configure DHCPc_CFG_ROUTE_MAX_NBR to the maximum number of routes (routers & static routes)
+*               a client MAY hold.  A value of 0 disables the router list & the static routes : ONLY the
+*               first router is then used, as the interface's default gateway.
+*
+*               See also 'DHCPc ROUTE DATA TYPE'.
+*
+*          (10) Configure DHCPc_CFG_SRV_MAX_NBR to the maximum number of domain name servers & of NTP
+*               servers a client MAY hold, & DHCPc_CFG_DOMAIN_NAME_MAX_LEN to the maximum length of the
+*               domain name a client MAY hold.  A DHCPc_CFG_SRV_MAX_NBR of 0 disables the server
+*               functions; a DHCPc_CFG_DOMAIN_NAME_MAX_LEN of 0 disables ONLY the domain name.
+*
+*               See also 'DHCPc SERVER FUNCTION DATA TYPE'.
+*
+*          (11) Configure DHCPc_CFG_PARAM_APPLY_EN to DEF_ENABLED to apply the interface MTU, the ARP cache
+*               timeout, the default IP TTL & the TCP default TTL received in the lease to the IP stack.
+*               Configure DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC to the ARP cache timeout the application configures
+*               with 'NetARP_CfgCacheTimeout()', restored once NO lease timeout is applied anymore.
+*
+*               See also 'DHCPc PARAMETER APPLY DEFINES'.
+*
+*          (12) Configure DHCPc_CFG_HW_TYPE_GENERIC_EN to DEF_ENABLED to run the DHCP client on interfaces
+*               of any hardware type, including interfaces without a hardware address fitting the 'chaddr'
+*               field.  When DEF_DISABLED, ONLY Ethernet interfaces are supported, with the smallest code.
+*
+*               See also 'DHCPc HARDWARE ADDRESS DEFINES'.
+*
+*          (13) Configure DHCPc_CFG_RELAY_EN to DEF_ENABLED to record the relay agent path of the replies
+*               received by a client.  Configure DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN to the maximum length
+*               of the relay agent information recorded, 0 to record ONLY the relay agent address.
+*
+*               See also 'DHCPc RELAY INFORMATION DATA TYPE'.
+*
+*          (14) Configure DHCPc_CFG_IPv6_EN to DEF_ENABLED to run DHCPv6 clients, acquiring an address, a
+*               delegated prefix or both, with the tasks, timers & pools of the DHCP client.  Requires the
+*               IPv6 module of the network protocol suite.
+*
+*               See also 'DHCPv6 DEFINES'.
 *********************************************************************************************************
 */
 
@@ -209,6 +309,85 @@
                                                                 /*   DEF_ENABLED   Broadcast bit     set                */
 #endif
 
+#ifndef  DHCPc_CFG_MSG_BUF_SIZE
+#define  DHCPc_CFG_MSG_BUF_SIZE                          576    /* Configure DHCP msg buf size (in octets, see Note #2).*/
+#endif
+
+#ifndef  DHCPc_CFG_FORCERENEW_EN
+#define  DHCPc_CFG_FORCERENEW_EN                DEF_DISABLED    /* Configure FORCERENEW listener         (see Note #3) :*/
+                                                                /*   DEF_DISABLED  FORCERENEW NOT accepted              */
+                                                                /*   DEF_ENABLED   FORCERENEW     accepted while BOUND  */
+#endif
+
+#ifndef  DHCPc_CFG_RENEW_COALESCE_WIN_SEC
+#define  DHCPc_CFG_RENEW_COALESCE_WIN_SEC                  0    /* Configure renew coalescing window     (see Note #4). */
+#endif
+
+#ifndef  DHCPc_CFG_CLIENT_ID_MAX_LEN
+#define  DHCPc_CFG_CLIENT_ID_MAX_LEN                       0    /* Configure max client id len (in octets, see Note #5).*/
+#endif
+
+#ifndef  DHCPc_CFG_EMUL_MAX_NBR_CLIENT
+#define  DHCPc_CFG_EMUL_MAX_NBR_CLIENT                     0    /* Configure max nbr of virtual clients  (see Note #6). */
+#endif
+
+#ifndef  DHCPc_CFG_WORKER_NBR
+#define  DHCPc_CFG_WORKER_NBR                              1    /* Configure nbr of DHCPc tasks          (see Note #7). */
+#endif
+
+#ifndef  DHCPc_CFG_VENDOR_CLASS_MAX_LEN
+#define  DHCPc_CFG_VENDOR_CLASS_MAX_LEN                    0    /* Configure max vendor class len        (see Note #8). */
+#endif
+
+#ifndef  DHCPc_CFG_VENDOR_INFO_MAX_LEN
+#define  DHCPc_CFG_VENDOR_INFO_MAX_LEN                     0    /* Configure max vendor info  len        (see Note #8). */
+#endif
+
+#ifndef  DHCPc_CFG_ROUTE_MAX_NBR
+#define  DHCPc_CFG_ROUTE_MAX_NBR                           0    /* Configure max nbr of routes           (see Note #9). */
+#endif
+
+#ifndef  DHCPc_CFG_SRV_MAX_NBR
+#define  DHCPc_CFG_SRV_MAX_NBR                             0    /* Configure max nbr of DNS/NTP srvs    (see Note #10). */
+#endif
+
+#ifndef  DHCPc_CFG_DOMAIN_NAME_MAX_LEN
+#define  DHCPc_CFG_DOMAIN_NAME_MAX_LEN                     0    /* Configure max domain name len        (see Note #10). */
+#endif
+
+#ifndef  DHCPc_CFG_PARAM_APPLY_EN
+#define  DHCPc_CFG_PARAM_APPLY_EN               DEF_DISABLED    /* Configure lease param apply          (see Note #11) :*/
+                                                                /*   DEF_DISABLED  Lease params NOT applied             */
+                                                                /*   DEF_ENABLED   Lease params     applied             */
+#endif
+
+#ifndef  DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC
+                                                                /* Configure ARP cache timeout (in sec, see Note #11).  */
+#define  DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC        NET_ARP_CACHE_TIMEOUT_DFLT_SEC
+#endif
+
+#ifndef  DHCPc_CFG_HW_TYPE_GENERIC_EN
+#define  DHCPc_CFG_HW_TYPE_GENERIC_EN           DEF_DISABLED    /* Configure generic hw type            (see Note #12) :*/
+                                                                /*   DEF_DISABLED  Ethernet IFs ONLY                    */
+                                                                /*   DEF_ENABLED   IFs of any hw type                   */
+#endif
+
+#ifndef  DHCPc_CFG_RELAY_EN
+#define  DHCPc_CFG_RELAY_EN                     DEF_DISABLED    /* Configure relay agent path           (see Note #13) :*/
+                                                                /*   DEF_DISABLED  Relay path NOT recorded              */
+                                                                /*   DEF_ENABLED   Relay path     recorded              */
+#endif
+
+#ifndef  DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN
+#define  DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN                0    /* Configure max relay agent info len   (see Note #13). */
+#endif
+
+#ifndef  DHCPc_CFG_IPv6_EN
+#define  DHCPc_CFG_IPv6_EN                      DEF_DISABLED    /* Configure DHCPv6 client              (see Note #14) :*/
+                                                                /*   DEF_DISABLED  DHCPv6 client NOT present            */
+                                                                /*   DEF_ENABLED   DHCPv6 client     present            */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -239,6 +418,8 @@ typedef  enum dhcp_c_err {
     DHCPc_ERR_IF_NOT_MANAGED                         =   24,    /* IF NOT managed by DHCP client.                       */
     DHCPc_ERR_IF_OPT_NONE                            =   25,    /* DHCP opt NOT present on IF.                          */
     DHCPc_ERR_IF_CFG_STATE                           =   26,    /* IP cfg state err.                                    */
+    DHCPc_ERR_INVALID_CFG                            =   27,    /* Invalid IF cfg.                                      */
+    DHCPc_ERR_IF_ADDR_NONE                           =   28,    /* NO addr cfg'd on IF.                                 */
 
     DHCPc_ERR_IF_INFO_NONE_AVAIL                     =   30,    /* IF info  pool empty.                                 */
     DHCPc_ERR_IF_INFO_IF_USED                        =   31,    /* IF info  already already used for this IF.           */
@@ -248,6 +429,10 @@ typedef  enum dhcp_c_err {
 
     DHCPc_ERR_COMM_NONE_AVAIL                        =   50,    /* Comm obj pool empty.                                 */
 
+    DHCPc_ERR_REQ_IN_USE                             =   55,    /* Req handle already pending.                          */
+    DHCPc_ERR_REQ_TIMEOUT                            =   56,    /* Req NOT completed before timeout.                    */
+    DHCPc_ERR_REQ_WAIT_NONE_AVAIL                    =   57,    /* Req waiter pool empty.                               */
+
     DHCPc_ERR_TMR_NONE_AVAIL                         =   60,    /* Tmr      pool empty.                                 */
     DHCPc_ERR_TMR_INVALID_MSG                        =   61,    /* Invalid tmr msg.                                     */
     DHCPc_ERR_TMR_CFG                                =   62,    /* Err cfg'ing tmr.                                     */
@@ -266,6 +451,14 @@ typedef  enum dhcp_c_err {
 
     DHCPc_ERR_IPv4_NOT_PRESENT                       =  100,    /* DHCPc requires NET_IP_CFG_IPv4_EN set to DEF_ENABLED */
 
+    DHCPc_ERR_EMUL_IN_USE                            =  110,    /* Client emulation already running.                    */
+
+    DHCPc_ERR_ROUTE_NONE                             =  120,    /* NO route to dest.                                    */
+
+    DHCPc_ERR_CLIENT_ID_NONE                         =  130,    /* NO hw addr & NO client id to identify client.        */
+
+    DHCPc_ERR_IPv6_STATUS                            =  140,    /* DHCPv6 status code err rx'd.                         */
+
 
 
     DHCPc_OS_ERR_NONE                                = 1000,
@@ -283,6 +476,10 @@ typedef  enum dhcp_c_err {
     DHCPc_OS_ERR_INIT_TMR                            = 1027,
     DHCPc_OS_ERR_INIT_TMR_SIGNAL                     = 1028,
     DHCPc_OS_ERR_INIT_TMR_SIGNAL_NAME                = 1029,
+    DHCPc_OS_ERR_INIT_REQ_SIGNAL                     = 1030,
+    DHCPc_OS_ERR_INIT_REQ_SIGNAL_NAME                = 1031,
+    DHCPc_OS_ERR_INIT_IF_LOCK                        = 1032,
+    DHCPc_OS_ERR_INIT_IF_LOCK_NAME                   = 1033,
 
     DHCPc_OS_ERR_INIT_TASK                           = 1040,
     DHCPc_OS_ERR_INIT_TASK_NAME                      = 1041,
@@ -292,6 +489,8 @@ typedef  enum dhcp_c_err {
     DHCPc_OS_ERR_LOCK                                = 1050,
     DHCPc_OS_ERR_MSG_Q                               = 1051,
     DHCPc_OS_ERR_TMR                                 = 1052,
+    DHCPc_OS_ERR_REQ_SIGNAL                          = 1053,
+    DHCPc_OS_ERR_REQ_TIMEOUT                         = 1054,
 
 } DHCPc_ERR;
 
@@ -309,9 +508,21 @@ typedef  enum dhcp_c_err {
 *********************************************************************************************************
 *                                        DHCP MESSAGE DEFINES
 *
-* Note(s) : (1) RFC #2131, section 'Protocol Summary' states that "a DHCP client must be prepared to
-*               receive a message of up to 576 octets".  Hense, the size of the DHCP message buffer is
-*               fixed to this length.
+* Note(s) : (1) (a) RFC #2131, section 'Protocol Summary' states that "a DHCP client must be prepared to
+*                   receive a message of up to 576 octets".  Hense, the size of the DHCP message buffer
+*                   is at least this length.
+*
+*               (b) RFC #2132, section 'Maximum DHCP Message Size' specifies that a client MAY advertise
+*                   "the maximum length DHCP message that it is willing to accept.  The length is specified
+*                   as an unsigned 16-bit integer. [...] The minimum legal value is 576 octets".
+*
+*                   When the message buffer is configured larger than the minimum, the client advertises
+*                   this option in DISCOVER & REQUEST messages so that the server MAY send all of the
+*                   requested options in a single reply.  The advertised value accounts for the IP & UDP
+*                   headers, as most servers subtract them from the option value.
+*
+*                   #### Messages larger than the interface MTU are fragmented; the TCP/IP stack MUST
+*                   then be configured to reassemble IP datagrams of that size.
 *
 *           (2) (a) RFC #2131, section 'Introduction' states that "the format of DHCP messages is based
 *                   on the format of BOOTP messages, to capture the BOOTP relay agent behavior described
@@ -343,9 +554,13 @@ typedef  enum dhcp_c_err {
 *********************************************************************************************************
 */
 
-#define  DHCP_MSG_BUF_SIZE                                576   /* Buf size                          (see Note #1).     */
+                                                                /* Buf size                          (see Note #1a).    */
+#define  DHCP_MSG_BUF_SIZE                 DHCPc_CFG_MSG_BUF_SIZE
+#define  DHCP_MSG_BUF_SIZE_MIN                            576   /* Min buf size                      (see Note #1a).    */
+#define  DHCP_MSG_IP_UDP_HDR_SIZE                          28   /* IP & UDP hdr size                 (see Note #1b).    */
 
 #define  DHCP_MSG_TX_MIN_LEN                              300   /* Min tx'd msg len                  (see Note #2).     */
+#define  DHCP_MSG_HDR_LEN                                 236   /* Len of DHCP_MSG_HDR (in octets).                     */
 #define  DHCP_MSG_RX_MIN_LEN                              244   /* Min rx'd msg len                  (see Note #2).     */
 
 #define  DHCP_MAGIC_COOKIE                         0x63825363   /* Magic cookie                      (see Note #3).     */
@@ -359,6 +574,8 @@ typedef  enum dhcp_c_err {
 
 #define  DHCP_HTYPE_ETHER                                   1   /* Ethernet hardware address type.                      */
 
+#define  DHCP_CHADDR_LEN                                   16   /* Len of 'chaddr' field (in octets).                   */
+
 
 /*
 *********************************************************************************************************
@@ -381,14 +598,22 @@ typedef  enum dhcp_c_err {
 #define  DHCP_MSG_NAK                                      6
 #define  DHCP_MSG_RELEASE                                  7
 #define  DHCP_MSG_INFORM                                   8
+#define  DHCP_MSG_FORCERENEW                               9
 
 
 /*
 *********************************************************************************************************
 *                                 DHCP COMMUNICATION MESSAGE DEFINES
 *
-* Note(s) : (1) The worse case for the communication message queue is 5 messages being posted to the
-*               queue waiting to be consumed; this is hence the maximum queue size per interface.
+* Note(s) : (1) Every communication message is posted to the queue within a communication object, which is
+*               ONLY freed once the message has been consumed by DHCPc_MsgRxHandler().  The queue hence never
+*               holds more messages than there are communication objects, i.e. DHCPc_COMM_MSG_MAX_NBR per
+*               interface (see 'DHCPc TIMER, INTERFACE INFORMATION, & MESSAGE QUANTITY DEFINES  Note #3'),
+*               whatever the kind of the messages posted.
+*
+*           (2) INFORM & FORCERENEW messages also need a communication object & hence do NOT increase the
+*               worst case; a message that can NOT get one is refused with DHCPc_ERR_COMM_NONE_AVAIL before
+*               being posted.
 *********************************************************************************************************
 */
 
@@ -399,9 +624,11 @@ typedef  enum dhcp_c_err {
 #define  DHCPc_COMM_MSG_T1_EXPIRED                         3
 #define  DHCPc_COMM_MSG_T2_EXPIRED                         4
 #define  DHCPc_COMM_MSG_LEASE_EXPIRED                      5
+#define  DHCPc_COMM_MSG_INFORM                             6
+#define  DHCPc_COMM_MSG_FORCERENEW                         7
 
 
-#define  DHCPc_COMM_MSG_MAX_NBR                            5    /* See Note #1.                                         */
+#define  DHCPc_COMM_MSG_MAX_NBR                            2    /* See Note #1.                                         */
 
 
 /*
@@ -411,8 +638,8 @@ typedef  enum dhcp_c_err {
 * Note(s) : (1) The DHCP states are depicted in RFC #2131, figure 5 'State-transition diagram for DHCP
 *               clients'.
 *
-*           (2) DHCP_STATE_NONE, DHCP_STATE_LOCAL_LINK, & DHCP_STATE_STOPPING are not defined in RFC #2132,
-*               and are intended to be used internally only.
+*           (2) DHCP_STATE_NONE, DHCP_STATE_LOCAL_LINK, DHCP_STATE_STOPPING & DHCP_STATE_INFORM are not
+*               defined in RFC #2132, and are intended to be used internally only.
 *********************************************************************************************************
 */
 
@@ -431,6 +658,8 @@ typedef  enum dhcp_c_err {
 
 #define  DHCP_STATE_STOPPING                              10    /* See note #2.                                         */
 
+#define  DHCP_STATE_INFORM                                11    /* See note #2.                                         */
+
 
 /*
 *********************************************************************************************************
@@ -447,6 +676,8 @@ typedef  enum dhcp_c_err {
 
 #define  DHCP_STATUS_FAIL                                  5
 
+#define  DHCP_STATUS_INFORMED                              6
+
 
 /*
 *********************************************************************************************************
@@ -455,6 +686,9 @@ typedef  enum dhcp_c_err {
 * Note(s) : (1) This section defines the DHCP Options and BOOTP Vendor Extensions, as defined in
 *               RFC #2132.  This list is not necessarily exhaustive; please refer to the Internet
 *               Assigned Numbers Authority (www.iana.org) for the complete list.
+*
+*           (2) RFC #2132, section 'Option Overload' states that "this option is used to indicate that the
+*               DHCP 'sname' or 'file' fields are being overloaded by using them to carry DHCP options".
 *********************************************************************************************************
 */
 
@@ -553,9 +787,174 @@ typedef  enum dhcp_c_err {
 #define  DHCP_OPT_CLIENT_IDENTIFIER                               61    /*  n,     2 <= n <= 255                        */
 #define  DHCP_OPT_TFTP_SERVER_NAME                                66    /*  n,     1 <= n <= 255                        */
 #define  DHCP_OPT_BOOTFILE_NAME                                   67    /*  n,     1 <= n <= 255                        */
+#define  DHCP_OPT_RELAY_AGENT_INFORMATION                         82    /*  n,     2 <= n <= 255                        */
+#define  DHCP_OPT_AUTHENTICATION                                  90    /*  n,    11 <= n <= 255                        */
+#define  DHCP_OPT_DOMAIN_SEARCH                                  119    /*  n,     1 <= n <= 255                        */
+#define  DHCP_OPT_CLASSLESS_STATIC_ROUTE                         121    /*  n,     5 <= n <= 255                        */
+#define  DHCP_OPT_FORCERENEW_NONCE_CAPABLE                       145    /*  n,     1 <= n <= 255                        */
 
 #define  DHCP_OPT_END                                            255    /*  0                                           */
 
+                                                                /* Option overload values (see Note #2).                */
+#define  DHCP_OPT_OVERLOAD_FILE                                    1    /* 'file'  field holds opt's.                   */
+#define  DHCP_OPT_OVERLOAD_SNAME                                   2    /* 'sname' field holds opt's.                   */
+#define  DHCP_OPT_OVERLOAD_BOTH                                    3    /* Both fields   hold  opt's.                   */
+
+
+/*
+*********************************************************************************************************
+*                                   DHCP CLIENT IDENTIFIER DEFINES
+*
+* Note(s) : (1) RFC #2131, section 4.2 requires a client supplying a 'client identifier' option to use the
+*               same identifier in all subsequent messages, & the server to use that identifier to identify
+*               the client.
+*
+*               Each logical client of an interface is thus identified by its own client identifier,
+*               while all of them share the interface's hardware address in the 'chaddr' field.
+*
+*           (2) RFC #2132, section 'Client-identifier' requires the option to be at least 2 octets long.
+*               The maximum length is limited to the longest DUID based client identifier.  The option
+*               does NOT always fit in a minimum size DHCP message along with the vendor options & the
+*               parameter request list; the message buffer size is hence checked against the configured
+*               maximum lengths at compile time (see 'DHCPc TRANSMIT OPTION TEMPLATE DEFINES  Note #3').
+*
+*           (3) RFC #4361, section 6.1 defines a client identifier built from the client's DHCP Unique
+*               Identifier (DUID) & from an Identity Association Unique Identifier (IAID) :
+*
+*                   +------+------+------+------+------+------+------+------+--
+*                   | Type |                  IAID                 |  DUID  ...
+*                   | 255  |                                       |        ...
+*                   +------+------+------+------+------+------+------+------+--
+*
+*               so that the DHCP server identifies the client by the same DUID as its DHCPv6 server.
+*********************************************************************************************************
+*/
+
+#define  DHCP_CLIENT_ID_LEN_MIN                            2    /* See Note #2.                                         */
+#define  DHCP_CLIENT_ID_LEN_MAX                           64
+
+#define  DHCP_CLIENT_ID_TYPE_DUID                        255    /* Client id type : DUID/IAID   (see Note #3).          */
+#define  DHCP_CLIENT_ID_IAID_LEN                           4    /* IAID len (in octets).                                */
+#define  DHCP_CLIENT_ID_DUID_OFFSET                        5    /* Offset of DUID in client id.                         */
+
+
+/*
+*********************************************************************************************************
+*                                     DHCP VENDOR OPTION DEFINES
+*
+* Note(s) : (1) RFC #2132, sections 'Vendor class identifier' & 'Vendor Specific Information' allow the
+*               client to identify its vendor type & configuration to the DHCP server (e.g. so that the
+*               server selects a class-based address pool), & to send vendor-specific information.
+*
+*           (2) The maximum lengths bound the options' size in the transmit option template.  At their
+*               largest, combined with the client identifier (see 'DHCP CLIENT IDENTIFIER DEFINES  Note #2'),
+*               the options do NOT fit in a minimum size DHCP message; the message buffer size is hence
+*               checked against the configured maximum lengths at compile time (see 'DHCPc TRANSMIT OPTION
+*               TEMPLATE DEFINES  Note #3').
+*********************************************************************************************************
+*/
+
+#define  DHCP_VENDOR_CLASS_LEN_MIN                         1    /* See Note #2.                                         */
+#define  DHCP_VENDOR_CLASS_LEN_MAX                        64
+
+#define  DHCP_VENDOR_INFO_LEN_MIN                          1
+#define  DHCP_VENDOR_INFO_LEN_MAX                         64
+
+
+/*
+*********************************************************************************************************
+*                                         DHCP ROUTE DEFINES
+*
+* Note(s) : (1) RFC #3442, section 'Classless Route Option Format' encodes each route of the 'Classless
+*               Static Route' option as the destination prefix length, followed by the significant octets
+*               of the destination (i.e. the prefix length rounded up to whole octets) & by the router.
+*               "The minimum length of this option is 5 bytes", i.e. a single default route.
+*
+*           (2) RFC #2132, section 'Static Route Option' encodes each route as a destination address
+*               followed by the router address.  The destination mask is the class mask of the destination
+*               address.
+*********************************************************************************************************
+*/
+
+#define  DHCP_ROUTE_PREFIX_LEN_MAX                        32    /* Max prefix len (see Note #1).                        */
+#define  DHCP_ROUTE_ROUTER_LEN                             4
+#define  DHCP_ROUTE_CLASSLESS_LEN_MIN                      5    /* Min len of classless route opt (see Note #1).        */
+#define  DHCP_ROUTE_STATIC_LEN                             8    /* Len of a static route (see Note #2).                 */
+
+                                                                /* Class masks (see Note #2).                           */
+#define  DHCP_ROUTE_CLASS_A_MASK                 0x80000000u
+#define  DHCP_ROUTE_CLASS_A                      0x00000000u
+#define  DHCP_ROUTE_CLASS_A_MASK_NET             0xFF000000u
+#define  DHCP_ROUTE_CLASS_B_MASK                 0xC0000000u
+#define  DHCP_ROUTE_CLASS_B                      0x80000000u
+#define  DHCP_ROUTE_CLASS_B_MASK_NET             0xFFFF0000u
+#define  DHCP_ROUTE_CLASS_C_MASK                 0xE0000000u
+#define  DHCP_ROUTE_CLASS_C                      0xC0000000u
+#define  DHCP_ROUTE_CLASS_C_MASK_NET             0xFFFFFF00u
+
+
+/*
+*********************************************************************************************************
+*                                      DHCP DOMAIN NAME DEFINES
+*
+* Note(s) : (1) RFC #2132, section 'Domain Name' encodes the 'Domain Name' option as the domain name
+*               itself, in ASCII, without any terminating NULL character.
+*
+*           (2) RFC #3397, section 'Domain Search Option Format' encodes the 'Domain Search' option as a
+*               list of domain names in DNS wire format, i.e. as a sequence of length-prefixed labels ending
+*               with a zero-length label, that MAY be compressed with pointers to a preceding name of the
+*               list (see RFC #1035, section 'Message compression').
+*********************************************************************************************************
+*/
+
+#define  DHCP_DOMAIN_NAME_LEN_MAX                        253    /* Max domain name len (in chars).                      */
+#define  DHCP_DOMAIN_LABEL_LEN_MAX                        63    /* Max label       len (in chars, see Note #2).         */
+
+#define  DHCP_DOMAIN_LABEL_PTR_MASK                    0xC0u    /* Label len mask of a compression ptr (see Note #2).   */
+#define  DHCP_DOMAIN_LABEL_SEP                           '.'
+
+
+/*
+*********************************************************************************************************
+*                                     DHCP AUTHENTICATION DEFINES
+*
+* Note(s) : (1) With the Forcerenew Nonce Authentication protocol (see RFC #6704), the server sends a nonce
+*               in the 'Authentication' option of the DHCPACK message.  The server then authenticates any
+*               following DHCPFORCERENEW message with an HMAC-MD5 digest computed over the whole message,
+*               keyed with that nonce.
+*
+*           (2) The 'Authentication' option value holds the protocol, the algorithm & the replay
+*               detection method (RDM) octets, followed by the replay detection value, the
+*               authentication information type & the authentication information (see RFC #3118,
+*               section 'Format of the authentication option').
+*
+*           (3) The nonce & the HMAC-MD5 digest are both 16 octets long, so both 'Authentication' options
+*               have the same length.
+*********************************************************************************************************
+*/
+
+#define  DHCP_AUTH_PROTOCOL_FORCERENEW_NONCE               3    /* See Note #1.                                         */
+#define  DHCP_AUTH_ALGORITHM_HMAC_MD5                      1
+#define  DHCP_AUTH_RDM_MONOTONIC                           0
+
+#define  DHCP_AUTH_INFO_TYPE_NONCE                         1    /* Nonce    auth info (in DHCPACK).                     */
+#define  DHCP_AUTH_INFO_TYPE_HMAC_MD5                      2    /* HMAC-MD5 auth info (in DHCPFORCERENEW).              */
+
+#define  DHCP_AUTH_REPLAY_LEN                              8    /* Replay detection val len (in octets).                */
+#define  DHCP_AUTH_NONCE_LEN                              16    /* Nonce                len (in octets).                */
+#define  DHCP_AUTH_HMAC_MD5_LEN                           16    /* HMAC-MD5 digest      len (in octets).                */
+
+                                                                /* Auth opt val offsets (see Note #2).                  */
+#define  DHCP_AUTH_OFFSET_PROTOCOL                         0
+#define  DHCP_AUTH_OFFSET_ALGORITHM                        1
+#define  DHCP_AUTH_OFFSET_RDM                              2
+#define  DHCP_AUTH_OFFSET_REPLAY                           3
+#define  DHCP_AUTH_OFFSET_INFO_TYPE                       11
+#define  DHCP_AUTH_OFFSET_INFO                            12
+
+                                                                /* Auth opt val len (see Note #3).                      */
+#define  DHCP_AUTH_OPT_LEN                 (DHCP_AUTH_OFFSET_INFO + DHCP_AUTH_NONCE_LEN)
+
 
 /*
 *********************************************************************************************************
@@ -570,12 +969,22 @@ typedef  enum dhcp_c_err {
 *               See also 'DHCPc_InitStateHandler()  Note #4'.
 *
 *           (3) When a RELEASE message is transmited, it is possible that the target has to resolve
-*               the destination hardware address through ARP.  We hence have to introduce a slight delay
-*               to allow that address to be resolved and for the RELEASE message to be sent out before
-*               the interface network layer is un-configured.
+*               the destination hardware address through ARP.  We hence have to wait for that address to
+*               be resolved and for the RELEASE message to be sent out before the interface network layer
+*               is un-configured.
 *
 *               Not doing so would result in the message to never to transmited since an un-configured
 *               interface does NOT resolve pending ARP caches.
+*
+*               The ARP cache is polled every DHCP_RELEASE_POLL_DLY_MS milliseconds & the wait ends as
+*               soon as the address is resolved, or after DHCP_RELEASE_DLY_S seconds at most.
+*
+*               See also 'DHCPc_ReleaseWait()  Note #2'.
+*
+*           (4) Lease deadlines are compared on the DHCPc time base using signed differences; any lease,
+*               T1 or T2 time larger than this value is therefore handled as an infinite time.
+*
+*               See also 'DHCPc_LeaseTimeCalc()  Note #3'.
 *********************************************************************************************************
 */
 
@@ -586,22 +995,32 @@ typedef  enum dhcp_c_err {
 
 #define  DHCP_MIN_RETX_TIME_S                           300     /* Min re-tx time (see Note #1).                        */
 
+                                                                /* Max lease time offset (see Note #4).                 */
+#define  DHCP_LEASE_TIME_MAX_SEC                    DEF_INT_32S_MAX_VAL
+
 #define  DHCP_INIT_DLY_MS                             10000     /* Init       dly (see Note #2).                        */
 
-                                                                /* Release    dly (see Note #3).                        */
+                                                                /* Release max dly (see Note #3).                       */
 #define  DHCP_RELEASE_DLY_S                         NET_ARP_REQ_RETRY_TIMEOUT_DFLT_SEC
 
+#define  DHCP_RELEASE_POLL_DLY_MS                        50     /* Release poll dly (see Note #3).                      */
+
 
 /*
 *********************************************************************************************************
 *                                         DHCP TIMER DEFINES
 *
 * Note(s) : (1) DHCP client time tick for timer(s) associated to address lease(s).
+*
+*           (2) Renewing a lease more than one hour before its T1 time would defeat the lease times set by
+*               the server (see 'DHCPc DEFAULT CFG  Note #4').
 *********************************************************************************************************
 */
 
 #define  DHCPc_TMR_PERIOD_SEC                               5   /* Period of DHCPc tmr in sec (see Note #1).            */
 
+#define  DHCPc_RENEW_COALESCE_WIN_MAX_SEC                3600   /* Max renew coalescing window (see Note #2).           */
+
 
 /*
 *********************************************************************************************************
@@ -618,7 +1037,19 @@ typedef  enum dhcp_c_err {
 *               configured to use DHCP.  Since communication objects are used by both DHCPc timers &
 *               by the start and stop function, it is possible that DHCPc_CFG_MAX_NBR_IF number of
 *               communication objects be used by timers while the application tries to stop
-*               those DHCPc_CFG_MAX_NBR_IF interfaces at the same time.
+*               those DHCPc_CFG_MAX_NBR_IF interfaces at the same time.  The communication message
+*               queue is sized accordingly (see 'DHCP COMMUNICATION MESSAGE DEFINES  Note #1').
+*
+*           (4) When several logical clients run on the same interface (see 'DHCP CLIENT IDENTIFIER
+*               DEFINES  Note #1'), each logical client uses its own interface information; the total
+*               number of interfaces is then the total number of logical clients.
+*
+*           (5) Each DHCPv6 client also uses its own interface information (see 'DHCPv6 DEFINES'); an
+*               interface running both a DHCP & a DHCPv6 client counts as two interfaces.
+*
+*           (6) Define the number of request waiters as the total number of interfaces, i.e. up to one task
+*               waiting on a request of each interface at the same time (see 'dhcp-c.c  DHCPc_ReqWait()
+*               Note #2').
 *********************************************************************************************************
 */
 
@@ -630,7 +1061,10 @@ typedef  enum dhcp_c_err {
 #define  DHCPc_NBR_MSG_BUF                 (DHCPc_CFG_MAX_NBR_IF + 1)
 
                                                                 /* See Note #3.                                         */
-#define  DHCPc_NBR_COMM                    (DHCPc_CFG_MAX_NBR_IF * 2)
+#define  DHCPc_NBR_COMM                    (DHCPc_CFG_MAX_NBR_IF * DHCPc_COMM_MSG_MAX_NBR)
+
+                                                                /* See Note #6.                                         */
+#define  DHCPc_NBR_REQ_WAIT                 DHCPc_CFG_MAX_NBR_IF
 
 
 /*
@@ -642,117 +1076,497 @@ typedef  enum dhcp_c_err {
                                                                 /* ------------------- DHCPc FLAGS -------------------- */
 #define  DHCPc_FLAG_NONE                         DEF_BIT_NONE
 #define  DHCPc_FLAG_USED                           DEF_BIT_00   /* Obj cur used; i.e. NOT in free pool.                 */
+#define  DHCPc_FLAG_ADDR_SHARED                    DEF_BIT_01   /* IF addr'd by other client(s) when nego started.      */
+#define  DHCPc_FLAG_ROUTE_INSTALLED                DEF_BIT_02   /* Routes installed by route fnct.                      */
+#define  DHCPc_FLAG_IPv6                           DEF_BIT_03   /* DHCPv6 client.                                       */
 
 
 /*
 *********************************************************************************************************
-*                                  DHCPc TIME DELAY & RETRY DEFINES
+*                                   DHCPc HARDWARE ADDRESS DEFINES
+*
+* Note(s) : (1) (a) When DHCPc_CFG_HW_TYPE_GENERIC_EN is DEF_DISABLED, ONLY Ethernet interfaces are
+*                   supported : the 'htype' & 'hlen' fields are constant & the hardware address of the
+*                   interface MUST be an Ethernet address.
+*
+*               (b) When DHCPc_CFG_HW_TYPE_GENERIC_EN is DEF_ENABLED, the 'htype' field is taken from the
+*                   interface configuration (see 'DHCPc INTERFACE CONFIGURATION DATA TYPE  Note #7') & the
+*                   'hlen' field from the length of the interface's hardware address.  The hardware type
+*                   is NOT derived from the interface :
+*
+*                   (1) A hardware type of DHCPc_HW_TYPE_NONE, the default, stands for Ethernet; the
+*                       interface MUST then have an Ethernet hardware address, otherwise the client is NOT
+*                       started & DHCPc_ERR_INVALID_HW_ADDR is returned.
+*
+*                   (2) The hardware type of any other interface (e.g. a PPP or an IP over InfiniBand
+*                       interface) MUST be configured explicitly.
+*
+*           (2) RFC #2131, section 'Protocol Summary' limits the client hardware address to the 16 octets
+*               of the 'chaddr' field.  An interface without a hardware address, or with a hardware address
+*               longer than 'chaddr' (e.g. IP over InfiniBand, see RFC #4390), transmits an 'hlen' of 0 &
+*               an empty 'chaddr' :
+*
+*               (a) The client is then ONLY identified by its client identifier, which MUST be configured
+*                   (see 'DHCP CLIENT IDENTIFIER DEFINES').
+*
+*               (b) The broadcast bit is always set, since the server can NOT unicast a reply to the
+*                   client's hardware address.
+*
+*               (c) Since uC/TCP-IP ARP ONLY runs on Ethernet interfaces, the address validation & the
+*                   dynamic link-local address configuration are ONLY performed on Ethernet interfaces.
 *********************************************************************************************************
 */
 
-#define  DHCPc_BACKOFF_DLY_INITIAL_MS                    2000   /* Initial dly                  (in ms).                */
-#define  DHCPc_BACKOFF_DLY_MAX_MS                       64000   /* Max exponential back-off dly (in ms).                */
-#define  DHCPc_BACKOFF_DLY_SCALAR                           2   /* Exponential back-off dly scalar.                     */
-
-#define  DHCPc_TX_MAX_RETRY                                 3   /* Max nbr of  tx  retry   when transitory err.         */
-#define  DHCPc_RX_MAX_RETRY                                 3   /* Max nbr of  rx  retry   when transitory err.         */
-#define  DHCPc_TX_TIME_DLY_MS                             500   /* Dly between tx  retries when transitory err, in ms.  */
-#define  DHCPc_RX_TIME_DLY_MS                             500   /* Dly between rx  retries when transitory err, in ms.  */
+#define  DHCPc_HW_TYPE_NONE                                 0   /* Hw type NOT cfg'd (see Note #1b1).                   */
 
-#define  DHCP_ADDR_VALIDATE_WAIT_TIME_MS                 3000   /* ARP reply wait time for addr validation.             */
+                                                                /* Max hw addr len (see Note #2).                       */
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+#define  DHCPc_HW_ADDR_LEN_MAX               DHCP_CHADDR_LEN
+#else
+#define  DHCPc_HW_ADDR_LEN_MAX        NET_IF_ETHER_ADDR_SIZE
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                         LINK-LOCAL ADDRESSES DEFINES
+*                                DHCPc PARAMETER REQUEST LIST DEFINES
+*
+* Note(s) : (1) The parameter request list is built once, when the interface is started, from the system
+*               requested parameters enabled in the interface configuration & from the application
+*               requested parameters NOT already present in the list (see 'dhcp-c.c  DHCPc_ParamReqBuild()').
+*
+*           (2) Each system requested parameter flag matches the parameter at the same index in the
+*               system requested parameter table (see 'dhcp-c.c  DHCPc_ReqParam[]').
+*
+*           (3) Since the system requested parameters that are NOT enabled do NOT use any entry of the
+*               interface's parameter request table, the application MAY request up to
+*               DHCPc_PARAM_REQ_TBL_SIZE distinct parameters when ALL system parameters are disabled.
+*
+*           (4) The system requested parameters of a feature disabled at compile-time (see 'DEFAULT
+*               CONFIGURATION  Notes #9, #10 & #11') keep their flag & their entry in the system requested
+*               parameter table, but are NOT part of DHCPc_REQ_PARAM_ALL & do NOT use any entry of the
+*               interface's parameter request table.
 *********************************************************************************************************
 */
 
-#define  DHCP_LOCAL_LINK_PROBE_WAIT_S                    1
-#define  DHCP_LOCAL_LINK_PROBE_NUM                       3
-#define  DHCP_LOCAL_LINK_PROBE_MIN_S                     1
-#define  DHCP_LOCAL_LINK_PROBE_MAX_S                     2
-#define  DHCP_LOCAL_LINK_ANNOUNCE_WAIT_S                 2
-#define  DHCP_LOCAL_LINK_ANNOUNCE_NUM                    2
-#define  DHCP_LOCAL_LINK_ANNOUNCE_INTERVAL_S             2
-#define  DHCP_LOCAL_LINK_MAX_CONFLICTS                  10
-#define  DHCP_LOCAL_LINK_RATE_LIMIT_INTERVAL_S          60
-#define  DHCP_LOCAL_LINK_DEFEND_INTERVAL_S              10
+                                                                /* ------- SYS REQ'D PARAM FLAGS (see Note #2) -------- */
+#define  DHCPc_REQ_PARAM_NONE                    DEF_BIT_NONE
+#define  DHCPc_REQ_PARAM_SUBNET_MASK               DEF_BIT_00   /* Subnet mask.                                         */
+#define  DHCPc_REQ_PARAM_ROUTER                    DEF_BIT_01   /* Router(s).                                           */
+#define  DHCPc_REQ_PARAM_DNS                       DEF_BIT_02   /* Domain name server(s).                               */
+#define  DHCPc_REQ_PARAM_TIME_OFFSET               DEF_BIT_03   /* Time offset.                                         */
+#define  DHCPc_REQ_PARAM_CLASSLESS_ROUTE           DEF_BIT_04   /* Classless static routes.                             */
+#define  DHCPc_REQ_PARAM_STATIC_ROUTE              DEF_BIT_05   /* Static routes.                                       */
+#define  DHCPc_REQ_PARAM_NTP                       DEF_BIT_06   /* NTP server(s).                                       */
+#define  DHCPc_REQ_PARAM_DOMAIN_NAME               DEF_BIT_07   /* Domain name.                                         */
+#define  DHCPc_REQ_PARAM_DOMAIN_SEARCH             DEF_BIT_08   /* Domain search list.                                  */
+#define  DHCPc_REQ_PARAM_MTU                       DEF_BIT_09   /* IF MTU.                                              */
+#define  DHCPc_REQ_PARAM_ARP_CACHE_TIMEOUT         DEF_BIT_10   /* ARP cache timeout.                                   */
+#define  DHCPc_REQ_PARAM_IP_TTL                    DEF_BIT_11   /* Dflt IP  TTL.                                        */
+#define  DHCPc_REQ_PARAM_TCP_TTL                   DEF_BIT_12   /* Dflt TCP TTL.                                        */
+
+#define  DHCPc_REQ_PARAM_SYS_TBL_SIZE                      13   /* Size of sys req'd param tbl.                         */
+
+                                                                /* ----- SYS REQ'D PARAM EN'D FLAGS (see Note #4) ----- */
+#define  DHCPc_REQ_PARAM_BASE                   (DHCPc_REQ_PARAM_SUBNET_MASK | \
+                                                 DHCPc_REQ_PARAM_ROUTER      | \
+                                                 DHCPc_REQ_PARAM_DNS         | \
+                                                 DHCPc_REQ_PARAM_TIME_OFFSET)
+#define  DHCPc_REQ_PARAM_BASE_NBR                           4
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+#define  DHCPc_REQ_PARAM_ROUTE                  (DHCPc_REQ_PARAM_CLASSLESS_ROUTE | \
+                                                 DHCPc_REQ_PARAM_STATIC_ROUTE)
+#define  DHCPc_REQ_PARAM_ROUTE_NBR                          2
+#else
+#define  DHCPc_REQ_PARAM_ROUTE                   DHCPc_REQ_PARAM_NONE
+#define  DHCPc_REQ_PARAM_ROUTE_NBR                          0
+#endif
 
-#define  DHCP_LOCAL_LINK_DHCP_LOOKUP_S                 300
-#define  DHCP_LOCAL_LINK_ARP_CONFLICT_POOL_S            10
+#if   ((DHCPc_CFG_SRV_MAX_NBR         > 0) && \
+       (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0))
+#define  DHCPc_REQ_PARAM_SRV                    (DHCPc_REQ_PARAM_NTP           | \
+                                                 DHCPc_REQ_PARAM_DOMAIN_NAME   | \
+                                                 DHCPc_REQ_PARAM_DOMAIN_SEARCH)
+#define  DHCPc_REQ_PARAM_SRV_NBR                            3
+#elif  (DHCPc_CFG_SRV_MAX_NBR         > 0)
+#define  DHCPc_REQ_PARAM_SRV                     DHCPc_REQ_PARAM_NTP
+#define  DHCPc_REQ_PARAM_SRV_NBR                            1
+#else
+#define  DHCPc_REQ_PARAM_SRV                     DHCPc_REQ_PARAM_NONE
+#define  DHCPc_REQ_PARAM_SRV_NBR                            0
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+#define  DHCPc_REQ_PARAM_APPLY                  (DHCPc_REQ_PARAM_MTU               | \
+                                                 DHCPc_REQ_PARAM_ARP_CACHE_TIMEOUT | \
+                                                 DHCPc_REQ_PARAM_IP_TTL            | \
+                                                 DHCPc_REQ_PARAM_TCP_TTL)
+#define  DHCPc_REQ_PARAM_APPLY_NBR                          4
+#else
+#define  DHCPc_REQ_PARAM_APPLY                   DHCPc_REQ_PARAM_NONE
+#define  DHCPc_REQ_PARAM_APPLY_NBR                          0
+#endif
 
+#define  DHCPc_REQ_PARAM_ALL                    (DHCPc_REQ_PARAM_BASE  | \
+                                                 DHCPc_REQ_PARAM_ROUTE | \
+                                                 DHCPc_REQ_PARAM_SRV   | \
+                                                 DHCPc_REQ_PARAM_APPLY)
+                                                                /* Nbr of sys req'd param.                              */
+#define  DHCPc_REQ_PARAM_SYS_NBR                (DHCPc_REQ_PARAM_BASE_NBR  + \
+                                                 DHCPc_REQ_PARAM_ROUTE_NBR + \
+                                                 DHCPc_REQ_PARAM_SRV_NBR   + \
+                                                 DHCPc_REQ_PARAM_APPLY_NBR)
 
-/*
-*********************************************************************************************************
-*                                             DATA TYPES
-*********************************************************************************************************
-*/
+                                                                /* Size of IF param req tbl          (see Note #3).     */
+#define  DHCPc_PARAM_REQ_TBL_SIZE          (DHCPc_CFG_PARAM_REQ_TBL_SIZE + DHCPc_REQ_PARAM_SYS_NBR)
 
 
 /*
 *********************************************************************************************************
-*                                     DHCPc ERROR CODES DATA TYPE
+*                                    DHCPc PARAMETER APPLY DEFINES
+*
+* Note(s) : (1) The lease parameters enabled in the interface configuration are applied to the IP stack as
+*               soon as the lease is bound or renewed, & reverted when the lease is lost or when the client
+*               is stopped :
+*
+*               (a) The 'Interface MTU' option is applied with 'NetIF_MTU_Set()'; the MTU configured before
+*                   the first lease applying it on the interface is saved, & restored once NO client of the
+*                   interface has a lease MTU applied (see Note #2).  An MTU smaller than 68 octets is
+*                   ignored (see RFC #2132, section 'Interface MTU Option').
+*
+*               (b) The 'ARP Cache Timeout' option is applied with 'NetARP_CfgCacheTimeout()', limited to
+*                   the range accepted by the ARP layer.  The ARP layer does NOT return its timeout : the
+*                   timeout configured by the application, DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC, is saved once in
+*                   DHCPc_Init() & restored once NO client has a lease timeout applied (see Note #2).
+*
+*               (c) uC/TCP-IP does NOT allow to change its default IP & TCP TTLs at run-time.  The 'Default
+*                   IP Time-to-live' & 'TCP Default TTL' options are hence applied through the TTL function
+*                   configured with 'DHCPc_TTL_FnctSet()', if any (see 'DHCPc TTL FUNCTION DATA TYPE').
+*
+*           (2) #### The ARP cache timeout is common to ALL interfaces : the last lease applying it sets
+*               the timeout of every interface.  'DHCPc_ARP_CacheTimeoutCnt' counts the clients with a lease
+*               timeout applied & is accessed with the global DHCPc lock acquired.
+*
+*               Likewise, the logical clients of an interface share its MTU : the last lease applying it sets
+*               the MTU of the interface.  'DHCPc_MTU_CntTbl' counts, per interface, the clients with a lease
+*               MTU applied & 'DHCPc_MTU_PrevTbl' holds the MTU to restore, both accessed with the global
+*               DHCPc lock acquired.
 *********************************************************************************************************
 */
 
+#define  DHCPc_PARAM_APPLY_NONE                  DEF_BIT_NONE
+#define  DHCPc_PARAM_APPLY_MTU                     DEF_BIT_00   /* IF MTU            (see Note #1a).                    */
+#define  DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT       DEF_BIT_01   /* ARP cache timeout (see Note #1b).                    */
+#define  DHCPc_PARAM_APPLY_IP_TTL                  DEF_BIT_02   /* Dflt IP  TTL      (see Note #1c).                    */
+#define  DHCPc_PARAM_APPLY_TCP_TTL                 DEF_BIT_03   /* Dflt TCP TTL      (see Note #1c).                    */
+#define  DHCPc_PARAM_APPLY_ALL                  (DHCPc_PARAM_APPLY_MTU               | \
+                                                 DHCPc_PARAM_APPLY_ARP_CACHE_TIMEOUT | \
+                                                 DHCPc_PARAM_APPLY_IP_TTL            | \
+                                                 DHCPc_PARAM_APPLY_TCP_TTL)
+
+#define  DHCPc_PARAM_APPLY_MTU_MIN                        68    /* Min MTU (in octets, see Note #1a).                   */
+
 
 /*
 *********************************************************************************************************
-*                  DHCPc TIMER, INTERFACE INFORMATION, & MESSAGE QUANTITY DATA TYPES
+*                                DHCPc TRANSMIT OPTION TEMPLATE DEFINES
+*
+* Note(s) : (1) The options that do NOT depend on the client state are built once, when the interface is
+*               started, in the transmit option template of the interface (see 'dhcp-c.c
+*               DHCPc_TxOptTmplBuild()').  The template is divided in consecutive parts, so that a message
+*               copies the template up to the end of its last part :
+*
+*               (a) Options of every message              : client identifier & host name.
+*               (b) Options of messages requesting params : maximum DHCP message size, vendor class
+*                                                           identifier, vendor-specific information &
+*                                                           parameter request list.
+*               (c) Options of DISCOVER & REQUEST messages : FORCERENEW nonce capable.
+*
+*           (2) The template size includes the code & length octets of each option.
+*
+*           (3) The largest transmitted message holds the fixed message header, the magic cookie, the
+*               state dependent options (message type, requested IP address & server identifier), the
+*               whole template & the END option.  Its length is checked against DHCPc_CFG_MSG_BUF_SIZE
+*               at compile time, so that every message of a started interface fits in a message buffer
+*               whatever the configured client identifier, host name, vendor options & parameter
+*               request list.
 *********************************************************************************************************
 */
 
-typedef  CPU_INT16U  DHCPc_IF_INFO_QTY;                         /* Defines max qty of       IF info to support.         */
-#define  DHCPc_IF_INFO_NBR_MIN                            1
-#define  DHCPc_IF_INFO_NBR_MAX          DEF_INT_16U_MAX_VAL
+                                                                /* --------- TX OPT TMPL PARTS (see Note #1) ---------- */
+#define  DHCPc_TX_OPT_TMPL_PART_ALL                         0   /* Opt of every msg          (see Note #1a).            */
+#define  DHCPc_TX_OPT_TMPL_PART_PARAM                       1   /* Opt of param req msgs     (see Note #1b).            */
+#define  DHCPc_TX_OPT_TMPL_PART_NEGO                        2   /* Opt of DISCOVER & REQUEST (see Note #1c).            */
+#define  DHCPc_TX_OPT_TMPL_NBR_PART                         3   /* Nbr of tx opt tmpl parts.                            */
 
-typedef  CPU_INT16U  DHCPc_MSG_QTY;                             /* Defines max qty of       msg     to support.         */
-#define  DHCPc_MSG_NBR_MIN                                1
-#define  DHCPc_MSG_NBR_MAX              DEF_INT_16U_MAX_VAL
+#if (CPU_CFG_NAME_EN == DEF_ENABLED)
+#define  DHCPc_TX_OPT_TMPL_HOST_NAME_SIZE  (2 + CPU_CFG_NAME_SIZE)
+#else
+#define  DHCPc_TX_OPT_TMPL_HOST_NAME_SIZE                   0
+#endif
 
-typedef  CPU_INT16U  DHCPc_COMM_QTY;                            /* Defines max qty of DHCPc comm    to support.         */
-#define  DHCPc_COMM_NBR_MIN                               1
-#define  DHCPc_COMM_NBR_MAX             DEF_INT_16U_MAX_VAL
+#if (DHCPc_CFG_VENDOR_CLASS_MAX_LEN > 0)
+#define  DHCPc_TX_OPT_TMPL_VENDOR_CLASS_SIZE  (2 + DHCPc_CFG_VENDOR_CLASS_MAX_LEN)
+#else
+#define  DHCPc_TX_OPT_TMPL_VENDOR_CLASS_SIZE                0
+#endif
 
-typedef  CPU_INT16U  DHCPc_TMR_QTY;                             /* Defines max qty of DHCPc tmrs    to support.         */
-#define  DHCPc_TMR_NBR_MIN                                1
-#define  DHCPc_TMR_NBR_MAX              DEF_INT_16U_MAX_VAL
+#if (DHCPc_CFG_VENDOR_INFO_MAX_LEN > 0)
+#define  DHCPc_TX_OPT_TMPL_VENDOR_INFO_SIZE   (2 + DHCPc_CFG_VENDOR_INFO_MAX_LEN)
+#else
+#define  DHCPc_TX_OPT_TMPL_VENDOR_INFO_SIZE                 0
+#endif
+
+                                                                /* Size of IF tx opt tmpl            (see Note #2).     */
+#define  DHCPc_TX_OPT_TMPL_SIZE           ((2 + DHCPc_CFG_CLIENT_ID_MAX_LEN)   + \
+                                           DHCPc_TX_OPT_TMPL_HOST_NAME_SIZE    + \
+                                           (2 + 2)                             + \
+                                           DHCPc_TX_OPT_TMPL_VENDOR_CLASS_SIZE + \
+                                           DHCPc_TX_OPT_TMPL_VENDOR_INFO_SIZE  + \
+                                           (2 + DHCPc_PARAM_REQ_TBL_SIZE)      + \
+                                           (2 + 1))
+
+                                                                /* Max len of tx'd msg               (see Note #3).     */
+#define  DHCPc_TX_MSG_LEN_MAX             ( DHCP_MSG_HDR_LEN                   + \
+                                            DHCP_MAGIC_COOKIE_SIZE             + \
+                                           (2 + 1)                             + \
+                                           (2 + 4)                             + \
+                                           (2 + 4)                             + \
+                                            DHCPc_TX_OPT_TMPL_SIZE             + \
+                                            1)
 
 
 /*
 *********************************************************************************************************
-*                                        DHCPc TIMER DATA TYPE
+*                                     DHCPc RANDOM NUMBER DEFINES
 *********************************************************************************************************
 */
 
-typedef  CPU_INT32U  DHCPc_TMR_TICK;
+#define  DHCPc_RAND_SEED_INIT                      0x2545F491u  /* Pseudo-rand nbr generator init state.                */
+#define  DHCPc_RAND_FNV_PRIME                        16777619u  /* FNV-1a 32-bit prime.                                 */
 
 
 /*
 *********************************************************************************************************
-*                                     DHCP MESSAGE TYPE DATA TYPE
-*
-* Note(s) : (1) See section 'DHCP MESSAGE TYPE DEFINES' for possible values.
+*                                  DHCPc TIME DELAY & RETRY DEFINES
 *********************************************************************************************************
 */
 
-typedef  CPU_INT08U  DHCPc_MSG_TYPE;
+#define  DHCPc_BACKOFF_DLY_INITIAL_MS                    2000   /* Initial dly                  (in ms).                */
+#define  DHCPc_BACKOFF_DLY_MAX_MS                       64000   /* Max exponential back-off dly (in ms).                */
+#define  DHCPc_BACKOFF_DLY_SCALAR                           2   /* Exponential back-off dly scalar.                     */
+#define  DHCPc_BACKOFF_DLY_RAND_MS                       1000   /* Max random back-off dly offset (in ms).              */
+
+#define  DHCPc_TX_MAX_RETRY                                 3   /* Max nbr of  tx  retry   when transitory err.         */
+#define  DHCPc_RX_MAX_RETRY                                 3   /* Max nbr of  rx  retry   when transitory err.         */
+#define  DHCPc_TX_TIME_DLY_MS                             500   /* Dly between tx  retries when transitory err, in ms.  */
+#define  DHCPc_RX_TIME_DLY_MS                             500   /* Dly between rx  retries when transitory err, in ms.  */
+
+#define  DHCPc_TRANSACTION_ID_WIN_LEN                       3   /* Max nbr of prev xids accepted for an OFFER.          */
+
+#define  DHCP_ADDR_VALIDATE_WAIT_TIME_MS                 3000   /* ARP reply wait time for addr validation.             */
 
 
 /*
 *********************************************************************************************************
-*                                DHCP COMMUNICATION MESSAGE DATA TYPE
+*                                       DHCPc EMULATION DEFINES
 *
-* Note(s) : (1) See section 'DHCP COMMUNICATION MESSAGE DEFINES' for possible values.
+* Note(s) : (1) The client emulation runs many virtual clients from a single event loop to load test a DHCP
+*               server (see 'DHCPc_EmulRun()').  Each virtual client uses a synthetic, locally administered
+*               hardware address & a client identifier built from it (see RFC #2132, section
+*               'Client-identifier').
+*
+*           (2) The transaction ID of a virtual client holds the index of the client in the emulation table
+*               in its lower 16 bits, so that replies are dispatched without searching the table.
+*
+*           (3) Latency histogram bucket #0 counts the transactions completed in less than 1 ms; bucket #n
+*               counts those completed in [2^(n - 1), 2^n) ms.  The last bucket also counts all longer
+*               transactions.
 *********************************************************************************************************
 */
 
-typedef  CPU_INT08U  DHCPc_COMM_MSG;
+#define  DHCPc_EMUL_RX_TIMEOUT_MS                           1   /* Event loop rx timeout               (in ms).         */
+#define  DHCPc_EMUL_TMR_PERIOD_MS                          10   /* Retransmission timeout chk period   (in ms).         */
 
+#define  DHCPc_EMUL_ADDR_HW_LOCAL                        0x02   /* Locally administered unicast hw addr (see Note #1).  */
+#define  DHCPc_EMUL_CLIENT_ID_LEN    (1 + NET_IF_ETHER_ADDR_SIZE)   /* Client id : hw type + hw addr (see Note #1).     */
 
-/*
-*********************************************************************************************************
+#define  DHCPc_EMUL_XID_IX_MASK                    0x0000FFFFu  /* Client ix in xid                 (see Note #2).      */
+#define  DHCPc_EMUL_XID_SEQ_SHIFT                          16
+
+#define  DHCPc_EMUL_LATENCY_HIST_NBR                       16   /* Nbr of latency histogram buckets (see Note #3).      */
+
+
+/*
+*********************************************************************************************************
+*                                           DHCPv6 DEFINES
+*
+* Note(s) : (1) See RFC #8415, section 'Message Formats'.  A DHCPv6 message starts with a 1-octet message
+*               type & a 3-octet transaction ID, followed by options made of a 2-octet code, a 2-octet
+*               length & the option value, all in network order.
+*
+*           (2) The client DUID is either taken from a client identifier of type DHCP_CLIENT_ID_TYPE_DUID
+*               (see 'DHCP CLIENT IDENTIFIER DEFINES  Note #3'), along with its IAID, or built as a DUID-LL
+*               from the interface's hardware address (see RFC #8415, section 'Link-Layer Address
+*               (DUID-LL)').  A server DUID is at most 128 octets long plus its 2-octet DUID type (see
+*               RFC #8415, section 'DHCP Unique Identifier (DUID)').
+*
+*           (3) A DHCPv6 client requests one or both of the following identity associations :
+*
+*               (a) DHCPc_IPv6_IA_NA    One non-temporary address, configured on the interface.
+*               (b) DHCPc_IPv6_IA_PD    One delegated prefix, pushed to the prefix function (see 'DHCPc
+*                                           DHCPv6 PREFIX FUNCTION DATA TYPE').
+*
+*           (4) An address obtained through IA_NA carries NO on-link information & is hence configured with
+*               a 128-bit prefix length; the on-link prefixes are learned from Router Advertisements (see
+*               RFC #8415, section 'Identity Association for Non-temporary Addresses Option').
+*********************************************************************************************************
+*/
+
+#define  DHCPc_IPv6_PORT_CLIENT                           546   /* Client UDP port.                                     */
+#define  DHCPc_IPv6_PORT_SERVER                           547   /* Server UDP port.                                     */
+
+#define  DHCPc_IPv6_MSG_HDR_LEN                             4   /* Msg type + xid (see Note #1).                        */
+#define  DHCPc_IPv6_MSG_XID_MASK                   0x00FFFFFFu  /* 24-bit xid.                                          */
+
+                                                                /* ----------------- DHCPv6 MSG TYPES ----------------- */
+#define  DHCPc_IPv6_MSG_SOLICIT                             1
+#define  DHCPc_IPv6_MSG_ADVERTISE                           2
+#define  DHCPc_IPv6_MSG_REQUEST                             3
+#define  DHCPc_IPv6_MSG_RENEW                               5
+#define  DHCPc_IPv6_MSG_REBIND                              6
+#define  DHCPc_IPv6_MSG_REPLY                               7
+#define  DHCPc_IPv6_MSG_RELEASE                             8
+#define  DHCPc_IPv6_MSG_DECLINE                             9
+
+                                                                /* ------------------ DHCPv6 OPTIONS ------------------ */
+#define  DHCPc_IPv6_OPT_HDR_LEN                             4   /* Opt code + len (see Note #1).                        */
+#define  DHCPc_IPv6_OPT_CLIENTID                            1
+#define  DHCPc_IPv6_OPT_SERVERID                            2
+#define  DHCPc_IPv6_OPT_IA_NA                               3
+#define  DHCPc_IPv6_OPT_IAADDR                              5
+#define  DHCPc_IPv6_OPT_ORO                                 6
+#define  DHCPc_IPv6_OPT_ELAPSED_TIME                        8
+#define  DHCPc_IPv6_OPT_STATUS_CODE                        13
+#define  DHCPc_IPv6_OPT_IA_PD                              25
+#define  DHCPc_IPv6_OPT_IAPREFIX                           26
+#define  DHCPc_IPv6_OPT_SOL_MAX_RT                         82
+
+#define  DHCPc_IPv6_OPT_IA_LEN                             12   /* IA_NA/IA_PD fixed len : IAID, T1 & T2.               */
+#define  DHCPc_IPv6_OPT_IAADDR_LEN                         24   /* IAADDR   fixed len : addr & lifetimes.               */
+#define  DHCPc_IPv6_OPT_IAPREFIX_LEN                       25   /* IAPREFIX fixed len : lifetimes, len & prefix.        */
+#define  DHCPc_IPv6_OPT_ELAPSED_TIME_LEN                    2
+#define  DHCPc_IPv6_OPT_STATUS_CODE_LEN                     2   /* Status code len, without status msg.                 */
+#define  DHCPc_IPv6_ELAPSED_TIME_MAX                   0xFFFF   /* Max elapsed time (in 1/100 sec).                     */
+
+                                                                /* ---------------- DHCPv6 STATUS CODES --------------- */
+#define  DHCPc_IPv6_STATUS_SUCCESS                          0
+#define  DHCPc_IPv6_STATUS_NO_ADDRS_AVAIL                   2
+#define  DHCPc_IPv6_STATUS_NO_BINDING                       3
+#define  DHCPc_IPv6_STATUS_NO_PREFIX_AVAIL                  6
+
+                                                                /* -------------------- DHCPv6 DUID ------------------- */
+#define  DHCPc_IPv6_DUID_TYPE_LL                            3   /* DUID-LL type (see Note #2).                          */
+#define  DHCPc_IPv6_DUID_LL_HDR_LEN                         4   /* DUID-LL hdr : DUID type & hw type.                   */
+                                                                /* Max client DUID len (see Note #2).                   */
+#define  DHCPc_IPv6_DUID_LEN_MAX   (DHCP_CLIENT_ID_LEN_MAX - DHCP_CLIENT_ID_DUID_OFFSET)
+#define  DHCPc_IPv6_SRV_ID_LEN_MAX                        130   /* Max srv   DUID len (see Note #2).                    */
+
+#define  DHCPc_IPv6_LIFETIME_INFINITE              0xFFFFFFFFu  /* Infinite lifetime.                                   */
+#define  DHCPc_IPv6_ADDR_PREFIX_LEN                       128   /* IA_NA addr prefix len (see Note #4).                 */
+
+                                                                /* ----------- DHCPv6 IA TYPES (see Note #3) ---------- */
+#define  DHCPc_IPv6_IA_NONE                      DEF_BIT_NONE
+#define  DHCPc_IPv6_IA_NA                          DEF_BIT_00   /* Non-temporary addr.                                  */
+#define  DHCPc_IPv6_IA_PD                          DEF_BIT_01   /* Delegated prefix.                                    */
+#define  DHCPc_IPv6_IA_ALL                      (DHCPc_IPv6_IA_NA | \
+                                                 DHCPc_IPv6_IA_PD)
+
+
+/*
+*********************************************************************************************************
+*                                         LINK-LOCAL ADDRESSES DEFINES
+*********************************************************************************************************
+*/
+
+#define  DHCP_LOCAL_LINK_PROBE_WAIT_S                    1
+#define  DHCP_LOCAL_LINK_PROBE_NUM                       3
+#define  DHCP_LOCAL_LINK_PROBE_MIN_S                     1
+#define  DHCP_LOCAL_LINK_PROBE_MAX_S                     2
+#define  DHCP_LOCAL_LINK_ANNOUNCE_WAIT_S                 2
+#define  DHCP_LOCAL_LINK_ANNOUNCE_NUM                    2
+#define  DHCP_LOCAL_LINK_ANNOUNCE_INTERVAL_S             2
+#define  DHCP_LOCAL_LINK_MAX_CONFLICTS                  10
+#define  DHCP_LOCAL_LINK_RATE_LIMIT_INTERVAL_S          60
+#define  DHCP_LOCAL_LINK_DEFEND_INTERVAL_S              10
+
+#define  DHCP_LOCAL_LINK_DHCP_LOOKUP_S                 300
+#define  DHCP_LOCAL_LINK_ARP_CONFLICT_POOL_S            10
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                     DHCPc ERROR CODES DATA TYPE
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                  DHCPc TIMER, INTERFACE INFORMATION, & MESSAGE QUANTITY DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT16U  DHCPc_IF_INFO_QTY;                         /* Defines max qty of       IF info to support.         */
+#define  DHCPc_IF_INFO_NBR_MIN                            1
+#define  DHCPc_IF_INFO_NBR_MAX          DEF_INT_16U_MAX_VAL
+
+typedef  CPU_INT16U  DHCPc_MSG_QTY;                             /* Defines max qty of       msg     to support.         */
+#define  DHCPc_MSG_NBR_MIN                                1
+#define  DHCPc_MSG_NBR_MAX              DEF_INT_16U_MAX_VAL
+
+typedef  CPU_INT16U  DHCPc_COMM_QTY;                            /* Defines max qty of DHCPc comm    to support.         */
+#define  DHCPc_COMM_NBR_MIN                               1
+#define  DHCPc_COMM_NBR_MAX             DEF_INT_16U_MAX_VAL
+
+typedef  CPU_INT16U  DHCPc_TMR_QTY;                             /* Defines max qty of DHCPc tmrs    to support.         */
+#define  DHCPc_TMR_NBR_MIN                                1
+#define  DHCPc_TMR_NBR_MAX              DEF_INT_16U_MAX_VAL
+
+
+
+/*
+*********************************************************************************************************
+*                                     DHCP MESSAGE TYPE DATA TYPE
+*
+* Note(s) : (1) See section 'DHCP MESSAGE TYPE DEFINES' for possible values.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  DHCPc_MSG_TYPE;
+
+
+/*
+*********************************************************************************************************
+*                                DHCP COMMUNICATION MESSAGE DATA TYPE
+*
+* Note(s) : (1) See section 'DHCP COMMUNICATION MESSAGE DEFINES' for possible values.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  DHCPc_COMM_MSG;
+
+
+/*
+*********************************************************************************************************
 *                                     DHCP CLIENT STATE DATA TYPE
 *
 * Note(s) : (1) See section 'DHCP CLIENT STATE DEFINES' for possible values.
@@ -784,6 +1598,419 @@ typedef  CPU_INT08U  DHCPc_STATUS;
 typedef  CPU_INT08U  DHCPc_OPT_CODE;
 
 
+/*
+*********************************************************************************************************
+*                               DHCPc INTERFACE CONFIGURATION DATA TYPE
+*
+* Note(s) : (1) The interface configuration structure holds the negotiation parameters that MAY differ
+*               from one interface to another.  Its default values are the compile-time values set in
+*               'dhcp-c_cfg.h' & 'dhcp-c.h' (see 'DHCPc_CfgIF_DfltGet()').
+*
+*           (2) 'AddrValidateEn' & 'LocalLinkEn' can only disable, at run-time, a feature enabled at
+*               compile-time with DHCPc_CFG_ADDR_VALIDATE_EN & DHCPc_CFG_DYN_LOCAL_LINK_ADDR_EN.
+*
+*           (3) 'ReqParamSys' holds the system requested parameters the DHCP client requests on the
+*               interface (see 'DHCPc PARAMETER REQUEST LIST DEFINES').  The parameters NOT needed by the
+*               application MAY be removed from the list by clearing their flag.
+*
+*           (4) 'ClientID' holds the client identifier of the logical client to start on the interface
+*               (see 'DHCP CLIENT IDENTIFIER DEFINES  Note #1').  A 'ClientID_Len' of 0 starts the
+*               interface's default client, which sends NO client identifier.  A client identifier built
+*               from a DUID & an IAID MAY be set with 'DHCPc_CfgIF_ClientID_DUID_Set()'.
+*
+*           (5) 'VendorClass' & 'VendorInfo' hold the vendor class identifier & the vendor-specific
+*               information sent on the interface (see 'DHCP VENDOR OPTION DEFINES  Note #1').  A length of
+*               0 sends NO option.  The options MAY be set with 'DHCPc_CfgIF_VendorClassSet()' &
+*               'DHCPc_CfgIF_VendorInfoSet()'.
+*
+*           (6) 'ParamApply' holds the lease parameters applied to the IP stack on the interface (see
+*               'DHCPc PARAMETER APPLY DEFINES').  A parameter is ONLY received if its system requested
+*               parameter flag is also set in 'ReqParamSys'.
+*
+*           (7) 'HW_Type' holds the hardware type transmitted in the 'htype' field, as defined by IANA for
+*               ARP hardware types, or DHCPc_HW_TYPE_NONE for an Ethernet interface (see 'DHCPc HARDWARE
+*               ADDRESS DEFINES  Note #1b').  'AddrValidateEn' & 'LocalLinkEn' are ignored on an interface
+*               whose hardware type is NOT Ethernet (see 'DHCPc HARDWARE ADDRESS DEFINES  Note #2c').
+*
+*               #### DHCPc_Inform() uses the default configuration & hence ONLY runs on Ethernet interfaces.
+*********************************************************************************************************
+*/
+
+typedef  struct  dhcpc_cfg_if {
+    CPU_INT08U   NegoRetryCnt;                                  /* Nbr of lease nego retries.                           */
+    CPU_INT08U   DiscoverRetryCnt;                              /* Nbr of DISCOVER   retries.                           */
+    CPU_INT08U   ReqRetryCnt;                                   /* Nbr of REQUEST    retries.                           */
+
+    CPU_INT32U   BackOffDlyInitial_ms;                          /* Initial                  back-off dly (in ms).       */
+    CPU_INT32U   BackOffDlyMax_ms;                              /* Max     exponential      back-off dly (in ms).       */
+
+    CPU_INT32U   RxTimeout_ms;                                  /* Max inactivity time on rx             (in ms).       */
+    CPU_INT32U   AddrValidateWait_ms;                           /* ARP reply wait time for addr validation (in ms).     */
+
+    CPU_BOOLEAN  AddrValidateEn;                                /* Addr validation         en (see Note #2).            */
+    CPU_BOOLEAN  LocalLinkEn;                                   /* Dyn link-local addr cfg en (see Note #2).            */
+
+    CPU_INT16U   ReqParamSys;                                   /* Sys req'd param flags (see Note #3).                 */
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+    CPU_INT08U   ParamApply;                                    /* Applied lease param flags (see Note #6).             */
+#endif
+
+#if (DHCPc_CFG_HW_TYPE_GENERIC_EN == DEF_ENABLED)
+    CPU_INT08U   HW_Type;                                       /* Hw type (see Note #7).                               */
+#endif
+
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)                           /* Client id (see Note #4) :                            */
+    CPU_INT08U   ClientID[DHCPc_CFG_CLIENT_ID_MAX_LEN];         /*   Client id val.                                     */
+    CPU_INT08U   ClientID_Len;                                  /*   Client id len (in octets).                         */
+#endif
+
+#if (DHCPc_CFG_VENDOR_CLASS_MAX_LEN > 0)                        /* Vendor class id (see Note #5) :                      */
+    CPU_INT08U   VendorClass[DHCPc_CFG_VENDOR_CLASS_MAX_LEN];   /*   Vendor class id val.                               */
+    CPU_INT08U   VendorClass_Len;                               /*   Vendor class id len (in octets).                   */
+#endif
+
+#if (DHCPc_CFG_VENDOR_INFO_MAX_LEN > 0)                         /* Vendor-specific info (see Note #5) :                 */
+    CPU_INT08U   VendorInfo[DHCPc_CFG_VENDOR_INFO_MAX_LEN];     /*   Vendor info val.                                   */
+    CPU_INT08U   VendorInfo_Len;                                /*   Vendor info len (in octets).                       */
+#endif
+} DHCPc_CFG_IF;
+
+
+/*
+*********************************************************************************************************
+*                                     DHCPc REQUEST DATA TYPE
+*
+* Note(s) : (1) A request handle tracks the completion of an asynchronous start or stop request (see
+*               'DHCPc_StartAsync()' & 'DHCPc_StopAsync()').  The handle is owned by the application &
+*               MUST remain valid until the request completes.
+*
+*           (2) Once the request completes, 'Status' & 'Err' hold the interface's DHCP status & the
+*               request's return error code.  The request's completion can either be awaited with
+*               'DHCPc_ReqWait()' or notified through the optional callback function.
+*
+*           (3) The callback function is called by the DHCPc task, with the DHCPc lock released, once the
+*               request is completed; it MAY call any DHCPc API function (but 'DHCPc_ReqWait()') & MAY
+*               re-use its request handle.
+*********************************************************************************************************
+*/
+
+typedef  void  (*DHCPc_REQ_CALLBACK_FNCT)(NET_IF_NBR     if_nbr,
+                                          DHCPc_STATUS   status,
+                                          DHCPc_ERR      err,
+                                          void          *p_arg);
+
+
+typedef  struct  dhcpc_req {
+    NET_IF_NBR                IF_Nbr;                           /* IF nbr for this req.                                 */
+
+    CPU_BOOLEAN               Pend;                             /* Indicates if req is pending.                         */
+
+    DHCPc_STATUS              Status;                           /* IF DHCP status on completion    (see Note #2).       */
+    DHCPc_ERR                 Err;                              /* Req     err    on completion    (see Note #2).       */
+
+    DHCPc_REQ_CALLBACK_FNCT   CallbackFnct;                     /* Completion callback fnct        (see Note #3).       */
+    void                     *CallbackArg;                      /* Completion callback fnct arg.                        */
+} DHCPc_REQ;
+
+
+/*
+*********************************************************************************************************
+*                                 DHCPc RANDOM NUMBER FUNCTION DATA TYPE
+*
+* Note(s) : (1) A random number function MAY be configured to provide the DHCP client with random numbers
+*               from an entropy source (e.g. a hardware random number generator; see 'DHCPc_RandFnctSet()').
+*               The random numbers are used for the transaction IDs, the back-off delay randomization &
+*               the link-local address candidates.
+*
+*           (2) The random number function returns a 32-bit random number in 'prand' & DEF_OK, or DEF_FAIL
+*               if NO random number is available; the DHCP client then falls back on its internal pseudo-
+*               random number generator, seeded from each interface's hardware address & the OS tick.
+*
+*           (3) The random number function MAY be called by any DHCPc task, with or without the DHCPc lock
+*               acquired, & MUST NOT call any DHCPc API function nor block.
+*********************************************************************************************************
+*/
+
+typedef  CPU_BOOLEAN  (*DHCPc_RAND_FNCT)(CPU_INT32U  *prand);
+
+
+/*
+*********************************************************************************************************
+*                                       DHCPc ROUTE DATA TYPE
+*
+* Note(s) : (1) The routes of a client are taken from the last accepted lease :
+*
+*               (a) From the 'Classless Static Route' option, if present.  The 'Router' & 'Static Route'
+*                   options are then ignored, as required by RFC #3442, section 'DHCP Client Behavior'.
+*
+*               (b) Otherwise, from the 'Static Route' option & from the 'Router' option, each router being
+*                   a default route, in the server's order of preference.
+*
+*               A route whose next-hop is 0.0.0.0 designates a destination directly reachable on the
+*               interface's link.  All addresses are in host order.
+*
+*           (2) (a) uC/TCP-IP only holds a default gateway per interface address.  The routes are hence
+*                   installed into & removed from the IP stack by the route function configured with
+*                   'DHCPc_RouteFnctSet()', if any, with 'add' set to DEF_YES when the route is installed &
+*                   to DEF_NO when the route is removed.
+*
+*               (b) The routes are installed once the address is configured & removed when the lease is
+*                   lost or when the client is stopped.
+*
+*               (c) The route function is called by the DHCPc task, without the DHCPc lock, & MUST
+*                   NOT call any DHCPc API function nor block.
+*
+*           (3) The next-hop to a destination MAY also be looked up with 'DHCPc_RouteNextHopGet()'.
+*********************************************************************************************************
+*/
+
+typedef  struct  dhcpc_route {
+    NET_IPv4_ADDR   AddrDest;                                   /* Dest addr.                                           */
+    NET_IPv4_ADDR   AddrMask;                                   /* Dest mask.                                           */
+    NET_IPv4_ADDR   AddrNextHop;                                /* Next-hop addr (see Note #1).                         */
+} DHCPc_ROUTE;
+
+
+typedef  void  (*DHCPc_ROUTE_FNCT)(NET_IF_NBR      if_nbr,
+                                   DHCPc_ROUTE    *proute,
+                                   CPU_BOOLEAN     add);
+
+
+/*
+*********************************************************************************************************
+*                                   DHCPc SERVER FUNCTION DATA TYPE
+*
+* Note(s) : (1) The domain name servers, the NTP servers & the domain name of a client are taken from the
+*               'Domain Name Server', 'Network Time Protocol Servers' & 'Domain Name' options of the last
+*               accepted lease.  When NO 'Domain Name' option is received, the domain name is the first
+*               domain of the 'Domain Search' option (see 'DHCP DOMAIN NAME DEFINES').  All addresses are
+*               in host order & the domain name is NULL-terminated.
+*
+*           (2) (a) The servers & the domain name are pushed to the DNS & NTP functions configured with
+*                   'DHCPc_SrvFnctSet()', e.g. to configure the uC/DNSc & SNTP clients, so that NO polling
+*                   of the lease options is required from the application.
+*
+*               (b) The functions are called as soon as a lease is bound, renewed or informed with servers
+*                   or a domain name different from the ones previously pushed, & with NO server when the
+*                   lease is lost or when the client is stopped.
+*
+*               (c) The functions are called by the DHCPc task, without the DHCPc lock, & MUST NOT
+*                   call any DHCPc API function nor block.  The server tables & the domain name are ONLY
+*                   valid during the call.
+*
+*           (3) #### The servers in excess of DHCPc_CFG_SRV_MAX_NBR are discarded, as is a domain name
+*               longer than DHCPc_CFG_DOMAIN_NAME_MAX_LEN.
+*********************************************************************************************************
+*/
+
+typedef  void  (*DHCPc_DNS_FNCT)(NET_IF_NBR      if_nbr,
+                                 NET_IPv4_ADDR  *paddr_srv_tbl,
+                                 CPU_INT08U      addr_srv_nbr,
+                                 CPU_CHAR       *pdomain_name);
+
+
+typedef  void  (*DHCPc_NTP_FNCT)(NET_IF_NBR      if_nbr,
+                                 NET_IPv4_ADDR  *paddr_srv_tbl,
+                                 CPU_INT08U      addr_srv_nbr);
+
+
+/*
+*********************************************************************************************************
+*                                     DHCPc TTL FUNCTION DATA TYPE
+*
+* Note(s) : (1) The TTL function configured with 'DHCPc_TTL_FnctSet()' receives the default IP TTL &
+*               the TCP default TTL of the lease, each being 0 when NOT received or when reverted, in which
+*               case the IP stack default TTL SHOULD be restored.  It is called whenever either TTL
+*               changes (see 'DHCPc PARAMETER APPLY DEFINES  Note #1c').
+*
+*           (2) The TTL function is called by the DHCPc task, without the DHCPc lock, & MUST NOT call
+*               any DHCPc API function nor block.
+*********************************************************************************************************
+*/
+
+typedef  void  (*DHCPc_TTL_FNCT)(NET_IF_NBR   if_nbr,
+                                 CPU_INT08U   ttl_ip,
+                                 CPU_INT08U   ttl_tcp);
+
+
+/*
+*********************************************************************************************************
+*                                   DHCPc RELAY INFORMATION DATA TYPE
+*
+* Note(s) : (1) The relay information of a client records the relay agent path of the last reply received
+*               by the client, for diagnostics of routed deployments :
+*
+*               (a) 'AddrRelay' holds the 'giaddr' field of the reply, in host order, i.e. the address of
+*                   the relay agent that forwarded the reply, or NET_IPv4_ADDR_NONE if the reply was
+*                   received directly from the server.
+*
+*               (b) 'AgentInfo' holds the value of the 'Relay Agent Information' option of the reply, if
+*                   echoed to the client, truncated to DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN octets.  RFC
+*                   #3046, section 'Relay Agent Operation' requires the relay agent to remove the option
+*                   from the replies it forwards, so the option is ONLY present with some relay agents.
+*
+*               (c) 'RxRelayedCtr' & 'RxDirectCtr' count the replies received through a relay agent &
+*                   directly from a server.
+*
+*           (2) The relay information does NOT change the destination of the messages : RFC #2131, section
+*               'DHCPREQUEST generated during RENEWING state' unicasts the renewal REQUEST messages to the
+*               server that granted the lease, whether its replies are relayed or NOT.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+typedef  struct  dhcpc_relay_info {
+    NET_IPv4_ADDR   AddrRelay;                                  /* Relay agent addr (see Note #1a).                     */
+#if (DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN > 0)                    /* Relay agent info (see Note #1b) :                    */
+    CPU_INT08U      AgentInfo[DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN];
+    CPU_INT08U      AgentInfoLen;                               /*   Relay agent info len (in octets).                  */
+#endif
+    CPU_INT32U      RxRelayedCtr;                               /* Nbr of replies rx'd through a relay (see Note #1c).  */
+    CPU_INT32U      RxDirectCtr;                                /* Nbr of replies rx'd directly from a server.          */
+} DHCPc_RELAY_INFO;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     DHCPc DHCPv6 LEASE DATA TYPE
+*
+* Note(s) : (1) The DHCPv6 lease of a client holds the address & the delegated prefix last obtained by the
+*               client (see 'DHCPc_IPv6_LeaseGet()') :
+*
+*               (a) 'IA' holds the identity associations obtained (see 'DHCPv6 DEFINES  Note #3'); the
+*                   address & the prefix are ONLY valid if their identity association is set.
+*
+*               (b) The lifetimes are in seconds, as received from the server; DHCPc_IPv6_LIFETIME_INFINITE
+*                   stands for an infinite lifetime.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+typedef  struct  dhcpc_ipv6_lease {
+    CPU_INT08U      IA;                                         /* IAs obtained (see Note #1a).                         */
+
+    NET_IPv6_ADDR   Addr;                                       /* Addr.                                                */
+    CPU_INT32U      AddrLifetimePref_sec;                       /* Addr preferred lifetime   (see Note #1b).            */
+    CPU_INT32U      AddrLifetimeValid_sec;                      /* Addr valid     lifetime   (see Note #1b).            */
+
+    NET_IPv6_ADDR   Prefix;                                     /* Delegated prefix.                                    */
+    CPU_INT08U      PrefixLen;                                  /* Delegated prefix len (in bits).                      */
+    CPU_INT32U      PrefixLifetimePref_sec;                     /* Prefix preferred lifetime (see Note #1b).            */
+    CPU_INT32U      PrefixLifetimeValid_sec;                    /* Prefix valid     lifetime (see Note #1b).            */
+} DHCPc_IPv6_LEASE;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                DHCPc DHCPv6 PREFIX FUNCTION DATA TYPE
+*
+* Note(s) : (1) The prefix function configured with 'DHCPc_IPv6_PrefixFnctSet()' receives the prefix
+*               delegated to a DHCPv6 client & its lifetimes (in seconds) whenever the prefix is obtained or
+*               renewed.  A valid lifetime of 0 indicates that the prefix is NO longer delegated to the
+*               client & MUST NOT be used anymore, e.g. on the downstream interfaces of a router.
+*
+*           (2) The prefix function is called by the DHCPc task, without the DHCPc lock, & MUST NOT
+*               call any DHCPc API function nor block.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+typedef  void  (*DHCPc_IPv6_PREFIX_FNCT)(NET_IF_NBR      if_nbr,
+                                         NET_IPv6_ADDR  *pprefix,
+                                         CPU_INT08U      prefix_len,
+                                         CPU_INT32U      lifetime_pref_sec,
+                                         CPU_INT32U      lifetime_valid_sec);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  DHCPc DHCPv6 INFORMATION DATA TYPE
+*
+* Note(s) : (1) 'DUID' & 'IAID' identify the client to the DHCPv6 servers (see 'DHCPv6 DEFINES  Note #2').
+*               'ServerID' holds the DUID of the server that granted the lease.
+*
+*           (2) 'AddrCfgd' & 'PrefixPushed' indicate whether the lease address is configured on the
+*               interface & whether the lease prefix was pushed to the prefix function, so that both are
+*               reverted once the lease is lost.
+*
+*           (3) 'Lease' holds ONLY the lease applied to the interface, i.e. granted by a server in a REPLY
+*               message & configured.  'LeasePend' holds the lease offered in an ADVERTISE message, sent
+*               as hints in the REQUEST messages, or the lease declined in a DECLINE message.  It is ONLY
+*               accessed by the DHCPc task.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+typedef  struct  dhcpc_ipv6_info {
+    CPU_INT08U         IA_Req;                                  /* Requested IAs (see 'DHCPv6 DEFINES  Note #3').       */
+    CPU_INT32U         IAID;                                    /* IAID (see Note #1).                                  */
+
+    CPU_INT08U         DUID[DHCPc_IPv6_DUID_LEN_MAX];           /* Client DUID (see Note #1).                           */
+    CPU_INT08U         DUID_Len;                                /* Client DUID len (in octets).                         */
+    CPU_INT08U         ServerID[DHCPc_IPv6_SRV_ID_LEN_MAX];     /* Srv    DUID (see Note #1).                           */
+    CPU_INT08U         ServerID_Len;                            /* Srv    DUID len (in octets).                         */
+
+    DHCPc_IPv6_LEASE   Lease;                                   /* Cur     lease (see Note #3).                         */
+    DHCPc_IPv6_LEASE   LeasePend;                               /* Pending lease (see Note #3).                         */
+
+    CPU_BOOLEAN        AddrCfgd;                                /* Lease addr   cfg'd  (see Note #2).                   */
+    CPU_BOOLEAN        PrefixPushed;                            /* Lease prefix pushed (see Note #2).                   */
+} DHCPc_IPv6_INFO;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    DHCPc EMULATION DATA TYPES
+*
+* Note(s) : (1) Virtual clients are started at 'ArrivalRate' clients per second, until 'ClientNbr' clients
+*               are started; at most DHCPc_CFG_EMUL_MAX_NBR_CLIENT clients are negotiating at any time.
+*
+*           (2) A message NOT answered within 'Timeout_ms' is retransmitted up to 'RetryCnt' times before
+*               the virtual client fails.
+*
+*           (3) The latency of a transaction is the time from the first DISCOVER to the ACK.  See
+*               'DHCPc EMULATION DEFINES  Note #3' for the histogram buckets.
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)
+typedef  struct  dhcpc_emul_cfg {
+    CPU_INT32U    ClientNbr;                                    /* Nbr of virtual clients to start  (see Note #1).      */
+    CPU_INT32U    ArrivalRate;                                  /* Client arrival rate (per sec,     see Note #1).      */
+    CPU_INT32U    Timeout_ms;                                   /* Retransmission timeout (in ms,    see Note #2).      */
+    CPU_INT08U    RetryCnt;                                     /* Max nbr of retransmissions       (see Note #2).      */
+    CPU_BOOLEAN   ReleaseEn;                                    /* Release lease once acquired.                         */
+} DHCPc_EMUL_CFG;
+
+
+typedef  struct  dhcpc_emul_stats {
+    CPU_INT32U    ClientStartCtr;                               /* Nbr of virtual clients started.                      */
+    CPU_INT32U    ClientBoundCtr;                               /* Nbr of transactions completed with an ACK.           */
+    CPU_INT32U    ClientNakCtr;                                 /* Nbr of transactions ended   with a  NAK.             */
+    CPU_INT32U    ClientFailCtr;                                /* Nbr of transactions failed  after max retries.       */
+
+    CPU_INT32U    TxCtr;                                        /* Nbr of msgs tx'd.                                    */
+    CPU_INT32U    TxRetryCtr;                                   /* Nbr of msgs re-tx'd.                                 */
+    CPU_INT32U    RxCtr;                                        /* Nbr of replies rx'd & accepted.                      */
+    CPU_INT32U    RxDiscardCtr;                                 /* Nbr of msgs    rx'd & discarded.                     */
+
+    CPU_INT32U    Elapsed_ms;                                   /* Emulation duration          (in ms).                 */
+    CPU_INT32U    TransPerSec;                                  /* Completed transactions per sec.                      */
+
+    CPU_INT32U    LatencyMin_ms;                                /* Min transaction latency     (in ms, see Note #3).    */
+    CPU_INT32U    LatencyMax_ms;                                /* Max transaction latency     (in ms).                 */
+    CPU_INT32U    LatencyAvg_ms;                                /* Avg transaction latency     (in ms).                 */
+                                                                /* Latency histogram                   (see Note #3).   */
+    CPU_INT32U    LatencyHist[DHCPc_EMUL_LATENCY_HIST_NBR];
+} DHCPc_EMUL_STATS;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       DHCP MESSAGE DATA TYPE
@@ -824,7 +2051,7 @@ typedef  struct dhcp_msg_hdr {
     CPU_INT32U  yiaddr;                                         /* Client IP addr rtn'd by server.                      */
     CPU_INT32U  siaddr;
     CPU_INT32U  giaddr;
-    CPU_INT08U  chaddr[16];                                     /* Client HW addr.                                      */
+    CPU_INT08U  chaddr[DHCP_CHADDR_LEN];                        /* Client HW addr.                                      */
     CPU_INT08U  sname[64];
     CPU_INT08U  file[128];
                                                                 /* DHCP Opt's (see Note #3).                            */
@@ -872,36 +2099,149 @@ struct dhcpc_msg {
 /*
 *********************************************************************************************************
 *                                DHCPc INTERFACE INFORMATION DATA TYPE
+*
+* Note(s) : (1) 'ParamReqTbl' holds the complete parameter request list sent in the DISCOVER & REQUEST
+*               messages (see 'DHCPc PARAMETER REQUEST LIST DEFINES  Note #1').
+*
+*           (2) While the lease is bound, 'ForceRenewSockID' is opened on the assigned address & the client
+*               port; it is closed as soon as the interface leaves the BOUND state.
+*
+*           (3) Lease times are kept as absolute deadlines on the DHCPc time base (see 'DHCPc_TimeGet_sec()'),
+*               all anchored on the time the lease was requested (see 'DHCPc_LeaseTimeCalc()  Note #2').
+*               They are computed once per lease & are NEVER decremented.
+*
+*           (4) 'AddrCfgd' holds the address configured on the interface by this client, so that only this
+*               address is removed when other logical clients still hold an address on the same interface.
+*
+*           (5) 'IF_NextPtr' links the interface informations of the same interface number, starting from
+*               'DHCPc_InfoIF_Tbl[]' indexed by the interface number, so that the interface information of a
+*               client is found without searching the whole interface information list.
+*
+*           (6) 'TxOptTmpl' holds the options transmitted unchanged in every message of the interface (see
+*               'DHCPc TRANSMIT OPTION TEMPLATE DEFINES  Note #1').  'TxOptTmplLen[]' holds the length of
+*               the template up to the end of each template part, & 'TxOptTmplClientID_Ix' the offset of the
+*               client identifier value in the template.
+*
+*           (7) 'TransactionID' holds the last transaction ID generated for a DISCOVER or INFORM message.
+*               'TransactionID_WinLen' holds the number of transaction IDs preceding the last one that are
+*               still accepted in a reply, so that a late OFFER for a previous DISCOVER retransmission is
+*               used.  'TransactionID_Req' holds the transaction ID of the accepted OFFER, carried by the
+*               following REQUEST, DECLINE & RELEASE messages (see 'dhcp-c.c  DHCPc_Discover()  Note #1').
+*
+*           (8) 'AcqStartTime' holds the time the client began the address acquisition or renewal, from
+*               which the 'secs' field of the transmitted messages is computed (see 'dhcp-c.c
+*               DHCPc_TxMsgPrepare()  Note #13').
+*
+*           (9) 'RouteTbl' holds the 'RouteQty' routes of the last accepted lease, sorted by decreasing
+*               destination prefix length so that the first matching route is the most specific one (see
+*               'DHCPc ROUTE DATA TYPE  Note #1').  The route table is protected by the interface lock.
+*
+*          (10) 'DNS_SrvTbl', 'NTP_SrvTbl' & 'DomainName' hold the servers & the domain name last pushed to
+*               the server functions (see 'DHCPc SERVER FUNCTION DATA TYPE  Note #2b').  They are ONLY
+*               accessed by the DHCPc task.
+*
+*          (11) 'ParamApplied' holds the lease parameters currently applied to the IP stack, with their
+*               applied values (see 'DHCPc PARAMETER APPLY DEFINES').  They are ONLY accessed by the DHCPc
+*               task.
+*
+*          (12) 'Relay' holds the relay agent path of the last reply received by the client (see 'DHCPc RELAY
+*               INFORMATION DATA TYPE').  It is ONLY written by the DHCPc task, with the interface lock
+*               acquired, & read by other tasks with the interface lock acquired.
+*
+*          (13) 'IPv6' holds the identity & the lease of a DHCPv6 client, i.e. of an interface information
+*               with the DHCPc_FLAG_IPv6 flag set (see 'DHCPc DHCPv6 INFORMATION DATA TYPE').  The lease is
+*               protected by the interface lock.  The DHCP specific fields are NOT used by a DHCPv6 client.
+*
+*          (14) 'Gen' is incremented each time the interface information is freed, & is NOT cleared.  It is
+*               copied in every communication object created for the interface information, so that a timer
+*               or FORCERENEW message posted for a previous client of the same interface information is
+*               discarded (see 'DHCPc COMMUNICATION DATA TYPE  Note #1').
 *********************************************************************************************************
 */
 
 struct dhcpc_if_info {
     DHCPc_IF_INFO      *PrevPtr;                                /* Ptr to PREV IF INFO.                                 */
     DHCPc_IF_INFO      *NextPtr;                                /* Ptr to NEXT IF INFO.                                 */
+    DHCPc_IF_INFO      *IF_NextPtr;                             /* Ptr to NEXT IF INFO of same IF (see Note #5).        */
 
     DHCPc_IF_INFO_QTY   ID;                                     /* IF info id.                                          */
+    CPU_INT16U          Gen;                                    /* IF info generation (see Note #14).                   */
     NET_IF_NBR          IF_Nbr;                                 /* IF nbr for this IF info.                             */
 
     NET_IPv4_ADDR       ServerID;                               /* Server responsible for lease (in net order).         */
 
-                                                                /* Param req tbl.                                       */
-    DHCPc_OPT_CODE      ParamReqTbl[DHCPc_CFG_PARAM_REQ_TBL_SIZE];
+                                                                /* Param req tbl (see Note #1).                         */
+    DHCPc_OPT_CODE      ParamReqTbl[DHCPc_PARAM_REQ_TBL_SIZE];
     CPU_INT08U          ParamReqQty;                            /* Param req qty.                                       */
 
+                                                                /* Tx opt tmpl (see Note #6) :                          */
+    CPU_INT08U          TxOptTmpl[DHCPc_TX_OPT_TMPL_SIZE];      /*   Opt.                                               */
+                                                                /*   Len up to end of each part.                        */
+    CPU_INT16U          TxOptTmplLen[DHCPc_TX_OPT_TMPL_NBR_PART];
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)
+    CPU_INT16U          TxOptTmplClientID_Ix;                   /*   Ix of client id val.                               */
+#endif
+
+    DHCPc_CFG_IF        Cfg;                                    /* IF nego cfg.                                         */
+
+    NET_IPv4_ADDR       AddrCfgd;                               /* Addr cfg'd by client (in host order, see Note #4).   */
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)                               /* Routes (see Note #9) :                               */
+    DHCPc_ROUTE         RouteTbl[DHCPc_CFG_ROUTE_MAX_NBR];      /*   Route tbl.                                         */
+    CPU_INT08U          RouteQty;                               /*   Nbr of routes.                                     */
+#endif
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)                                 /* Srvs (see Note #10) :                                */
+    NET_IPv4_ADDR       DNS_SrvTbl[DHCPc_CFG_SRV_MAX_NBR];      /*   DNS srv tbl.                                       */
+    CPU_INT08U          DNS_SrvQty;                             /*   Nbr of DNS srvs.                                   */
+    NET_IPv4_ADDR       NTP_SrvTbl[DHCPc_CFG_SRV_MAX_NBR];      /*   NTP srv tbl.                                       */
+    CPU_INT08U          NTP_SrvQty;                             /*   Nbr of NTP srvs.                                   */
+#if (DHCPc_CFG_DOMAIN_NAME_MAX_LEN > 0)                         /*   Domain name (NULL-terminated).                     */
+    CPU_CHAR            DomainName[DHCPc_CFG_DOMAIN_NAME_MAX_LEN + 1];
+#endif
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)                   /* Applied lease params (see Note #11) :                */
+    CPU_INT08U          ParamApplied;                           /*   Applied param flags.                               */
+    NET_MTU             MTU;                                    /*   Applied IF MTU.                                    */
+    CPU_INT16U          ARP_CacheTimeout_sec;                   /*   Applied ARP cache timeout (in sec).                */
+    CPU_INT08U          TTL_IP;                                 /*   Applied dflt IP  TTL.                              */
+    CPU_INT08U          TTL_TCP;                                /*   Applied dflt TCP TTL.                              */
+#endif
+
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+    DHCPc_RELAY_INFO    Relay;                                  /* Relay info (see Note #12).                           */
+#endif
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+    DHCPc_IPv6_INFO     IPv6;                                   /* DHCPv6 info (see Note #13).                          */
+#endif
+
+#if (DHCPc_CFG_FORCERENEW_EN == DEF_ENABLED)                    /* FORCERENEW (see Note #2) :                           */
+    NET_SOCK_ID         ForceRenewSockID;                       /*   Listen sock id.                                    */
+    CPU_BOOLEAN         ForceRenewNonceValid;                   /*   Indicates if nonce rx'd from server.               */
+    CPU_INT08U          ForceRenewNonce[DHCP_AUTH_NONCE_LEN];   /*   Nonce  rx'd in last ACK.                           */
+    CPU_INT08U          ForceRenewReplay[DHCP_AUTH_REPLAY_LEN]; /*   Last   replay detection val rx'd from server.      */
+#endif
+
     DHCPc_MSG          *MsgPtr;                                 /* Ptr to DHCP msg.                                     */
 
     DHCPc_STATE         ClientState;                            /* DHCP client state.                                   */
     DHCPc_STATUS        LeaseStatus;                            /* Status of DHCP lease for this IF.                    */
     DHCPc_ERR           LastErr;                                /* Last DHCP error, set only when lease failed.         */
 
-    CPU_INT32U          TransactionID;
+    CPU_INT32U          TransactionID;                          /* Last xid generated               (see Note #7).      */
+    CPU_INT08U          TransactionID_WinLen;                   /* Nbr of prev xids accepted        (see Note #7).      */
+    CPU_INT32U          TransactionID_Req;                      /* Xid of accepted OFFER            (see Note #7).      */
+
+    CPU_INT32U          AcqStartTime;                           /* Acquisition start time (in DHCPc sec, see Note #8).  */
 
-    CPU_INT32U          NegoStartTime;                          /* Nego start     time.                                 */
-    CPU_INT32U          TmrExpirationTime;                      /* Tmr expiration time.                                 */
+    CPU_INT32U          NegoStartTime;                          /* Nego start time (in DHCPc sec).                      */
 
-    CPU_INT32U          LeaseTime_sec;
-    CPU_INT32U          T1_Time_sec;
-    CPU_INT32U          T2_Time_sec;
+                                                                /* Lease deadlines (in DHCPc sec, see Note #3) :        */
+    CPU_INT32U          LeaseDeadline_sec;                      /*   Lease expiration.                                  */
+    CPU_INT32U          T1_Deadline_sec;                        /*   T1    expiration.                                  */
+    CPU_INT32U          T2_Deadline_sec;                        /*   T2    expiration.                                  */
 
     DHCPc_TMR          *Tmr;                                    /* Ptr to DHCP tmr.                                     */
 
@@ -912,6 +2252,11 @@ struct dhcpc_if_info {
 /*
 *********************************************************************************************************
 *                                    DHCPc COMMUNICATION DATA TYPE
+*
+* Note(s) : (1) 'IF_InfoGen' holds the generation of the interface information when the communication object
+*               was created (see 'DHCPc INTERFACE INFORMATION DATA TYPE  Note #14').  The communication object
+*               is dispatched ONLY if the interface information still has the same generation, i.e. has NOT
+*               been freed & re-used by another client since.
 *********************************************************************************************************
 */
 
@@ -922,15 +2267,22 @@ struct  dhcpc_comm {
     DHCPc_COMM_QTY   ID;                                        /* Comm id.                                             */
 
     NET_IF_NBR       IF_Nbr;                                    /* IF nbr for this comm.                                */
+    DHCPc_IF_INFO   *IF_InfoPtr;                                /* Ptr to IF info (i.e. client) for this comm.          */
+    CPU_INT16U       IF_InfoGen;                                /* Gen of IF info    (see Note #1).                     */
     DHCPc_COMM_MSG   CommMsg;                                   /* Msg    for this comm.                                */
 
     CPU_INT16U       Flags;                                     /* Comm flags.                                          */
+
+    DHCPc_REQ       *ReqPtr;                                    /* Ptr to req handle to complete.                       */
 };
 
 
 /*
 *********************************************************************************************************
 *                                        DHCPc TIMER DATA TYPE
+*
+* Note(s) : (1) Timers hold an absolute deadline on the DHCPc time base rather than a count of remaining
+*               timer periods; see 'DHCPc_TmrTaskHandler()  Note #4'.
 *********************************************************************************************************
 */
 
@@ -941,12 +2293,39 @@ struct  dhcpc_tmr {
     DHCPc_TMR_QTY    ID;                                        /* Tmr id.                                              */
 
     void            *Obj;                                       /* Ptr to obj using tmr.                                */
-    DHCPc_TMR_TICK   TmrVal;                                    /* Cur tmr val (in DHCPc_TMR_TICK ticks).               */
+    CPU_INT32U       Deadline_sec;                              /* Tmr deadline (in DHCPc sec, see Note #1).            */
 
     CPU_INT16U       Flags;                                     /* Tmr flags.                                           */
 };
 
 
+/*
+*********************************************************************************************************
+*                                   DHCPc EMULATED CLIENT DATA TYPE
+*
+* Note(s) : (1) A virtual client holds only the state of its current transaction; the messages are built &
+*               validated through a shared interface information (see 'DHCPc_EmulRun()  Note #3').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)
+typedef  struct  dhcpc_emul_client {
+    DHCPc_STATE      ClientState;                               /* Virtual client state (NONE if free).                 */
+
+    CPU_INT08U       AddrHW[NET_IF_ETHER_ADDR_SIZE];            /* Synthetic hw addr.                                   */
+    CPU_INT32U       TransactionID;
+
+    NET_IPv4_ADDR    ServerID;                                  /* Server of rx'd OFFER      (in net order).            */
+    NET_IPv4_ADDR    AddrOffered;                               /* Addr   of rx'd OFFER      (in net order).            */
+
+    CPU_INT32U       StartTime_tick;                            /* Time of first DISCOVER    (in OS ticks).             */
+    CPU_INT32U       AcqStartTime;                              /* Time of first DISCOVER    (in DHCPc sec).            */
+    CPU_INT32U       TxTime_tick;                               /* Time of last  tx'd msg    (in OS ticks).             */
+    CPU_INT08U       RetryCnt;                                  /* Nbr of re-tx of last msg.                            */
+} DHCPc_EMUL_CLIENT;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -958,6 +2337,7 @@ DHCPc_EXT  CPU_BOOLEAN     DHCPc_InitDone;                      /* Indicates whe
 DHCPc_EXT  DHCPc_IF_INFO   DHCPc_InfoTbl[DHCPc_NBR_IF_INFO];
 DHCPc_EXT  DHCPc_IF_INFO  *DHCPc_InfoPoolPtr;                   /* Ptr to pool of free DHCPc info.                      */
 DHCPc_EXT  DHCPc_IF_INFO  *DHCPc_InfoListHead;                  /* Ptr to head of Info List.                            */
+DHCPc_EXT  DHCPc_IF_INFO  *DHCPc_InfoIF_Tbl[NET_IF_NBR_IF_TOT]; /* Tbl of IF info ptrs indexed by IF nbr.               */
 
 DHCPc_EXT  DHCPc_MSG       DHCPc_MsgTbl[DHCPc_NBR_MSG_BUF];
 DHCPc_EXT  DHCPc_MSG      *DHCPc_MsgPoolPtr;                    /* Ptr to pool of free DHCPc msg.                       */
@@ -971,6 +2351,52 @@ DHCPc_EXT  DHCPc_TMR       DHCPc_TmrTbl[DHCPc_NBR_TMR];
 DHCPc_EXT  DHCPc_TMR      *DHCPc_TmrPoolPtr;                    /* Ptr to pool of free DHCPc tmrs.                      */
 DHCPc_EXT  DHCPc_TMR      *DHCPc_TmrListHead;                   /* Ptr to head of Tmr List.                             */
 
+DHCPc_EXT  CPU_INT32U      DHCPc_TimeCur_sec;                   /* Cur DHCPc time (in sec).                             */
+DHCPc_EXT  CPU_INT32U      DHCPc_TimeRef_tick;                  /* OS tick matching cur DHCPc time.                     */
+
+                                                                /* Reqs waited on, per req waiter (NULL if free).       */
+DHCPc_EXT  DHCPc_REQ      *DHCPc_ReqWaitTbl[DHCPc_NBR_REQ_WAIT];
+
+DHCPc_EXT  DHCPc_RAND_FNCT  DHCPc_RandFnct;                     /* Rand nbr fnct (NULL if none).                        */
+DHCPc_EXT  CPU_INT32U      DHCPc_RandState;                     /* Pseudo-rand nbr generator state.                     */
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)
+DHCPc_EXT  DHCPc_ROUTE_FNCT  DHCPc_RouteFnct;                   /* Route fnct (NULL if none).                           */
+#endif
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)
+DHCPc_EXT  DHCPc_DNS_FNCT  DHCPc_DNS_Fnct;                      /* DNS fnct (NULL if none).                             */
+DHCPc_EXT  DHCPc_NTP_FNCT  DHCPc_NTP_Fnct;                      /* NTP fnct (NULL if none).                             */
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+DHCPc_EXT  DHCPc_TTL_FNCT  DHCPc_TTL_Fnct;                      /* TTL fnct (NULL if none).                             */
+                                                                /* ARP cache timeout cfg'd by app (in sec) ...          */
+DHCPc_EXT  CPU_INT16U      DHCPc_ARP_CacheTimeoutPrev_sec;      /* ... & nbr of clients with lease timeout applied ...  */
+DHCPc_EXT  CPU_INT16U      DHCPc_ARP_CacheTimeoutCnt;           /* ... (see 'DHCPc PARAMETER APPLY DEFINES  Note #2').  */
+                                                                /* IF MTUs before leases & nbr of clients with lease MTU*/
+                                                                /* applied, per IF (see 'DHCPc PARAMETER APPLY ...      */
+                                                                /* ... DEFINES  Note #2').                              */
+DHCPc_EXT  NET_MTU         DHCPc_MTU_PrevTbl[NET_IF_NBR_IF_TOT];
+DHCPc_EXT  CPU_INT16U      DHCPc_MTU_CntTbl[NET_IF_NBR_IF_TOT];
+#endif
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+DHCPc_EXT  DHCPc_IPv6_PREFIX_FNCT  DHCPc_IPv6_PrefixFnct;       /* DHCPv6 prefix fnct (NULL if none).                   */
+#endif
+
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)                         /* Client emulation :                                   */
+DHCPc_EXT  DHCPc_EMUL_CLIENT  DHCPc_EmulClientTbl[DHCPc_CFG_EMUL_MAX_NBR_CLIENT];
+DHCPc_EXT  DHCPc_IF_INFO   DHCPc_EmulIF_Info;                   /*   Shared IF info of virtual clients.                 */
+DHCPc_EXT  DHCPc_MSG       DHCPc_EmulMsgRx;                     /*   Rx msg buf.                                        */
+DHCPc_EXT  DHCPc_MSG       DHCPc_EmulMsgLast;                   /*   Last rx'd msg of cur virtual client.               */
+DHCPc_EXT  DHCPc_MSG       DHCPc_EmulMsgTx;                     /*   Tx msg buf.                                        */
+DHCPc_EXT  CPU_BOOLEAN     DHCPc_EmulActive;                    /*   Indicates if emulation running.                    */
+DHCPc_EXT  CPU_INT32U      DHCPc_EmulClientCnt;                 /*   Nbr of active virtual clients.                     */
+DHCPc_EXT  CPU_INT32U      DHCPc_EmulLatencySum_sec;            /*   Sum of latencies (sec part).                       */
+DHCPc_EXT  CPU_INT32U      DHCPc_EmulLatencySum_ms;             /*   Sum of latencies (ms  part).                       */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -979,6 +2405,7 @@ DHCPc_EXT  DHCPc_TMR      *DHCPc_TmrListHead;                   /* Ptr to head o
 */
 
 
+
 /*
 *********************************************************************************************************
 *                                         FUNCTION PROTOTYPES
@@ -993,12 +2420,113 @@ void           DHCPc_Start        (NET_IF_NBR       if_nbr,
                                    CPU_INT08U       req_param_tbl_qty,
                                    DHCPc_ERR       *perr);
 
+                                                                /* Start DHCP service with specific IF cfg.             */
+void           DHCPc_StartExt     (NET_IF_NBR       if_nbr,
+                                   DHCPc_CFG_IF    *pcfg,
+                                   DHCPc_OPT_CODE  *preq_param_tbl,
+                                   CPU_INT08U       req_param_tbl_qty,
+                                   DHCPc_ERR       *perr);
+
+                                                                /* Start DHCP service & track its completion.           */
+void           DHCPc_StartAsync   (NET_IF_NBR       if_nbr,
+                                   DHCPc_CFG_IF    *pcfg,
+                                   DHCPc_OPT_CODE  *preq_param_tbl,
+                                   CPU_INT08U       req_param_tbl_qty,
+                                   DHCPc_REQ       *preq,
+                                   DHCPc_ERR       *perr);
+
+                                                                /* Get dflt IF cfg.                                     */
+void           DHCPc_CfgIF_DfltGet(DHCPc_CFG_IF    *pcfg,
+                                   DHCPc_ERR       *perr);
+
+#if (DHCPc_CFG_CLIENT_ID_MAX_LEN > 0)                           /* Set IF cfg client id from DUID & IAID.               */
+void           DHCPc_CfgIF_ClientID_DUID_Set(DHCPc_CFG_IF  *pcfg,
+                                             CPU_INT32U     iaid,
+                                             CPU_INT08U    *pduid,
+                                             CPU_INT08U     duid_len,
+                                             DHCPc_ERR     *perr);
+#endif
+
+#if (DHCPc_CFG_VENDOR_CLASS_MAX_LEN > 0)                        /* Set IF cfg vendor class id.                          */
+void           DHCPc_CfgIF_VendorClassSet   (DHCPc_CFG_IF  *pcfg,
+                                             CPU_INT08U    *pvendor_class,
+                                             CPU_INT08U     vendor_class_len,
+                                             DHCPc_ERR     *perr);
+#endif
+
+#if (DHCPc_CFG_VENDOR_INFO_MAX_LEN > 0)                         /* Set IF cfg vendor-specific info.                     */
+void           DHCPc_CfgIF_VendorInfoSet    (DHCPc_CFG_IF  *pcfg,
+                                             CPU_INT08U    *pvendor_info,
+                                             CPU_INT08U     vendor_info_len,
+                                             DHCPc_ERR     *perr);
+#endif
+
+                                                                /* Set rand nbr fnct.                                   */
+void           DHCPc_RandFnctSet  (DHCPc_RAND_FNCT  rand_fnct,
+                                   DHCPc_ERR       *perr);
+
+#if (DHCPc_CFG_ROUTE_MAX_NBR > 0)                               /* Set route fnct.                                      */
+void           DHCPc_RouteFnctSet    (DHCPc_ROUTE_FNCT   route_fnct,
+                                      DHCPc_ERR         *perr);
+
+                                                                /* Get next-hop to dest.                                */
+NET_IPv4_ADDR  DHCPc_RouteNextHopGet (NET_IF_NBR         if_nbr,
+                                      NET_IPv4_ADDR      addr_dest,
+                                      DHCPc_ERR         *perr);
+#endif
+
+#if (DHCPc_CFG_SRV_MAX_NBR > 0)                                 /* Set DNS & NTP fncts.                                 */
+void           DHCPc_SrvFnctSet   (DHCPc_DNS_FNCT   dns_fnct,
+                                   DHCPc_NTP_FNCT   ntp_fnct,
+                                   DHCPc_ERR       *perr);
+#endif
+
+#if (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)                   /* Set TTL fnct.                                        */
+void           DHCPc_TTL_FnctSet  (DHCPc_TTL_FNCT   ttl_fnct,
+                                   DHCPc_ERR       *perr);
+#endif
+
                                                                 /* Stop  DHCP service for specified interface.          */
 void           DHCPc_Stop         (NET_IF_NBR       if_nbr,
+                                   DHCPc_ERR       *perr);
+
+                                                                /* Stop  DHCP service & track its completion.           */
+void           DHCPc_StopAsync    (NET_IF_NBR       if_nbr,
+                                   DHCPc_REQ       *preq,
+                                   DHCPc_ERR       *perr);
+
+                                                                /* Init req handle.                                     */
+void           DHCPc_ReqInit      (DHCPc_REQ                *preq,
+                                   DHCPc_REQ_CALLBACK_FNCT   callback_fnct,
+                                   void                     *p_callback_arg,
+                                   DHCPc_ERR                *perr);
+
+                                                                /* Wait for req completion.                             */
+DHCPc_STATUS  DHCPc_ReqWait       (DHCPc_REQ       *preq,
+                                   CPU_INT32U       timeout_ms,
+                                   DHCPc_ERR       *perr);
+
+                                                                /* Get cfg param for statically addressed IF.           */
+void           DHCPc_Inform       (NET_IF_NBR       if_nbr,
+                                   DHCPc_OPT_CODE  *preq_param_tbl,
+                                   CPU_INT08U       req_param_tbl_qty,
+                                   DHCPc_ERR       *perr);
+
+                                                                /* Stop  DHCP service for specified logical client.     */
+void           DHCPc_ClientStop   (NET_IF_NBR       if_nbr,
+                                   CPU_INT08U      *pclient_id,
+                                   CPU_INT08U       client_id_len,
+                                   DHCPc_REQ       *preq,
                                    DHCPc_ERR       *perr);
 
                                                                 /* Check an interface's DHCP status & last error.       */
 DHCPc_STATUS  DHCPc_ChkStatus     (NET_IF_NBR       if_nbr,
+                                   DHCPc_ERR       *perr_last);
+
+                                                                /* Check a logical client's DHCP status & last error.   */
+DHCPc_STATUS  DHCPc_ClientChkStatus(NET_IF_NBR      if_nbr,
+                                   CPU_INT08U      *pclient_id,
+                                   CPU_INT08U       client_id_len,
                                    DHCPc_ERR       *perr_last);
 
                                                                 /* Get value for a given DHCP option.                   */
@@ -1008,6 +2536,64 @@ void          DHCPc_GetOptVal     (NET_IF_NBR       if_nbr,
                                    CPU_INT16U      *pval_buf_len,
                                    DHCPc_ERR       *perr);
 
+                                                                /* Get value for a given logical client's DHCP option.  */
+void          DHCPc_ClientGetOptVal(NET_IF_NBR      if_nbr,
+                                   CPU_INT08U      *pclient_id,
+                                   CPU_INT08U       client_id_len,
+                                   DHCPc_OPT_CODE   opt_code,
+                                   CPU_INT08U      *pval_buf,
+                                   CPU_INT16U      *pval_buf_len,
+                                   DHCPc_ERR       *perr);
+
+#if (DHCPc_CFG_RELAY_EN == DEF_ENABLED)
+                                                                /* Get relay info for specified interface.              */
+void          DHCPc_RelayInfoGet  (NET_IF_NBR        if_nbr,
+                                   DHCPc_RELAY_INFO *prelay_info,
+                                   DHCPc_ERR        *perr);
+
+                                                                /* Get relay info for a given logical client.           */
+void          DHCPc_ClientRelayInfoGet(NET_IF_NBR        if_nbr,
+                                       CPU_INT08U       *pclient_id,
+                                       CPU_INT08U        client_id_len,
+                                       DHCPc_RELAY_INFO *prelay_info,
+                                       DHCPc_ERR        *perr);
+#endif
+
+#if (DHCPc_CFG_IPv6_EN == DEF_ENABLED)
+                                                                /* Start DHCPv6 client on specified interface.          */
+void          DHCPc_IPv6_Start    (NET_IF_NBR         if_nbr,
+                                   DHCPc_CFG_IF      *pcfg,
+                                   CPU_INT08U         ia_req,
+                                   DHCPc_REQ         *preq,
+                                   DHCPc_ERR         *perr);
+
+                                                                /* Stop  DHCPv6 client on specified interface.          */
+void          DHCPc_IPv6_Stop     (NET_IF_NBR         if_nbr,
+                                   DHCPc_REQ         *preq,
+                                   DHCPc_ERR         *perr);
+
+                                                                /* Check an interface's DHCPv6 status & last error.     */
+DHCPc_STATUS  DHCPc_IPv6_ChkStatus(NET_IF_NBR         if_nbr,
+                                   DHCPc_ERR         *perr_last);
+
+                                                                /* Get DHCPv6 lease for specified interface.            */
+void          DHCPc_IPv6_LeaseGet (NET_IF_NBR         if_nbr,
+                                   DHCPc_IPv6_LEASE  *please,
+                                   DHCPc_ERR         *perr);
+
+                                                                /* Set DHCPv6 prefix fnct.                              */
+void          DHCPc_IPv6_PrefixFnctSet(DHCPc_IPv6_PREFIX_FNCT   prefix_fnct,
+                                       DHCPc_ERR               *perr);
+#endif
+
+#if (DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0)
+                                                                /* Run client emulation to load test a DHCP server.     */
+void          DHCPc_EmulRun       (NET_IF_NBR        if_nbr,
+                                   DHCPc_EMUL_CFG   *pcfg,
+                                   DHCPc_EMUL_STATS *pstats,
+                                   DHCPc_ERR        *perr);
+#endif
+
 
 void          DHCPc_TmrTaskHandler(void);
 
@@ -1033,6 +2619,13 @@ void         DHCPc_OS_Lock               (DHCPc_ERR   *perr);       /* Acquire a
 
 void         DHCPc_OS_Unlock             (void);                    /* Release access to DHCP client.                   */
 
+                                                                /* Acquire access to IF info.                       */
+void         DHCPc_OS_IF_Lock            (DHCPc_IF_INFO_QTY   if_info_id,
+                                          DHCPc_ERR          *perr);
+
+                                                                /* Release access to IF info.                       */
+void         DHCPc_OS_IF_Unlock          (DHCPc_IF_INFO_QTY   if_info_id);
+
 
 void         DHCPc_OS_TaskInit           (DHCPc_ERR   *perr);       /* Create & start DHCPc Task.                       */
 
@@ -1052,10 +2645,18 @@ void         DHCPc_OS_TmrWait            (DHCPc_ERR   *perr);       /* Wait  unt
 void         DHCPc_OS_TmrSignal          (void);                    /* Signal that DHCPc Timer expired.                 */
 
 
-CPU_INT32U   DHCPc_OS_TimeGet_tick       (void);                    /* Get       current time (in ticks).               */
+void         DHCPc_OS_ReqWait            (CPU_INT16U   ix,          /* Wait  until a DHCPc req completes.               */
+                                          CPU_INT32U   timeout_tick,
+                                          DHCPc_ERR   *perr);
+
+void         DHCPc_OS_ReqSignal          (CPU_INT16U   ix);         /* Signal that a DHCPc req completed.               */
+
+void         DHCPc_OS_ReqSignalClr       (CPU_INT16U   ix);         /* Clr    a DHCPc req waiter's signal.              */
+
 
-CPU_INT32U   DHCPc_OS_TimeCalcElapsed_sec(CPU_INT32U   time_start,  /* Calculate elapsed time (in seconds).             */
-                                          CPU_INT32U   time_stop);
+CPU_INT32U   DHCPc_OS_TimeGet_tick       (void);                    /* Get current time      (in ticks).                */
+
+CPU_INT32U   DHCPc_OS_TimeGetRate_tick   (void);                    /* Get clock tick rate   (in ticks per sec).        */
 
 
 /*
@@ -1122,17 +2723,279 @@ CPU_INT32U   DHCPc_OS_TimeCalcElapsed_sec(CPU_INT32U   time_start,  /* Calculate
 
 
 
+#ifndef  DHCPc_CFG_FORCERENEW_EN
+#error  "DHCPc_CFG_FORCERENEW_EN                 not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+
+#elif  ((DHCPc_CFG_FORCERENEW_EN != DEF_DISABLED) && \
+        (DHCPc_CFG_FORCERENEW_EN != DEF_ENABLED ))
+#error  "DHCPc_CFG_FORCERENEW_EN           illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_RENEW_COALESCE_WIN_SEC
+#error  "DHCPc_CFG_RENEW_COALESCE_WIN_SEC        not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0   ]                   "
+#error  "                                  [     &&  <= 3600]                   "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_RENEW_COALESCE_WIN_SEC,                  \
+                     0,                                                 \
+                     DHCPc_RENEW_COALESCE_WIN_MAX_SEC) != DEF_OK)
+#error  "DHCPc_CFG_RENEW_COALESCE_WIN_SEC  illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0   ]                   "
+#error  "                                  [     &&  <= 3600]                   "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_CLIENT_ID_MAX_LEN
+#error  "DHCPc_CFG_CLIENT_ID_MAX_LEN             not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  == 0 ]                     "
+#error  "                                  [     ||  >= 2 ]                     "
+#error  "                                  [     &&  <= 64]                     "
+
+#elif  ((DHCPc_CFG_CLIENT_ID_MAX_LEN != 0) &&                           \
+        (DEF_CHK_VAL(DHCPc_CFG_CLIENT_ID_MAX_LEN,                       \
+                     DHCP_CLIENT_ID_LEN_MIN,                            \
+                     DHCP_CLIENT_ID_LEN_MAX) != DEF_OK))
+#error  "DHCPc_CFG_CLIENT_ID_MAX_LEN       illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  == 0 ]                     "
+#error  "                                  [     ||  >= 2 ]                     "
+#error  "                                  [     &&  <= 64]                     "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_EMUL_MAX_NBR_CLIENT
+#error  "DHCPc_CFG_EMUL_MAX_NBR_CLIENT           not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0    ]                  "
+#error  "                                  [     &&  <= 65535]                  "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_EMUL_MAX_NBR_CLIENT,                     \
+                     0,                                                 \
+                     DEF_INT_16U_MAX_VAL) != DEF_OK)
+#error  "DHCPc_CFG_EMUL_MAX_NBR_CLIENT     illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0    ]                  "
+#error  "                                  [     &&  <= 65535]                  "
+
+#elif  ((DHCPc_CFG_EMUL_MAX_NBR_CLIENT > 0) &&                          \
+        (DHCPc_CFG_CLIENT_ID_MAX_LEN   < 7))
+#error  "DHCPc_CFG_CLIENT_ID_MAX_LEN       illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 7 when client emulation]"
+#error  "                                  [         is enabled                ]"
+#endif
+
+
+
+#ifndef  DHCPc_CFG_VENDOR_CLASS_MAX_LEN
+#error  "DHCPc_CFG_VENDOR_CLASS_MAX_LEN          not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0 ]                     "
+#error  "                                  [     &&  <= 64]                     "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_VENDOR_CLASS_MAX_LEN,                    \
+                     0,                                                 \
+                     DHCP_VENDOR_CLASS_LEN_MAX) != DEF_OK)
+#error  "DHCPc_CFG_VENDOR_CLASS_MAX_LEN    illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0 ]                     "
+#error  "                                  [     &&  <= 64]                     "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_VENDOR_INFO_MAX_LEN
+#error  "DHCPc_CFG_VENDOR_INFO_MAX_LEN           not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0 ]                     "
+#error  "                                  [     &&  <= 64]                     "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_VENDOR_INFO_MAX_LEN,                     \
+                     0,                                                 \
+                     DHCP_VENDOR_INFO_LEN_MAX) != DEF_OK)
+#error  "DHCPc_CFG_VENDOR_INFO_MAX_LEN     illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0 ]                     "
+#error  "                                  [     &&  <= 64]                     "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_ROUTE_MAX_NBR
+#error  "DHCPc_CFG_ROUTE_MAX_NBR                 not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 255]                    "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_ROUTE_MAX_NBR,                           \
+                     0,                                                 \
+                     DEF_INT_08U_MAX_VAL) != DEF_OK)
+#error  "DHCPc_CFG_ROUTE_MAX_NBR           illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 255]                    "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_SRV_MAX_NBR
+#error  "DHCPc_CFG_SRV_MAX_NBR                   not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 255]                    "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_SRV_MAX_NBR,                             \
+                     0,                                                 \
+                     DEF_INT_08U_MAX_VAL) != DEF_OK)
+#error  "DHCPc_CFG_SRV_MAX_NBR             illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 255]                    "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_DOMAIN_NAME_MAX_LEN
+#error  "DHCPc_CFG_DOMAIN_NAME_MAX_LEN           not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 253]                    "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_DOMAIN_NAME_MAX_LEN,                     \
+                     0,                                                 \
+                     DHCP_DOMAIN_NAME_LEN_MAX) != DEF_OK)
+#error  "DHCPc_CFG_DOMAIN_NAME_MAX_LEN     illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 253]                    "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_PARAM_APPLY_EN
+#error  "DHCPc_CFG_PARAM_APPLY_EN                not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+
+#elif  ((DHCPc_CFG_PARAM_APPLY_EN != DEF_DISABLED) && \
+        (DHCPc_CFG_PARAM_APPLY_EN != DEF_ENABLED ))
+#error  "DHCPc_CFG_PARAM_APPLY_EN          illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+
+#elif   (DHCPc_CFG_PARAM_APPLY_EN == DEF_ENABLED)
+#ifdef   NET_ARP_MODULE_EN
+#ifndef  DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC
+#error  "DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC         not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= NET_ARP_CACHE_TIMEOUT_MIN_SEC]  "
+#error  "                                  [     &&  <= NET_ARP_CACHE_TIMEOUT_MAX_SEC]  "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC,                   \
+                     NET_ARP_CACHE_TIMEOUT_MIN_SEC,                     \
+                     NET_ARP_CACHE_TIMEOUT_MAX_SEC) != DEF_OK)
+#error  "DHCPc_CFG_ARP_CACHE_TIMEOUT_SEC   illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= NET_ARP_CACHE_TIMEOUT_MIN_SEC]  "
+#error  "                                  [     &&  <= NET_ARP_CACHE_TIMEOUT_MAX_SEC]  "
+#endif
+#endif
+#endif
+
+
+
+#ifndef  DHCPc_CFG_HW_TYPE_GENERIC_EN
+#error  "DHCPc_CFG_HW_TYPE_GENERIC_EN            not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+
+#elif  ((DHCPc_CFG_HW_TYPE_GENERIC_EN != DEF_DISABLED) && \
+        (DHCPc_CFG_HW_TYPE_GENERIC_EN != DEF_ENABLED ))
+#error  "DHCPc_CFG_HW_TYPE_GENERIC_EN      illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_RELAY_EN
+#error  "DHCPc_CFG_RELAY_EN                      not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+
+#elif  ((DHCPc_CFG_RELAY_EN != DEF_DISABLED) && \
+        (DHCPc_CFG_RELAY_EN != DEF_ENABLED ))
+#error  "DHCPc_CFG_RELAY_EN                illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN
+#error  "DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN      not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 255]                    "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN,                \
+                     0,                                                 \
+                     DEF_INT_08U_MAX_VAL) != DEF_OK)
+#error  "DHCPc_CFG_RELAY_AGENT_INFO_MAX_LEN illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 0  ]                    "
+#error  "                                  [     &&  <= 255]                    "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_IPv6_EN
+#error  "DHCPc_CFG_IPv6_EN                       not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+
+#elif  ((DHCPc_CFG_IPv6_EN != DEF_DISABLED) && \
+        (DHCPc_CFG_IPv6_EN != DEF_ENABLED ))
+#error  "DHCPc_CFG_IPv6_EN                 illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_WORKER_NBR
+#error  "DHCPc_CFG_WORKER_NBR                    not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  == 1    ]                  "
+
+#elif   (DHCPc_CFG_WORKER_NBR != 1)
+#error  "DHCPc_CFG_WORKER_NBR              illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  == 1    ]                  "
+#endif
+
+
+
+#ifndef  DHCPc_CFG_MSG_BUF_SIZE
+#error  "DHCPc_CFG_MSG_BUF_SIZE                  not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 576  ]                  "
+#error  "                                  [     &&  <= 65507]                  "
+
+#elif   (DEF_CHK_VAL(DHCPc_CFG_MSG_BUF_SIZE,                            \
+                     DHCP_MSG_BUF_SIZE_MIN,                             \
+                     DEF_INT_16U_MAX_VAL - DHCP_MSG_IP_UDP_HDR_SIZE) != DEF_OK)
+#error  "DHCPc_CFG_MSG_BUF_SIZE            illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= 576  ]                  "
+#error  "                                  [     &&  <= 65507]                  "
+
+#elif   (DHCPc_TX_MSG_LEN_MAX > DHCPc_CFG_MSG_BUF_SIZE)
+#error  "DHCPc_CFG_MSG_BUF_SIZE            illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  >= DHCPc_TX_MSG_LEN_MAX]   "
+#error  "                                  [See 'dhcp-c.h  DHCPc TRANSMIT OPTION]"
+#error  "                                  [    TEMPLATE DEFINES  Note #3'     ]"
+#endif
+
+
+
 #ifndef  DHCPc_CFG_PARAM_REQ_TBL_SIZE
 #error  "DHCPc_CFG_PARAM_REQ_TBL_SIZE            not #define'd in 'dhcp-c_cfg.h'"
 #error  "                                  [MUST be  >= 1  ]                    "
-#error  "                                  [     &&  <= 255]                    "
+#error  "                                  [     &&  <= 251]                    "
 
-#elif   (DEF_CHK_VAL(DHCPc_CFG_PARAM_REQ_TBL_SIZE, \
-                     1,                            \
-                     DEF_INT_08U_MAX_VAL) != DEF_OK)
+#elif   (DEF_CHK_VAL(DHCPc_CFG_PARAM_REQ_TBL_SIZE,                      \
+                     1,                                                 \
+                     DEF_INT_08U_MAX_VAL - DHCPc_REQ_PARAM_SYS_NBR) != DEF_OK)
 #error  "DHCPc_CFG_PARAM_REQ_TBL_SIZE      illegally #define'd in 'dhcp-c_cfg.h'"
 #error  "                                  [MUST be  >= 1  ]                    "
-#error  "                                  [     &&  <= 255]                    "
+#error  "                                  [     &&  <= 251]                    "
 #endif
 
 
@@ -1298,11 +3161,20 @@ CPU_INT32U   DHCPc_OS_TimeCalcElapsed_sec(CPU_INT32U   time_start,  /* Calculate
 *********************************************************************************************************
 */
 
-#if     (NET_IF_CFG_ETHER_EN != DEF_ENABLED)
+                                                                /* See 'DHCPc HARDWARE ADDRESS DEFINES  Note #1a'.      */
+#if    ((DHCPc_CFG_HW_TYPE_GENERIC_EN != DEF_ENABLED) && \
+        (NET_IF_CFG_ETHER_EN          != DEF_ENABLED))
 #error  "NET_IF_CFG_ETHER_EN               illegally #define'd in 'net_cfg.h'"
 #error  "                                  [MUST be  DEF_ENABLED]            "
 #endif
 
+                                                                /* See 'DHCPc DEFAULT CFG  Note #14'.                   */
+#if    ((DHCPc_CFG_IPv6_EN == DEF_ENABLED) && \
+        (!defined(NET_IPv6_MODULE_EN)))
+#error  "NET_IPv6_CFG_EN                   illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  DEF_ENABLED]            "
+#endif
+
 
 /*
 *********************************************************************************************************